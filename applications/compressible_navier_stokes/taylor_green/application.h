@@ -125,7 +125,8 @@ public:
 
     // clang-format off
      prm.enter_subsection("Application");
-       prm.add_parameter("MeshType", mesh_type_string, "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+       prm.add_parameter("MeshType",           mesh_type_string,    "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+       prm.add_parameter("VectorizationWidth", vectorization_width, "SIMD width of the operator evaluation (0: default width of deal.II).", dealii::Patterns::Integer(0, 16));
      prm.leave_subsection();
     // clang-format on
   }
@@ -213,6 +214,7 @@ private:
 
     // NUMERICAL PARAMETERS
     this->param.use_combined_operator = true;
+    this->param.vectorization_width   = vectorization_width;
   }
 
   void
@@ -307,6 +309,8 @@ private:
   std::string mesh_type_string = "Cartesian";
   MeshType    mesh_type        = MeshType::Cartesian;
 
+  unsigned int vectorization_width = 0;
+
   double const start_time = 0.0;
   double const end_time   = 20.0 * CHARACTERISTIC_TIME;
 };
@@ -112,14 +112,15 @@ public:
 
     // clang-format off
     prm.enter_subsection("Application");
-      prm.add_parameter("MeshType",        mesh_type_string,                  "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
-      prm.add_parameter("NCoarseCells1D",  n_subdivisions_1d_hypercube,       "Number of cells per direction on coarse grid.", dealii::Patterns::Integer(1,5));
-      prm.add_parameter("ExploitSymmetry", exploit_symmetry,                  "Exploit symmetry and reduce DoFs by a factor of 8?");
-      prm.add_parameter("MovingMesh",      ALE,                               "Moving mesh?");
-      prm.add_parameter("Inviscid",        inviscid,                          "Is this an inviscid simulation?");
-      prm.add_parameter("ReynoldsNumber",  Re,                                "Reynolds number (ignored if Inviscid = true)");
-      prm.add_parameter("WriteRestart",    write_restart,                     "Should restart files be written?");
-      prm.add_parameter("ReadRestart",     read_restart,                      "Is this a restarted simulation?");
+      prm.add_parameter("MeshType",                mesh_type_string,            "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+      prm.add_parameter("NCoarseCells1D",          n_subdivisions_1d_hypercube, "Number of cells per direction on coarse grid.", dealii::Patterns::Integer(1,5));
+      prm.add_parameter("ExploitSymmetry",         exploit_symmetry,            "Exploit symmetry and reduce DoFs by a factor of 8?");
+      prm.add_parameter("MovingMesh",              ALE,                         "Moving mesh?");
+      prm.add_parameter("Inviscid",                inviscid,                    "Is this an inviscid simulation?");
+      prm.add_parameter("ReynoldsNumber",          Re,                          "Reynolds number (ignored if Inviscid = true)");
+      prm.add_parameter("WriteRestart",            write_restart,               "Should restart files be written?");
+      prm.add_parameter("ReadRestart",             read_restart,                "Is this a restarted simulation?");
+      prm.add_parameter("FusedIntegralQuantities", fused_integral_quantities,   "Evaluate integral quantities in a single matrix-free loop?");
     prm.leave_subsection();
     // clang-format on
   }
@@ -435,6 +436,9 @@ private:
   {
     PostProcessorData<dim> pp_data;
 
+    // evaluate the integral quantities (e.g. kinetic energy) in a single matrix-free loop
+    pp_data.fused_integral_quantities = fused_integral_quantities;
+
     std::string name = this->output_parameters.filename + "_l" +
                        std::to_string(this->param.grid.n_refine_global) + "_k" +
                        std::to_string(this->param.degree_u);
@@ -515,6 +519,9 @@ private:
   bool write_restart = false;
   bool read_restart  = false;
 
+  // evaluate integral quantities in a single matrix-free loop
+  bool fused_integral_quantities = true;
+
   double const V_0                 = 1.0;
   double const L                   = 1.0;
   double const p_0                 = 0.0;
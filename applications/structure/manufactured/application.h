@@ -303,13 +303,26 @@ public:
   {
   }
 
+  void
+  add_parameters(dealii::ParameterHandler & prm) final
+  {
+    ApplicationBase<dim, Number>::add_parameters(prm);
+
+    // clang-format off
+    prm.enter_subsection("Application");
+      prm.add_parameter("Unsteady",         unsteady,          "Solve unsteady problem (steady problem otherwise).");
+      prm.add_parameter("LargeDeformation", large_deformation, "Geometrically nonlinear problem (linear problem otherwise).");
+    prm.leave_subsection();
+    // clang-format on
+  }
+
 private:
   void
   set_parameters() final
   {
     this->param.problem_type         = unsteady ? ProblemType::Unsteady : ProblemType::Steady;
     this->param.body_force           = true;
-    this->param.large_deformation    = true;
+    this->param.large_deformation    = large_deformation;
     this->param.pull_back_body_force = false;
     this->param.pull_back_traction   = false;
 
@@ -433,7 +446,9 @@ private:
 
   double const density = 1.0;
 
-  bool const   unsteady         = true;
+  bool unsteady          = true;
+  bool large_deformation = true;
+
   double const max_displacement = 0.1 * length;
   double const start_time       = 0.0;
   double const end_time         = 1.0;
@@ -77,6 +77,9 @@ Driver<dim, Number>::setup()
                       matrix_free_data->get_quadrature_vector(),
                       matrix_free_data->data);
 
+  if(not(is_test))
+    print_batch_fill_ratio(pcout, *matrix_free, mpi_comm);
+
   // setup compressible Navier-Stokes operator
   pde_operator->setup(matrix_free, matrix_free_data);
 
@@ -27,6 +27,7 @@
 
 // utilities
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/kernel_profiler.h>
 #include <exadg/utilities/resolution_parameters.h>
 
 // application
@@ -126,6 +127,8 @@ main(int argc, char ** argv)
   ExaDG::SpatialResolutionParameters  spatial(input_file);
   ExaDG::TemporalResolutionParameters temporal(input_file);
 
+  ExaDG::KernelProfiler::enable(general.kernel_profiling);
+
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
   {
@@ -159,6 +162,8 @@ main(int argc, char ** argv)
     }
   }
 
+  ExaDG::KernelProfiler::print_results(mpi_comm);
+
   return 0;
 }
 
@@ -32,6 +32,7 @@
 #include <exadg/compressible_navier_stokes/user_interface/boundary_descriptor.h>
 #include <exadg/compressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+#include <exadg/matrix_free/degree_dispatch.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/interior_penalty_parameter.h>
 
@@ -39,72 +40,72 @@ namespace ExaDG
 {
 namespace CompNS
 {
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-    dealii::VectorizedArray<Number>
-    calculate_pressure(dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & rho_u,
-                       dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u,
-                       dealii::VectorizedArray<Number> const &                         rho_E,
-                       Number const &                                                  gamma)
+    VectorizedArrayType
+    calculate_pressure(dealii::Tensor<1, dim, VectorizedArrayType> const & rho_u,
+                       dealii::Tensor<1, dim, VectorizedArrayType> const & u,
+                       VectorizedArrayType const &                         rho_E,
+                       Number const &                                      gamma)
 {
   return (gamma - 1.0) * (rho_E - 0.5 * scalar_product(rho_u, u));
 }
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-  dealii::VectorizedArray<Number>
-  calculate_pressure(dealii::VectorizedArray<Number> const &                         rho,
-                     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u,
-                     dealii::VectorizedArray<Number> const &                         E,
-                     Number const &                                                  gamma)
+  VectorizedArrayType
+  calculate_pressure(VectorizedArrayType const &                         rho,
+                     dealii::Tensor<1, dim, VectorizedArrayType> const & u,
+                     VectorizedArrayType const &                         E,
+                     Number const &                                      gamma)
 {
   return (gamma - 1.0) * rho * (E - 0.5 * scalar_product(u, u));
 }
 
-template<typename Number>
+template<typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-  dealii::VectorizedArray<Number>
-  calculate_temperature(dealii::VectorizedArray<Number> const & p,
-                        dealii::VectorizedArray<Number> const & rho,
-                        Number const &                          R)
+  VectorizedArrayType
+  calculate_temperature(VectorizedArrayType const & p,
+                        VectorizedArrayType const & rho,
+                        Number const &              R)
 {
   return p / (rho * R);
 }
 
-template<int dim, typename Number>
-inline dealii::VectorizedArray<Number>
-calculate_energy(dealii::VectorizedArray<Number> const &                         T,
-                 dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u,
-                 Number const &                                                  c_v)
+template<int dim, typename Number, typename VectorizedArrayType>
+inline VectorizedArrayType
+calculate_energy(VectorizedArrayType const &                         T,
+                 dealii::Tensor<1, dim, VectorizedArrayType> const & u,
+                 Number const &                                      c_v)
 {
   return c_v * T + 0.5 * scalar_product(u, u);
 }
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
-  calculate_grad_E(dealii::VectorizedArray<Number> const &                         rho_inverse,
-                   dealii::VectorizedArray<Number> const &                         rho_E,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & grad_rho,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & grad_rho_E)
+  dealii::Tensor<1, dim, VectorizedArrayType>
+  calculate_grad_E(VectorizedArrayType const &                         rho_inverse,
+                   VectorizedArrayType const &                         rho_E,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & grad_rho,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & grad_rho_E)
 {
-  dealii::VectorizedArray<Number> E = rho_inverse * rho_E;
+  VectorizedArrayType E = rho_inverse * rho_E;
 
   return rho_inverse * (grad_rho_E - E * grad_rho);
 }
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
-  calculate_grad_u(dealii::VectorizedArray<Number> const &                         rho_inverse,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & rho_u,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & grad_rho,
-                   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & grad_rho_u)
+  dealii::Tensor<2, dim, VectorizedArrayType>
+  calculate_grad_u(VectorizedArrayType const &                         rho_inverse,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & rho_u,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & grad_rho,
+                   dealii::Tensor<2, dim, VectorizedArrayType> const & grad_rho_u)
 {
-  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> out;
+  dealii::Tensor<2, dim, VectorizedArrayType> out;
   for(unsigned int d = 0; d < dim; ++d)
   {
-    dealii::VectorizedArray<Number> ud = rho_inverse * rho_u[d];
+    VectorizedArrayType ud = rho_inverse * rho_u[d];
     for(unsigned int e = 0; e < dim; ++e)
       out[d][e] = rho_inverse * (grad_rho_u[d][e] - ud * grad_rho[e]);
   }
@@ -112,27 +113,27 @@ inline DEAL_II_ALWAYS_INLINE //
   return out;
 }
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
-    calculate_grad_T(dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & grad_E,
-                     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u,
-                     dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & grad_u,
-                     Number const &                                                  gamma,
-                     Number const &                                                  R)
+    dealii::Tensor<1, dim, VectorizedArrayType>
+    calculate_grad_T(dealii::Tensor<1, dim, VectorizedArrayType> const & grad_E,
+                     dealii::Tensor<1, dim, VectorizedArrayType> const & u,
+                     dealii::Tensor<2, dim, VectorizedArrayType> const & grad_u,
+                     Number const &                                      gamma,
+                     Number const &                                      R)
 {
   return (gamma - 1.0) / R * (grad_E - u * grad_u);
 }
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
-    calculate_stress_tensor(dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & grad_u,
-                            Number const & viscosity)
+    dealii::Tensor<2, dim, VectorizedArrayType>
+    calculate_stress_tensor(dealii::Tensor<2, dim, VectorizedArrayType> const & grad_u,
+                            Number const &                                      viscosity)
 {
-  dealii::VectorizedArray<Number> const divu = (2. / 3.) * trace(grad_u);
+  VectorizedArrayType const divu = (2. / 3.) * trace(grad_u);
 
-  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> out;
+  dealii::Tensor<2, dim, VectorizedArrayType> out;
   for(unsigned int d = 0; d < dim; ++d)
   {
     for(unsigned int e = 0; e < dim; ++e)
@@ -147,25 +148,25 @@ inline DEAL_II_ALWAYS_INLINE //
  * Calculates exterior state "+" for a scalar/vectorial quantity depending on interior state "-" and
  * boundary conditions.
  */
-template<int dim, typename Number, int rank>
+template<int dim, typename Number, int rank, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-  dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+  dealii::Tensor<rank, dim, VectorizedArrayType>
   calculate_exterior_value(
-    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> const & value_m,
+    dealii::Tensor<rank, dim, VectorizedArrayType> const & value_m,
     BoundaryType const                                                 boundary_type,
     BoundaryDescriptorStd<dim> const &                                 boundary_descriptor,
     dealii::types::boundary_id const &                                 boundary_id,
-    dealii::Point<dim, dealii::VectorizedArray<Number>> const &        q_point,
+    dealii::Point<dim, VectorizedArrayType> const &        q_point,
     Number const &                                                     time)
 {
-  dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> value_p;
+  dealii::Tensor<rank, dim, VectorizedArrayType> value_p;
 
   if(boundary_type == BoundaryType::Dirichlet)
   {
     auto bc = boundary_descriptor.dirichlet_bc.find(boundary_id)->second;
-    auto g  = FunctionEvaluator<rank, dim, Number>::value(bc, q_point, time);
+    auto g  = FunctionEvaluator<rank, dim, Number, VectorizedArrayType>::value(bc, q_point, time);
 
-    value_p = -value_m + dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>(2.0 * g);
+    value_p = -value_m + dealii::Tensor<rank, dim, VectorizedArrayType>(2.0 * g);
   }
   else if(boundary_type == BoundaryType::Neumann)
   {
@@ -183,18 +184,18 @@ inline DEAL_II_ALWAYS_INLINE //
  * Calculates exterior state of normal gradient (Neumann type boundary conditions)
  * depending on interior data and boundary conditions.
  */
-template<int dim, typename Number, int rank>
+template<int dim, typename Number, int rank, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-  dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+  dealii::Tensor<rank, dim, VectorizedArrayType>
   calculate_exterior_normal_grad(
-    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> const & grad_M_normal,
+    dealii::Tensor<rank, dim, VectorizedArrayType> const & grad_M_normal,
     BoundaryType const &                                               boundary_type,
     BoundaryDescriptorStd<dim> const &                                 boundary_descriptor,
     dealii::types::boundary_id const &                                 boundary_id,
-    dealii::Point<dim, dealii::VectorizedArray<Number>> const &        q_point,
+    dealii::Point<dim, VectorizedArrayType> const &        q_point,
     Number const &                                                     time)
 {
-  dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> grad_P_normal;
+  dealii::Tensor<rank, dim, VectorizedArrayType> grad_P_normal;
 
   if(boundary_type == BoundaryType::Dirichlet)
   {
@@ -204,10 +205,10 @@ inline DEAL_II_ALWAYS_INLINE //
   else if(boundary_type == BoundaryType::Neumann)
   {
     auto bc = boundary_descriptor.neumann_bc.find(boundary_id)->second;
-    auto h  = FunctionEvaluator<rank, dim, Number>::value(bc, q_point, time);
+    auto h  = FunctionEvaluator<rank, dim, Number, VectorizedArrayType>::value(bc, q_point, time);
 
     grad_P_normal =
-      -grad_M_normal + dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>(2.0 * h);
+      -grad_M_normal + dealii::Tensor<rank, dim, VectorizedArrayType>(2.0 * h);
   }
   else
   {
@@ -220,20 +221,20 @@ inline DEAL_II_ALWAYS_INLINE //
 /*
  * This function calculates the Lax-Friedrichs flux for the momentum equation
  */
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
-    calculate_flux(dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & momentum_flux_M,
-                   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & momentum_flux_P,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & rho_u_M,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & rho_u_P,
-                   dealii::VectorizedArray<Number> const &                         lambda,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & normal)
+    dealii::Tensor<1, dim, VectorizedArrayType>
+    calculate_flux(dealii::Tensor<2, dim, VectorizedArrayType> const & momentum_flux_M,
+                   dealii::Tensor<2, dim, VectorizedArrayType> const & momentum_flux_P,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & rho_u_M,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & rho_u_P,
+                   VectorizedArrayType const &                         lambda,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & normal)
 {
-  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> out;
+  dealii::Tensor<1, dim, VectorizedArrayType> out;
   for(unsigned int d = 0; d < dim; ++d)
   {
-    dealii::VectorizedArray<Number> sum = dealii::VectorizedArray<Number>();
+    VectorizedArrayType sum = VectorizedArrayType();
     for(unsigned int e = 0; e < dim; ++e)
       sum += (momentum_flux_M[d][e] + momentum_flux_P[d][e]) * normal[e];
     out[d] = 0.5 * (sum + lambda * (rho_u_M[d] - rho_u_P[d]));
@@ -245,17 +246,17 @@ inline DEAL_II_ALWAYS_INLINE //
 /*
  * This function calculates the Lax-Friedrichs flux for scalar quantities (density/energy)
  */
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-    dealii::VectorizedArray<Number>
-    calculate_flux(dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & flux_M,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & flux_P,
-                   dealii::VectorizedArray<Number> const &                         value_M,
-                   dealii::VectorizedArray<Number> const &                         value_P,
-                   dealii::VectorizedArray<Number> const &                         lambda,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & normal)
+    VectorizedArrayType
+    calculate_flux(dealii::Tensor<1, dim, VectorizedArrayType> const & flux_M,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & flux_P,
+                   VectorizedArrayType const &                         value_M,
+                   VectorizedArrayType const &                         value_P,
+                   VectorizedArrayType const &                         lambda,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & normal)
 {
-  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> average_flux = 0.5 * (flux_M + flux_P);
+  dealii::Tensor<1, dim, VectorizedArrayType> average_flux = 0.5 * (flux_M + flux_P);
 
   return average_flux * normal + 0.5 * lambda * (value_M - value_P);
 }
@@ -264,19 +265,19 @@ inline DEAL_II_ALWAYS_INLINE //
  * Calculation of lambda for Lax-Friedrichs flux according to Hesthaven:
  *   lambda = max( |u_M| + sqrt(|gamma * p_M / rho_M|) , |u_P| + sqrt(|gamma * p_P / rho_P|) )
  */
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType>
 inline DEAL_II_ALWAYS_INLINE //
-  dealii::VectorizedArray<Number>
-  calculate_lambda(dealii::VectorizedArray<Number> const &                         rho_m,
-                   dealii::VectorizedArray<Number> const &                         rho_p,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_m,
-                   dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_p,
-                   dealii::VectorizedArray<Number> const &                         p_m,
-                   dealii::VectorizedArray<Number> const &                         p_p,
-                   Number const &                                                  gamma)
+  VectorizedArrayType
+  calculate_lambda(VectorizedArrayType const &                         rho_m,
+                   VectorizedArrayType const &                         rho_p,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & u_m,
+                   dealii::Tensor<1, dim, VectorizedArrayType> const & u_p,
+                   VectorizedArrayType const &                         p_m,
+                   VectorizedArrayType const &                         p_p,
+                   Number const &                                      gamma)
 {
-  dealii::VectorizedArray<Number> lambda_m = u_m.norm() + std::sqrt(std::abs(gamma * p_m / rho_m));
-  dealii::VectorizedArray<Number> lambda_p = u_p.norm() + std::sqrt(std::abs(gamma * p_p / rho_p));
+  VectorizedArrayType lambda_m = u_m.norm() + std::sqrt(std::abs(gamma * p_m / rho_m));
+  VectorizedArrayType lambda_p = u_p.norm() + std::sqrt(std::abs(gamma * p_p / rho_p));
 
   return std::max(lambda_m, lambda_p);
 }
@@ -296,29 +297,29 @@ struct BodyForceOperatorData
   std::shared_ptr<dealii::Function<dim>> rhs_E;
 };
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType = dealii::VectorizedArray<Number>>
 class BodyForceOperator
 {
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  typedef BodyForceOperator<dim, Number> This;
+  typedef BodyForceOperator<dim, Number, VectorizedArrayType> This;
 
-  typedef CellIntegrator<dim, 1, Number>   CellIntegratorScalar;
-  typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
+  typedef CellIntegrator<dim, 1, Number, VectorizedArrayType>   CellIntegratorScalar;
+  typedef CellIntegrator<dim, dim, Number, VectorizedArrayType> CellIntegratorVector;
 
-  typedef dealii::VectorizedArray<Number>                         scalar;
-  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
-  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
-  typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
+  typedef VectorizedArrayType                         scalar;
+  typedef dealii::Tensor<1, dim, VectorizedArrayType> vector;
+  typedef dealii::Tensor<2, dim, VectorizedArrayType> tensor;
+  typedef dealii::Point<dim, VectorizedArrayType>     point;
 
   BodyForceOperator() : matrix_free(nullptr), eval_time(0.0)
   {
   }
 
   void
-  initialize(dealii::MatrixFree<dim, Number> const & matrix_free_in,
-             BodyForceOperatorData<dim> const &      data_in)
+  initialize(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free_in,
+             BodyForceOperatorData<dim> const &                           data_in)
   {
     this->matrix_free = &matrix_free_in;
     this->data        = data_in;
@@ -350,19 +351,27 @@ public:
     vector u        = momentum.get_value(q) / rho;
 
     scalar rhs_density =
-      FunctionEvaluator<0, dim, Number>::value(data.rhs_rho, q_points, eval_time);
-    vector rhs_momentum = FunctionEvaluator<1, dim, Number>::value(data.rhs_u, q_points, eval_time);
-    scalar rhs_energy   = FunctionEvaluator<0, dim, Number>::value(data.rhs_E, q_points, eval_time);
+      FunctionEvaluator<0, dim, Number, VectorizedArrayType>::value(data.rhs_rho,
+                                                                    q_points,
+                                                                    eval_time);
+    vector rhs_momentum =
+      FunctionEvaluator<1, dim, Number, VectorizedArrayType>::value(data.rhs_u,
+                                                                    q_points,
+                                                                    eval_time);
+    scalar rhs_energy =
+      FunctionEvaluator<0, dim, Number, VectorizedArrayType>::value(data.rhs_E,
+                                                                    q_points,
+                                                                    eval_time);
 
     return std::make_tuple(rhs_density, rhs_momentum, rhs_momentum * u + rhs_energy);
   }
 
 private:
   void
-  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-            VectorType &                                  dst,
-            VectorType const &                            src,
-            std::pair<unsigned int, unsigned int> const & cell_range) const
+  cell_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+            VectorType &                                                 dst,
+            VectorType const &                                           src,
+            std::pair<unsigned int, unsigned int> const &                cell_range) const
   {
     CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
     CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
@@ -393,7 +402,7 @@ private:
     }
   }
 
-  dealii::MatrixFree<dim, Number> const * matrix_free;
+  dealii::MatrixFree<dim, Number, VectorizedArrayType> const * matrix_free;
 
   BodyForceOperatorData<dim> data;
 
@@ -410,24 +419,24 @@ struct MassOperatorData
   unsigned int quad_index;
 };
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType = dealii::VectorizedArray<Number>>
 class MassOperator
 {
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  typedef MassOperator<dim, Number> This;
+  typedef MassOperator<dim, Number, VectorizedArrayType> This;
 
-  typedef CellIntegrator<dim, 1, Number>   CellIntegratorScalar;
-  typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
+  typedef CellIntegrator<dim, 1, Number, VectorizedArrayType>   CellIntegratorScalar;
+  typedef CellIntegrator<dim, dim, Number, VectorizedArrayType> CellIntegratorVector;
 
   MassOperator() : matrix_free(nullptr)
   {
   }
 
   void
-  initialize(dealii::MatrixFree<dim, Number> const & matrix_free_in,
-             MassOperatorData const &                data_in)
+  initialize(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free_in,
+             MassOperatorData const &                                     data_in)
   {
     this->matrix_free = &matrix_free_in;
     this->data        = data_in;
@@ -449,10 +458,10 @@ public:
 
 private:
   void
-  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-            VectorType &                                  dst,
-            VectorType const &                            src,
-            std::pair<unsigned int, unsigned int> const & cell_range) const
+  cell_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+            VectorType &                                                 dst,
+            VectorType const &                                           src,
+            std::pair<unsigned int, unsigned int> const &                cell_range) const
   {
     CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
     CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
@@ -482,8 +491,8 @@ private:
     }
   }
 
-  dealii::MatrixFree<dim, Number> const * matrix_free;
-  MassOperatorData                        data;
+  dealii::MatrixFree<dim, Number, VectorizedArrayType> const * matrix_free;
+  MassOperatorData                                             data;
 };
 
 template<int dim>
@@ -503,31 +512,31 @@ struct ConvectiveOperatorData
   double specific_gas_constant;
 };
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType = dealii::VectorizedArray<Number>>
 class ConvectiveOperator
 {
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  typedef ConvectiveOperator<dim, Number> This;
+  typedef ConvectiveOperator<dim, Number, VectorizedArrayType> This;
 
-  typedef CellIntegrator<dim, 1, Number>   CellIntegratorScalar;
-  typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorScalar;
-  typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
-  typedef FaceIntegrator<dim, dim, Number> FaceIntegratorVector;
+  typedef CellIntegrator<dim, 1, Number, VectorizedArrayType>   CellIntegratorScalar;
+  typedef FaceIntegrator<dim, 1, Number, VectorizedArrayType>   FaceIntegratorScalar;
+  typedef CellIntegrator<dim, dim, Number, VectorizedArrayType> CellIntegratorVector;
+  typedef FaceIntegrator<dim, dim, Number, VectorizedArrayType> FaceIntegratorVector;
 
-  typedef dealii::VectorizedArray<Number>                         scalar;
-  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
-  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
-  typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
+  typedef VectorizedArrayType                         scalar;
+  typedef dealii::Tensor<1, dim, VectorizedArrayType> vector;
+  typedef dealii::Tensor<2, dim, VectorizedArrayType> tensor;
+  typedef dealii::Point<dim, VectorizedArrayType>     point;
 
   ConvectiveOperator() : matrix_free(nullptr)
   {
   }
 
   void
-  initialize(dealii::MatrixFree<dim, Number> const & matrix_free_in,
-             ConvectiveOperatorData<dim> const &     data_in)
+  initialize(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free_in,
+             ConvectiveOperatorData<dim> const &                          data_in)
   {
     this->matrix_free = &matrix_free_in;
     this->data        = data_in;
@@ -549,8 +558,20 @@ public:
   {
     this->eval_time = evaluation_time;
 
-    matrix_free->loop(
-      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    auto const & shape_data = matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0];
+
+    // select cell integrals with compile-time polynomial degree once per evaluation
+    dispatch_degree(shape_data.fe_degree,
+                    shape_data.n_q_points_1d,
+                    [&](auto fe_degree, auto n_q_points_1d) {
+                      matrix_free->loop(&This::template cell_loop<decltype(fe_degree)::value,
+                                                                  decltype(n_q_points_1d)::value>,
+                                        &This::face_loop,
+                                        &This::boundary_face_loop,
+                                        this,
+                                        dst,
+                                        src);
+                    });
   }
 
   void
@@ -559,12 +580,13 @@ public:
     eval_time = evaluation_time;
   }
 
+  template<typename IntegratorScalar, typename IntegratorVector>
   inline DEAL_II_ALWAYS_INLINE //
     std::tuple<vector, tensor, vector>
-    get_volume_flux(CellIntegratorScalar & density,
-                    CellIntegratorVector & momentum,
-                    CellIntegratorScalar & energy,
-                    unsigned int const     q) const
+    get_volume_flux(IntegratorScalar & density,
+                    IntegratorVector & momentum,
+                    IntegratorScalar & energy,
+                    unsigned int const q) const
   {
     scalar rho_inv = 1.0 / density.get_value(q);
     vector rho_u   = momentum.get_value(q);
@@ -661,51 +683,51 @@ public:
     // element e⁺
 
     // calculate rho_P
-    scalar rho_P = calculate_exterior_value<dim, Number, 0>(rho_M,
-                                                            boundary_type_density,
-                                                            data.bc->density,
-                                                            boundary_id,
-                                                            density.quadrature_point(q),
-                                                            this->eval_time);
+    scalar rho_P = calculate_exterior_value<dim, Number, 0, scalar>(rho_M,
+                                                                    boundary_type_density,
+                                                                    data.bc->density,
+                                                                    boundary_id,
+                                                                    density.quadrature_point(q),
+                                                                    this->eval_time);
 
     // calculate u_P
-    vector u_P = calculate_exterior_value<dim, Number, 1>(u_M,
-                                                          boundary_type_velocity,
-                                                          data.bc->velocity,
-                                                          boundary_id,
-                                                          momentum.quadrature_point(q),
-                                                          this->eval_time);
+    vector u_P = calculate_exterior_value<dim, Number, 1, scalar>(u_M,
+                                                                  boundary_type_velocity,
+                                                                  data.bc->velocity,
+                                                                  boundary_id,
+                                                                  momentum.quadrature_point(q),
+                                                                  this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
 
     // calculate p_P
-    scalar p_P = calculate_exterior_value<dim, Number, 0>(p_M,
-                                                          boundary_type_pressure,
-                                                          data.bc->pressure,
-                                                          boundary_id,
-                                                          density.quadrature_point(q),
-                                                          this->eval_time);
+    scalar p_P = calculate_exterior_value<dim, Number, 0, scalar>(p_M,
+                                                                  boundary_type_pressure,
+                                                                  data.bc->pressure,
+                                                                  boundary_id,
+                                                                  density.quadrature_point(q),
+                                                                  this->eval_time);
 
     // calculate E_P
-    scalar E_P = dealii::make_vectorized_array<Number>(0.0);
+    scalar E_P = dealii::make_vectorized_array<VectorizedArrayType>(0.0);
     if(boundary_variable == EnergyBoundaryVariable::Energy)
     {
-      E_P = calculate_exterior_value<dim, Number, 0>(E_M,
-                                                     boundary_type_energy,
-                                                     data.bc->energy,
-                                                     boundary_id,
-                                                     energy.quadrature_point(q),
-                                                     this->eval_time);
+      E_P = calculate_exterior_value<dim, Number, 0, scalar>(E_M,
+                                                             boundary_type_energy,
+                                                             data.bc->energy,
+                                                             boundary_id,
+                                                             energy.quadrature_point(q),
+                                                             this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
     {
       scalar T_M = calculate_temperature(p_M, rho_M, R);
-      scalar T_P = calculate_exterior_value<dim, Number, 0>(T_M,
-                                                            boundary_type_energy,
-                                                            data.bc->energy,
-                                                            boundary_id,
-                                                            energy.quadrature_point(q),
-                                                            this->eval_time);
+      scalar T_P = calculate_exterior_value<dim, Number, 0, scalar>(T_M,
+                                                                    boundary_type_energy,
+                                                                    data.bc->energy,
+                                                                    boundary_id,
+                                                                    energy.quadrature_point(q),
+                                                                    this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
     }
@@ -739,15 +761,19 @@ public:
   }
 
 private:
+  template<int fe_degree, int n_q_points_1d>
   void
-  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-            VectorType &                                  dst,
-            VectorType const &                            src,
-            std::pair<unsigned int, unsigned int> const & cell_range) const
+  cell_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+            VectorType &                                                 dst,
+            VectorType const &                                           src,
+            std::pair<unsigned int, unsigned int> const &                cell_range) const
   {
-    CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
-    CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
-    CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
+    typedef CellIntegratorFixedDegree<dim, fe_degree, n_q_points_1d, 1, Number>   IntegratorScalar;
+    typedef CellIntegratorFixedDegree<dim, fe_degree, n_q_points_1d, dim, Number> IntegratorVector;
+
+    IntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
+    IntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
+    IntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
@@ -776,10 +802,10 @@ private:
   }
 
   void
-  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-            VectorType &                                  dst,
-            VectorType const &                            src,
-            std::pair<unsigned int, unsigned int> const & face_range) const
+  face_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+            VectorType &                                                 dst,
+            VectorType const &                                           src,
+            std::pair<unsigned int, unsigned int> const &                face_range) const
   {
     FaceIntegratorScalar density_m(matrix_free, true, data.dof_index, data.quad_index, 0);
     FaceIntegratorScalar density_p(matrix_free, false, data.dof_index, data.quad_index, 0);
@@ -843,10 +869,10 @@ private:
   }
 
   void
-  boundary_face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-                     VectorType &                                  dst,
-                     VectorType const &                            src,
-                     std::pair<unsigned int, unsigned int> const & face_range) const
+  boundary_face_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+                     VectorType &                                                 dst,
+                     VectorType const &                                           src,
+                     std::pair<unsigned int, unsigned int> const &                face_range) const
   {
     FaceIntegratorScalar density(matrix_free, true, data.dof_index, data.quad_index, 0);
     FaceIntegratorVector momentum(matrix_free, true, data.dof_index, data.quad_index, 1);
@@ -896,7 +922,7 @@ private:
     }
   }
 
-  dealii::MatrixFree<dim, Number> const * matrix_free;
+  dealii::MatrixFree<dim, Number, VectorizedArrayType> const * matrix_free;
 
   ConvectiveOperatorData<dim> data;
 
@@ -942,31 +968,31 @@ struct ViscousOperatorData
   double specific_gas_constant;
 };
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType = dealii::VectorizedArray<Number>>
 class ViscousOperator
 {
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  typedef ViscousOperator<dim, Number> This;
+  typedef ViscousOperator<dim, Number, VectorizedArrayType> This;
 
-  typedef CellIntegrator<dim, 1, Number>   CellIntegratorScalar;
-  typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorScalar;
-  typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
-  typedef FaceIntegrator<dim, dim, Number> FaceIntegratorVector;
+  typedef CellIntegrator<dim, 1, Number, VectorizedArrayType>   CellIntegratorScalar;
+  typedef FaceIntegrator<dim, 1, Number, VectorizedArrayType>   FaceIntegratorScalar;
+  typedef CellIntegrator<dim, dim, Number, VectorizedArrayType> CellIntegratorVector;
+  typedef FaceIntegrator<dim, dim, Number, VectorizedArrayType> FaceIntegratorVector;
 
-  typedef dealii::VectorizedArray<Number>                         scalar;
-  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
-  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
-  typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
+  typedef VectorizedArrayType                         scalar;
+  typedef dealii::Tensor<1, dim, VectorizedArrayType> vector;
+  typedef dealii::Tensor<2, dim, VectorizedArrayType> tensor;
+  typedef dealii::Point<dim, VectorizedArrayType>     point;
 
   ViscousOperator() : matrix_free(nullptr), degree(1)
   {
   }
 
   void
-  initialize(dealii::MatrixFree<dim, Number> const & matrix_free_in,
-             ViscousOperatorData<dim> const &        data_in)
+  initialize(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free_in,
+             ViscousOperatorData<dim> const &                             data_in)
   {
     this->matrix_free = &matrix_free_in;
     this->data        = data_in;
@@ -998,8 +1024,20 @@ public:
   {
     this->eval_time = evaluation_time;
 
-    matrix_free->loop(
-      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    auto const & shape_data = matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0];
+
+    // select cell integrals with compile-time polynomial degree once per evaluation
+    dispatch_degree(shape_data.fe_degree,
+                    shape_data.n_q_points_1d,
+                    [&](auto fe_degree, auto n_q_points_1d) {
+                      matrix_free->loop(&This::template cell_loop<decltype(fe_degree)::value,
+                                                                  decltype(n_q_points_1d)::value>,
+                                        &This::face_loop,
+                                        &This::boundary_face_loop,
+                                        this,
+                                        dst,
+                                        src);
+                    });
   }
 
   void
@@ -1029,12 +1067,13 @@ public:
     return tau;
   }
 
+  template<typename IntegratorScalar, typename IntegratorVector>
   inline DEAL_II_ALWAYS_INLINE //
     std::tuple<vector, tensor, vector>
-    get_volume_flux(CellIntegratorScalar & density,
-                    CellIntegratorVector & momentum,
-                    CellIntegratorScalar & energy,
-                    unsigned int const     q) const
+    get_volume_flux(IntegratorScalar & density,
+                    IntegratorVector & momentum,
+                    IntegratorScalar & energy,
+                    unsigned int const q) const
   {
     scalar rho_inv  = 1.0 / density.get_value(q);
     vector grad_rho = density.get_gradient(q);
@@ -1145,12 +1184,12 @@ public:
     scalar rho_M      = density.get_value(q);
     vector grad_rho_M = density.get_gradient(q);
 
-    scalar rho_P = calculate_exterior_value<dim, Number, 0>(rho_M,
-                                                            boundary_type_density,
-                                                            data.bc->density,
-                                                            boundary_id,
-                                                            density.quadrature_point(q),
-                                                            this->eval_time);
+    scalar rho_P = calculate_exterior_value<dim, Number, 0, scalar>(rho_M,
+                                                                    boundary_type_density,
+                                                                    data.bc->density,
+                                                                    boundary_id,
+                                                                    density.quadrature_point(q),
+                                                                    this->eval_time);
 
     scalar jump_density          = rho_M - rho_P;
     scalar gradient_flux_density = -tau_IP * jump_density;
@@ -1162,12 +1201,12 @@ public:
     scalar rho_inv_M = 1.0 / rho_M;
     vector u_M       = rho_inv_M * rho_u_M;
 
-    vector u_P = calculate_exterior_value<dim, Number, 1>(u_M,
-                                                          boundary_type_velocity,
-                                                          data.bc->velocity,
-                                                          boundary_id,
-                                                          momentum.quadrature_point(q),
-                                                          this->eval_time);
+    vector u_P = calculate_exterior_value<dim, Number, 1, scalar>(u_M,
+                                                                  boundary_type_velocity,
+                                                                  data.bc->velocity,
+                                                                  boundary_id,
+                                                                  momentum.quadrature_point(q),
+                                                                  this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
 
@@ -1175,12 +1214,12 @@ public:
     tensor tau_M    = calculate_stress_tensor(grad_u_M, mu);
 
     vector tau_P_normal =
-      calculate_exterior_normal_grad<dim, Number, 1>(tau_M * normal,
-                                                     boundary_type_velocity,
-                                                     data.bc->velocity,
-                                                     boundary_id,
-                                                     momentum.quadrature_point(q),
-                                                     this->eval_time);
+      calculate_exterior_normal_grad<dim, Number, 1, scalar>(tau_M * normal,
+                                                             boundary_type_velocity,
+                                                             data.bc->velocity,
+                                                             boundary_id,
+                                                             momentum.quadrature_point(q),
+                                                             this->eval_time);
 
     vector jump_momentum          = rho_u_M - rho_u_P;
     vector gradient_flux_momentum = 0.5 * (tau_M * normal + tau_P_normal) - tau_IP * jump_momentum;
@@ -1190,26 +1229,26 @@ public:
     vector grad_rho_E_M = energy.get_gradient(q);
 
     scalar E_M = rho_inv_M * rho_E_M;
-    scalar E_P = dealii::make_vectorized_array<Number>(0.0);
+    scalar E_P = dealii::make_vectorized_array<VectorizedArrayType>(0.0);
     if(boundary_variable == EnergyBoundaryVariable::Energy)
     {
-      E_P = calculate_exterior_value<dim, Number, 0>(E_M,
-                                                     boundary_type_energy,
-                                                     data.bc->energy,
-                                                     boundary_id,
-                                                     energy.quadrature_point(q),
-                                                     this->eval_time);
+      E_P = calculate_exterior_value<dim, Number, 0, scalar>(E_M,
+                                                             boundary_type_energy,
+                                                             data.bc->energy,
+                                                             boundary_id,
+                                                             energy.quadrature_point(q),
+                                                             this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
     {
       scalar p_M = calculate_pressure(rho_M, u_M, E_M, gamma);
       scalar T_M = calculate_temperature(p_M, rho_M, R);
-      scalar T_P = calculate_exterior_value<dim, Number, 0>(T_M,
-                                                            boundary_type_energy,
-                                                            data.bc->energy,
-                                                            boundary_id,
-                                                            energy.quadrature_point(q),
-                                                            this->eval_time);
+      scalar T_P = calculate_exterior_value<dim, Number, 0, scalar>(T_M,
+                                                                    boundary_type_energy,
+                                                                    data.bc->energy,
+                                                                    boundary_id,
+                                                                    energy.quadrature_point(q),
+                                                                    this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
     }
@@ -1221,12 +1260,12 @@ public:
 
     scalar grad_T_M_normal = grad_T_M * normal;
     scalar grad_T_P_normal =
-      calculate_exterior_normal_grad<dim, Number, 0>(grad_T_M_normal,
-                                                     boundary_type_energy,
-                                                     data.bc->energy,
-                                                     boundary_id,
-                                                     energy.quadrature_point(q),
-                                                     this->eval_time);
+      calculate_exterior_normal_grad<dim, Number, 0, scalar>(grad_T_M_normal,
+                                                             boundary_type_energy,
+                                                             data.bc->energy,
+                                                             boundary_id,
+                                                             energy.quadrature_point(q),
+                                                             this->eval_time);
 
     scalar jump_energy          = rho_E_M - rho_E_P;
     scalar gradient_flux_energy = 0.5 * (u_M * tau_M * normal + u_P * tau_P_normal +
@@ -1335,12 +1374,12 @@ public:
 
     // density
     scalar rho_M = density.get_value(q);
-    scalar rho_P = calculate_exterior_value<dim, Number, 0>(rho_M,
-                                                            boundary_type_density,
-                                                            data.bc->density,
-                                                            boundary_id,
-                                                            density.quadrature_point(q),
-                                                            this->eval_time);
+    scalar rho_P = calculate_exterior_value<dim, Number, 0, scalar>(rho_M,
+                                                                    boundary_type_density,
+                                                                    data.bc->density,
+                                                                    boundary_id,
+                                                                    density.quadrature_point(q),
+                                                                    this->eval_time);
 
     scalar rho_inv_M = 1.0 / rho_M;
 
@@ -1348,12 +1387,12 @@ public:
     vector rho_u_M = momentum.get_value(q);
     vector u_M     = rho_inv_M * rho_u_M;
 
-    vector u_P = calculate_exterior_value<dim, Number, 1>(u_M,
-                                                          boundary_type_velocity,
-                                                          data.bc->velocity,
-                                                          boundary_id,
-                                                          momentum.quadrature_point(q),
-                                                          this->eval_time);
+    vector u_P = calculate_exterior_value<dim, Number, 1, scalar>(u_M,
+                                                                  boundary_type_velocity,
+                                                                  data.bc->velocity,
+                                                                  boundary_id,
+                                                                  momentum.quadrature_point(q),
+                                                                  this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
 
@@ -1361,26 +1400,26 @@ public:
     scalar rho_E_M = energy.get_value(q);
     scalar E_M     = rho_inv_M * rho_E_M;
 
-    scalar E_P = dealii::make_vectorized_array<Number>(0.0);
+    scalar E_P = dealii::make_vectorized_array<VectorizedArrayType>(0.0);
     if(boundary_variable == EnergyBoundaryVariable::Energy)
     {
-      E_P = calculate_exterior_value<dim, Number, 0>(E_M,
-                                                     boundary_type_energy,
-                                                     data.bc->energy,
-                                                     boundary_id,
-                                                     energy.quadrature_point(q),
-                                                     this->eval_time);
+      E_P = calculate_exterior_value<dim, Number, 0, scalar>(E_M,
+                                                             boundary_type_energy,
+                                                             data.bc->energy,
+                                                             boundary_id,
+                                                             energy.quadrature_point(q),
+                                                             this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
     {
       scalar p_M = calculate_pressure(rho_M, u_M, E_M, gamma);
       scalar T_M = calculate_temperature(p_M, rho_M, R);
-      scalar T_P = calculate_exterior_value<dim, Number, 0>(T_M,
-                                                            boundary_type_energy,
-                                                            data.bc->energy,
-                                                            boundary_id,
-                                                            energy.quadrature_point(q),
-                                                            this->eval_time);
+      scalar T_P = calculate_exterior_value<dim, Number, 0, scalar>(T_M,
+                                                                    boundary_type_energy,
+                                                                    data.bc->energy,
+                                                                    boundary_id,
+                                                                    energy.quadrature_point(q),
+                                                                    this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
     }
@@ -1413,15 +1452,19 @@ public:
   }
 
 private:
+  template<int fe_degree, int n_q_points_1d>
   void
-  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-            VectorType &                                  dst,
-            VectorType const &                            src,
-            std::pair<unsigned int, unsigned int> const & cell_range) const
+  cell_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+            VectorType &                                                 dst,
+            VectorType const &                                           src,
+            std::pair<unsigned int, unsigned int> const &                cell_range) const
   {
-    CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
-    CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
-    CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
+    typedef CellIntegratorFixedDegree<dim, fe_degree, n_q_points_1d, 1, Number>   IntegratorScalar;
+    typedef CellIntegratorFixedDegree<dim, fe_degree, n_q_points_1d, dim, Number> IntegratorVector;
+
+    IntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
+    IntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
+    IntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
@@ -1448,10 +1491,10 @@ private:
   }
 
   void
-  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-            VectorType &                                  dst,
-            VectorType const &                            src,
-            std::pair<unsigned int, unsigned int> const & face_range) const
+  face_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+            VectorType &                                                 dst,
+            VectorType const &                                           src,
+            std::pair<unsigned int, unsigned int> const &                face_range) const
   {
     FaceIntegratorScalar density_m(matrix_free, true, data.dof_index, data.quad_index, 0);
     FaceIntegratorScalar density_p(matrix_free, false, data.dof_index, data.quad_index, 0);
@@ -1528,10 +1571,10 @@ private:
   }
 
   void
-  boundary_face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-                     VectorType &                                  dst,
-                     VectorType const &                            src,
-                     std::pair<unsigned int, unsigned int> const & face_range) const
+  boundary_face_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+                     VectorType &                                                 dst,
+                     VectorType const &                                           src,
+                     std::pair<unsigned int, unsigned int> const &                face_range) const
   {
     FaceIntegratorScalar density(matrix_free, true, data.dof_index, data.quad_index, 0);
     FaceIntegratorVector momentum(matrix_free, true, data.dof_index, data.quad_index, 1);
@@ -1598,7 +1641,7 @@ private:
     }
   }
 
-  dealii::MatrixFree<dim, Number> const * matrix_free;
+  dealii::MatrixFree<dim, Number, VectorizedArrayType> const * matrix_free;
 
   ViscousOperatorData<dim> data;
 
@@ -1622,7 +1665,7 @@ private:
   // thermal conductivity
   Number lambda;
 
-  dealii::AlignedVector<dealii::VectorizedArray<Number>> array_penalty_parameter;
+  dealii::AlignedVector<VectorizedArrayType> array_penalty_parameter;
 
   mutable Number eval_time;
 };
@@ -1640,35 +1683,35 @@ struct CombinedOperatorData
   std::shared_ptr<BoundaryDescriptor<dim> const> bc;
 };
 
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType = dealii::VectorizedArray<Number>>
 class CombinedOperator
 {
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  typedef ConvectiveOperator<dim, Number> ConvectiveOp;
-  typedef ViscousOperator<dim, Number>    ViscousOp;
-  typedef CombinedOperator<dim, Number>   This;
+  typedef ConvectiveOperator<dim, Number, VectorizedArrayType> ConvectiveOp;
+  typedef ViscousOperator<dim, Number, VectorizedArrayType>    ViscousOp;
+  typedef CombinedOperator<dim, Number, VectorizedArrayType>   This;
 
-  typedef CellIntegrator<dim, 1, Number>   CellIntegratorScalar;
-  typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorScalar;
-  typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
-  typedef FaceIntegrator<dim, dim, Number> FaceIntegratorVector;
+  typedef CellIntegrator<dim, 1, Number, VectorizedArrayType>   CellIntegratorScalar;
+  typedef FaceIntegrator<dim, 1, Number, VectorizedArrayType>   FaceIntegratorScalar;
+  typedef CellIntegrator<dim, dim, Number, VectorizedArrayType> CellIntegratorVector;
+  typedef FaceIntegrator<dim, dim, Number, VectorizedArrayType> FaceIntegratorVector;
 
-  typedef dealii::VectorizedArray<Number>                         scalar;
-  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
-  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
-  typedef dealii::Point<dim, dealii::VectorizedArray<Number>>     point;
+  typedef VectorizedArrayType                         scalar;
+  typedef dealii::Tensor<1, dim, VectorizedArrayType> vector;
+  typedef dealii::Tensor<2, dim, VectorizedArrayType> tensor;
+  typedef dealii::Point<dim, VectorizedArrayType>     point;
 
   CombinedOperator() : matrix_free(nullptr), convective_operator(nullptr), viscous_operator(nullptr)
   {
   }
 
   void
-  initialize(dealii::MatrixFree<dim, Number> const & matrix_free_in,
-             CombinedOperatorData<dim> const &       data_in,
-             ConvectiveOp const &                    convective_operator_in,
-             ViscousOp const &                       viscous_operator_in)
+  initialize(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free_in,
+             CombinedOperatorData<dim> const &                            data_in,
+             ConvectiveOp const &                                         convective_operator_in,
+             ViscousOp const &                                            viscous_operator_in)
   {
     this->matrix_free = &matrix_free_in;
     this->data        = data_in;
@@ -1690,23 +1733,39 @@ public:
     convective_operator->set_evaluation_time(evaluation_time);
     viscous_operator->set_evaluation_time(evaluation_time);
 
-    matrix_free->loop(
-      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    auto const & shape_data = matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0];
+
+    // select cell integrals with compile-time polynomial degree once per evaluation
+    dispatch_degree(shape_data.fe_degree,
+                    shape_data.n_q_points_1d,
+                    [&](auto fe_degree, auto n_q_points_1d) {
+                      matrix_free->loop(&This::template cell_loop<decltype(fe_degree)::value,
+                                                                  decltype(n_q_points_1d)::value>,
+                                        &This::face_loop,
+                                        &This::boundary_face_loop,
+                                        this,
+                                        dst,
+                                        src);
+                    });
 
     // perform cell integrals only for performance measurements
-    //    matrix_free->cell_loop(&This::cell_loop, this, dst, src);
+    //    matrix_free->cell_loop(&This::template cell_loop<-1, 0>, this, dst, src);
   }
 
 private:
+  template<int fe_degree, int n_q_points_1d>
   void
-  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-            VectorType &                                  dst,
-            VectorType const &                            src,
-            std::pair<unsigned int, unsigned int> const & cell_range) const
+  cell_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+            VectorType &                                                 dst,
+            VectorType const &                                           src,
+            std::pair<unsigned int, unsigned int> const &                cell_range) const
   {
-    CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
-    CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
-    CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
+    typedef CellIntegratorFixedDegree<dim, fe_degree, n_q_points_1d, 1, Number>   IntegratorScalar;
+    typedef CellIntegratorFixedDegree<dim, fe_degree, n_q_points_1d, dim, Number> IntegratorVector;
+
+    IntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
+    IntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
+    IntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
@@ -1739,10 +1798,10 @@ private:
   }
 
   void
-  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-            VectorType &                                  dst,
-            VectorType const &                            src,
-            std::pair<unsigned int, unsigned int> const & face_range) const
+  face_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+            VectorType &                                                 dst,
+            VectorType const &                                           src,
+            std::pair<unsigned int, unsigned int> const &                face_range) const
   {
     FaceIntegratorScalar density_m(matrix_free, true, data.dof_index, data.quad_index, 0);
     FaceIntegratorScalar density_p(matrix_free, false, data.dof_index, data.quad_index, 0);
@@ -1821,10 +1880,10 @@ private:
   }
 
   void
-  boundary_face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
-                     VectorType &                                  dst,
-                     VectorType const &                            src,
-                     std::pair<unsigned int, unsigned int> const & face_range) const
+  boundary_face_loop(dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+                     VectorType &                                                 dst,
+                     VectorType const &                                           src,
+                     std::pair<unsigned int, unsigned int> const &                face_range) const
   {
     FaceIntegratorScalar density(matrix_free, true, data.dof_index, data.quad_index, 0);
     FaceIntegratorVector momentum(matrix_free, true, data.dof_index, data.quad_index, 1);
@@ -1904,12 +1963,12 @@ private:
     }
   }
 
-  dealii::MatrixFree<dim, Number> const * matrix_free;
+  dealii::MatrixFree<dim, Number, VectorizedArrayType> const * matrix_free;
 
   CombinedOperatorData<dim> data;
 
-  ConvectiveOperator<dim, Number> const * convective_operator;
-  ViscousOperator<dim, Number> const *    viscous_operator;
+  ConvectiveOperator<dim, Number, VectorizedArrayType> const * convective_operator;
+  ViscousOperator<dim, Number, VectorizedArrayType> const *    viscous_operator;
 };
 
 } // namespace CompNS
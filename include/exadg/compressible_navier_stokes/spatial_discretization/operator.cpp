@@ -197,7 +197,7 @@ Operator<dim, Number>::evaluate(VectorType & dst, VectorType const & src, Number
   // body force term
   if(param.right_hand_side == true)
   {
-    body_force_operator.evaluate_add(dst, src, time);
+    spatial_operators->evaluate_body_force_add(dst, src, time);
   }
 
   // apply inverse mass operator
@@ -215,7 +215,7 @@ Operator<dim, Number>::evaluate_convective(VectorType &       dst,
   if(param.equation_type == EquationType::Euler ||
      param.equation_type == EquationType::NavierStokes)
   {
-    convective_operator.evaluate(dst, src, time);
+    spatial_operators->evaluate_convective(dst, src, time);
   }
 }
 
@@ -227,7 +227,7 @@ Operator<dim, Number>::evaluate_viscous(VectorType &       dst,
 {
   if(param.equation_type == EquationType::NavierStokes)
   {
-    viscous_operator.evaluate(dst, src, time);
+    spatial_operators->evaluate_viscous(dst, src, time);
   }
 }
 
@@ -240,7 +240,7 @@ Operator<dim, Number>::evaluate_convective_and_viscous(VectorType &       dst,
   if(param.use_combined_operator == true)
   {
     // viscous and convective terms
-    combined_operator.evaluate(dst, src, time);
+    spatial_operators->evaluate_combined(dst, src, time);
   }
   else // apply operators separately
   {
@@ -250,14 +250,14 @@ Operator<dim, Number>::evaluate_convective_and_viscous(VectorType &       dst,
     // viscous operator
     if(param.equation_type == EquationType::NavierStokes)
     {
-      viscous_operator.evaluate_add(dst, src, time);
+      spatial_operators->evaluate_viscous_add(dst, src, time);
     }
 
     // convective operator
     if(param.equation_type == EquationType::Euler ||
        param.equation_type == EquationType::NavierStokes)
     {
-      convective_operator.evaluate_add(dst, src, time);
+      spatial_operators->evaluate_convective_add(dst, src, time);
     }
   }
 }
@@ -489,7 +489,6 @@ Operator<dim, Number>::setup_operators()
   body_force_operator_data.rhs_rho    = field_functions->right_hand_side_density;
   body_force_operator_data.rhs_u      = field_functions->right_hand_side_velocity;
   body_force_operator_data.rhs_E      = field_functions->right_hand_side_energy;
-  body_force_operator.initialize(*matrix_free, body_force_operator_data);
 
   // convective operator
   ConvectiveOperatorData<dim> convective_operator_data;
@@ -498,7 +497,6 @@ Operator<dim, Number>::setup_operators()
   convective_operator_data.bc                    = boundary_descriptor;
   convective_operator_data.heat_capacity_ratio   = param.heat_capacity_ratio;
   convective_operator_data.specific_gas_constant = param.specific_gas_constant;
-  convective_operator.initialize(*matrix_free, convective_operator_data);
 
   // viscous operator
   ViscousOperatorData<dim> viscous_operator_data;
@@ -511,25 +509,55 @@ Operator<dim, Number>::setup_operators()
   viscous_operator_data.heat_capacity_ratio   = param.heat_capacity_ratio;
   viscous_operator_data.specific_gas_constant = param.specific_gas_constant;
   viscous_operator_data.bc                    = boundary_descriptor;
-  viscous_operator.initialize(*matrix_free, viscous_operator_data);
 
+  std::shared_ptr<CombinedOperatorData<dim>> combined_operator_data;
   if(param.use_combined_operator == true)
   {
     AssertThrow(param.n_q_points_convective == param.n_q_points_viscous,
                 dealii::ExcMessage("Use the same number of quadrature points for convective term "
                                    "and viscous term in case of combined operator."));
 
-    CombinedOperatorData<dim> combined_operator_data;
-    combined_operator_data.dof_index  = get_dof_index_all();
-    combined_operator_data.quad_index = get_quad_index_overintegration_vis();
-    combined_operator_data.bc         = boundary_descriptor;
-
-    combined_operator.initialize(*matrix_free,
-                                 combined_operator_data,
-                                 convective_operator,
-                                 viscous_operator);
+    combined_operator_data             = std::make_shared<CombinedOperatorData<dim>>();
+    combined_operator_data->dof_index  = get_dof_index_all();
+    combined_operator_data->quad_index = get_quad_index_overintegration_vis();
+    combined_operator_data->bc         = boundary_descriptor;
   }
 
+  // the widths listed here cover all instruction set extensions supported by deal.II, widths not
+  // available in the deal.II build are rejected by create_spatial_operators()
+  unsigned int const width = param.vectorization_width > 0 ?
+                               param.vectorization_width :
+                               dealii::VectorizedArray<Number>::size();
+  if(width == 1)
+    spatial_operators = create_spatial_operators<1>(body_force_operator_data,
+                                                    convective_operator_data,
+                                                    viscous_operator_data,
+                                                    combined_operator_data);
+  else if(width == 2)
+    spatial_operators = create_spatial_operators<2>(body_force_operator_data,
+                                                    convective_operator_data,
+                                                    viscous_operator_data,
+                                                    combined_operator_data);
+  else if(width == 4)
+    spatial_operators = create_spatial_operators<4>(body_force_operator_data,
+                                                    convective_operator_data,
+                                                    viscous_operator_data,
+                                                    combined_operator_data);
+  else if(width == 8)
+    spatial_operators = create_spatial_operators<8>(body_force_operator_data,
+                                                    convective_operator_data,
+                                                    viscous_operator_data,
+                                                    combined_operator_data);
+  else if(width == 16)
+    spatial_operators = create_spatial_operators<16>(body_force_operator_data,
+                                                     convective_operator_data,
+                                                     viscous_operator_data,
+                                                     combined_operator_data);
+  else
+    AssertThrow(false,
+                dealii::ExcMessage("Vectorization width " + std::to_string(width) +
+                                   " is not supported."));
+
   // calculators
   p_u_T_calculator.initialize(*matrix_free,
                               get_dof_index_all(),
@@ -547,6 +575,90 @@ Operator<dim, Number>::setup_operators()
                                    get_quad_index_standard());
 }
 
+template<int dim, typename Number>
+template<std::size_t width>
+std::shared_ptr<SpatialOperatorsBase<Number>>
+Operator<dim, Number>::create_spatial_operators(
+  BodyForceOperatorData<dim> const &               body_force_data,
+  ConvectiveOperatorData<dim> const &              convective_data,
+  ViscousOperatorData<dim> const &                 viscous_data,
+  std::shared_ptr<CombinedOperatorData<dim>> const combined_data) const
+{
+  if constexpr(is_vectorization_width_available<Number, width>())
+  {
+    typedef dealii::VectorizedArray<Number, width> VectorizedArrayType;
+
+    std::shared_ptr<dealii::MatrixFree<dim, Number, VectorizedArrayType> const> matrix_free_width;
+
+    if constexpr(width == dealii::VectorizedArray<Number>::size())
+    {
+      matrix_free_width = matrix_free;
+    }
+    else
+    {
+      pcout << std::endl
+            << "Setup MatrixFree object with vectorization width " << width
+            << " for the operator evaluation ..." << std::endl;
+
+      // same setup as the default dealii::MatrixFree object, only the vectorization type differs
+      typename dealii::MatrixFree<dim, Number>::AdditionalData const & data_default =
+        matrix_free_data->data;
+
+      typedef typename dealii::MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
+        AdditionalData;
+
+      AdditionalData data;
+      data.tasks_parallel_scheme = static_cast<typename AdditionalData::TasksParallelScheme>(
+        data_default.tasks_parallel_scheme);
+      data.tasks_block_size                     = data_default.tasks_block_size;
+      data.mapping_update_flags                 = data_default.mapping_update_flags;
+      data.mapping_update_flags_boundary_faces  = data_default.mapping_update_flags_boundary_faces;
+      data.mapping_update_flags_inner_faces     = data_default.mapping_update_flags_inner_faces;
+      data.mapping_update_flags_faces_by_cells  = data_default.mapping_update_flags_faces_by_cells;
+      data.mg_level                             = data_default.mg_level;
+      data.store_plain_indices                  = data_default.store_plain_indices;
+      data.initialize_indices                   = data_default.initialize_indices;
+      data.initialize_mapping                   = data_default.initialize_mapping;
+      data.overlap_communication_computation    = data_default.overlap_communication_computation;
+      data.hold_all_faces_to_owned_cells        = data_default.hold_all_faces_to_owned_cells;
+      data.cell_vectorization_category          = data_default.cell_vectorization_category;
+      data.cell_vectorization_categories_strict = data_default.cell_vectorization_categories_strict;
+
+      auto matrix_free_new =
+        std::make_shared<dealii::MatrixFree<dim, Number, VectorizedArrayType>>();
+      matrix_free_new->reinit(*grid->mapping,
+                              matrix_free_data->get_dof_handler_vector(),
+                              matrix_free_data->get_constraint_vector(),
+                              matrix_free_data->get_quadrature_vector(),
+                              data);
+      matrix_free_width = matrix_free_new;
+
+      pcout << std::endl << "... done!" << std::endl;
+    }
+
+    return std::make_shared<SpatialOperators<dim, Number, VectorizedArrayType>>(matrix_free_width,
+                                                                                body_force_data,
+                                                                                convective_data,
+                                                                                viscous_data,
+                                                                                combined_data);
+  }
+  else
+  {
+    (void)body_force_data;
+    (void)convective_data;
+    (void)viscous_data;
+    (void)combined_data;
+
+    AssertThrow(false,
+                dealii::ExcMessage("Vectorization width " + std::to_string(width) +
+                                   " is not available in the deal.II build, which supports up to " +
+                                   std::to_string(dealii::VectorizedArray<Number>::size()) +
+                                   " lanes."));
+
+    return nullptr;
+  }
+}
+
 template class Operator<2, float>;
 template class Operator<2, double>;
 
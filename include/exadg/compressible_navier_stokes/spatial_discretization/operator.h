@@ -31,6 +31,7 @@
 #include <exadg/compressible_navier_stokes/spatial_discretization/calculators.h>
 #include <exadg/compressible_navier_stokes/spatial_discretization/interface.h>
 #include <exadg/compressible_navier_stokes/spatial_discretization/kernels_and_operators.h>
+#include <exadg/compressible_navier_stokes/spatial_discretization/spatial_operators.h>
 #include <exadg/compressible_navier_stokes/user_interface/boundary_descriptor.h>
 #include <exadg/compressible_navier_stokes/user_interface/field_functions.h>
 #include <exadg/compressible_navier_stokes/user_interface/parameters.h>
@@ -173,6 +174,13 @@ private:
   void
   setup_operators();
 
+  template<std::size_t width>
+  std::shared_ptr<SpatialOperatorsBase<Number>>
+  create_spatial_operators(BodyForceOperatorData<dim> const &               body_force_data,
+                           ConvectiveOperatorData<dim> const &              convective_data,
+                           ViscousOperatorData<dim> const &                 viscous_data,
+                           std::shared_ptr<CombinedOperatorData<dim>> const combined_data) const;
+
   unsigned int
   get_dof_index_all() const;
 
@@ -246,15 +254,13 @@ private:
   /*
    * Basic operators.
    */
-  MassOperator<dim, Number>       mass_operator;
-  BodyForceOperator<dim, Number>  body_force_operator;
-  ConvectiveOperator<dim, Number> convective_operator;
-  ViscousOperator<dim, Number>    viscous_operator;
+  MassOperator<dim, Number> mass_operator;
 
   /*
-   * Merged operators.
+   * Body force, convective, viscous and merged operators, evaluated with the vectorization width
+   * selected by Parameters::vectorization_width.
    */
-  CombinedOperator<dim, Number> combined_operator;
+  std::shared_ptr<SpatialOperatorsBase<Number>> spatial_operators;
 
   InverseMassOperator<dim, dim + 2, Number> inverse_mass_all;
   InverseMassOperator<dim, dim, Number>     inverse_mass_vector;
@@ -0,0 +1,166 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_SPATIAL_OPERATORS_H_
+#define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_SPATIAL_OPERATORS_H_
+
+// deal.II
+#include <deal.II/base/vectorization.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/kernels_and_operators.h>
+
+namespace ExaDG
+{
+namespace CompNS
+{
+/*
+ * Returns true if dealii::VectorizedArray<Number, width> is available in the deal.II build, i.e.,
+ * for a single lane and for all instruction set extensions up to the one deal.II has been
+ * configured with.
+ */
+template<typename Number, std::size_t width>
+constexpr bool
+is_vectorization_width_available()
+{
+  return width == 1 or (width * 8 * sizeof(Number) >= 128 and
+                        width * 8 * sizeof(Number) <= DEAL_II_VECTORIZATION_WIDTH_IN_BITS);
+}
+
+/*
+ * Interface to the operators evaluating the right-hand side of the explicit time integration,
+ * independent of the vectorization type these operators are instantiated for.
+ */
+template<typename Number>
+class SpatialOperatorsBase
+{
+protected:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  virtual ~SpatialOperatorsBase()
+  {
+  }
+
+  virtual void
+  evaluate_body_force_add(VectorType & dst, VectorType const & src, Number const time) const = 0;
+
+  virtual void
+  evaluate_convective(VectorType & dst, VectorType const & src, Number const time) const = 0;
+
+  virtual void
+  evaluate_convective_add(VectorType & dst, VectorType const & src, Number const time) const = 0;
+
+  virtual void
+  evaluate_viscous(VectorType & dst, VectorType const & src, Number const time) const = 0;
+
+  virtual void
+  evaluate_viscous_add(VectorType & dst, VectorType const & src, Number const time) const = 0;
+
+  virtual void
+  evaluate_combined(VectorType & dst, VectorType const & src, Number const time) const = 0;
+};
+
+/*
+ * Body force, convective, viscous and combined operators set up on a dealii::MatrixFree object
+ * with vectorization type VectorizedArrayType. The vectors passed to the evaluate functions are
+ * compatible with those of the default dealii::MatrixFree object, since both objects use the same
+ * DoFHandlers and the same MPI partitioning.
+ */
+template<int dim, typename Number, typename VectorizedArrayType>
+class SpatialOperators : public SpatialOperatorsBase<Number>
+{
+private:
+  typedef typename SpatialOperatorsBase<Number>::VectorType VectorType;
+
+public:
+  SpatialOperators(
+    std::shared_ptr<dealii::MatrixFree<dim, Number, VectorizedArrayType> const> matrix_free_in,
+    BodyForceOperatorData<dim> const &                                           body_force_data,
+    ConvectiveOperatorData<dim> const &                                          convective_data,
+    ViscousOperatorData<dim> const &                                             viscous_data,
+    std::shared_ptr<CombinedOperatorData<dim>> const                             combined_data)
+    : matrix_free(matrix_free_in)
+  {
+    body_force_operator.initialize(*matrix_free, body_force_data);
+    convective_operator.initialize(*matrix_free, convective_data);
+    viscous_operator.initialize(*matrix_free, viscous_data);
+
+    if(combined_data.get() != nullptr)
+    {
+      combined_operator.initialize(*matrix_free,
+                                   *combined_data,
+                                   convective_operator,
+                                   viscous_operator);
+    }
+  }
+
+  void
+  evaluate_body_force_add(VectorType & dst, VectorType const & src, Number const time) const final
+  {
+    body_force_operator.evaluate_add(dst, src, time);
+  }
+
+  void
+  evaluate_convective(VectorType & dst, VectorType const & src, Number const time) const final
+  {
+    convective_operator.evaluate(dst, src, time);
+  }
+
+  void
+  evaluate_convective_add(VectorType & dst, VectorType const & src, Number const time) const final
+  {
+    convective_operator.evaluate_add(dst, src, time);
+  }
+
+  void
+  evaluate_viscous(VectorType & dst, VectorType const & src, Number const time) const final
+  {
+    viscous_operator.evaluate(dst, src, time);
+  }
+
+  void
+  evaluate_viscous_add(VectorType & dst, VectorType const & src, Number const time) const final
+  {
+    viscous_operator.evaluate_add(dst, src, time);
+  }
+
+  void
+  evaluate_combined(VectorType & dst, VectorType const & src, Number const time) const final
+  {
+    combined_operator.evaluate(dst, src, time);
+  }
+
+private:
+  std::shared_ptr<dealii::MatrixFree<dim, Number, VectorizedArrayType> const> matrix_free;
+
+  BodyForceOperator<dim, Number, VectorizedArrayType>  body_force_operator;
+  ConvectiveOperator<dim, Number, VectorizedArrayType> convective_operator;
+  ViscousOperator<dim, Number, VectorizedArrayType>    viscous_operator;
+  CombinedOperator<dim, Number, VectorizedArrayType>   combined_operator;
+};
+
+} // namespace CompNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_SPATIAL_OPERATORS_H_ */
@@ -41,7 +41,7 @@ TimeIntExplRK<Number>::TimeIntExplRK(
                               param_in.end_time,
                               param_in.max_number_of_time_steps,
                               param_in.restart_data,
-                              false, // currently no adaptive time stepping implemented
+                              param_in.adaptive_time_stepping,
                               mpi_comm_in,
                               is_test_in),
     pde_operator(operator_in),
@@ -50,7 +50,9 @@ TimeIntExplRK<Number>::TimeIntExplRK(
     postprocessor(postprocessor_in),
     l2_norm(0.0),
     cfl_number(param.cfl_number / std::pow(2.0, refine_steps_time)),
-    diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time))
+    diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time)),
+    time_step_error_control(1.0),
+    n_rejected_steps(0)
 {
 }
 
@@ -92,12 +94,34 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   {
     rk_time_integrator = std::make_shared<LowStorageRKTD<Operator, VectorType>>(pde_operator, 4, 8);
   }
+  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Embedded)
+  {
+    rk_time_integrator = std::make_shared<EmbeddedRK3Stage4BS<Operator, VectorType>>(pde_operator);
+  }
+  else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK5Stage7Embedded)
+  {
+    rk_time_integrator = std::make_shared<EmbeddedRK5Stage7DP<Operator, VectorType>>(pde_operator);
+  }
   else if(this->param.temporal_discretization == TemporalDiscretization::SSPRK)
   {
     rk_time_integrator = std::make_shared<SSPRK<Operator, VectorType>>(pde_operator,
                                                                        param.order_time_integrator,
                                                                        param.stages);
   }
+
+  // error-controlled adaptive time stepping
+  if(this->adaptive_time_stepping)
+  {
+    embedded_rk_time_integrator =
+      std::dynamic_pointer_cast<EmbeddedRungeKuttaTimeIntegrator<Operator, VectorType>>(
+        rk_time_integrator);
+
+    AssertThrow(embedded_rk_time_integrator.get() != nullptr,
+                dealii::ExcMessage("Error control requires an embedded Runge-Kutta method."));
+
+    step_size_controller =
+      std::make_shared<PIStepSizeController>(embedded_rk_time_integrator->get_order_embedded());
+  }
 }
 
 /*
@@ -191,15 +215,24 @@ TimeIntExplRK<Number>::calculate_time_step_size()
     AssertThrow(false,
                 dealii::ExcMessage("Specified type of time step calculation is not implemented."));
   }
+
+  // the initial time step size of adaptive time stepping is also bounded by the maximum time step
+  // size
+  if(this->adaptive_time_stepping)
+    this->time_step = std::min(this->time_step, param.time_step_size_max);
 }
 
 template<typename Number>
 double
 TimeIntExplRK<Number>::recalculate_time_step_size() const
 {
-  AssertThrow(false, dealii::ExcMessage("Currently no adaptive time stepping implemented."));
+  // step size proposed by the step size controller, bounded by the maximum time step size and
+  // chosen such that the end time is not exceeded
+  double new_time_step_size = std::min(time_step_error_control, param.time_step_size_max);
+  if(this->end_time - this->get_time() > 0.0)
+    new_time_step_size = std::min(new_time_step_size, this->end_time - this->get_time());
 
-  return 1.0;
+  return new_time_step_size;
 }
 
 template<typename Number>
@@ -241,15 +274,39 @@ TimeIntExplRK<Number>::do_timestep_solve()
   dealii::Timer timer;
   timer.restart();
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  unsigned int n_rejected = 0;
+  if(this->adaptive_time_stepping)
+  {
+    // the time step size is reduced in case of rejected steps
+    n_rejected = solve_timestep_error_controlled(*embedded_rk_time_integrator,
+                                                 *step_size_controller,
+                                                 this->solution_np,
+                                                 this->solution_n,
+                                                 this->time,
+                                                 this->time_step,
+                                                 time_step_error_control,
+                                                 param.adaptive_time_stepping_abs_tolerance,
+                                                 param.adaptive_time_stepping_rel_tolerance);
+    n_rejected_steps += n_rejected;
+  }
+  else
+  {
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+  }
 
   if(print_solver_info() and not(this->is_test))
   {
     this->pcout << std::endl << "Solve compressible Navier-Stokes equations explicitly:";
     print_wall_time(this->pcout, timer.wall_time());
+
+    if(this->adaptive_time_stepping)
+    {
+      this->pcout << "  Rejected steps (current / total): " << n_rejected << " / "
+                  << n_rejected_steps << std::endl;
+    }
   }
 
   this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
@@ -84,6 +84,12 @@ enum_to_string(TemporalDiscretization const enum_type)
     case TemporalDiscretization::ExplRK5Stage9Reg2S:
       string_type = "ExplRK5Stage9Reg2S";
       break;
+    case TemporalDiscretization::ExplRK3Stage4Embedded:
+      string_type = "ExplRK3Stage4Embedded";
+      break;
+    case TemporalDiscretization::ExplRK5Stage7Embedded:
+      string_type = "ExplRK5Stage7Embedded";
+      break;
     case TemporalDiscretization::SSPRK:
       string_type = "SSPRK";
       break;
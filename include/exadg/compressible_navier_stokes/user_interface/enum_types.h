@@ -89,7 +89,9 @@ enum class TemporalDiscretization
   ExplRK4Stage8Reg2, // optimized for maximum time step sizes in DG context
   ExplRK4Stage5Reg3C,
   ExplRK5Stage9Reg2S,
-  SSPRK // specify order and stages of time integration scheme
+  ExplRK3Stage4Embedded, // Bogacki-Shampine 3(2), embedded error estimator
+  ExplRK5Stage7Embedded, // Dormand-Prince 5(4), embedded error estimator
+  SSPRK                  // specify order and stages of time integration scheme
 };
 
 std::string
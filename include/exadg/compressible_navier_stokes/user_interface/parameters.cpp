@@ -53,6 +53,10 @@ Parameters::Parameters()
     time_step_size(-1.),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
     n_refine_time(0),
+    adaptive_time_stepping(false),
+    adaptive_time_stepping_abs_tolerance(1.e-6),
+    adaptive_time_stepping_rel_tolerance(1.e-6),
+    time_step_size_max(std::numeric_limits<double>::max()),
     max_velocity(-1.),
     cfl_number(-1.),
     diffusion_number(-1.),
@@ -76,7 +80,8 @@ Parameters::Parameters()
 
     // NUMERICAL PARAMETERS
     detect_instabilities(true),
-    use_combined_operator(false)
+    use_combined_operator(false),
+    vectorization_width(0)
 {
 }
 
@@ -113,6 +118,21 @@ Parameters::check() const
     AssertThrow(stages >= 1, dealii::ExcMessage("Specify number of RK stages!"));
   }
 
+  if(adaptive_time_stepping)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK3Stage4Embedded ||
+                  temporal_discretization == TemporalDiscretization::ExplRK5Stage7Embedded,
+                dealii::ExcMessage(
+                  "Adaptive time stepping requires a Runge-Kutta method with error estimator."));
+
+    AssertThrow(adaptive_time_stepping_abs_tolerance > 0.0 &&
+                  adaptive_time_stepping_rel_tolerance >= 0.0,
+                dealii::ExcMessage("Invalid tolerances for error-controlled time stepping."));
+
+    AssertThrow(time_step_size_max > 0.0,
+                dealii::ExcMessage("Invalid parameter time_step_size_max."));
+  }
+
   if(calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
   {
     AssertThrow(max_velocity >= 0.0, dealii::ExcMessage("Invalid parameter max_velocity."));
@@ -135,6 +155,9 @@ Parameters::check() const
   }
 
   // NUMERICAL PARAMETERS
+  AssertThrow(vectorization_width == 0 or
+                (vectorization_width & (vectorization_width - 1)) == 0,
+              dealii::ExcMessage("The vectorization width has to be a power of two."));
 }
 
 
@@ -214,6 +237,19 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
   print_parameter(pcout, "Temporal refinements", n_refine_time);
 
+  print_parameter(pcout, "Adaptive time stepping", adaptive_time_stepping);
+
+  if(adaptive_time_stepping)
+  {
+    print_parameter(pcout,
+                    "Absolute tolerance (error control)",
+                    adaptive_time_stepping_abs_tolerance);
+    print_parameter(pcout,
+                    "Relative tolerance (error control)",
+                    adaptive_time_stepping_rel_tolerance);
+    print_parameter(pcout, "Maximum allowable time step size", time_step_size_max);
+  }
+
 
   // here we do not print quantities such as cfl_number, diffusion_number, time_step_size
   // because this is done by the time integration scheme (or the functions that
@@ -257,6 +293,8 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
 
   print_parameter(pcout, "Detect instabilities", detect_instabilities);
   print_parameter(pcout, "Use combined operator", use_combined_operator);
+  if(vectorization_width > 0)
+    print_parameter(pcout, "Vectorization width", vectorization_width);
 }
 
 } // namespace CompNS
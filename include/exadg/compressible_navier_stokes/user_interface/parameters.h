@@ -136,6 +136,21 @@ public:
   // number of refinements for temporal discretization
   unsigned int n_refine_time;
 
+  // Adaptive time stepping based on the embedded error estimator, only available for the
+  // Runge-Kutta methods ExplRK3Stage4Embedded and ExplRK5Stage7Embedded. The time step size is
+  // controlled by a PI controller such that the estimated local error satisfies
+  // |error_i| <= abs_tolerance + rel_tolerance * |u_i| in the root-mean-square sense, and steps
+  // violating the tolerance are rejected. The time step size according to
+  // calculation_of_time_step_size is only used as the initial time step size.
+  bool adaptive_time_stepping;
+
+  double adaptive_time_stepping_abs_tolerance;
+  double adaptive_time_stepping_rel_tolerance;
+
+  // maximum time step size in case of adaptive time stepping, i.e., the step size proposed by the
+  // PI controller is limited to this value
+  double time_step_size_max;
+
   // maximum velocity needed when calculating the time step according to cfl-condition
   double max_velocity;
 
@@ -192,6 +207,13 @@ public:
   // use combined operator for viscous term and convective term in order to improve run
   // time
   bool use_combined_operator;
+
+  // number of SIMD lanes (cells or faces per batch) used for the evaluation of the convective,
+  // viscous and body force terms. The default value 0 selects the width of
+  // dealii::VectorizedArray<Number> deal.II has been configured with. Smaller widths (a power of
+  // two, e.g. 1 for a scalar evaluation) reduce the number of empty lanes on small meshes or
+  // meshes with many cell and face categories, at the price of an additional MatrixFree object.
+  unsigned int vectorization_width;
 };
 
 } // namespace CompNS
@@ -44,9 +44,24 @@ Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0),
     is_test(is_test),
     is_throughput_study(is_throughput_study),
-    application(app)
+    application(app),
+    n_time_steps_per_slab(0)
 {
-  print_general_info<Number>(pcout, mpi_comm, is_test);
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_parallel_in_time(MPI_Comm const &           time_comm,
+                                            PararealParameters const & parameters)
+{
+  parareal_parameters = parameters;
+
+  parareal = std::make_shared<Parareal<dealii::LinearAlgebra::distributed::Vector<Number>>>(
+    time_comm, parareal_parameters);
+
+  // all time slabs solve the same problem in space, only the first time slab prints
+  pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0 and
+                      parareal->get_time_slab() == 0);
 }
 
 template<int dim, typename Number>
@@ -56,8 +71,17 @@ Driver<dim, Number>::setup()
   dealii::Timer timer;
   timer.restart();
 
+  print_general_info<Number>(pcout, mpi_comm, is_test);
+
+  if(parareal)
+    parareal_parameters.print(pcout);
+
   pcout << std::endl << "Setting up scalar convection-diffusion solver:" << std::endl;
 
+  // the output of the setup is the same on all time slabs and printed on the first time slab only
+  bool const print_output = not(parareal) or parareal->get_time_slab() == 0;
+
+  application->set_print_output(print_output);
   application->setup();
 
   if(application->get_parameters().ale_formulation) // moving mesh
@@ -72,6 +96,29 @@ Driver<dim, Number>::setup()
                                                         application->get_parameters().start_time);
   }
 
+  if(parareal)
+  {
+    Parameters const & param = application->get_parameters();
+
+    AssertThrow(param.problem_type == ProblemType::Unsteady and
+                  (param.temporal_discretization == TemporalDiscretization::ExplRK or
+                   param.temporal_discretization == TemporalDiscretization::IMEXRK),
+                dealii::ExcMessage("Parareal is only implemented for unsteady problems with "
+                                   "(explicit or IMEX) Runge-Kutta time integration."));
+
+    AssertThrow(not(param.ale_formulation) and not(param.adaptive_time_stepping) and
+                  not(param.restart_data.write_restart) and not(param.restarted_simulation),
+                dealii::ExcMessage("Parareal can not be used in combination with ALE, adaptive "
+                                   "time stepping, or restart."));
+
+    // the time step size of the coarse propagator exceeds the stability limit of explicit schemes
+    AssertThrow(param.temporal_discretization == TemporalDiscretization::IMEXRK or
+                  parareal_parameters.coarsening_factor == 1,
+                dealii::ExcMessage("Parareal with a coarsening factor larger than 1 requires "
+                                   "IMEXRK time integration, the coarse propagator violates the "
+                                   "stability limit of explicit Runge-Kutta methods otherwise."));
+  }
+
   // initialize convection-diffusion operator
   pde_operator = std::make_shared<Operator<dim, Number>>(application->get_grid(),
                                                          grid_motion,
@@ -80,6 +127,7 @@ Driver<dim, Number>::setup()
                                                          application->get_parameters(),
                                                          "scalar",
                                                          mpi_comm);
+  pde_operator->set_print_output(print_output);
 
   // initialize matrix_free
   matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
@@ -87,8 +135,23 @@ Driver<dim, Number>::setup()
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
   if(application->get_parameters().use_cell_based_face_loops)
-    Categorization::do_cell_based_loops(*application->get_grid()->triangulation,
-                                        matrix_free_data->data);
+  {
+    auto const bc = application->get_boundary_descriptor();
+    Categorization::do_cell_based_loops_by_face_type(
+      *application->get_grid()->triangulation,
+      matrix_free_data->data,
+      [&](dealii::types::boundary_id const id) { return bc->get_boundary_type(id); });
+
+    if(application->get_parameters().use_cell_batching_by_conditioning)
+      Categorization::do_conditioning_based_categories(*application->get_grid()->triangulation,
+                                                       matrix_free_data->data);
+  }
+  if(application->get_parameters().use_local_time_stepping)
+  {
+    Categorization::do_time_step_level_categories(*application->get_grid()->triangulation,
+                                                  matrix_free_data->data,
+                                                  application->get_parameters().n_time_step_levels);
+  }
   std::shared_ptr<dealii::Mapping<dim> const> mapping =
     get_dynamic_mapping<dim, Number>(application->get_grid(), grid_motion);
   matrix_free->reinit(*mapping,
@@ -97,6 +160,9 @@ Driver<dim, Number>::setup()
                       matrix_free_data->get_quadrature_vector(),
                       matrix_free_data->data);
 
+  if(not(is_test))
+    print_batch_fill_ratio(pcout, *matrix_free, mpi_comm);
+
   // setup convection-diffusion operator
   pde_operator->setup(matrix_free, matrix_free_data);
 
@@ -112,6 +178,7 @@ Driver<dim, Number>::setup()
       time_integrator = create_time_integrator<dim, Number>(
         pde_operator, application->get_parameters(), mpi_comm, is_test, postprocessor);
 
+      time_integrator->set_print_output(print_output);
       time_integrator->setup(application->get_parameters().restarted_simulation);
     }
     else if(application->get_parameters().problem_type == ProblemType::Steady)
@@ -133,10 +200,22 @@ Driver<dim, Number>::setup()
 
     if(application->get_parameters().problem_type == ProblemType::Unsteady)
     {
-      if(application->get_parameters().temporal_discretization == TemporalDiscretization::BDF)
+      if(application->get_parameters().temporal_discretization == TemporalDiscretization::BDF ||
+         application->get_parameters().temporal_discretization == TemporalDiscretization::IMEXRK)
       {
-        std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator_bdf =
-          std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
+        double scaling_factor = 1.0;
+        if(application->get_parameters().temporal_discretization == TemporalDiscretization::BDF)
+        {
+          std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator_bdf =
+            std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
+          scaling_factor = time_integrator_bdf->get_scaling_factor_time_derivative_term();
+        }
+        else
+        {
+          std::shared_ptr<TimeIntIMEXRK<dim, Number>> time_integrator_imex =
+            std::dynamic_pointer_cast<TimeIntIMEXRK<dim, Number>>(time_integrator);
+          scaling_factor = time_integrator_imex->get_scaling_factor_time_derivative_term();
+        }
 
         if(application->get_parameters().get_type_velocity_field() == TypeVelocityField::DoFVector)
         {
@@ -145,8 +224,7 @@ Driver<dim, Number>::setup()
           velocity_ptr = &velocity;
         }
 
-        pde_operator->setup_solver(time_integrator_bdf->get_scaling_factor_time_derivative_term(),
-                                   velocity_ptr);
+        pde_operator->setup_solver(scaling_factor, velocity_ptr);
       }
       else
       {
@@ -190,13 +268,69 @@ Driver<dim, Number>::ale_update() const
   time_int_bdf->ale_update();
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_parallel_in_time()
+{
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  Parameters const & param = application->get_parameters();
+
+  std::shared_ptr<TimeIntExplRKBase<Number>> time_integrator_rk =
+    std::dynamic_pointer_cast<TimeIntExplRKBase<Number>>(time_integrator);
+
+  // the fine propagator uses (at most) the time step size of the time integrator, the coarse
+  // propagator a time step size larger by the coarsening factor
+  double const slab_length =
+    (param.end_time - param.start_time) / parareal->get_number_of_time_slabs();
+  n_time_steps_per_slab =
+    std::max(1, (int)std::ceil(slab_length / time_integrator->get_time_step_size() - 1.e-10));
+  unsigned int const n_time_steps_coarse =
+    std::max(1U, n_time_steps_per_slab / parareal_parameters.coarsening_factor);
+
+  auto const fine = [&](VectorType & solution, double const start, double const end) {
+    time_integrator_rk->propagate(solution, start, end, n_time_steps_per_slab);
+  };
+
+  auto const coarse = [&](VectorType & solution, double const start, double const end) {
+    time_integrator_rk->propagate(solution, start, end, n_time_steps_coarse);
+  };
+
+  VectorType solution;
+  pde_operator->initialize_dof_vector(solution);
+  pde_operator->prescribe_initial_conditions(solution, param.start_time);
+
+  dealii::Timer timer;
+  timer.restart();
+
+  parareal->solve(solution, param.start_time, param.end_time, fine, coarse);
+
+  timer_tree.insert({"Convection-diffusion", "Parareal"}, timer.wall_time());
+
+  pcout << std::endl
+        << "Parareal " << (parareal->has_converged() ? "converged in " : "did not converge within ")
+        << parareal->get_number_of_iterations() << " iterations (" << n_time_steps_per_slab
+        << " fine and " << n_time_steps_coarse << " coarse time steps per time slab)." << std::endl;
+
+  // the solution at the end time is known on the last time slab
+  if(parareal->get_time_slab() + 1 == parareal->get_number_of_time_slabs())
+    postprocessor->do_postprocessing(solution,
+                                     param.end_time,
+                                     n_time_steps_per_slab *
+                                       parareal->get_number_of_time_slabs());
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::solve()
 {
   if(application->get_parameters().problem_type == ProblemType::Unsteady)
   {
-    if(application->get_parameters().ale_formulation == true)
+    if(parareal)
+    {
+      solve_parallel_in_time();
+    }
+    else if(application->get_parameters().ale_formulation == true)
     {
       do
       {
@@ -235,7 +369,7 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
 
   this->pcout << "Performance results for convection-diffusion solver:" << std::endl;
 
-  // Averaged number of iterations are only relevant for BDF time integrator
+  // Averaged number of iterations are only relevant for BDF and IMEX Runge-Kutta time integrators
   if(application->get_parameters().problem_type == ProblemType::Unsteady &&
      application->get_parameters().temporal_discretization == TemporalDiscretization::BDF)
   {
@@ -245,6 +379,15 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
       std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
     time_integrator_bdf->print_iterations();
   }
+  else if(application->get_parameters().problem_type == ProblemType::Unsteady &&
+          application->get_parameters().temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    this->pcout << std::endl << "Average number of iterations:" << std::endl;
+
+    std::shared_ptr<TimeIntIMEXRK<dim, Number>> time_integrator_imex =
+      std::dynamic_pointer_cast<TimeIntIMEXRK<dim, Number>>(time_integrator);
+    time_integrator_imex->print_iterations();
+  }
 
   // wall times
   timer_tree.insert({"Convection-diffusion"}, total_time);
@@ -263,6 +406,13 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
         std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
       timer_tree.insert({"Convection-diffusion"}, time_integrator_bdf->get_timings());
     }
+    else if(application->get_parameters().temporal_discretization ==
+            TemporalDiscretization::IMEXRK)
+    {
+      std::shared_ptr<TimeIntIMEXRK<dim, Number>> time_integrator_imex =
+        std::dynamic_pointer_cast<TimeIntIMEXRK<dim, Number>>(time_integrator);
+      timer_tree.insert({"Convection-diffusion"}, time_integrator_imex->get_timings());
+    }
     else
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
@@ -290,6 +440,14 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   if(application->get_parameters().problem_type == ProblemType::Unsteady)
   {
     unsigned int N_time_steps = this->time_integrator->get_number_of_time_steps();
+    if(parareal)
+    {
+      // all time slabs together perform the time steps of the whole time interval
+      N_time_steps = n_time_steps_per_slab * parareal->get_number_of_time_slabs();
+      N_mpi_processes *= parareal->get_number_of_time_slabs();
+
+      print_parameter(pcout, "Parareal iterations", parareal->get_number_of_iterations());
+    }
     print_throughput_unsteady(pcout, DoFs, overall_time_avg, N_time_steps, N_mpi_processes);
   }
   else
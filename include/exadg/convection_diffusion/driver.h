@@ -44,7 +44,9 @@
 #include <exadg/convection_diffusion/user_interface/parameters.h>
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 #include <exadg/grid/grid_motion_function.h>
+#include <exadg/matrix_free/batch_fill_ratio.h>
 #include <exadg/matrix_free/matrix_free_data.h>
+#include <exadg/time_integration/parareal.h>
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
 
@@ -112,6 +114,15 @@ public:
          bool const                                    is_test,
          bool const                                    is_throughput_study);
 
+  /*
+   * Parallel-in-time solution of unsteady problems with the Parareal algorithm. Has to be called
+   * before setup(). The driver solves the problem on one time slab, the communicator of the driver
+   * is the communicator of this time slab and time_comm connects the time slabs, see
+   * split_communicator_time_slabs().
+   */
+  void
+  setup_parallel_in_time(MPI_Comm const & time_comm, PararealParameters const & parameters);
+
   void
   setup();
 
@@ -133,6 +144,9 @@ private:
   void
   ale_update() const;
 
+  void
+  solve_parallel_in_time();
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
@@ -162,6 +176,14 @@ private:
 
   std::shared_ptr<DriverSteadyProblems<Number>> driver_steady;
 
+  // parallel-in-time
+  PararealParameters parareal_parameters;
+
+  std::shared_ptr<Parareal<dealii::LinearAlgebra::distributed::Vector<Number>>> parareal;
+
+  // number of time steps of the fine propagator per time slab
+  unsigned int n_time_steps_per_slab;
+
   // Computation time (wall clock time)
   mutable TimerTree timer_tree;
 };
@@ -31,8 +31,12 @@
 // driver
 #include <exadg/convection_diffusion/driver.h>
 
+// parallel-in-time
+#include <exadg/time_integration/parareal.h>
+
 // utilities
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/kernel_profiler.h>
 #include <exadg/utilities/resolution_parameters.h>
 
 // application
@@ -54,6 +58,9 @@ create_input_file(std::string const & input_file)
   TemporalResolutionParameters temporal;
   temporal.add_parameters(prm);
 
+  PararealParameters parareal;
+  parareal.add_parameters(prm);
+
   // we have to assume a default dimension and default Number type
   // for the automatic generation of a default input file
   unsigned int const Dim = 2;
@@ -67,12 +74,14 @@ create_input_file(std::string const & input_file)
 
 template<int dim, typename Number>
 void
-run(std::string const & input_file,
-    unsigned int const  degree,
-    unsigned int const  refine_space,
-    unsigned int const  refine_time,
-    MPI_Comm const &    mpi_comm,
-    bool const          is_test)
+run(std::string const &        input_file,
+    unsigned int const         degree,
+    unsigned int const         refine_space,
+    unsigned int const         refine_time,
+    MPI_Comm const &           mpi_comm,
+    MPI_Comm const &           time_comm,
+    PararealParameters const & parareal,
+    bool const                 is_test)
 {
   dealii::Timer timer;
   timer.restart();
@@ -85,6 +94,9 @@ run(std::string const & input_file,
   std::shared_ptr<ConvDiff::Driver<dim, Number>> driver =
     std::make_shared<ConvDiff::Driver<dim, Number>>(mpi_comm, application, is_test, false);
 
+  if(parareal.n_time_slabs > 1)
+    driver->setup_parallel_in_time(time_comm, parareal);
+
   driver->setup();
 
   driver->solve();
@@ -132,6 +144,15 @@ main(int argc, char ** argv)
   ExaDG::GeneralParameters            general(input_file);
   ExaDG::SpatialResolutionParameters  spatial(input_file);
   ExaDG::TemporalResolutionParameters temporal(input_file);
+  ExaDG::PararealParameters           parareal(input_file);
+
+  ExaDG::KernelProfiler::enable(general.kernel_profiling);
+
+  // parallel-in-time: each time slab solves the problem in space on slab_comm
+  MPI_Comm slab_comm = mpi_comm;
+  MPI_Comm time_comm = MPI_COMM_SELF;
+  if(parareal.n_time_slabs > 1)
+    ExaDG::split_communicator_time_slabs(mpi_comm, parareal.n_time_slabs, slab_comm, time_comm);
 
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
@@ -148,17 +169,41 @@ main(int argc, char ** argv)
       {
         // run the simulation
         if(general.dim == 2 && general.precision == "float")
-          ExaDG::run<2, float>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+          ExaDG::run<2, float>(input_file,
+                               degree,
+                               refine_space,
+                               refine_time,
+                               slab_comm,
+                               time_comm,
+                               parareal,
+                               general.is_test);
         else if(general.dim == 2 && general.precision == "double")
-          ExaDG::run<2, double>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+          ExaDG::run<2, double>(input_file,
+                                degree,
+                                refine_space,
+                                refine_time,
+                                slab_comm,
+                                time_comm,
+                                parareal,
+                                general.is_test);
         else if(general.dim == 3 && general.precision == "float")
-          ExaDG::run<3, float>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+          ExaDG::run<3, float>(input_file,
+                               degree,
+                               refine_space,
+                               refine_time,
+                               slab_comm,
+                               time_comm,
+                               parareal,
+                               general.is_test);
         else if(general.dim == 3 && general.precision == "double")
-          ExaDG::run<3, double>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+          ExaDG::run<3, double>(input_file,
+                                degree,
+                                refine_space,
+                                refine_time,
+                                slab_comm,
+                                time_comm,
+                                parareal,
+                                general.is_test);
         else
           AssertThrow(false,
                       dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
@@ -166,6 +211,14 @@ main(int argc, char ** argv)
     }
   }
 
+  if(parareal.n_time_slabs > 1)
+  {
+    MPI_Comm_free(&slab_comm);
+    MPI_Comm_free(&time_comm);
+  }
+
+  ExaDG::KernelProfiler::print_results(mpi_comm);
+
   return 0;
 }
 
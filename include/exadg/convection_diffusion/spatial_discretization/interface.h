@@ -55,6 +55,24 @@ public:
                              double const       evaluation_time,
                              VectorType const * velocity = nullptr) const = 0;
 
+  // explicit time integration with local time stepping: evaluate operator on one time step level
+  virtual void
+  evaluate_explicit_time_int_time_step_level(VectorType &       dst,
+                                             VectorType const & src,
+                                             double const       evaluation_time,
+                                             unsigned int const time_step_level,
+                                             VectorType const * velocity = nullptr) const = 0;
+
+  virtual void
+  apply_inverse_mass_operator_time_step_level(VectorType &       dst,
+                                              unsigned int const time_step_level) const = 0;
+
+  virtual unsigned int
+  get_n_time_step_levels() const = 0;
+
+  virtual std::vector<unsigned int> const &
+  get_time_step_level_dof_indices(unsigned int const time_step_level) const = 0;
+
   // explicit time integration: OIF substepping
   virtual void
   evaluate_oif(VectorType &       dst,
@@ -161,6 +179,51 @@ public:
     }
   }
 
+  /*
+   * Local time stepping: evaluate the operator on the given time step level, see
+   * LocalTimeSteppingIntegrator.
+   */
+  void
+  evaluate_time_step_level(VectorType &       dst,
+                           VectorType const & src,
+                           double const       evaluation_time,
+                           unsigned int const time_step_level) const
+  {
+    if(numerical_velocity_field)
+    {
+      interpolate(velocity_interpolated, evaluation_time, velocities, times);
+
+      pde_operator->evaluate_explicit_time_int_time_step_level(
+        dst, src, evaluation_time, time_step_level, &velocity_interpolated);
+    }
+    else
+    {
+      pde_operator->evaluate_explicit_time_int_time_step_level(dst,
+                                                               src,
+                                                               evaluation_time,
+                                                               time_step_level);
+    }
+  }
+
+  void
+  apply_inverse_mass_operator_time_step_level(VectorType &       dst,
+                                              unsigned int const time_step_level) const
+  {
+    pde_operator->apply_inverse_mass_operator_time_step_level(dst, time_step_level);
+  }
+
+  unsigned int
+  get_n_time_step_levels() const
+  {
+    return pde_operator->get_n_time_step_levels();
+  }
+
+  std::vector<unsigned int> const &
+  get_time_step_level_dof_indices(unsigned int const time_step_level) const
+  {
+    return pde_operator->get_time_step_level_dof_indices(time_step_level);
+  }
+
   void
   initialize_dof_vector(VectorType & src) const
   {
@@ -74,6 +74,12 @@ Operator<dim, Number>::Operator(
   pcout << std::endl << "... done!" << std::endl;
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::set_print_output(bool const print_output)
+{
+  pcout.set_condition(print_output and dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+}
 
 template<int dim, typename Number>
 void
@@ -219,6 +225,7 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
 
   // merged operator
   if(param.temporal_discretization == TemporalDiscretization::BDF ||
+     param.temporal_discretization == TemporalDiscretization::IMEXRK ||
      (param.temporal_discretization == TemporalDiscretization::ExplRK &&
       param.use_combined_operator == true))
   {
@@ -233,9 +240,11 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
 
     // linear system of equations has to be solved: the problem is either steady or
     // an unsteady problem is solved with BDF time integration (semi-implicit or fully implicit
-    // formulation of convective and diffusive terms)
+    // formulation of convective and diffusive terms) or IMEX Runge-Kutta time integration
+    // (explicit convective term, implicit diffusive term)
     if(param.problem_type == ProblemType::Steady ||
-       param.temporal_discretization == TemporalDiscretization::BDF)
+       param.temporal_discretization == TemporalDiscretization::BDF ||
+       param.temporal_discretization == TemporalDiscretization::IMEXRK)
     {
       if(param.problem_type == ProblemType::Unsteady)
         combined_operator_data.unsteady_problem = true;
@@ -281,6 +290,12 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
                                  diffusive_kernel);
   }
 
+  // local time stepping
+  if(param.use_local_time_stepping)
+  {
+    time_step_levels.initialize(*matrix_free, get_dof_index(), param.n_time_step_levels);
+  }
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
@@ -687,6 +702,68 @@ Operator<dim, Number>::evaluate_explicit_time_int(VectorType &       dst,
   inverse_mass_operator.apply(dst, dst);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_explicit_time_int_time_step_level(
+  VectorType &       dst,
+  VectorType const & src,
+  double const       time,
+  unsigned int const time_step_level,
+  VectorType const * velocity) const
+{
+  AssertThrow(param.use_local_time_stepping and param.use_combined_operator,
+              dealii::ExcMessage("Local time stepping requires the combined operator."));
+
+  if(param.convective_problem())
+  {
+    if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+    {
+      AssertThrow(velocity != nullptr, dealii::ExcMessage("velocity pointer is not initialized."));
+
+      combined_operator.set_velocity_ptr(*velocity);
+    }
+  }
+
+  dst = 0.0;
+
+  combined_operator.set_time(time);
+  combined_operator.evaluate_add_time_step_level(dst, src, time_step_levels, time_step_level);
+
+  // shift diffusive and convective term to the rhs of the equation
+  dst *= -1.0;
+
+  if(param.right_hand_side == true)
+  {
+    rhs_operator.evaluate_add_time_step_level(dst, time, time_step_levels, time_step_level);
+  }
+
+  // apply inverse mass operator on the cells of the current level only
+  inverse_mass_operator.apply_time_step_level(dst, dst, time_step_levels, time_step_level);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::apply_inverse_mass_operator_time_step_level(
+  VectorType &       dst,
+  unsigned int const time_step_level) const
+{
+  inverse_mass_operator.apply_time_step_level(dst, dst, time_step_levels, time_step_level);
+}
+
+template<int dim, typename Number>
+unsigned int
+Operator<dim, Number>::get_n_time_step_levels() const
+{
+  return time_step_levels.get_n_levels();
+}
+
+template<int dim, typename Number>
+std::vector<unsigned int> const &
+Operator<dim, Number>::get_time_step_level_dof_indices(unsigned int const time_step_level) const
+{
+  return time_step_levels.get_dof_indices(time_step_level);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_convective_term(VectorType &       dst,
@@ -705,6 +782,28 @@ Operator<dim, Number>::evaluate_convective_term(VectorType &       dst,
   convective_operator.evaluate(dst, src);
 }
 
+template<int dim, typename Number>
+double
+Operator<dim, Number>::evaluate_convective_term_and_calculate_time_step_cfl(
+  VectorType &       dst,
+  VectorType const & src,
+  double const       time,
+  VectorType const & velocity) const
+{
+  AssertThrow(param.get_type_velocity_field() == TypeVelocityField::DoFVector,
+              dealii::ExcMessage("The velocity field has to be a DoF vector."));
+
+  convective_operator.set_velocity_ptr(velocity);
+  convective_operator.set_time(time);
+
+  return convective_operator.evaluate_and_calculate_time_step_cfl(
+    dst,
+    src,
+    param.degree,
+    param.exponent_fe_degree_convection,
+    param.adaptive_time_stepping_cfl_type);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_oif(VectorType &       dst,
@@ -932,6 +1031,23 @@ Operator<dim, Number>::calculate_time_step_cfl_numerical_velocity(VectorType con
                                                     mpi_comm);
 }
 
+template<int dim, typename Number>
+double
+Operator<dim, Number>::calculate_time_step_cfl_numerical_velocity(
+  VectorType const & velocity,
+  VectorType const & grid_velocity) const
+{
+  return calculate_time_step_cfl_local<dim, Number>(*matrix_free,
+                                                    get_dof_index_velocity(),
+                                                    get_quad_index(),
+                                                    velocity,
+                                                    param.degree,
+                                                    param.exponent_fe_degree_convection,
+                                                    param.adaptive_time_stepping_cfl_type,
+                                                    mpi_comm,
+                                                    &grid_velocity);
+}
+
 template<int dim, typename Number>
 double
 Operator<dim, Number>::calculate_time_step_cfl_analytical_velocity(double const time) const
@@ -35,6 +35,7 @@
 #include <exadg/grid/grid.h>
 #include <exadg/grid/grid_motion_interface.h>
 #include <exadg/matrix_free/matrix_free_data.h>
+#include <exadg/matrix_free/time_step_levels.h>
 #include <exadg/operators/inverse_mass_operator.h>
 #include <exadg/operators/mass_operator.h>
 #include <exadg/operators/rhs_operator.h>
@@ -62,6 +63,12 @@ public:
            std::string const &                               field,
            MPI_Comm const &                                  mpi_comm);
 
+  /*
+   * Output to pcout is written on the first process of the communicator if print_output is true
+   * (default), e.g., to print on one time slab only for parallel-in-time simulations.
+   */
+  void
+  set_print_output(bool const print_output);
 
   void
   fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const;
@@ -126,6 +133,34 @@ public:
                              double const       evaluation_time,
                              VectorType const * velocity = nullptr) const;
 
+  /*
+   * Local time stepping: same as evaluate_explicit_time_int(), but restricted to the cells and
+   * faces of the given time step level. The inverse mass operator is applied to the degrees of
+   * freedom of the given level only, i.e., the contributions of faces between the given level and
+   * coarser levels remain in weak form (not multiplied by the inverse mass matrix) for the degrees
+   * of freedom of the coarser cells.
+   */
+  void
+  evaluate_explicit_time_int_time_step_level(VectorType &       dst,
+                                             VectorType const & src,
+                                             double const       evaluation_time,
+                                             unsigned int const time_step_level,
+                                             VectorType const * velocity = nullptr) const;
+
+  /*
+   * Local time stepping: applies the inverse mass operator to the degrees of freedom of the given
+   * time step level (in-place).
+   */
+  void
+  apply_inverse_mass_operator_time_step_level(VectorType &       dst,
+                                              unsigned int const time_step_level) const;
+
+  unsigned int
+  get_n_time_step_levels() const;
+
+  std::vector<unsigned int> const &
+  get_time_step_level_dof_indices(unsigned int const time_step_level) const;
+
   /*
    * This function evaluates the convective term which is needed when using an explicit formulation
    * for the convective term.
@@ -136,6 +171,16 @@ public:
                            double const       evaluation_time,
                            VectorType const * velocity = nullptr) const;
 
+  /*
+   * Same as above, but the time step size according to the local CFL criterion is calculated for
+   * the given numerical velocity field within the same loop over all cells.
+   */
+  double
+  evaluate_convective_term_and_calculate_time_step_cfl(VectorType &       dst,
+                                                       VectorType const & src,
+                                                       double const       evaluation_time,
+                                                       VectorType const & velocity) const;
+
   /*
    * This function is called by OIF sub-stepping algorithm. It evaluates the convective term,
    * multiplies the result by -1.0 and applies the inverse mass operator.
@@ -260,6 +305,11 @@ public:
   double
   calculate_time_step_cfl_numerical_velocity(VectorType const & velocity) const;
 
+  // local CFL criterion: use numerical velocity field relative to the grid velocity (ALE)
+  double
+  calculate_time_step_cfl_numerical_velocity(VectorType const & velocity,
+                                             VectorType const & grid_velocity) const;
+
   // local CFL criterion: use analytical velocity field
   double
   calculate_time_step_cfl_analytical_velocity(double const time) const;
@@ -419,6 +469,11 @@ private:
    */
   CombinedOperator<dim, Number> combined_operator;
 
+  /*
+   * Time step levels of cells and faces (local time stepping).
+   */
+  TimeStepLevels<dim, Number> time_step_levels;
+
   /*
    * Solvers and preconditioners
    */
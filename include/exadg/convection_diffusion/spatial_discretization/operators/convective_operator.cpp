@@ -64,6 +64,25 @@ ConvectiveOperator<dim, Number>::get_velocity() const
   return kernel->get_velocity();
 }
 
+template<int dim, typename Number>
+double
+ConvectiveOperator<dim, Number>::evaluate_and_calculate_time_step_cfl(
+  VectorType &           dst,
+  VectorType const &     src,
+  unsigned int const     degree,
+  double const           exponent_fe_degree,
+  CFLConditionType const cfl_condition_type) const
+{
+  AssertThrow(operator_data.kernel_data.velocity_type == TypeVelocityField::DoFVector,
+              dealii::ExcMessage("Invalid parameter velocity_type."));
+
+  time_step_calculator_cfl.start(degree, exponent_fe_degree, cfl_condition_type);
+
+  this->evaluate(dst, src);
+
+  return time_step_calculator_cfl.finish(src.get_mpi_communicator());
+}
+
 template<int dim, typename Number>
 void
 ConvectiveOperator<dim, Number>::reinit_cell(unsigned int const cell) const
@@ -109,6 +128,9 @@ ConvectiveOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) c
 {
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
+    if(time_step_calculator_cfl.is_active())
+      time_step_calculator_cfl.submit(kernel->get_velocity_cell(q), integrator.inverse_jacobian(q));
+
     if(operator_data.kernel_data.formulation == FormulationConvectiveTerm::DivergenceFormulation)
     {
       scalar value = integrator.get_value(q);
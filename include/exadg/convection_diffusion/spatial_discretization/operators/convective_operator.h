@@ -27,6 +27,7 @@
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/operator_base.h>
+#include <exadg/time_integration/time_step_calculation.h>
 
 namespace ExaDG
 {
@@ -521,6 +522,16 @@ public:
     return (velocity * gradient);
   }
 
+  /*
+   * Returns the numerical velocity field in quadrature point q of the current cell.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    vector
+    get_velocity_cell(unsigned int const q) const
+  {
+    return integrator_velocity->get_value(q);
+  }
+
 private:
   ConvectiveKernelData<dim> data;
 
@@ -576,6 +587,19 @@ public:
   void
   set_velocity_ptr(VectorType const & velocity) const;
 
+  /*
+   * Evaluates the operator and calculates the time step size according to the local CFL condition
+   * (CFL = 1.0) within the same cell loop, using the numerical velocity field in the quadrature
+   * points of the convective operator. The returned time step size is the minimum over all
+   * processors.
+   */
+  double
+  evaluate_and_calculate_time_step_cfl(VectorType &           dst,
+                                       VectorType const &     src,
+                                       unsigned int const     degree,
+                                       double const           exponent_fe_degree,
+                                       CFLConditionType const cfl_condition_type) const;
+
 private:
   void
   reinit_cell(unsigned int const cell) const;
@@ -617,6 +641,9 @@ private:
   ConvectiveOperatorData<dim> operator_data;
 
   std::shared_ptr<Operators::ConvectiveKernel<dim, Number>> kernel;
+
+  // time step calculation as a by-product of the operator evaluation
+  mutable TimeStepCalculatorCFL<dim, Number> time_step_calculator_cfl;
 };
 } // namespace ConvDiff
 } // namespace ExaDG
@@ -24,6 +24,7 @@
 
 #include <exadg/convection_diffusion/time_integration/time_int_bdf.h>
 #include <exadg/convection_diffusion/time_integration/time_int_explicit_runge_kutta.h>
+#include <exadg/convection_diffusion/time_integration/time_int_imex_runge_kutta.h>
 #include <exadg/convection_diffusion/user_interface/parameters.h>
 
 namespace ExaDG
@@ -53,10 +54,16 @@ create_time_integrator(std::shared_ptr<Operator<dim, Number>>          pde_opera
     time_integrator = std::make_shared<TimeIntBDF<dim, Number>>(
       pde_operator, parameters, mpi_comm, is_test, postprocessor);
   }
+  else if(parameters.temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    time_integrator = std::make_shared<TimeIntIMEXRK<dim, Number>>(
+      pde_operator, parameters, mpi_comm, is_test, postprocessor);
+  }
   else
   {
     AssertThrow(parameters.temporal_discretization == TemporalDiscretization::ExplRK ||
-                  parameters.temporal_discretization == TemporalDiscretization::BDF,
+                  parameters.temporal_discretization == TemporalDiscretization::BDF ||
+                  parameters.temporal_discretization == TemporalDiscretization::IMEXRK,
                 dealii::ExcMessage("Specified time integration scheme is not implemented!"));
   }
 
@@ -56,7 +56,9 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
     iterations({0, 0}),
     cfl_oif(param.cfl_oif / std::pow(2.0, refine_steps_time)),
     postprocessor(postprocessor_in),
-    vec_grid_coordinates(param_in.order_time_integrator)
+    vec_grid_coordinates(param_in.order_time_integrator),
+    time_step_cfl_np_available(false),
+    time_step_cfl_np(std::numeric_limits<double>::max())
 {
 }
 
@@ -384,11 +386,22 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
     AssertThrow(velocities[0] != nullptr,
                 dealii::ExcMessage("Pointer velocities[0] is not initialized."));
 
-    VectorType u_relative = *velocities[0];
-    if(param.ale_formulation == true)
-      u_relative -= grid_velocity;
-
-    new_time_step_size = pde_operator->calculate_time_step_cfl_numerical_velocity(u_relative);
+    if(time_step_cfl_np_available)
+    {
+      // velocities[0] has already been used to evaluate the convective term at the end of the
+      // last time step, which also provided the time step size
+      new_time_step_size         = time_step_cfl_np;
+      time_step_cfl_np_available = false;
+    }
+    else if(param.ale_formulation == true)
+    {
+      new_time_step_size =
+        pde_operator->calculate_time_step_cfl_numerical_velocity(*velocities[0], grid_velocity);
+    }
+    else
+    {
+      new_time_step_size = pde_operator->calculate_time_step_cfl_numerical_velocity(*velocities[0]);
+    }
     new_time_step_size *= cfl;
   }
 
@@ -632,10 +645,20 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
     {
       if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
       {
-        pde_operator->evaluate_convective_term(convective_term_np,
-                                               solution_np,
-                                               this->get_next_time(),
-                                               &velocity_np);
+        if(this->adaptive_time_stepping && param.analytical_velocity_field == false)
+        {
+          // velocity_np is a copy of velocities[0] used by recalculate_time_step_size()
+          time_step_cfl_np = pde_operator->evaluate_convective_term_and_calculate_time_step_cfl(
+            convective_term_np, solution_np, this->get_next_time(), velocity_np);
+          time_step_cfl_np_available = true;
+        }
+        else
+        {
+          pde_operator->evaluate_convective_term(convective_term_np,
+                                                 solution_np,
+                                                 this->get_next_time(),
+                                                 &velocity_np);
+        }
       }
       else
       {
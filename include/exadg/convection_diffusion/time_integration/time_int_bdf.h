@@ -173,6 +173,11 @@ private:
   VectorType              grid_velocity;
   std::vector<VectorType> vec_grid_coordinates;
   VectorType              grid_coordinates_np;
+
+  // time step size according to local CFL criterion (CFL = 1) calculated as a by-product of the
+  // evaluation of the convective term at the end of the time step
+  mutable bool   time_step_cfl_np_available;
+  mutable double time_step_cfl_np;
 };
 
 } // namespace ConvDiff
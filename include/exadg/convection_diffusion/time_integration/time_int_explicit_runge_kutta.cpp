@@ -23,6 +23,8 @@
 #include <exadg/convection_diffusion/spatial_discretization/interface.h>
 #include <exadg/convection_diffusion/time_integration/time_int_explicit_runge_kutta.h>
 #include <exadg/convection_diffusion/user_interface/parameters.h>
+#include <exadg/time_integration/embedded_runge_kutta.h>
+#include <exadg/time_integration/local_time_stepping.h>
 #include <exadg/time_integration/time_step_calculation.h>
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -31,6 +33,89 @@ namespace ExaDG
 {
 namespace ConvDiff
 {
+/*
+ * Creates the explicit Runge-Kutta method of the given type for an operator providing the
+ * functions evaluate() and initialize_dof_vector().
+ */
+template<typename Operator, typename VectorType>
+std::shared_ptr<ExplicitTimeIntegrator<Operator, VectorType>>
+create_explicit_runge_kutta_integrator(TimeIntegratorRK const          type,
+                                       std::shared_ptr<Operator> const underlying_operator)
+{
+  std::shared_ptr<ExplicitTimeIntegrator<Operator, VectorType>> time_integrator;
+
+  if(type == TimeIntegratorRK::ExplRK1Stage1)
+  {
+    time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(
+        1, underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK2Stage2)
+  {
+    time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(
+        2, underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK3Stage3)
+  {
+    time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(
+        3, underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK4Stage4)
+  {
+    time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(
+        4, underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK3Stage4Reg2C)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRK3Stage4Reg2C<Operator, VectorType>>(underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK4Stage5Reg2C)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRK4Stage5Reg2C<Operator, VectorType>>(underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK4Stage5Reg3C)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRK4Stage5Reg3C<Operator, VectorType>>(underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK5Stage9Reg2S)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRK5Stage9Reg2S<Operator, VectorType>>(underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK3Stage7Reg2)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRKTD<Operator, VectorType>>(underlying_operator, 3, 7);
+  }
+  else if(type == TimeIntegratorRK::ExplRK4Stage8Reg2)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRKTD<Operator, VectorType>>(underlying_operator, 4, 8);
+  }
+  else if(type == TimeIntegratorRK::ExplRK3Stage4Embedded)
+  {
+    time_integrator =
+      std::make_shared<EmbeddedRK3Stage4BS<Operator, VectorType>>(underlying_operator);
+  }
+  else if(type == TimeIntegratorRK::ExplRK5Stage7Embedded)
+  {
+    time_integrator =
+      std::make_shared<EmbeddedRK5Stage7DP<Operator, VectorType>>(underlying_operator);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+
+  return time_integrator;
+}
+
 template<typename Number>
 TimeIntExplRK<Number>::TimeIntExplRK(
   std::shared_ptr<Interface::Operator<Number>>    operator_in,
@@ -49,6 +134,8 @@ TimeIntExplRK<Number>::TimeIntExplRK(
     param(param_in),
     refine_steps_time(param_in.n_refine_time),
     time_step_diff(1.0),
+    time_step_error_control(1.0),
+    n_rejected_steps(0),
     cfl(param.cfl / std::pow(2.0, refine_steps_time)),
     diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time)),
     postprocessor(postprocessor_in)
@@ -112,6 +199,15 @@ TimeIntExplRK<Number>::calculate_time_step_size()
     print_parameter(this->pcout, "CFL", cfl);
     print_parameter(this->pcout, "Time step size (CFL global)", time_step_conv);
 
+    // local time stepping: the global CFL condition applies to the finest level
+    if(param.use_local_time_stepping)
+    {
+      time_step_conv *= std::pow(2.0, param.n_time_step_levels - 1);
+
+      print_parameter(this->pcout, "Time step levels", param.n_time_step_levels);
+      print_parameter(this->pcout, "Time step size (coarsest level)", time_step_conv);
+    }
+
     // adaptive time stepping
     if(this->adaptive_time_stepping)
     {
@@ -213,6 +309,17 @@ template<typename Number>
 double
 TimeIntExplRK<Number>::recalculate_time_step_size() const
 {
+  if(param.use_error_controlled_time_stepping())
+  {
+    // step size proposed by the controller, bounded by the maximum time step size and chosen such
+    // that the end time is not exceeded
+    double new_time_step_size = std::min(time_step_error_control, param.time_step_size_max);
+    if(this->end_time - this->get_time() > 0.0)
+      new_time_step_size = std::min(new_time_step_size, this->end_time - this->get_time());
+
+    return new_time_step_size;
+  }
+
   AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::CFL ||
                 param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
               dealii::ExcMessage(
@@ -266,67 +373,35 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   expl_rk_operator =
     std::make_shared<OperatorExplRK<Number>>(pde_operator, numerical_velocity_field);
 
-  if(param.time_integrator_rk == TimeIntegratorRK::ExplRK1Stage1)
-  {
-    rk_time_integrator =
-      std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorExplRK<Number>, VectorType>>(
-        1, expl_rk_operator);
-  }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK2Stage2)
+  if(param.use_local_time_stepping)
   {
-    rk_time_integrator =
-      std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorExplRK<Number>, VectorType>>(
-        2, expl_rk_operator);
-  }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK3Stage3)
-  {
-    rk_time_integrator =
-      std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorExplRK<Number>, VectorType>>(
-        3, expl_rk_operator);
-  }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK4Stage4)
-  {
-    rk_time_integrator =
-      std::make_shared<ExplicitRungeKuttaTimeIntegrator<OperatorExplRK<Number>, VectorType>>(
-        4, expl_rk_operator);
+    typedef LocalTimeSteppingIntegrator<OperatorExplRK<Number>, VectorType> LTS;
+    typedef typename LTS::LevelOperator                                   LevelOperator;
+
+    rk_time_integrator = std::make_shared<LTS>(
+      expl_rk_operator, [&](std::shared_ptr<LevelOperator> const level_operator) {
+        return create_explicit_runge_kutta_integrator<LevelOperator, VectorType>(
+          param.time_integrator_rk, level_operator);
+      });
   }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK3Stage4Reg2C)
-  {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK3Stage4Reg2C<OperatorExplRK<Number>, VectorType>>(
-        expl_rk_operator);
-  }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg2C)
-  {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK4Stage5Reg2C<OperatorExplRK<Number>, VectorType>>(
-        expl_rk_operator);
-  }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg3C)
-  {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK4Stage5Reg3C<OperatorExplRK<Number>, VectorType>>(
-        expl_rk_operator);
-  }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK5Stage9Reg2S)
-  {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK5Stage9Reg2S<OperatorExplRK<Number>, VectorType>>(
-        expl_rk_operator);
-  }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK3Stage7Reg2)
-  {
-    rk_time_integrator =
-      std::make_shared<LowStorageRKTD<OperatorExplRK<Number>, VectorType>>(expl_rk_operator, 3, 7);
-  }
-  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK4Stage8Reg2)
+  else
   {
     rk_time_integrator =
-      std::make_shared<LowStorageRKTD<OperatorExplRK<Number>, VectorType>>(expl_rk_operator, 4, 8);
+      create_explicit_runge_kutta_integrator<OperatorExplRK<Number>, VectorType>(
+        param.time_integrator_rk, expl_rk_operator);
   }
-  else
+
+  if(param.use_error_controlled_time_stepping())
   {
-    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+    typedef EmbeddedRungeKuttaTimeIntegrator<OperatorExplRK<Number>, VectorType> EmbeddedRK;
+
+    embedded_rk_time_integrator = std::dynamic_pointer_cast<EmbeddedRK>(rk_time_integrator);
+
+    AssertThrow(embedded_rk_time_integrator.get() != nullptr,
+                dealii::ExcMessage("Error control requires an embedded Runge-Kutta method."));
+
+    step_size_controller =
+      std::make_shared<PIStepSizeController>(embedded_rk_time_integrator->get_order_embedded());
   }
 }
 
@@ -354,15 +429,39 @@ TimeIntExplRK<Number>::do_timestep_solve()
     }
   }
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  unsigned int n_rejected = 0;
+  if(param.use_error_controlled_time_stepping())
+  {
+    // the time step size is reduced in case of rejected steps
+    n_rejected = solve_timestep_error_controlled(*embedded_rk_time_integrator,
+                                                 *step_size_controller,
+                                                 this->solution_np,
+                                                 this->solution_n,
+                                                 this->time,
+                                                 this->time_step,
+                                                 time_step_error_control,
+                                                 param.adaptive_time_stepping_abs_tolerance,
+                                                 param.adaptive_time_stepping_rel_tolerance);
+    n_rejected_steps += n_rejected;
+  }
+  else
+  {
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+  }
 
   if(print_solver_info() and not(this->is_test))
   {
     this->pcout << std::endl << "Solve scalar convection-diffusion equation explicitly:";
     print_wall_time(this->pcout, timer.wall_time());
+
+    if(param.use_error_controlled_time_stepping())
+    {
+      this->pcout << "  Rejected steps (current / total): " << n_rejected << " / "
+                  << n_rejected_steps << std::endl;
+    }
   }
 
   this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
@@ -27,6 +27,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/time_integration/embedded_runge_kutta.h>
 #include <exadg/time_integration/explicit_runge_kutta.h>
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
 
@@ -99,6 +100,11 @@ private:
 
   std::shared_ptr<ExplicitTimeIntegrator<OperatorExplRK<Number>, VectorType>> rk_time_integrator;
 
+  // error-controlled adaptive time stepping
+  std::shared_ptr<EmbeddedRungeKuttaTimeIntegrator<OperatorExplRK<Number>, VectorType>>
+                                        embedded_rk_time_integrator;
+  std::shared_ptr<PIStepSizeController> step_size_controller;
+
   Parameters const & param;
 
   unsigned int const refine_steps_time;
@@ -110,6 +116,11 @@ private:
   // recomputed in case of adaptive time stepping
   double time_step_diff;
 
+  // time step size proposed by the step size controller for the next time step
+  double time_step_error_control;
+
+  unsigned int n_rejected_steps;
+
   double const cfl;
   double const diffusion_number;
 
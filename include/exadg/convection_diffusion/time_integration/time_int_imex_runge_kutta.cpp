@@ -0,0 +1,373 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// deal.II
+#include <deal.II/base/timer.h>
+
+// ExaDG
+#include <exadg/convection_diffusion/postprocessor/postprocessor_base.h>
+#include <exadg/convection_diffusion/spatial_discretization/operator.h>
+#include <exadg/convection_diffusion/time_integration/time_int_imex_runge_kutta.h>
+#include <exadg/convection_diffusion/user_interface/parameters.h>
+#include <exadg/time_integration/interpolate.h>
+#include <exadg/time_integration/time_step_calculation.h>
+#include <exadg/utilities/print_functions.h>
+#include <exadg/utilities/print_solver_results.h>
+
+namespace ExaDG
+{
+namespace ConvDiff
+{
+template<int dim, typename Number>
+TimeIntIMEXRK<dim, Number>::TimeIntIMEXRK(
+  std::shared_ptr<Operator<dim, Number>>          operator_in,
+  Parameters const &                              param_in,
+  MPI_Comm const &                                mpi_comm_in,
+  bool const                                      is_test_in,
+  std::shared_ptr<PostProcessorInterface<Number>> postprocessor_in)
+  : TimeIntExplRKBase<Number>(param_in.start_time,
+                              param_in.end_time,
+                              param_in.max_number_of_time_steps,
+                              param_in.restart_data,
+                              param_in.adaptive_time_stepping,
+                              mpi_comm_in,
+                              is_test_in),
+    pde_operator(operator_in),
+    param(param_in),
+    tableau(param_in.time_integrator_imex_rk),
+    refine_steps_time(param_in.n_refine_time),
+    cfl(param.cfl / std::pow(2.0, refine_steps_time)),
+    iterations({0, 0}),
+    postprocessor(postprocessor_in)
+{
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::set_velocities_and_times(
+  std::vector<VectorType const *> const & velocities_in,
+  std::vector<double> const &             times_in)
+{
+  velocities = velocities_in;
+  times      = times_in;
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::extrapolate_solution(VectorType & vector)
+{
+  vector.equ(1.0, this->solution_n);
+}
+
+template<int dim, typename Number>
+double
+TimeIntIMEXRK<dim, Number>::get_scaling_factor_time_derivative_term() const
+{
+  return 1.0 / (tableau.get_gamma() * this->get_time_step_size());
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::print_iterations() const
+{
+  std::vector<std::string> names = {"Linear system (per stage)"};
+
+  std::vector<double> iterations_avg;
+  iterations_avg.resize(1);
+  iterations_avg[0] = (double)iterations.second / std::max(1., (double)iterations.first);
+
+  print_list_of_iterations(this->pcout, names, iterations_avg);
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::initialize_vectors()
+{
+  pde_operator->initialize_dof_vector(this->solution_n);
+  pde_operator->initialize_dof_vector(this->solution_np);
+
+  // the terms of the last stage are never needed since the schemes are stiffly accurate
+  unsigned int const n_previous_stages = tableau.get_n_stages() - 1;
+
+  if(param.convective_problem())
+  {
+    vec_convective_term.resize(n_previous_stages);
+    for(auto & vec : vec_convective_term)
+      pde_operator->initialize_dof_vector(vec);
+
+    if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+      pde_operator->initialize_dof_vector_velocity(velocity);
+  }
+
+  // the implicit term of the first stage is never needed (vanishing first column of implicit
+  // Butcher tableau)
+  vec_implicit_term.resize(n_previous_stages);
+  for(unsigned int i = 1; i < n_previous_stages; ++i)
+    pde_operator->initialize_dof_vector(vec_implicit_term[i]);
+
+  pde_operator->initialize_dof_vector(stage_solution);
+  pde_operator->initialize_dof_vector(sum_stage_terms);
+  pde_operator->initialize_dof_vector(rhs_vector);
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::initialize_solution()
+{
+  pde_operator->prescribe_initial_conditions(this->solution_n, this->time);
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::initialize_time_integrator()
+{
+  // nothing to do, the Butcher tableau is set up in the constructor
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::calculate_time_step_size()
+{
+  if(param.calculation_of_time_step_size == TimeStepCalculation::UserSpecified)
+  {
+    this->time_step = calculate_const_time_step(param.time_step_size, refine_steps_time);
+
+    this->pcout << std::endl
+                << "Calculation of time step size (user-specified):" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "time step size", this->time_step);
+  }
+  else if(param.calculation_of_time_step_size == TimeStepCalculation::CFL)
+  {
+    double time_step_conv = pde_operator->calculate_time_step_cfl_global(this->get_time());
+    time_step_conv *= cfl;
+
+    this->pcout << std::endl
+                << "Calculation of time step size according to CFL condition:" << std::endl
+                << std::endl;
+    print_parameter(this->pcout, "CFL", cfl);
+    print_parameter(this->pcout, "Time step size (CFL global)", time_step_conv);
+
+    // adaptive time stepping
+    if(this->adaptive_time_stepping)
+    {
+      double time_step_adap = std::numeric_limits<double>::max();
+
+      if(param.analytical_velocity_field)
+      {
+        time_step_adap =
+          pde_operator->calculate_time_step_cfl_analytical_velocity(this->get_time());
+        time_step_adap *= cfl;
+      }
+
+      // use adaptive time step size only if it is smaller, otherwise use global time step size
+      time_step_conv = std::min(time_step_conv, time_step_adap);
+
+      // make sure that the maximum allowable time step size is not exceeded
+      time_step_conv = std::min(time_step_conv, param.time_step_size_max);
+
+      print_parameter(this->pcout, "Time step size (CFL adaptive)", time_step_conv);
+    }
+    else
+    {
+      time_step_conv =
+        adjust_time_step_to_hit_end_time(this->start_time, this->end_time, time_step_conv);
+
+      this->pcout << std::endl
+                  << "Adjust time step size to hit end time:" << std::endl
+                  << std::endl;
+      print_parameter(this->pcout, "Time step size", time_step_conv);
+    }
+
+    this->time_step = time_step_conv;
+  }
+  else
+  {
+    AssertThrow(false,
+                dealii::ExcMessage("Specified type of time step calculation is not implemented."));
+  }
+}
+
+template<int dim, typename Number>
+double
+TimeIntIMEXRK<dim, Number>::recalculate_time_step_size() const
+{
+  AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::CFL,
+              dealii::ExcMessage(
+                "Adaptive time step is not implemented for this type of time step calculation."));
+
+  double new_time_step_size = std::numeric_limits<double>::max();
+  if(param.analytical_velocity_field)
+  {
+    new_time_step_size =
+      pde_operator->calculate_time_step_cfl_analytical_velocity(this->get_time());
+    new_time_step_size *= cfl;
+  }
+  else
+  {
+    AssertThrow(velocities[0] != nullptr,
+                dealii::ExcMessage("Pointer velocities[0] is not initialized."));
+
+    new_time_step_size = pde_operator->calculate_time_step_cfl_numerical_velocity(*velocities[0]);
+    new_time_step_size *= cfl;
+  }
+
+  // make sure that time step size does not exceed maximum allowable time step size
+  new_time_step_size = std::min(new_time_step_size, param.time_step_size_max);
+
+  double last_time_step_size = this->get_time_step_size();
+  double factor              = param.adaptive_time_stepping_limiting_factor;
+  limit_time_step_change(new_time_step_size, last_time_step_size, factor);
+
+  return new_time_step_size;
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::evaluate_convective_term(VectorType &       dst,
+                                                     VectorType const & src,
+                                                     double const       time) const
+{
+  if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+  {
+    if(param.analytical_velocity_field)
+      pde_operator->project_velocity(velocity, time);
+    else
+      interpolate(velocity, time, velocities, times);
+
+    pde_operator->evaluate_convective_term(dst, src, time, &velocity);
+  }
+  else
+  {
+    pde_operator->evaluate_convective_term(dst, src, time);
+  }
+}
+
+template<int dim, typename Number>
+bool
+TimeIntIMEXRK<dim, Number>::print_solver_info() const
+{
+  return param.solver_info_data.write(this->global_timer.wall_time(),
+                                      this->time,
+                                      this->time_step_number);
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::do_timestep_solve()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  double const       dt             = this->get_time_step_size();
+  double const       scaling_factor = get_scaling_factor_time_derivative_term();
+  unsigned int const n_stages       = tableau.get_n_stages();
+
+  bool const convective_problem = param.convective_problem();
+
+  // first stage is explicit, U_0 = u_n
+  if(convective_problem)
+    evaluate_convective_term(vec_convective_term[0], this->solution_n, this->time);
+
+  // the solution of the previous stage serves as initial guess
+  stage_solution = this->solution_n;
+
+  unsigned int N_iter_total = 0;
+
+  for(unsigned int i = 1; i < n_stages; ++i)
+  {
+    double const stage_time = this->time + tableau.get_c(i) * dt;
+
+    // sum_stage_terms = M * u_n + dt * sum_{j<i} ( - a_expl(i,j) * C(U_j) + a_impl(i,j) * I(U_j) )
+    pde_operator->apply_mass_operator(sum_stage_terms, this->solution_n);
+    for(unsigned int j = 0; j < i; ++j)
+    {
+      if(convective_problem)
+        sum_stage_terms.add(-dt * tableau.get_a_expl(i, j), vec_convective_term[j]);
+
+      if(j > 0)
+        sum_stage_terms.add(dt * tableau.get_a_impl(i, j), vec_implicit_term[j]);
+    }
+
+    // rhs-vector f and inhomogeneous boundary face integrals of diffusive term at stage time
+    pde_operator->rhs(rhs_vector, stage_time);
+    rhs_vector.add(scaling_factor, sum_stage_terms);
+
+    // The preconditioner is updated at most once per time step since all implicit stages share
+    // the same operator.
+    bool const update_preconditioner =
+      i == 1 && param.update_preconditioner &&
+      (this->time_step_number % param.update_preconditioner_every_time_steps == 0);
+
+    unsigned int const N_iter = pde_operator->solve(
+      stage_solution, rhs_vector, update_preconditioner, scaling_factor, stage_time);
+
+    iterations.first += 1;
+    iterations.second += N_iter;
+    N_iter_total += N_iter;
+
+    if(i < n_stages - 1)
+    {
+      // I(U_i) = - K * U_i + r(t_i) = (M * U_i - sum_stage_terms) / (gamma * dt), which avoids
+      // an additional evaluation of the diffusive operator
+      pde_operator->apply_mass_operator(vec_implicit_term[i], stage_solution);
+      vec_implicit_term[i].add(-1.0, sum_stage_terms);
+      vec_implicit_term[i] *= scaling_factor;
+
+      if(convective_problem)
+        evaluate_convective_term(vec_convective_term[i], stage_solution, stage_time);
+    }
+  }
+
+  // the schemes are stiffly accurate
+  this->solution_np = stage_solution;
+
+  if(print_solver_info() and not(this->is_test))
+  {
+    this->pcout << std::endl << "Solve scalar convection-diffusion equation (IMEX):";
+    print_solver_info_linear(this->pcout, N_iter_total, timer.wall_time());
+  }
+
+  this->timer_tree->insert({"Timeloop", "Solve"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+TimeIntIMEXRK<dim, Number>::postprocessing() const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  postprocessor->do_postprocessing(this->solution_n, this->time, this->time_step_number);
+
+  this->timer_tree->insert({"Timeloop", "Postprocessing"}, timer.wall_time());
+}
+
+// instantiations
+
+template class TimeIntIMEXRK<2, float>;
+template class TimeIntIMEXRK<2, double>;
+
+template class TimeIntIMEXRK<3, float>;
+template class TimeIntIMEXRK<3, double>;
+
+} // namespace ConvDiff
+} // namespace ExaDG
@@ -0,0 +1,147 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_CONVECTION_DIFFUSION_TIME_INT_IMEX_RUNGE_KUTTA_H_
+#define INCLUDE_CONVECTION_DIFFUSION_TIME_INT_IMEX_RUNGE_KUTTA_H_
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/imex_runge_kutta.h>
+#include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
+
+namespace ExaDG
+{
+namespace ConvDiff
+{
+// forward declarations
+class Parameters;
+
+template<int dim, typename Number>
+class Operator;
+
+template<typename Number>
+class PostProcessorInterface;
+
+/*
+ * Additive implicit-explicit Runge-Kutta time integration: the convective term is treated
+ * explicitly and the diffusive term implicitly. Each implicit stage solves a linear system of
+ * equations with the operator (M / (gamma * dt) + K) of mass matrix M and diffusive operator K,
+ * which is symmetric positive definite, so that the iterative solver and preconditioner
+ * (e.g. CG with multigrid) set up for BDF time integration with explicit convective term can be
+ * used. The time step size is limited by the CFL condition only.
+ */
+template<int dim, typename Number>
+class TimeIntIMEXRK : public TimeIntExplRKBase<Number>
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  TimeIntIMEXRK(std::shared_ptr<Operator<dim, Number>>          operator_in,
+                Parameters const &                              param_in,
+                MPI_Comm const &                                mpi_comm_in,
+                bool const                                      is_test_in,
+                std::shared_ptr<PostProcessorInterface<Number>> postprocessor_in);
+
+  void
+  set_velocities_and_times(std::vector<VectorType const *> const & velocities_in,
+                           std::vector<double> const &             times_in);
+
+  void
+  extrapolate_solution(VectorType & vector);
+
+  /*
+   * Scaling factor of the mass operator in the linear systems of equations solved in the
+   * implicit stages.
+   */
+  double
+  get_scaling_factor_time_derivative_term() const;
+
+  void
+  print_iterations() const;
+
+private:
+  void
+  initialize_vectors();
+
+  void
+  initialize_solution();
+
+  void
+  postprocessing() const;
+
+  bool
+  print_solver_info() const;
+
+  void
+  do_timestep_solve() final;
+
+  void
+  calculate_time_step_size();
+
+  double
+  recalculate_time_step_size() const;
+
+  void
+  initialize_time_integrator();
+
+  /*
+   * Evaluates the convective term (without the minus sign of the right-hand side) at the given
+   * time.
+   */
+  void
+  evaluate_convective_term(VectorType & dst, VectorType const & src, double const time) const;
+
+  std::shared_ptr<Operator<dim, Number>> pde_operator;
+
+  Parameters const & param;
+
+  IMEXRungeKuttaTableau const tableau;
+
+  unsigned int const refine_steps_time;
+
+  double const cfl;
+
+  // convective and implicit terms of previous stages
+  std::vector<VectorType> vec_convective_term;
+  std::vector<VectorType> vec_implicit_term;
+
+  // solution of current stage and the sum of mass-weighted known stage contributions
+  VectorType stage_solution;
+  VectorType sum_stage_terms;
+  VectorType rhs_vector;
+
+  // numerical velocity field
+  std::vector<VectorType const *> velocities;
+  std::vector<double>             times;
+  VectorType mutable velocity;
+
+  // iteration counts
+  std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations;
+
+  std::shared_ptr<PostProcessorInterface<Number>> postprocessor;
+};
+
+} // namespace ConvDiff
+} // namespace ExaDG
+
+#endif /* INCLUDE_CONVECTION_DIFFUSION_TIME_INT_IMEX_RUNGE_KUTTA_H_ */
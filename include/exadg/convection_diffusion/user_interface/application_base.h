@@ -79,6 +79,16 @@ public:
     this->param.n_refine_time        = refine_time;
   }
 
+  /*
+   * Output to pcout is written on the first process of the communicator if print_output is true
+   * (default), e.g., to print on one time slab only for parallel-in-time simulations.
+   */
+  void
+  set_print_output(bool const print_output)
+  {
+    pcout.set_condition(print_output and dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
   void
   setup()
   {
@@ -140,6 +140,9 @@ enum_to_string(TemporalDiscretization const enum_type)
     case TemporalDiscretization::BDF:
       string_type = "BDF";
       break;
+    case TemporalDiscretization::IMEXRK:
+      string_type = "IMEXRK";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
@@ -215,6 +218,12 @@ enum_to_string(TimeIntegratorRK const enum_type)
     case TimeIntegratorRK::ExplRK5Stage9Reg2S:
       string_type = "ExplRK5Stage9Reg2S";
       break;
+    case TimeIntegratorRK::ExplRK3Stage4Embedded:
+      string_type = "ExplRK3Stage4Embedded";
+      break;
+    case TimeIntegratorRK::ExplRK5Stage7Embedded:
+      string_type = "ExplRK5Stage7Embedded";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
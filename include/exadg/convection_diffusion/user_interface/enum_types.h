@@ -107,12 +107,15 @@ enum_to_string(FormulationConvectiveTerm const enum_type);
  *  Temporal discretization method:
  *  ExplRK: Explicit Runge-Kutta methods (implemented for orders 1-4)
  *  BDF: backward differentiation formulae (implemented for order 1-3)
+ *  IMEXRK: additive implicit-explicit Runge-Kutta methods (explicit convective term,
+ *          implicit diffusive term)
  */
 enum class TemporalDiscretization
 {
   Undefined,
   ExplRK,
-  BDF
+  BDF,
+  IMEXRK
 };
 
 std::string
@@ -150,7 +153,9 @@ enum class TimeIntegratorRK
   ExplRK4Stage5Reg2C,
   ExplRK4Stage8Reg2, // optimized for maximum time step sizes in DG context
   ExplRK4Stage5Reg3C,
-  ExplRK5Stage9Reg2S
+  ExplRK5Stage9Reg2S,
+  ExplRK3Stage4Embedded, // Bogacki-Shampine 3(2), embedded error estimator
+  ExplRK5Stage7Embedded  // Dormand-Prince 5(4), embedded error estimator
 };
 
 std::string
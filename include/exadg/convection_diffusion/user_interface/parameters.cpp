@@ -44,6 +44,7 @@ Parameters::Parameters()
     // TEMPORAL DISCRETIZATION
     temporal_discretization(TemporalDiscretization::Undefined),
     time_integrator_rk(TimeIntegratorRK::Undefined),
+    time_integrator_imex_rk(IMEXRKType::ARS222),
     order_time_integrator(1),
     start_with_low_order(true),
     treatment_of_convective_term(TreatmentOfConvectiveTerm::Undefined),
@@ -52,6 +53,10 @@ Parameters::Parameters()
     adaptive_time_stepping_limiting_factor(1.2),
     time_step_size_max(std::numeric_limits<double>::max()),
     adaptive_time_stepping_cfl_type(CFLConditionType::VelocityNorm),
+    adaptive_time_stepping_abs_tolerance(1.e-6),
+    adaptive_time_stepping_rel_tolerance(1.e-6),
+    use_local_time_stepping(false),
+    n_time_step_levels(1),
     time_step_size(-1.),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
     n_refine_time(0),
@@ -88,6 +93,7 @@ Parameters::Parameters()
 
     // NUMERICAL PARAMETERS
     use_cell_based_face_loops(false),
+    use_cell_batching_by_conditioning(false),
     use_combined_operator(true),
     store_analytical_velocity_in_dof_vector(false),
     use_overintegration(false)
@@ -185,6 +191,30 @@ Parameters::check() const
                   dealii::ExcMessage("parameter must be defined"));
     }
 
+    if(temporal_discretization == TemporalDiscretization::IMEXRK)
+    {
+      AssertThrow(diffusive_problem(),
+                  dealii::ExcMessage(
+                    "IMEX Runge-Kutta time integration requires a diffusive term."));
+
+      if(convective_problem())
+      {
+        AssertThrow(
+          treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit,
+          dealii::ExcMessage(
+            "IMEX Runge-Kutta time integration requires an explicit treatment of the convective term."));
+      }
+
+      AssertThrow(
+        calculation_of_time_step_size == TimeStepCalculation::UserSpecified ||
+          calculation_of_time_step_size == TimeStepCalculation::CFL,
+        dealii::ExcMessage(
+          "IMEX Runge-Kutta time integration only supports a user-specified time step size or the CFL condition."));
+
+      if(calculation_of_time_step_size == TimeStepCalculation::CFL)
+        AssertThrow(cfl > 0., dealii::ExcMessage("parameter must be defined"));
+    }
+
     AssertThrow(calculation_of_time_step_size != TimeStepCalculation::Undefined,
                 dealii::ExcMessage("parameter must be defined"));
 
@@ -220,7 +250,7 @@ Parameters::check() const
           "Type of time step calculation CFLAndDiffusion does not make sense for the specified equation type."));
     }
 
-    if(adaptive_time_stepping == true)
+    if(adaptive_time_stepping == true and not use_error_controlled_time_stepping())
     {
       AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL ||
                     calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
@@ -228,6 +258,13 @@ Parameters::check() const
                     "Adaptive time stepping can only be used in combination with CFL condition."));
     }
 
+    if(use_error_controlled_time_stepping())
+    {
+      AssertThrow(adaptive_time_stepping_abs_tolerance > 0.0 &&
+                    adaptive_time_stepping_rel_tolerance >= 0.0,
+                  dealii::ExcMessage("Invalid tolerances for error-controlled time stepping."));
+    }
+
     if(temporal_discretization == TemporalDiscretization::ExplRK)
     {
       AssertThrow(order_time_integrator >= 1 && order_time_integrator <= 4,
@@ -247,6 +284,24 @@ Parameters::check() const
       }
     }
 
+    if(use_local_time_stepping)
+    {
+      AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK,
+                  dealii::ExcMessage(
+                    "Local time stepping is only implemented for explicit Runge-Kutta methods."));
+
+      AssertThrow(n_time_step_levels >= 1, dealii::ExcMessage("parameter must be defined"));
+
+      AssertThrow(adaptive_time_stepping == false,
+                  dealii::ExcMessage(
+                    "Local time stepping can not be used in combination with adaptive time stepping."));
+
+      AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL ||
+                    calculation_of_time_step_size == TimeStepCalculation::UserSpecified,
+                  dealii::ExcMessage(
+                    "Local time stepping can only be used with a CFL-based or user-specified time step size."));
+    }
+
     if(temporal_discretization == TemporalDiscretization::BDF)
     {
       AssertThrow(order_time_integrator >= 1 && order_time_integrator <= 4,
@@ -277,7 +332,8 @@ Parameters::check() const
 
 
   // SOLVER
-  if(temporal_discretization == TemporalDiscretization::BDF)
+  if(temporal_discretization == TemporalDiscretization::BDF ||
+     temporal_discretization == TemporalDiscretization::IMEXRK)
   {
     AssertThrow(solver != Solver::Undefined, dealii::ExcMessage("parameter must be defined"));
 
@@ -336,6 +392,15 @@ Parameters::check() const
   }
 
   // NUMERICAL PARAMETERS
+  if(use_local_time_stepping)
+  {
+    AssertThrow(use_combined_operator == true,
+                dealii::ExcMessage("Local time stepping requires the combined operator."));
+
+    AssertThrow(use_cell_based_face_loops == false,
+                dealii::ExcMessage(
+                  "Local time stepping can not be used with cell-based face loops."));
+  }
 }
 
 bool
@@ -372,12 +437,23 @@ bool
 Parameters::linear_system_has_to_be_solved() const
 {
   bool linear_solver_needed =
-    problem_type == ProblemType::Steady || (problem_type == ProblemType::Unsteady &&
-                                            temporal_discretization == TemporalDiscretization::BDF);
+    problem_type == ProblemType::Steady ||
+    (problem_type == ProblemType::Unsteady &&
+     (temporal_discretization == TemporalDiscretization::BDF ||
+      temporal_discretization == TemporalDiscretization::IMEXRK));
 
   return linear_solver_needed;
 }
 
+bool
+Parameters::use_error_controlled_time_stepping() const
+{
+  return problem_type == ProblemType::Unsteady &&
+         temporal_discretization == TemporalDiscretization::ExplRK && adaptive_time_stepping &&
+         (time_integrator_rk == TimeIntegratorRK::ExplRK3Stage4Embedded ||
+          time_integrator_rk == TimeIntegratorRK::ExplRK5Stage7Embedded);
+}
+
 TypeVelocityField
 Parameters::get_type_velocity_field() const
 {
@@ -464,6 +540,18 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "Explicit time integrator", enum_to_string(time_integrator_rk));
   }
 
+  if(temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    print_parameter(pcout, "IMEX time integrator", enum_to_string(time_integrator_imex_rk));
+
+    if(convective_problem())
+    {
+      print_parameter(pcout,
+                      "Treatment of convective term",
+                      enum_to_string(treatment_of_convective_term));
+    }
+  }
+
   print_parameter(pcout, "Maximum number of time steps", max_number_of_time_steps);
 
   print_parameter(pcout, "Temporal refinements", n_refine_time);
@@ -490,7 +578,16 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
   print_parameter(pcout, "Adaptive time stepping", adaptive_time_stepping);
 
-  if(adaptive_time_stepping)
+  if(use_error_controlled_time_stepping())
+  {
+    print_parameter(pcout,
+                    "Absolute tolerance (error control)",
+                    adaptive_time_stepping_abs_tolerance);
+    print_parameter(pcout,
+                    "Relative tolerance (error control)",
+                    adaptive_time_stepping_rel_tolerance);
+  }
+  else if(adaptive_time_stepping)
   {
     print_parameter(pcout,
                     "Adaptive time stepping limiting factor",
@@ -503,6 +600,14 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
                     enum_to_string(adaptive_time_stepping_cfl_type));
   }
 
+  if(temporal_discretization == TemporalDiscretization::ExplRK)
+  {
+    print_parameter(pcout, "Local time stepping", use_local_time_stepping);
+
+    if(use_local_time_stepping)
+      print_parameter(pcout, "Number of time step levels", n_time_step_levels);
+  }
+
 
   // here we do not print quantities such as cfl, diffusion_number, time_step_size
   // because this is done by the time integration scheme (or the functions that
@@ -587,6 +692,9 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
 
   print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
 
+  if(use_cell_based_face_loops)
+    print_parameter(pcout, "Cell batching by conditioning", use_cell_batching_by_conditioning);
+
   if(temporal_discretization == TemporalDiscretization::ExplRK)
     print_parameter(pcout, "Use combined operator", use_combined_operator);
 
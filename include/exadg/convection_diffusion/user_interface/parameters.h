@@ -63,6 +63,11 @@ public:
   bool
   linear_system_has_to_be_solved() const;
 
+  // adaptive time stepping based on the embedded error estimator of the explicit Runge-Kutta
+  // method (instead of the CFL condition)
+  bool
+  use_error_controlled_time_stepping() const;
+
   TypeVelocityField
   get_type_velocity_field() const;
 
@@ -143,6 +148,9 @@ public:
   // description: see enum declaration (only relevant for explicit time integration)
   TimeIntegratorRK time_integrator_rk;
 
+  // description: see enum declaration (only relevant for IMEX Runge-Kutta time integration)
+  IMEXRKType time_integrator_imex_rk;
+
   // order of time integration scheme (only relevant for BDF time integration)
   unsigned int order_time_integrator;
 
@@ -151,7 +159,8 @@ public:
 
   // description: see enum declaration (this parameter is ignored for steady problems or
   // unsteady problems with explicit Runge-Kutta time integration scheme). In case of
-  // a purely diffusive problem, one also does not have to specify this parameter.
+  // a purely diffusive problem, one also does not have to specify this parameter. IMEX
+  // Runge-Kutta time integration requires an explicit treatment of the convective term.
   TreatmentOfConvectiveTerm treatment_of_convective_term;
 
   // calculation of time step size
@@ -176,6 +185,24 @@ public:
   // criterion.
   CFLConditionType adaptive_time_stepping_cfl_type;
 
+  // Explicit Runge-Kutta methods with embedded error estimator (ExplRK3Stage4Embedded,
+  // ExplRK5Stage7Embedded): if adaptive_time_stepping is true, the time step size is controlled
+  // by a PI controller such that the estimated local error satisfies
+  // |error_i| <= abs_tolerance + rel_tolerance * |u_i| in the root-mean-square sense. Steps
+  // violating the tolerance are rejected and repeated. The time step size according to
+  // calculation_of_time_step_size is only used as the initial time step size.
+  double adaptive_time_stepping_abs_tolerance;
+  double adaptive_time_stepping_rel_tolerance;
+
+  // Local time stepping (only explicit Runge-Kutta time integration): cells are grouped into
+  // n_time_step_levels levels according to their size, and level l is advanced with time step
+  // size dt / 2^l where dt is the time step size of the coarsest level 0, see
+  // Categorization::get_time_step_levels(). In case of a CFL-based time step calculation, dt is
+  // chosen as 2^(n_time_step_levels-1) times the time step size of the global CFL condition.
+  bool use_local_time_stepping;
+
+  unsigned int n_time_step_levels;
+
   // user specified time step size:  note that this time_step_size is the first
   // in a series of time_step_size's when performing temporal convergence tests,
   // i.e., delta_t = time_step_size, time_step_size/2, ...
@@ -304,6 +331,12 @@ public:
   // can be changed to such an algorithm (cell_based_face_loops).
   bool use_cell_based_face_loops;
 
+  // Group cells of similar size and aspect ratio into the same cell batches (vectorization
+  // categories). This can reduce the cost of the matrix-free block Jacobi preconditioner, where
+  // the elementwise iterative solver of a cell batch iterates until all lanes have converged.
+  // Only relevant if cell-based face loops are used.
+  bool use_cell_batching_by_conditioning;
+
   // Evaluate convective term and diffusive term at once instead of implementing each
   // operator separately and subsequently looping over all operators. This parameter is
   // only relevant in case of fully explicit time stepping. In case of semi-implicit or
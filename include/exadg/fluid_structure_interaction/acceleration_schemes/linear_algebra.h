@@ -23,10 +23,14 @@
 #define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_LINEAR_ALGEBRA_H_
 
 // C/C++
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <vector>
 
 // deal.II
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
 
 namespace ExaDG
 {
@@ -77,27 +81,250 @@ private:
   std::vector<Number> data;
 };
 
+/*
+ * Contiguous block of columns, where each column holds the locally owned entries of a distributed
+ * vector of type VectorType. In contrast to a std::vector<VectorType>, no ghost entries and no
+ * data structures of the distributed vectors are stored, and the columns are contiguous in memory.
+ * Optionally, the columns are stored in single precision, e.g., for the history of previous time
+ * steps of quasi-Newton methods. Scalar products are computed over all processes of the
+ * communicator of the vectors.
+ *
+ * Optionally, the rows are restricted to a subset of the locally owned entries (given by their
+ * local indices), e.g., to the degrees of freedom at the fluid-structure interface, and the
+ * remaining entries of the vectors are ignored.
+ */
+template<typename VectorType>
+class ColumnBlock
+{
+public:
+  typedef typename VectorType::value_type Number;
+
+  ColumnBlock() : n_rows(0), n_cols(0), single_precision(false), mpi_comm(MPI_COMM_SELF)
+  {
+  }
+
+  /*
+   * Initializes an empty block for columns with the parallel layout of vector. If rows_in is
+   * given, the columns only hold the locally owned entries of vector with these local indices.
+   */
+  void
+  reinit(VectorType const &                                      vector,
+         bool const                                              single_precision_in = false,
+         std::shared_ptr<std::vector<unsigned int> const> const & rows_in            = nullptr)
+  {
+    rows             = rows_in;
+    n_rows           = rows ? rows->size() : vector.locally_owned_size();
+    n_cols           = 0;
+    single_precision = single_precision_in;
+    mpi_comm         = vector.get_mpi_communicator();
+    data_double.clear();
+    data_float.clear();
+  }
+
+  /*
+   * Initializes an empty block with the parallel layout of another block.
+   */
+  void
+  reinit(ColumnBlock const & other, bool const single_precision_in = false)
+  {
+    rows             = other.rows;
+    n_rows           = other.n_rows;
+    n_cols           = 0;
+    single_precision = single_precision_in;
+    mpi_comm         = other.mpi_comm;
+    data_double.clear();
+    data_float.clear();
+  }
+
+  unsigned int
+  n_columns() const
+  {
+    return n_cols;
+  }
+
+  /*
+   * Appends the column a - b.
+   */
+  void
+  push_back_difference(VectorType const & a, VectorType const & b)
+  {
+    resize(n_cols + 1);
+    apply([&](auto * data) {
+      auto * column = data + (n_cols - 1) * n_rows;
+      for(unsigned int i = 0; i < n_rows; ++i)
+        column[i] = a.local_element(row(i)) - b.local_element(row(i));
+    });
+  }
+
+  /*
+   * Appends all columns of other.
+   */
+  void
+  push_back(ColumnBlock const & other)
+  {
+    AssertThrow(other.n_rows == n_rows and other.rows == rows,
+                dealii::ExcMessage("Column blocks are incompatible."));
+
+    unsigned int const offset = n_cols;
+    resize(n_cols + other.n_cols);
+    apply([&](auto * data) {
+      other.apply([&](auto const * other_data) {
+        std::copy(other_data, other_data + other.n_cols * n_rows, data + offset * n_rows);
+      });
+    });
+  }
+
+  void
+  set_column_to_zero(unsigned int const j)
+  {
+    apply([&](auto * data) { std::fill(data + j * n_rows, data + (j + 1) * n_rows, 0); });
+  }
+
+  /*
+   * Returns the scalar product of columns i and j.
+   */
+  Number
+  dot(unsigned int const i, unsigned int const j) const
+  {
+    double sum = 0.0;
+    apply([&](auto const * data) {
+      for(unsigned int l = 0; l < n_rows; ++l)
+        sum += double(data[i * n_rows + l]) * double(data[j * n_rows + l]);
+    });
+    return Number(dealii::Utilities::MPI::sum(sum, mpi_comm));
+  }
+
+  /*
+   * Returns the scalar product of column j and vector.
+   */
+  Number
+  dot(unsigned int const j, VectorType const & vector) const
+  {
+    double sum = 0.0;
+    apply([&](auto const * data) {
+      for(unsigned int l = 0; l < n_rows; ++l)
+        sum += double(data[j * n_rows + l]) * double(vector.local_element(row(l)));
+    });
+    return Number(dealii::Utilities::MPI::sum(sum, mpi_comm));
+  }
+
+  Number
+  l2_norm(unsigned int const j) const
+  {
+    return std::sqrt(dot(j, j));
+  }
+
+  /*
+   * column i += factor * column j
+   */
+  void
+  add(unsigned int const i, Number const factor, unsigned int const j)
+  {
+    apply([&](auto * data) {
+      for(unsigned int l = 0; l < n_rows; ++l)
+        data[i * n_rows + l] += factor * data[j * n_rows + l];
+    });
+  }
+
+  void
+  scale(unsigned int const j, Number const factor)
+  {
+    apply([&](auto * data) {
+      for(unsigned int l = 0; l < n_rows; ++l)
+        data[j * n_rows + l] *= factor;
+    });
+  }
+
+  /*
+   * vector += factor * column j
+   */
+  void
+  add_to(VectorType & vector, Number const factor, unsigned int const j) const
+  {
+    apply([&](auto const * data) {
+      for(unsigned int l = 0; l < n_rows; ++l)
+        vector.local_element(row(l)) += factor * data[j * n_rows + l];
+    });
+  }
+
+private:
+  // local index of the vector entry stored in row l
+  unsigned int
+  row(unsigned int const l) const
+  {
+    return rows ? (*rows)[l] : l;
+  }
+
+  void
+  resize(unsigned int const n_cols_new)
+  {
+    n_cols = n_cols_new;
+    if(single_precision)
+      data_float.resize(n_cols * n_rows);
+    else
+      data_double.resize(n_cols * n_rows);
+  }
+
+  template<typename Function>
+  void
+  apply(Function const & function)
+  {
+    if(single_precision)
+      function(data_float.data());
+    else
+      function(data_double.data());
+  }
+
+  template<typename Function>
+  void
+  apply(Function const & function) const
+  {
+    if(single_precision)
+      function(data_float.data());
+    else
+      function(data_double.data());
+  }
+
+  // local indices of the vector entries stored in the rows (all locally owned entries if not set)
+  std::shared_ptr<std::vector<unsigned int> const> rows;
+
+  unsigned int n_rows;
+  unsigned int n_cols;
+
+  bool single_precision;
+
+  MPI_Comm mpi_comm;
+
+  // column-major storage
+  std::vector<double> data_double;
+  std::vector<float>  data_float;
+};
+
+/*
+ * Modified Gram-Schmidt orthogonalization of the columns of Q in place, Q = Q * R. Columns that
+ * are (almost) linearly dependent on the previous columns are set to zero (with R_ii = 1).
+ */
 template<typename VectorType, typename Number>
 void
-compute_QR_decomposition(std::vector<VectorType> & Q, Matrix<Number> & R, Number const eps = 1.e-2)
+compute_QR_decomposition(ColumnBlock<VectorType> & Q, Matrix<Number> & R, Number const eps = 1.e-2)
 {
-  for(unsigned int i = 0; i < Q.size(); ++i)
+  for(unsigned int i = 0; i < Q.n_columns(); ++i)
   {
-    Number const norm_initial = Number(Q[i].l2_norm());
+    Number const norm_initial = Number(Q.l2_norm(i));
 
     // orthogonalize
     for(unsigned int j = 0; j < i; ++j)
     {
-      Number r_ji = Q[j] * Q[i];
+      Number r_ji = Q.dot(j, i);
       R.set(r_ji, j, i);
-      Q[i].add(-r_ji, Q[j]);
+      Q.add(i, -r_ji, j);
     }
 
     // normalize or drop if linear dependent
-    Number r_ii = Number(Q[i].l2_norm());
+    Number r_ii = Number(Q.l2_norm(i));
     if(r_ii < eps * norm_initial)
     {
-      Q[i] = 0.0;
+      Q.set_column_to_zero(i);
       for(unsigned int j = 0; j < i; ++j)
         R.set(0.0, j, i);
       R.set(1.0, i, i);
@@ -105,7 +332,7 @@ compute_QR_decomposition(std::vector<VectorType> & Q, Matrix<Number> & R, Number
     else
     {
       R.set(r_ii, i, i);
-      Q[i] *= 1. / r_ii;
+      Q.scale(i, 1. / r_ii);
     }
   }
 }
@@ -133,33 +360,32 @@ backward_substitution(Matrix<Number> const &      matrix,
   }
 }
 
+/*
+ * Solves matrix * X = B for the columns of X, where B is given as input in X (in place).
+ */
 template<typename Number, typename VectorType>
 void
-backward_substitution_multiple_rhs(Matrix<Number> const &          matrix,
-                                   std::vector<VectorType> &       dst,
-                                   std::vector<VectorType> const & rhs)
+backward_substitution_multiple_rhs(Matrix<Number> const & matrix, ColumnBlock<VectorType> & X)
 {
-  int const n = dst.size();
+  int const n = X.n_columns();
 
   for(int i = n - 1; i >= 0; --i)
   {
-    VectorType value = rhs[i];
     for(int j = i + 1; j < n; ++j)
-    {
-      value.add(-matrix.get(i, j), dst[j]);
-    }
+      X.add(i, -matrix.get(i, j), j);
 
-    dst[i].equ(1.0 / matrix.get(i, i), value);
+    X.scale(i, 1.0 / matrix.get(i, i));
   }
 }
 
 template<typename VectorType>
 void
-inv_jacobian_times_residual(VectorType &                                                  b,
-                            std::vector<std::shared_ptr<std::vector<VectorType>>> const & D_history,
-                            std::vector<std::shared_ptr<std::vector<VectorType>>> const & R_history,
-                            std::vector<std::shared_ptr<std::vector<VectorType>>> const & Z_history,
-                            VectorType const &                                            residual)
+inv_jacobian_times_residual(
+  VectorType &                                                  b,
+  std::vector<std::shared_ptr<ColumnBlock<VectorType>>> const & D_history,
+  std::vector<std::shared_ptr<ColumnBlock<VectorType>>> const & R_history,
+  std::vector<std::shared_ptr<ColumnBlock<VectorType>>> const & Z_history,
+  VectorType const &                                            residual)
 {
   VectorType a = residual;
 
@@ -168,22 +394,22 @@ inv_jacobian_times_residual(VectorType &
 
   for(int idx = Z_history.size() - 1; idx >= 0; --idx)
   {
-    std::shared_ptr<std::vector<VectorType>> D = D_history[idx];
-    std::shared_ptr<std::vector<VectorType>> R = R_history[idx];
-    std::shared_ptr<std::vector<VectorType>> Z = Z_history[idx];
+    ColumnBlock<VectorType> const & D = *D_history[idx];
+    ColumnBlock<VectorType> const & R = *R_history[idx];
+    ColumnBlock<VectorType> const & Z = *Z_history[idx];
 
-    int const           k = Z->size();
+    int const           k = Z.n_columns();
     std::vector<double> Z_times_a(k, 0.0);
     for(int i = 0; i < k; ++i)
-      Z_times_a[i] = (*Z)[i] * a;
+      Z_times_a[i] = Z.dot(i, a);
 
     // add to b
     for(int i = 0; i < k; ++i)
-      b.add(Z_times_a[i], (*D)[i]);
+      D.add_to(b, Z_times_a[i], i);
 
     // add to a
     for(int i = 0; i < k; ++i)
-      a.add(-Z_times_a[i], (*R)[i]);
+      R.add_to(a, -Z_times_a[i], i);
   }
 }
 
@@ -22,6 +22,9 @@
 #ifndef INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_PARAMETERS_H_
 #define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_PARAMETERS_H_
 
+// deal.II
+#include <deal.II/base/parameter_handler.h>
+
 namespace ExaDG
 {
 namespace FSI
@@ -29,14 +32,25 @@ namespace FSI
 struct Parameters
 {
   Parameters()
-    : method("Aitken"),
+    : coupling_scheme("DirichletNeumann"),
+      method("Aitken"),
       abs_tol(1.e-12),
       rel_tol(1.e-3),
       omega_init(0.1),
       reused_time_steps(0),
+      reduced_precision_history(false),
+      restrict_to_interface(false),
       partitioned_iter_max(100),
-      geometric_tolerance(1.e-10)
+      geometric_tolerance(1.e-10),
+      n_processes_structure(0)
+  {
+  }
+
+  Parameters(std::string const & input_file) : Parameters()
   {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
   }
 
   void
@@ -44,6 +58,11 @@ struct Parameters
   {
     // clang-format off
     prm.enter_subsection(subsection_name);
+      prm.add_parameter("CouplingScheme",
+                        coupling_scheme,
+                        "Coupling scheme (sequential Dirichlet-Neumann or parallel Jacobi).",
+                        dealii::Patterns::Selection("DirichletNeumann|ParallelJacobi"),
+                        false);
       prm.add_parameter("Method",
                         method,
                         "Acceleration method.",
@@ -69,6 +88,16 @@ struct Parameters
                         "Number of time steps reused for acceleration.",
                         dealii::Patterns::Integer(0, 100),
                         false);
+      prm.add_parameter("ReducedPrecisionHistory",
+                        reduced_precision_history,
+                        "Store quasi-Newton history of previous time steps in single precision.",
+                        dealii::Patterns::Bool(),
+                        false);
+      prm.add_parameter("RestrictToInterface",
+                        restrict_to_interface,
+                        "Restrict quasi-Newton columns to the degrees of freedom at the interface.",
+                        dealii::Patterns::Bool(),
+                        false);
       prm.add_parameter("PartitionedIterMax",
                         partitioned_iter_max,
                         "Maximum number of fixed-point iterations.",
@@ -79,10 +108,25 @@ struct Parameters
                         "Tolerance used to locate points at FSI interface.",
                         dealii::Patterns::Double(0.0, 1.0),
                         false);
+      prm.add_parameter("ProcessesStructure",
+                        n_processes_structure,
+                        "Number of processes solving the structure concurrently to the fluid "
+                        "(ParallelJacobi only, 0: all processes solve both fields).",
+                        dealii::Patterns::Integer(0),
+                        false);
     prm.leave_subsection();
     // clang-format on
   }
 
+  /*
+   * DirichletNeumann: the structure is solved with the fluid stress of the current iteration
+   * (Gauss-Seidel type coupling), the fixed-point iteration is accelerated on the interface
+   * displacement. ParallelJacobi: fluid and structure are solved with the interface data of the
+   * current iterate, i.e., both field solves of one iteration are independent of each other (Jacobi
+   * type coupling), and the fixed-point iteration is accelerated on the stacked vector of interface
+   * displacement and fluid stress.
+   */
+  std::string  coupling_scheme;
   std::string  method;
   double       abs_tol;
   double       rel_tol;
@@ -90,8 +134,25 @@ struct Parameters
   unsigned int reused_time_steps;
   unsigned int partitioned_iter_max;
 
+  // quasi-Newton methods: store the columns of previous time steps in single precision
+  bool reduced_precision_history;
+
+  /*
+   * quasi-Newton methods: the columns only hold the structure displacement at the fluid-structure
+   * interface instead of all locally owned entries of the displacement vector. The fluid stress
+   * of the ParallelJacobi scheme is only non-zero at the interface and is stored completely.
+   */
+  bool restrict_to_interface;
+
   // tolerance used to locate points at the fluid-structure interface
   double geometric_tolerance;
+
+  /*
+   * ParallelJacobi: the first n_processes_structure processes solve the structure and the
+   * remaining processes solve the fluid, so that both fields are solved concurrently. For the
+   * default value 0, all processes solve both fields one after the other.
+   */
+  unsigned int n_processes_structure;
 };
 } // namespace FSI
 } // namespace ExaDG
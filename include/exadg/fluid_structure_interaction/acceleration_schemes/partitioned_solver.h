@@ -23,11 +23,16 @@
 #ifndef INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_PARTITIONED_SOLVER_H_
 #define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_ACCELERATION_SCHEMES_PARTITIONED_SOLVER_H_
 
+// C/C++
+#include <functional>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
 // FSI
 #include <exadg/fluid_structure_interaction/acceleration_schemes/linear_algebra.h>
 #include <exadg/fluid_structure_interaction/acceleration_schemes/parameters.h>
-#include <exadg/fluid_structure_interaction/single_field_solvers/fluid.h>
-#include <exadg/fluid_structure_interaction/single_field_solvers/structure.h>
 
 // utilities
 #include <exadg/utilities/print_solver_results.h>
@@ -37,7 +42,41 @@ namespace ExaDG
 {
 namespace FSI
 {
-template<int dim, typename Number>
+/*
+ * Fixed-point problem x = G(x) of a partitioned scheme to be solved in every time step. The vector
+ * x contains the interface unknowns of the coupling scheme (e.g. the interface displacement), the
+ * acceleration methods of PartitionedSolver operate on x only.
+ */
+template<typename VectorType>
+struct FixedPointProblem
+{
+  // initializes a vector of the interface unknowns
+  std::function<void(VectorType & x)> initialize_vector;
+
+  // predictor x_0 of the current time step
+  std::function<void(VectorType & x)> predict;
+
+  // evaluates x_tilde = G(x) in iteration k
+  std::function<void(VectorType & x_tilde, VectorType const & x, unsigned int const k)> apply;
+
+  // passes the relaxed iterate x_{k+1} to the field solvers before G is evaluated again
+  std::function<void(VectorType const & x)> update;
+
+  // checks convergence of the residual r = x_tilde - x
+  std::function<bool(VectorType const & r, VectorType const & x_tilde)> check_convergence;
+
+  /*
+   * Local indices of the locally owned entries of x the columns of the quasi-Newton methods are
+   * restricted to (all locally owned entries if not set). The map G must not depend on the
+   * remaining entries, which are not accelerated, i.e., x_{k+1} = x_tilde_k for these entries.
+   */
+  std::shared_ptr<std::vector<unsigned int> const> interface_rows;
+
+  // print solver information in the current time step
+  bool print_solver_info = false;
+};
+
+template<typename Number>
 class PartitionedSolver
 {
 private:
@@ -47,12 +86,7 @@ public:
   PartitionedSolver(Parameters const & parameters, MPI_Comm const & comm);
 
   void
-  setup(std::shared_ptr<SolverFluid<dim, Number>>     fluid_,
-        std::shared_ptr<SolverStructure<dim, Number>> structure_);
-
-  void
-  solve(std::function<void(VectorType &, VectorType const &, unsigned int)> const &
-          apply_dirichlet_neumann_scheme);
+  solve(FixedPointProblem<VectorType> const & problem);
 
   void
   print_iterations(dealii::ConditionalOStream const & pcout) const;
@@ -61,25 +95,28 @@ public:
   get_timings() const;
 
 private:
-  bool
-  check_convergence(VectorType const & residual) const;
-
   void
-  print_solver_info_header(unsigned int const iteration) const;
+  print_solver_info_header(FixedPointProblem<VectorType> const & problem,
+                           unsigned int const                    iteration) const;
 
   void
-  print_solver_info_converged(unsigned int const iteration) const;
+  print_solver_info_converged(FixedPointProblem<VectorType> const & problem,
+                              unsigned int const                    iteration) const;
+
+  /*
+   * Returns a copy of block for the history of previous time steps (in reduced precision if
+   * desired).
+   */
+  std::shared_ptr<ColumnBlock<VectorType>>
+  make_history_block(ColumnBlock<VectorType> const & block) const;
 
   Parameters parameters;
 
   // output to std::cout
   dealii::ConditionalOStream pcout;
 
-  std::shared_ptr<SolverFluid<dim, Number>>     fluid;
-  std::shared_ptr<SolverStructure<dim, Number>> structure;
-
   // required for quasi-Newton methods
-  std::vector<std::shared_ptr<std::vector<VectorType>>> D_history, R_history, Z_history;
+  std::vector<std::shared_ptr<ColumnBlock<VectorType>>> D_history, R_history, Z_history;
 
   // Computation time (wall clock time).
   std::shared_ptr<TimerTree> timer_tree;
@@ -91,9 +128,8 @@ private:
   std::pair<unsigned int, unsigned long long> partitioned_iterations;
 };
 
-template<int dim, typename Number>
-PartitionedSolver<dim, Number>::PartitionedSolver(Parameters const & parameters,
-                                                  MPI_Comm const &   comm)
+template<typename Number>
+PartitionedSolver<Number>::PartitionedSolver(Parameters const & parameters, MPI_Comm const & comm)
   : parameters(parameters),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
     partitioned_iterations({0, 0})
@@ -101,35 +137,12 @@ PartitionedSolver<dim, Number>::PartitionedSolver(Parameters const & parameters,
   timer_tree = std::make_shared<TimerTree>();
 }
 
-template<int dim, typename Number>
-void
-PartitionedSolver<dim, Number>::setup(std::shared_ptr<SolverFluid<dim, Number>>     fluid_,
-                                      std::shared_ptr<SolverStructure<dim, Number>> structure_)
-{
-  fluid     = fluid_;
-  structure = structure_;
-}
-
-template<int dim, typename Number>
-bool
-PartitionedSolver<dim, Number>::check_convergence(VectorType const & residual) const
-{
-  double const residual_norm = residual.l2_norm();
-  double const ref_norm_abs  = std::sqrt(structure->pde_operator->get_number_of_dofs());
-  double const ref_norm_rel  = structure->time_integrator->get_velocity_np().l2_norm() *
-                              structure->time_integrator->get_time_step_size();
-
-  bool const converged = (residual_norm < parameters.abs_tol * ref_norm_abs) ||
-                         (residual_norm < parameters.rel_tol * ref_norm_rel);
-
-  return converged;
-}
-
-template<int dim, typename Number>
+template<typename Number>
 void
-PartitionedSolver<dim, Number>::print_solver_info_header(unsigned int const iteration) const
+PartitionedSolver<Number>::print_solver_info_header(FixedPointProblem<VectorType> const & problem,
+                                                    unsigned int const iteration) const
 {
-  if(fluid->time_integrator->print_solver_info())
+  if(problem.print_solver_info)
   {
     pcout << std::endl
           << "======================================================================" << std::endl
@@ -139,20 +152,33 @@ PartitionedSolver<dim, Number>::print_solver_info_header(unsigned int const iter
   }
 }
 
-template<int dim, typename Number>
+template<typename Number>
 void
-PartitionedSolver<dim, Number>::print_solver_info_converged(unsigned int const iteration) const
+PartitionedSolver<Number>::print_solver_info_converged(
+  FixedPointProblem<VectorType> const & problem,
+  unsigned int const                    iteration) const
 {
-  if(fluid->time_integrator->print_solver_info())
+  if(problem.print_solver_info)
   {
     pcout << std::endl
           << "Partitioned FSI iteration converged in " << iteration << " iterations." << std::endl;
   }
 }
 
-template<int dim, typename Number>
+template<typename Number>
+std::shared_ptr<ColumnBlock<dealii::LinearAlgebra::distributed::Vector<Number>>>
+PartitionedSolver<Number>::make_history_block(ColumnBlock<VectorType> const & block) const
+{
+  auto history_block = std::make_shared<ColumnBlock<VectorType>>();
+  history_block->reinit(block, parameters.reduced_precision_history);
+  history_block->push_back(block);
+
+  return history_block;
+}
+
+template<typename Number>
 void
-PartitionedSolver<dim, Number>::print_iterations(dealii::ConditionalOStream const & pcout) const
+PartitionedSolver<Number>::print_iterations(dealii::ConditionalOStream const & pcout) const
 {
   std::vector<std::string> names;
   std::vector<double>      iterations_avg;
@@ -165,18 +191,16 @@ PartitionedSolver<dim, Number>::print_iterations(dealii::ConditionalOStream cons
   print_list_of_iterations(pcout, names, iterations_avg);
 }
 
-template<int dim, typename Number>
+template<typename Number>
 std::shared_ptr<TimerTree>
-PartitionedSolver<dim, Number>::get_timings() const
+PartitionedSolver<Number>::get_timings() const
 {
   return timer_tree;
 }
 
-template<int dim, typename Number>
+template<typename Number>
 void
-PartitionedSolver<dim, Number>::solve(
-  std::function<void(VectorType &, VectorType const &, unsigned int)> const &
-    apply_dirichlet_neumann_scheme)
+PartitionedSolver<Number>::solve(FixedPointProblem<VectorType> const & problem)
 {
   // iteration counter
   unsigned int k = 0;
@@ -184,28 +208,26 @@ PartitionedSolver<dim, Number>::solve(
   // fixed-point iteration with dynamic relaxation (Aitken relaxation)
   if(parameters.method == "Aitken")
   {
-    VectorType r_old, d;
-    structure->pde_operator->initialize_dof_vector(r_old);
-    structure->pde_operator->initialize_dof_vector(d);
+    VectorType x, x_tilde, r, r_old;
+    problem.initialize_vector(x);
+    problem.initialize_vector(x_tilde);
+    problem.initialize_vector(r);
+    problem.initialize_vector(r_old);
+
+    problem.predict(x);
 
     bool   converged = false;
     double omega     = 1.0;
     while(not converged and k < parameters.partitioned_iter_max)
     {
-      print_solver_info_header(k);
-
-      if(k == 0)
-        structure->time_integrator->extrapolate_displacement_to_np(d);
-      else
-        d = structure->time_integrator->get_displacement_np();
+      print_solver_info_header(problem, k);
 
-      VectorType d_tilde(d);
-      apply_dirichlet_neumann_scheme(d_tilde, d, k);
+      problem.apply(x_tilde, x, k);
 
       // compute residual and check convergence
-      VectorType r = d_tilde;
-      r.add(-1.0, d);
-      converged = check_convergence(r);
+      r = x_tilde;
+      r.add(-1.0, x);
+      converged = problem.check_convergence(r, x_tilde);
 
       // relaxation
       if(not(converged))
@@ -226,8 +248,8 @@ PartitionedSolver<dim, Number>::solve(
 
         r_old = r;
 
-        d.add(omega, r);
-        structure->time_integrator->set_displacement(d);
+        x.add(omega, r);
+        problem.update(x);
 
         timer_tree->insert({"Aitken"}, timer.wall_time());
       }
@@ -238,36 +260,33 @@ PartitionedSolver<dim, Number>::solve(
   }
   else if(parameters.method == "IQN-ILS")
   {
-    std::shared_ptr<std::vector<VectorType>> D, R;
-    D = std::make_shared<std::vector<VectorType>>();
-    R = std::make_shared<std::vector<VectorType>>();
-
-    VectorType d, d_tilde, d_tilde_old, r, r_old;
-    structure->pde_operator->initialize_dof_vector(d);
-    structure->pde_operator->initialize_dof_vector(d_tilde);
-    structure->pde_operator->initialize_dof_vector(d_tilde_old);
-    structure->pde_operator->initialize_dof_vector(r);
-    structure->pde_operator->initialize_dof_vector(r_old);
+    VectorType x, x_tilde, x_tilde_old, r, r_old;
+    problem.initialize_vector(x);
+    problem.initialize_vector(x_tilde);
+    problem.initialize_vector(x_tilde_old);
+    problem.initialize_vector(r);
+    problem.initialize_vector(r_old);
+
+    // columns of the current time step and work array for the QR-decomposition
+    ColumnBlock<VectorType> D, R, Q;
+    D.reinit(x, false, problem.interface_rows);
+    R.reinit(x, false, problem.interface_rows);
 
     unsigned int const q = parameters.reused_time_steps;
-    unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
+
+    problem.predict(x);
 
     bool converged = false;
     while(not(converged) and k < parameters.partitioned_iter_max)
     {
-      print_solver_info_header(k);
-
-      if(k == 0)
-        structure->time_integrator->extrapolate_displacement_to_np(d);
-      else
-        d = structure->time_integrator->get_displacement_np();
+      print_solver_info_header(problem, k);
 
-      apply_dirichlet_neumann_scheme(d_tilde, d, k);
+      problem.apply(x_tilde, x, k);
 
       // compute residual and check convergence
-      r = d_tilde;
-      r.add(-1.0, d);
-      converged = check_convergence(r);
+      r = x_tilde;
+      r.add(-1.0, x);
+      converged = problem.check_convergence(r, x_tilde);
 
       // relaxation
       if(not(converged))
@@ -275,38 +294,26 @@ PartitionedSolver<dim, Number>::solve(
         dealii::Timer timer;
         timer.restart();
 
-        if(k == 0 and (q == 0 or n == 0))
+        if(k == 0 and (q == 0 or R_history.empty()))
         {
-          d.add(parameters.omega_init, r);
+          x.add(parameters.omega_init, r);
         }
         else
         {
           if(k >= 1)
           {
             // append D, R matrices
-            VectorType delta_d_tilde = d_tilde;
-            delta_d_tilde.add(-1.0, d_tilde_old);
-            D->push_back(delta_d_tilde);
-
-            VectorType delta_r = r;
-            delta_r.add(-1.0, r_old);
-            R->push_back(delta_r);
+            D.push_back_difference(x_tilde, x_tilde_old);
+            R.push_back_difference(r, r_old);
           }
 
-          // fill vectors (including reuse)
-          std::vector<VectorType> Q = *R;
-          for(auto R_q : R_history)
-            for(auto delta_r : *R_q)
-              Q.push_back(delta_r);
-          std::vector<VectorType> D_all = *D;
-          for(auto D_q : D_history)
-            for(auto delta_d : *D_q)
-              D_all.push_back(delta_d);
-
-          AssertThrow(D_all.size() == Q.size(),
-                      dealii::ExcMessage("D, Q vectors must have same size."));
+          // fill work array (including reuse), the QR-decomposition is computed in place
+          Q.reinit(R);
+          Q.push_back(R);
+          for(auto const & R_q : R_history)
+            Q.push_back(*R_q);
 
-          unsigned int const k_all = Q.size();
+          unsigned int const k_all = Q.n_columns();
           if(k_all >= 1)
           {
             // compute QR-decomposition
@@ -315,27 +322,33 @@ PartitionedSolver<dim, Number>::solve(
 
             std::vector<Number> rhs(k_all, 0.0);
             for(unsigned int i = 0; i < k_all; ++i)
-              rhs[i] = -Number(Q[i] * r);
+              rhs[i] = -Q.dot(i, r);
 
             // alpha = U^{-1} rhs
             std::vector<Number> alpha(k_all, 0.0);
             backward_substitution(U, alpha, rhs);
 
-            // d_{k+1} = d_tilde_{k} + delta d_tilde
-            d = d_tilde;
-            for(unsigned int i = 0; i < k_all; ++i)
-              d.add(alpha[i], D_all[i]);
+            // x_{k+1} = x_tilde_{k} + delta x_tilde, with columns of D in the same order as in Q
+            x = x_tilde;
+            unsigned int i = 0;
+            for(unsigned int j = 0; j < D.n_columns(); ++j, ++i)
+              D.add_to(x, alpha[i], j);
+            for(auto const & D_q : D_history)
+              for(unsigned int j = 0; j < D_q->n_columns(); ++j, ++i)
+                D_q->add_to(x, alpha[i], j);
+
+            AssertThrow(i == k_all, dealii::ExcMessage("D, Q must have same number of columns."));
           }
           else // despite reuse, the vectors might be empty
           {
-            d.add(parameters.omega_init, r);
+            x.add(parameters.omega_init, r);
           }
         }
 
-        d_tilde_old = d_tilde;
+        x_tilde_old = x_tilde;
         r_old       = r;
 
-        structure->time_integrator->set_displacement(d);
+        problem.update(x);
 
         timer_tree->insert({"IQN-ILS"}, timer.wall_time());
       }
@@ -348,8 +361,8 @@ PartitionedSolver<dim, Number>::solve(
     timer.restart();
 
     // Update history
-    D_history.push_back(D);
-    R_history.push_back(R);
+    D_history.push_back(make_history_block(D));
+    R_history.push_back(make_history_block(R));
     if(D_history.size() > q)
       D_history.erase(D_history.begin());
     if(R_history.size() > q)
@@ -359,43 +372,39 @@ PartitionedSolver<dim, Number>::solve(
   }
   else if(parameters.method == "IQN-IMVLS")
   {
-    std::shared_ptr<std::vector<VectorType>> D, R;
-    D = std::make_shared<std::vector<VectorType>>();
-    R = std::make_shared<std::vector<VectorType>>();
-
-    std::vector<VectorType> B;
-
-    VectorType d, d_tilde, d_tilde_old, r, r_old, b, b_old;
-    structure->pde_operator->initialize_dof_vector(d);
-    structure->pde_operator->initialize_dof_vector(d_tilde);
-    structure->pde_operator->initialize_dof_vector(d_tilde_old);
-    structure->pde_operator->initialize_dof_vector(r);
-    structure->pde_operator->initialize_dof_vector(r_old);
-    structure->pde_operator->initialize_dof_vector(b);
-    structure->pde_operator->initialize_dof_vector(b_old);
+    VectorType x, x_tilde, x_tilde_old, r, r_old, b, b_old;
+    problem.initialize_vector(x);
+    problem.initialize_vector(x_tilde);
+    problem.initialize_vector(x_tilde_old);
+    problem.initialize_vector(r);
+    problem.initialize_vector(r_old);
+    problem.initialize_vector(b);
+    problem.initialize_vector(b_old);
+
+    // columns of the current time step and work array for the QR-decomposition
+    ColumnBlock<VectorType> D, R, B, Q;
+    D.reinit(x, false, problem.interface_rows);
+    R.reinit(x, false, problem.interface_rows);
+    B.reinit(x, false, problem.interface_rows);
+    Q.reinit(x, false, problem.interface_rows);
 
     std::shared_ptr<Matrix<Number>> U;
-    std::vector<VectorType>         Q;
 
     unsigned int const q = parameters.reused_time_steps;
-    unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
+
+    problem.predict(x);
 
     bool converged = false;
     while(not converged and k < parameters.partitioned_iter_max)
     {
-      print_solver_info_header(k);
-
-      if(k == 0)
-        structure->time_integrator->extrapolate_displacement_to_np(d);
-      else
-        d = structure->time_integrator->get_displacement_np();
+      print_solver_info_header(problem, k);
 
-      apply_dirichlet_neumann_scheme(d_tilde, d, k);
+      problem.apply(x_tilde, x, k);
 
       // compute residual and check convergence
-      r = d_tilde;
-      r.add(-1.0, d);
-      converged = check_convergence(r);
+      r = x_tilde;
+      r.add(-1.0, x);
+      converged = problem.check_convergence(r, x_tilde);
 
       // relaxation
       if(not(converged))
@@ -406,54 +415,49 @@ PartitionedSolver<dim, Number>::solve(
         // compute b vector
         inv_jacobian_times_residual(b, D_history, R_history, Z_history, r);
 
-        if(k == 0 and (q == 0 or n == 0))
+        if(k == 0 and (q == 0 or R_history.empty()))
         {
-          d.add(parameters.omega_init, r);
+          x.add(parameters.omega_init, r);
         }
         else
         {
-          d = d_tilde;
-          d.add(-1.0, b);
+          x = x_tilde;
+          x.add(-1.0, b);
 
           if(k >= 1)
           {
-            // append D, R, B matrices
-            VectorType delta_d_tilde = d_tilde;
-            delta_d_tilde.add(-1.0, d_tilde_old);
-            D->push_back(delta_d_tilde);
-
-            VectorType delta_r = r;
-            delta_r.add(-1.0, r_old);
-            R->push_back(delta_r);
+            // append D, R, B matrices (delta b = delta x_tilde - (b - b_old))
+            D.push_back_difference(x_tilde, x_tilde_old);
+            R.push_back_difference(r, r_old);
 
-            VectorType delta_b = delta_d_tilde;
-            delta_b.add(1.0, b_old);
-            delta_b.add(-1.0, b);
-            B.push_back(delta_b);
+            b_old.add(-1.0, b);
+            b_old.add(1.0, x_tilde);
+            B.push_back_difference(b_old, x_tilde_old);
 
             // compute QR-decomposition
             U = std::make_shared<Matrix<Number>>(k);
-            Q = *R;
+            Q.reinit(R);
+            Q.push_back(R);
             compute_QR_decomposition(Q, *U);
 
             std::vector<Number> rhs(k, 0.0);
             for(unsigned int i = 0; i < k; ++i)
-              rhs[i] = -Number(Q[i] * r);
+              rhs[i] = -Q.dot(i, r);
 
             // alpha = U^{-1} rhs
             std::vector<Number> alpha(k, 0.0);
             backward_substitution(*U, alpha, rhs);
 
             for(unsigned int i = 0; i < k; ++i)
-              d.add(alpha[i], B[i]);
+              B.add_to(x, alpha[i], i);
           }
         }
 
-        d_tilde_old = d_tilde;
+        x_tilde_old = x_tilde;
         r_old       = r;
         b_old       = b;
 
-        structure->time_integrator->set_displacement(d);
+        problem.update(x);
 
         timer_tree->insert({"IQN-IMVLS"}, timer.wall_time());
       }
@@ -466,19 +470,17 @@ PartitionedSolver<dim, Number>::solve(
     timer.restart();
 
     // Update history
-    D_history.push_back(D);
-    R_history.push_back(R);
+    D_history.push_back(make_history_block(D));
+    R_history.push_back(make_history_block(R));
     if(D_history.size() > q)
       D_history.erase(D_history.begin());
     if(R_history.size() > q)
       R_history.erase(R_history.begin());
 
-    // compute Z and add to Z_history
-    std::shared_ptr<std::vector<VectorType>> Z;
-    Z  = std::make_shared<std::vector<VectorType>>();
-    *Z = Q; // make sure that Z has correct size
-    backward_substitution_multiple_rhs(*U, *Z, Q);
-    Z_history.push_back(Z);
+    // compute Z (in place of Q) and add to Z_history
+    if(U)
+      backward_substitution_multiple_rhs(*U, Q);
+    Z_history.push_back(make_history_block(Q));
     if(Z_history.size() > q)
       Z_history.erase(Z_history.begin());
 
@@ -492,7 +494,7 @@ PartitionedSolver<dim, Number>::solve(
   partitioned_iterations.first += 1;
   partitioned_iterations.second += k;
 
-  print_solver_info_converged(k);
+  print_solver_info_converged(problem, k);
 }
 
 } // namespace FSI
@@ -19,6 +19,9 @@
  *  ______________________________________________________________________
  */
 
+// deal.II
+#include <deal.II/dofs/dof_tools.h>
+
 // ExaDG
 #include <exadg/fluid_structure_interaction/driver.h>
 #include <exadg/grid/marked_vertices.h>
@@ -31,9 +34,11 @@ namespace FSI
 template<int dim, typename Number>
 Driver<dim, Number>::Driver(std::string const &                           input_file,
                             MPI_Comm const &                              comm,
+                            std::shared_ptr<ProcessPartitioning const>    partitioning,
                             std::shared_ptr<ApplicationBase<dim, Number>> app,
                             bool const                                    is_test)
   : mpi_comm(comm),
+    partitioning(partitioning),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
     is_test(is_test),
     application(app)
@@ -47,7 +52,7 @@ Driver<dim, Number>::Driver(std::string const &                           input_
   structure = std::make_shared<SolverStructure<dim, Number>>();
   fluid     = std::make_shared<SolverFluid<dim, Number>>();
 
-  partitioned_solver = std::make_shared<PartitionedSolver<dim, Number>>(parameters, mpi_comm);
+  partitioned_solver = std::make_shared<PartitionedSolver<Number>>(parameters, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -63,40 +68,105 @@ Driver<dim, Number>::setup()
   {
     dealii::Timer timer_local;
 
-    application->setup();
+    if(partitioning->is_structure_process())
+      application->structure->setup();
+
+    if(partitioning->is_fluid_process())
+      application->fluid->setup();
 
     timer_tree.insert({"FSI", "Setup", "Application"}, timer_local.wall_time());
   }
 
   // setup structure
+  if(partitioning->is_structure_process())
   {
     dealii::Timer timer_local;
 
-    structure->setup(application->structure, mpi_comm, is_test);
+    structure->setup(application->structure, partitioning->get_field_communicator(), is_test);
 
     timer_tree.insert({"FSI", "Setup", "Structure"}, timer_local.wall_time());
   }
 
   // setup fluid
+  if(partitioning->is_fluid_process())
   {
     dealii::Timer timer_local;
 
-    fluid->setup(application->fluid, mpi_comm, is_test);
+    fluid->setup(application->fluid, partitioning->get_field_communicator(), is_test);
 
     timer_tree.insert({"FSI", "Setup", "Fluid"}, timer_local.wall_time());
   }
 
   setup_interface_coupling();
 
-  partitioned_solver->setup(fluid, structure);
+  // parallel Jacobi: the stacked vector of displacement and stress contains the locally owned
+  // entries of both fields on each process
+  if(parameters.coupling_scheme == "ParallelJacobi")
+  {
+    VectorType d, s;
+    initialize_vectors_parallel_jacobi(d, s);
+
+    std::vector<dealii::IndexSet> const locally_owned_entries =
+      dealii::Utilities::MPI::create_ascending_partitioning(mpi_comm,
+                                                            d.locally_owned_size() +
+                                                              s.locally_owned_size());
+
+    partitioner_parallel_jacobi = std::make_shared<dealii::Utilities::MPI::Partitioner>(
+      locally_owned_entries[dealii::Utilities::MPI::this_mpi_process(mpi_comm)],
+      dealii::IndexSet(locally_owned_entries[0].size()),
+      mpi_comm);
+  }
+
+  if(parameters.restrict_to_interface)
+    setup_interface_rows();
 
   timer_tree.insert({"FSI", "Setup"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_interface_rows()
+{
+  auto rows = std::make_shared<std::vector<unsigned int>>();
+
+  // structure displacement: degrees of freedom at the fluid-structure interface
+  unsigned int n_d = 0;
+  if(partitioning->is_structure_process())
+  {
+    auto const & dof_handler  = structure->pde_operator->get_dof_handler();
+    auto const   boundary_ids = extract_set_of_keys_from_map(
+      application->structure->get_boundary_descriptor()->neumann_cached_bc);
+
+    dealii::IndexSet const & locally_owned_dofs = dof_handler.locally_owned_dofs();
+    dealii::IndexSet const   interface_dofs =
+      dealii::DoFTools::extract_boundary_dofs(dof_handler, dealii::ComponentMask(), boundary_ids) &
+      locally_owned_dofs;
+
+    for(auto const dof : interface_dofs)
+      rows->push_back(locally_owned_dofs.index_within_set(dof));
+
+    n_d = locally_owned_dofs.n_elements();
+  }
+
+  // parallel Jacobi: the fluid stress is stored completely, see Parameters::restrict_to_interface
+  if(parameters.coupling_scheme == "ParallelJacobi" and partitioning->is_fluid_process())
+  {
+    VectorType s;
+    fluid->pde_operator->initialize_vector_velocity(s);
+    for(unsigned int i = 0; i < s.locally_owned_size(); ++i)
+      rows->push_back(n_d + i);
+  }
+
+  interface_rows = rows;
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::setup_interface_coupling()
 {
+  bool const is_structure_process = partitioning->is_structure_process();
+  bool const is_fluid_process     = partitioning->is_fluid_process();
+
   // structure to ALE
   {
     dealii::Timer timer_local;
@@ -104,36 +174,43 @@ Driver<dim, Number>::setup_interface_coupling()
 
     pcout << std::endl << "Setup interface coupling structure -> ALE ..." << std::endl;
 
-    auto const & tria         = structure->pde_operator->get_dof_handler().get_triangulation();
-    auto const   boundary_ids = extract_set_of_keys_from_map(
-      application->structure->get_boundary_descriptor()->neumann_cached_bc);
-    auto const marked_vertices_structure = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
-
-    if(application->fluid->get_parameters().mesh_movement_type == IncNS::MeshMovementType::Poisson)
-    {
-      structure_to_ale = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
-      structure_to_ale->setup(fluid->ale_poisson_operator->get_container_interface_data(),
-                              structure->pde_operator->get_dof_handler(),
-                              *application->structure->get_grid()->mapping,
-                              marked_vertices_structure,
-                              parameters.geometric_tolerance);
-    }
-    else if(application->fluid->get_parameters().mesh_movement_type ==
-            IncNS::MeshMovementType::Elasticity)
+    std::vector<bool> marked_vertices_structure;
+    if(is_structure_process)
     {
-      structure_to_ale = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
-      structure_to_ale->setup(
-        fluid->ale_elasticity_operator->get_container_interface_data_dirichlet(),
-        structure->pde_operator->get_dof_handler(),
-        *application->structure->get_grid()->mapping,
-        marked_vertices_structure,
-        parameters.geometric_tolerance);
+      auto const & tria         = structure->pde_operator->get_dof_handler().get_triangulation();
+      auto const   boundary_ids = extract_set_of_keys_from_map(
+        application->structure->get_boundary_descriptor()->neumann_cached_bc);
+      marked_vertices_structure = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
     }
-    else
+
+    std::shared_ptr<ContainerInterfaceData<dim, dim, Number>> interface_data_ale;
+    if(is_fluid_process)
     {
-      AssertThrow(false, dealii::ExcMessage("not implemented."));
+      if(application->fluid->get_parameters().mesh_movement_type ==
+         IncNS::MeshMovementType::Poisson)
+      {
+        interface_data_ale = fluid->ale_poisson_operator->get_container_interface_data();
+      }
+      else if(application->fluid->get_parameters().mesh_movement_type ==
+              IncNS::MeshMovementType::Elasticity)
+      {
+        interface_data_ale =
+          fluid->ale_elasticity_operator->get_container_interface_data_dirichlet();
+      }
+      else
+      {
+        AssertThrow(false, dealii::ExcMessage("not implemented."));
+      }
     }
 
+    structure_to_ale = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
+    setup_interface_coupling(
+      *structure_to_ale,
+      interface_data_ale,
+      is_structure_process ? &structure->pde_operator->get_dof_handler() : nullptr,
+      is_structure_process ? application->structure->get_grid()->mapping.get() : nullptr,
+      marked_vertices_structure);
+
     pcout << std::endl << "... done!" << std::endl;
 
     timer_tree.insert({"FSI", "Setup", "Coupling structure -> ALE"}, timer_local.wall_time());
@@ -146,17 +223,22 @@ Driver<dim, Number>::setup_interface_coupling()
 
     pcout << std::endl << "Setup interface coupling structure -> fluid ..." << std::endl;
 
-    auto const & tria         = structure->pde_operator->get_dof_handler().get_triangulation();
-    auto const   boundary_ids = extract_set_of_keys_from_map(
-      application->structure->get_boundary_descriptor()->neumann_cached_bc);
-    auto const marked_vertices_structure = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
+    std::vector<bool> marked_vertices_structure;
+    if(is_structure_process)
+    {
+      auto const & tria         = structure->pde_operator->get_dof_handler().get_triangulation();
+      auto const   boundary_ids = extract_set_of_keys_from_map(
+        application->structure->get_boundary_descriptor()->neumann_cached_bc);
+      marked_vertices_structure = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
+    }
 
     structure_to_fluid = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
-    structure_to_fluid->setup(fluid->pde_operator->get_container_interface_data(),
-                              structure->pde_operator->get_dof_handler(),
-                              *application->structure->get_grid()->mapping,
-                              marked_vertices_structure,
-                              parameters.geometric_tolerance);
+    setup_interface_coupling(
+      *structure_to_fluid,
+      is_fluid_process ? fluid->pde_operator->get_container_interface_data() : nullptr,
+      is_structure_process ? &structure->pde_operator->get_dof_handler() : nullptr,
+      is_structure_process ? application->structure->get_grid()->mapping.get() : nullptr,
+      marked_vertices_structure);
 
     pcout << std::endl << "... done!" << std::endl;
 
@@ -170,20 +252,27 @@ Driver<dim, Number>::setup_interface_coupling()
 
     pcout << std::endl << "Setup interface coupling fluid -> structure ..." << std::endl;
 
-    std::shared_ptr<dealii::Mapping<dim> const> mapping_fluid =
-      get_dynamic_mapping<dim, Number>(application->fluid->get_grid(), fluid->ale_grid_motion);
+    std::shared_ptr<dealii::Mapping<dim> const> mapping_fluid;
+    std::vector<bool>                           marked_vertices_fluid;
+    if(is_fluid_process)
+    {
+      mapping_fluid =
+        get_dynamic_mapping<dim, Number>(application->fluid->get_grid(), fluid->ale_grid_motion);
 
-    auto const & tria         = fluid->pde_operator->get_dof_handler_u().get_triangulation();
-    auto const   boundary_ids = extract_set_of_keys_from_map(
-      application->fluid->get_boundary_descriptor()->velocity->dirichlet_cached_bc);
-    auto const marked_vertices_fluid = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
+      auto const & tria         = fluid->pde_operator->get_dof_handler_u().get_triangulation();
+      auto const   boundary_ids = extract_set_of_keys_from_map(
+        application->fluid->get_boundary_descriptor()->velocity->dirichlet_cached_bc);
+      marked_vertices_fluid = get_marked_vertices_via_boundary_ids(tria, boundary_ids);
+    }
 
     fluid_to_structure = std::make_shared<InterfaceCoupling<dim, dim, Number>>();
-    fluid_to_structure->setup(structure->pde_operator->get_container_interface_data_neumann(),
-                              fluid->pde_operator->get_dof_handler_u(),
-                              *mapping_fluid,
-                              marked_vertices_fluid,
-                              parameters.geometric_tolerance);
+    setup_interface_coupling(
+      *fluid_to_structure,
+      is_structure_process ? structure->pde_operator->get_container_interface_data_neumann() :
+                             nullptr,
+      is_fluid_process ? &fluid->pde_operator->get_dof_handler_u() : nullptr,
+      mapping_fluid.get(),
+      marked_vertices_fluid);
 
     pcout << std::endl << "... done!" << std::endl;
 
@@ -191,12 +280,52 @@ Driver<dim, Number>::setup_interface_coupling()
   }
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_interface_coupling(
+  InterfaceCoupling<dim, dim, Number> &                           coupling,
+  std::shared_ptr<ContainerInterfaceData<dim, dim, Number>> const interface_data_dst,
+  dealii::DoFHandler<dim> const *                                 dof_handler_src,
+  dealii::Mapping<dim> const *                                    mapping_src,
+  std::vector<bool> const &                                       marked_vertices_src) const
+{
+  if(partitioning->is_disjoint())
+  {
+    coupling.setup(interface_data_dst,
+                   dof_handler_src,
+                   mapping_src,
+                   marked_vertices_src,
+                   parameters.geometric_tolerance,
+                   mpi_comm);
+  }
+  else
+  {
+    coupling.setup(interface_data_dst,
+                   *dof_handler_src,
+                   *mapping_src,
+                   marked_vertices_src,
+                   parameters.geometric_tolerance);
+  }
+}
+
+template<int dim, typename Number>
+template<typename T>
+T
+Driver<dim, Number>::broadcast_from_fluid(T const & value) const
+{
+  return dealii::Utilities::MPI::broadcast(mpi_comm, value, partitioning->get_root_fluid());
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::set_start_time() const
 {
   // The fluid domain is the master that dictates the start time
-  structure->time_integrator->reset_time(fluid->time_integrator->get_time());
+  double const start_time = broadcast_from_fluid(
+    partitioning->is_fluid_process() ? fluid->time_integrator->get_time() : 0.0);
+
+  if(partitioning->is_structure_process())
+    structure->time_integrator->reset_time(start_time);
 }
 
 template<int dim, typename Number>
@@ -204,40 +333,108 @@ void
 Driver<dim, Number>::synchronize_time_step_size() const
 {
   // The fluid domain is the master that dictates the time step size
-  structure->time_integrator->set_current_time_step_size(
-    fluid->time_integrator->get_time_step_size());
+  double const time_step_size = broadcast_from_fluid(
+    partitioning->is_fluid_process() ? fluid->time_integrator->get_time_step_size() : 0.0);
+
+  if(partitioning->is_structure_process())
+    structure->time_integrator->set_current_time_step_size(time_step_size);
 }
 
+/*
+ * Communication channels of the ghost value exchanges of the interface couplings, different from
+ * each other and from the default channel 0 used within the field solvers, since these exchanges
+ * can be in flight at the same time.
+ */
+namespace
+{
+unsigned int const channel_structure_to_ale   = 1;
+unsigned int const channel_structure_to_fluid = 2;
+unsigned int const channel_fluid_to_structure = 3;
+} // namespace
+
 template<int dim, typename Number>
 void
-Driver<dim, Number>::coupling_structure_to_ale(VectorType const & displacement_structure) const
+Driver<dim, Number>::coupling_structure_to_ale_start(
+  VectorType const & displacement_structure) const
 {
   dealii::Timer sub_timer;
   sub_timer.restart();
 
-  structure_to_ale->update_data(displacement_structure);
+  structure_to_ale->update_data_start(displacement_structure, channel_structure_to_ale);
+
   timer_tree.insert({"FSI", "Coupling structure -> ALE"}, sub_timer.wall_time());
 }
 
 template<int dim, typename Number>
 void
-Driver<dim, Number>::coupling_structure_to_fluid(bool const extrapolate) const
+Driver<dim, Number>::coupling_structure_to_ale_finish() const
 {
   dealii::Timer sub_timer;
   sub_timer.restart();
 
-  VectorType velocity_structure;
-  structure->pde_operator->initialize_dof_vector(velocity_structure);
-  if(extrapolate)
-    structure->time_integrator->extrapolate_velocity_to_np(velocity_structure);
-  else
-    velocity_structure = structure->time_integrator->get_velocity_np();
+  structure_to_ale->update_data_finish();
 
-  structure_to_fluid->update_data(velocity_structure);
+  timer_tree.insert({"FSI", "Coupling structure -> ALE"}, sub_timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::coupling_structure_to_fluid_start(VectorType & velocity_structure,
+                                                       bool const   extrapolate) const
+{
+  dealii::Timer sub_timer;
+  sub_timer.restart();
+
+  if(partitioning->is_structure_process())
+  {
+    structure->pde_operator->initialize_dof_vector(velocity_structure);
+    if(extrapolate)
+      structure->time_integrator->extrapolate_velocity_to_np(velocity_structure);
+    else
+      velocity_structure = structure->time_integrator->get_velocity_np();
+  }
+
+  structure_to_fluid->update_data_start(velocity_structure, channel_structure_to_fluid);
+
+  timer_tree.insert({"FSI", "Coupling structure -> fluid"}, sub_timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::coupling_structure_to_fluid_finish() const
+{
+  dealii::Timer sub_timer;
+  sub_timer.restart();
+
+  structure_to_fluid->update_data_finish();
 
   timer_tree.insert({"FSI", "Coupling structure -> fluid"}, sub_timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::coupling_fluid_to_structure_start(VectorType const & stress_fluid) const
+{
+  dealii::Timer sub_timer;
+  sub_timer.restart();
+
+  fluid_to_structure->update_data_start(stress_fluid, channel_fluid_to_structure);
+
+  timer_tree.insert({"FSI", "Coupling fluid -> structure"}, sub_timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::coupling_fluid_to_structure_finish() const
+{
+  dealii::Timer sub_timer;
+  sub_timer.restart();
+
+  fluid_to_structure->update_data_finish();
+
+  timer_tree.insert({"FSI", "Coupling fluid -> structure"}, sub_timer.wall_time());
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::coupling_fluid_to_structure(bool const end_of_time_step) const
@@ -246,6 +443,20 @@ Driver<dim, Number>::coupling_fluid_to_structure(bool const end_of_time_step) co
   sub_timer.restart();
 
   VectorType stress_fluid;
+  if(partitioning->is_fluid_process())
+    calculate_stress_fluid(stress_fluid, end_of_time_step);
+
+  timer_tree.insert({"FSI", "Coupling fluid -> structure"}, sub_timer.wall_time());
+
+  coupling_fluid_to_structure_start(stress_fluid);
+  coupling_fluid_to_structure_finish();
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::calculate_stress_fluid(VectorType & stress_fluid,
+                                            bool const   end_of_time_step) const
+{
   fluid->pde_operator->initialize_vector_velocity(stress_fluid);
   // calculate fluid stress at fluid-structure interface
   if(end_of_time_step)
@@ -262,9 +473,152 @@ Driver<dim, Number>::coupling_fluid_to_structure(bool const end_of_time_step) co
   }
 
   stress_fluid *= -1.0;
-  fluid_to_structure->update_data(stress_fluid);
+}
 
-  timer_tree.insert({"FSI", "Coupling fluid -> structure"}, sub_timer.wall_time());
+template<int dim, typename Number>
+FixedPointProblem<typename Driver<dim, Number>::VectorType>
+Driver<dim, Number>::make_fixed_point_problem_dirichlet_neumann() const
+{
+  FixedPointProblem<VectorType> problem;
+
+  problem.initialize_vector = [&](VectorType & d) {
+    structure->pde_operator->initialize_dof_vector(d);
+  };
+
+  problem.predict = [&](VectorType & d) {
+    structure->time_integrator->extrapolate_displacement_to_np(d);
+  };
+
+  problem.apply = [&](VectorType & d_tilde, VectorType const & d, unsigned int const k) {
+    apply_dirichlet_neumann_scheme(d_tilde, d, k);
+  };
+
+  problem.update = [&](VectorType const & d) {
+    structure->time_integrator->set_displacement(d);
+  };
+
+  problem.check_convergence = [&](VectorType const & r, VectorType const &) {
+    return check_convergence_dirichlet_neumann(r);
+  };
+
+  problem.interface_rows = interface_rows;
+
+  return problem;
+}
+
+template<int dim, typename Number>
+FixedPointProblem<typename Driver<dim, Number>::VectorType>
+Driver<dim, Number>::make_fixed_point_problem_parallel_jacobi() const
+{
+  FixedPointProblem<VectorType> problem;
+
+  problem.initialize_vector = [&](VectorType & x) { x.reinit(partitioner_parallel_jacobi); };
+
+  // displacement extrapolated in time and fluid stress of the last time step
+  problem.predict = [&](VectorType & x) {
+    VectorType d, s;
+    if(partitioning->is_structure_process())
+    {
+      structure->pde_operator->initialize_dof_vector(d);
+      structure->time_integrator->extrapolate_displacement_to_np(d);
+    }
+    if(partitioning->is_fluid_process())
+      calculate_stress_fluid(s, /* end_of_time_step = */ false);
+
+    merge_parallel_jacobi(x, d, s);
+  };
+
+  problem.apply = [&](VectorType & x_tilde, VectorType const & x, unsigned int const k) {
+    apply_parallel_jacobi_scheme(x_tilde, x, k);
+  };
+
+  // the structure velocity passed to the fluid depends on the displacement
+  problem.update = [&](VectorType const & x) {
+    if(partitioning->is_structure_process())
+    {
+      VectorType d, s;
+      initialize_vectors_parallel_jacobi(d, s);
+      split_parallel_jacobi(d, s, x);
+
+      structure->time_integrator->set_displacement(d);
+    }
+  };
+
+  problem.check_convergence = [&](VectorType const & r, VectorType const & x_tilde) {
+    return check_convergence_parallel_jacobi(r, x_tilde);
+  };
+
+  problem.interface_rows = interface_rows;
+
+  return problem;
+}
+
+template<int dim, typename Number>
+bool
+Driver<dim, Number>::check_convergence_dirichlet_neumann(VectorType const & residual) const
+{
+  double const residual_norm = residual.l2_norm();
+  double const ref_norm_abs  = std::sqrt(structure->pde_operator->get_number_of_dofs());
+  double const ref_norm_rel  = structure->time_integrator->get_velocity_np().l2_norm() *
+                              structure->time_integrator->get_time_step_size();
+
+  bool const converged = (residual_norm < parameters.abs_tol * ref_norm_abs) ||
+                         (residual_norm < parameters.rel_tol * ref_norm_rel);
+
+  return converged;
+}
+
+template<int dim, typename Number>
+bool
+Driver<dim, Number>::check_convergence_parallel_jacobi(VectorType const & residual,
+                                                       VectorType const & x_tilde) const
+{
+  VectorType r_d, r_s, d_tilde, s_tilde;
+  initialize_vectors_parallel_jacobi(r_d, r_s);
+  initialize_vectors_parallel_jacobi(d_tilde, s_tilde);
+  split_parallel_jacobi(r_d, r_s, residual);
+  split_parallel_jacobi(d_tilde, s_tilde, x_tilde);
+
+  auto const local_norm_sqr = [](VectorType const & vector) {
+    double norm_sqr = 0.0;
+    for(unsigned int i = 0; i < vector.locally_owned_size(); ++i)
+      norm_sqr += vector.local_element(i) * vector.local_element(i);
+    return norm_sqr;
+  };
+
+  // The displacement (stress) is only known on the processes of the structure (fluid) in general,
+  // so that the local contributions to the norms of both blocks are summed up over all processes.
+  std::vector<double> local_values(6, 0.0), values(6, 0.0);
+  local_values[0] = local_norm_sqr(r_d);
+  local_values[1] = local_norm_sqr(r_s);
+  local_values[2] = r_d.locally_owned_size();
+  local_values[3] = r_s.locally_owned_size();
+  local_values[4] = local_norm_sqr(s_tilde);
+  if(partitioning->is_structure_process())
+  {
+    local_values[5] = local_norm_sqr(structure->time_integrator->get_velocity_np()) *
+                      std::pow(structure->time_integrator->get_time_step_size(), 2);
+  }
+
+  dealii::Utilities::MPI::sum(local_values, mpi_comm, values);
+
+  // displacement: same criterion as for the Dirichlet-Neumann scheme
+  double const residual_norm_d = std::sqrt(values[0]);
+  double const ref_norm_abs_d  = std::sqrt(values[2]);
+  double const ref_norm_rel_d  = std::sqrt(values[5]);
+
+  bool const converged_d = (residual_norm_d < parameters.abs_tol * ref_norm_abs_d) ||
+                           (residual_norm_d < parameters.rel_tol * ref_norm_rel_d);
+
+  // stress: relative to the current stress
+  double const residual_norm_s = std::sqrt(values[1]);
+  double const ref_norm_abs_s  = std::sqrt(values[3]);
+  double const ref_norm_rel_s  = std::sqrt(values[4]);
+
+  bool const converged_s = (residual_norm_s < parameters.abs_tol * ref_norm_abs_s) ||
+                           (residual_norm_s < parameters.rel_tol * ref_norm_rel_s);
+
+  return converged_d and converged_s;
 }
 
 template<int dim, typename Number>
@@ -273,13 +627,20 @@ Driver<dim, Number>::apply_dirichlet_neumann_scheme(VectorType &       d_tilde,
                                                     VectorType const & d,
                                                     unsigned int       iteration) const
 {
-  coupling_structure_to_ale(d);
+  coupling_structure_to_ale_start(d);
+
+  // the velocity boundary condition for the fluid does not depend on the mesh motion, so that its
+  // transfer overlaps with the ALE solve
+  VectorType velocity_structure;
+  coupling_structure_to_fluid_start(velocity_structure, iteration == 0);
+
+  coupling_structure_to_ale_finish();
 
   // move the fluid mesh and update dependent data structures
   fluid->solve_ale(application->fluid, is_test);
 
   // update velocity boundary condition for fluid
-  coupling_structure_to_fluid(iteration == 0);
+  coupling_structure_to_fluid_finish();
 
   // solve fluid problem
   fluid->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
@@ -293,6 +654,97 @@ Driver<dim, Number>::apply_dirichlet_neumann_scheme(VectorType &       d_tilde,
   d_tilde = structure->time_integrator->get_displacement_np();
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::apply_parallel_jacobi_scheme(VectorType &       x_tilde,
+                                                  VectorType const & x,
+                                                  unsigned int       iteration) const
+{
+  VectorType d, s;
+  initialize_vectors_parallel_jacobi(d, s);
+  split_parallel_jacobi(d, s, x);
+
+  // interface data of both fields depending on the current iterate x = (d, s) only, the three
+  // transfers are in flight at the same time
+  VectorType velocity_structure;
+  coupling_structure_to_ale_start(d);
+  coupling_structure_to_fluid_start(velocity_structure, iteration == 0);
+  coupling_fluid_to_structure_start(s);
+
+  coupling_structure_to_ale_finish();
+  coupling_structure_to_fluid_finish();
+  coupling_fluid_to_structure_finish();
+
+  // The field solves are independent of each other and run concurrently if fluid and structure
+  // are solved on disjoint sets of processes.
+  if(partitioning->is_structure_process())
+  {
+    // solve structural problem
+    structure->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
+
+    d = structure->time_integrator->get_displacement_np();
+  }
+
+  if(partitioning->is_fluid_process())
+  {
+    // move the fluid mesh and update dependent data structures
+    fluid->solve_ale(application->fluid, is_test);
+
+    // solve fluid problem
+    fluid->time_integrator->advance_one_timestep_partitioned_solve(iteration == 0);
+
+    calculate_stress_fluid(s, /* end_of_time_step = */ true);
+  }
+
+  merge_parallel_jacobi(x_tilde, d, s);
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::initialize_vectors_parallel_jacobi(VectorType & d, VectorType & s) const
+{
+  // vectors of fields not solved by this process remain empty
+  if(partitioning->is_structure_process())
+    structure->pde_operator->initialize_dof_vector(d);
+
+  if(partitioning->is_fluid_process())
+    fluid->pde_operator->initialize_vector_velocity(s);
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::merge_parallel_jacobi(VectorType &       x,
+                                           VectorType const & d,
+                                           VectorType const & s) const
+{
+  unsigned int const n_d = d.locally_owned_size();
+
+  AssertThrow(x.locally_owned_size() == n_d + s.locally_owned_size(),
+              dealii::ExcMessage("Vectors have incompatible sizes."));
+
+  for(unsigned int i = 0; i < n_d; ++i)
+    x.local_element(i) = d.local_element(i);
+  for(unsigned int i = 0; i < s.locally_owned_size(); ++i)
+    x.local_element(n_d + i) = s.local_element(i);
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::split_parallel_jacobi(VectorType &       d,
+                                           VectorType &       s,
+                                           VectorType const & x) const
+{
+  unsigned int const n_d = d.locally_owned_size();
+
+  AssertThrow(x.locally_owned_size() == n_d + s.locally_owned_size(),
+              dealii::ExcMessage("Vectors have incompatible sizes."));
+
+  for(unsigned int i = 0; i < n_d; ++i)
+    d.local_element(i) = x.local_element(i);
+  for(unsigned int i = 0; i < s.locally_owned_size(); ++i)
+    s.local_element(i) = x.local_element(n_d + i);
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::solve() const
@@ -305,29 +757,49 @@ Driver<dim, Number>::solve() const
   {
     // update stress boundary condition for solid at time t_n (not t_{n+1})
     coupling_fluid_to_structure(/* end_of_time_step = */ false);
-    structure->time_integrator->compute_initial_acceleration(
-      application->structure->get_parameters().restarted_simulation);
+
+    if(partitioning->is_structure_process())
+    {
+      structure->time_integrator->compute_initial_acceleration(
+        application->structure->get_parameters().restarted_simulation);
+    }
   }
 
+  FixedPointProblem<VectorType> problem;
+  if(parameters.coupling_scheme == "DirichletNeumann")
+    problem = make_fixed_point_problem_dirichlet_neumann();
+  else if(parameters.coupling_scheme == "ParallelJacobi")
+    problem = make_fixed_point_problem_parallel_jacobi();
+  else
+    AssertThrow(false, dealii::ExcMessage("This coupling scheme is not implemented."));
+
+  bool const adaptive_time_stepping = broadcast_from_fluid(
+    partitioning->is_fluid_process() and
+    application->fluid->get_parameters().adaptive_time_stepping);
+
   // The fluid domain is the master that dictates when the time loop is finished
-  while(!fluid->time_integrator->finished())
+  while(not(broadcast_from_fluid(partitioning->is_fluid_process() and
+                                 fluid->time_integrator->finished())))
   {
     // pre-solve
-    fluid->time_integrator->advance_one_timestep_pre_solve(true);
-    structure->time_integrator->advance_one_timestep_pre_solve(false);
+    if(partitioning->is_fluid_process())
+      fluid->time_integrator->advance_one_timestep_pre_solve(true);
+    if(partitioning->is_structure_process())
+      structure->time_integrator->advance_one_timestep_pre_solve(false);
 
     // solve (using strongly-coupled partitioned scheme)
-    auto const lambda_dirichlet_neumann =
-      [&](VectorType & d_tilde, VectorType const & d, unsigned int k) {
-        apply_dirichlet_neumann_scheme(d_tilde, d, k);
-      };
-    partitioned_solver->solve(lambda_dirichlet_neumann);
+    problem.print_solver_info = broadcast_from_fluid(
+      partitioning->is_fluid_process() and fluid->time_integrator->print_solver_info());
+
+    partitioned_solver->solve(problem);
 
     // post-solve
-    fluid->time_integrator->advance_one_timestep_post_solve();
-    structure->time_integrator->advance_one_timestep_post_solve();
+    if(partitioning->is_fluid_process())
+      fluid->time_integrator->advance_one_timestep_post_solve();
+    if(partitioning->is_structure_process())
+      structure->time_integrator->advance_one_timestep_post_solve();
 
-    if(application->fluid->get_parameters().adaptive_time_stepping)
+    if(adaptive_time_stepping)
       synchronize_time_step_size();
   }
 }
@@ -349,56 +821,85 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "FSI:" << std::endl;
   partitioned_solver->print_iterations(pcout);
 
-  pcout << std::endl << "Fluid:" << std::endl;
-  fluid->time_integrator->print_iterations();
+  // For a disjoint process partitioning, the first process of the fluid prints the results of
+  // the fluid and the first process of the structure those of the structure.
+  dealii::ConditionalOStream pcout_field(
+    std::cout,
+    dealii::Utilities::MPI::this_mpi_process(partitioning->get_field_communicator()) == 0);
 
-  pcout << std::endl << "ALE:" << std::endl;
-  fluid->ale_grid_motion->print_iterations();
+  if(partitioning->is_fluid_process())
+  {
+    pcout_field << std::endl << "Fluid:" << std::endl;
+    fluid->time_integrator->print_iterations();
 
-  pcout << std::endl << "Structure:" << std::endl;
-  structure->time_integrator->print_iterations();
+    pcout_field << std::endl << "ALE:" << std::endl;
+    fluid->ale_grid_motion->print_iterations();
+  }
+
+  if(partitioning->is_structure_process())
+  {
+    pcout_field << std::endl << "Structure:" << std::endl;
+    structure->time_integrator->print_iterations();
+  }
 
   // wall times
-  pcout << std::endl << "Wall times:" << std::endl;
+  pcout_field << std::endl << "Wall times:" << std::endl;
 
   timer_tree.insert({"FSI"}, total_time);
 
-  timer_tree.insert({"FSI"}, fluid->time_integrator->get_timings(), "Fluid");
-  timer_tree.insert({"FSI"}, fluid->get_timings_ale());
-  timer_tree.insert({"FSI"}, structure->time_integrator->get_timings(), "Structure");
+  if(partitioning->is_fluid_process())
+  {
+    timer_tree.insert({"FSI"}, fluid->time_integrator->get_timings(), "Fluid");
+    timer_tree.insert({"FSI"}, fluid->get_timings_ale());
+  }
+  if(partitioning->is_structure_process())
+    timer_tree.insert({"FSI"}, structure->time_integrator->get_timings(), "Structure");
   timer_tree.insert({"FSI"}, partitioned_solver->get_timings());
 
-  pcout << std::endl << "Timings for level 1:" << std::endl;
-  timer_tree.print_level(pcout, 1);
+  pcout_field << std::endl << "Timings for level 1:" << std::endl;
+  timer_tree.print_level(pcout_field, 1);
 
-  pcout << std::endl << "Timings for level 2:" << std::endl;
-  timer_tree.print_level(pcout, 2);
+  pcout_field << std::endl << "Timings for level 2:" << std::endl;
+  timer_tree.print_level(pcout_field, 2);
 
   // Throughput in DoFs/s per time step per core
-  dealii::types::global_dof_index DoFs =
-    fluid->pde_operator->get_number_of_dofs() + structure->pde_operator->get_number_of_dofs();
+  dealii::types::global_dof_index DoFs_fluid = 0, DoFs_structure = 0;
 
-  if(application->fluid->get_parameters().mesh_movement_type == IncNS::MeshMovementType::Poisson)
+  if(partitioning->is_fluid_process())
   {
-    DoFs += fluid->pde_operator->get_number_of_dofs();
-  }
-  else if(application->fluid->get_parameters().mesh_movement_type ==
-          IncNS::MeshMovementType::Elasticity)
-  {
-    DoFs += fluid->ale_elasticity_operator->get_number_of_dofs();
-  }
-  else
-  {
-    AssertThrow(false, dealii::ExcMessage("not implemented."));
+    DoFs_fluid = fluid->pde_operator->get_number_of_dofs();
+
+    if(application->fluid->get_parameters().mesh_movement_type ==
+       IncNS::MeshMovementType::Poisson)
+    {
+      DoFs_fluid += fluid->pde_operator->get_number_of_dofs();
+    }
+    else if(application->fluid->get_parameters().mesh_movement_type ==
+            IncNS::MeshMovementType::Elasticity)
+    {
+      DoFs_fluid += fluid->ale_elasticity_operator->get_number_of_dofs();
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("not implemented."));
+    }
   }
 
+  if(partitioning->is_structure_process())
+    DoFs_structure = structure->pde_operator->get_number_of_dofs();
+
+  dealii::types::global_dof_index const DoFs =
+    broadcast_from_fluid(DoFs_fluid) +
+    dealii::Utilities::MPI::broadcast(mpi_comm, DoFs_structure, 0);
+
   unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
   dealii::Utilities::MPI::MinMaxAvg total_time_data =
     dealii::Utilities::MPI::min_max_avg(total_time, mpi_comm);
   double const total_time_avg = total_time_data.avg;
 
-  unsigned int N_time_steps = fluid->time_integrator->get_number_of_time_steps();
+  unsigned int const N_time_steps = broadcast_from_fluid(
+    partitioning->is_fluid_process() ? fluid->time_integrator->get_number_of_time_steps() : 0);
 
   print_throughput_unsteady(pcout, DoFs, total_time_avg, N_time_steps, N_mpi_processes);
 
@@ -28,6 +28,7 @@
 // FSI
 #include <exadg/fluid_structure_interaction/acceleration_schemes/parameters.h>
 #include <exadg/fluid_structure_interaction/acceleration_schemes/partitioned_solver.h>
+#include <exadg/fluid_structure_interaction/process_partitioning.h>
 #include <exadg/fluid_structure_interaction/single_field_solvers/fluid.h>
 #include <exadg/fluid_structure_interaction/single_field_solvers/structure.h>
 
@@ -46,8 +47,12 @@ private:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
 public:
+  /*
+   * The application has to be created on the field communicator of the process partitioning.
+   */
   Driver(std::string const &                           input_file,
          MPI_Comm const &                              comm,
+         std::shared_ptr<ProcessPartitioning const>    partitioning,
          std::shared_ptr<ApplicationBase<dim, Number>> application,
          bool const                                    is_test);
 
@@ -64,29 +69,121 @@ private:
   void
   setup_interface_coupling();
 
+  /*
+   * Local indices of the entries of the fixed-point vector at the fluid-structure interface, to
+   * which the columns of the quasi-Newton methods are restricted.
+   */
+  void
+  setup_interface_rows();
+
+  /*
+   * Sets up an interface coupling whose src-side and dst-side are solved by the same processes or,
+   * for a disjoint process partitioning, by different processes. Processes without src-side (or
+   * dst-side) pass nullptr.
+   */
+  void
+  setup_interface_coupling(
+    InterfaceCoupling<dim, dim, Number> &                           coupling,
+    std::shared_ptr<ContainerInterfaceData<dim, dim, Number>> const interface_data_dst,
+    dealii::DoFHandler<dim> const *                                 dof_handler_src,
+    dealii::Mapping<dim> const *                                    mapping_src,
+    std::vector<bool> const &                                       marked_vertices_src) const;
+
+  /*
+   * Returns the value of the fluid solver on all processes (the fluid is the master that dictates
+   * the time stepping, and the processes of the structure do not know the fluid solver for a
+   * disjoint process partitioning).
+   */
+  template<typename T>
+  T
+  broadcast_from_fluid(T const & value) const;
+
   void
   set_start_time() const;
 
   void
   synchronize_time_step_size() const;
 
+  /*
+   * The interface couplings are split into start() and finish() so that the communication overlaps
+   * with work that does not depend on the transferred data. The vectors passed to start() have to
+   * remain valid until finish() has been called.
+   */
+  void
+  coupling_structure_to_ale_start(VectorType const & displacement_structure) const;
+
+  void
+  coupling_structure_to_ale_finish() const;
+
+  /*
+   * Computes the structure velocity (extrapolated or of the current iterate) and starts its
+   * transfer to the fluid.
+   */
   void
-  coupling_structure_to_ale(VectorType const & displacement_structure) const;
+  coupling_structure_to_fluid_start(VectorType & velocity_structure, bool const extrapolate) const;
 
   void
-  coupling_structure_to_fluid(bool const extrapolate) const;
+  coupling_structure_to_fluid_finish() const;
+
+  void
+  coupling_fluid_to_structure_start(VectorType const & stress_fluid) const;
+
+  void
+  coupling_fluid_to_structure_finish() const;
 
   void
   coupling_fluid_to_structure(bool const end_of_time_step) const;
 
+  /*
+   * Calculates the fluid stress acting on the structure at the fluid-structure interface.
+   */
+  void
+  calculate_stress_fluid(VectorType & stress_fluid, bool const end_of_time_step) const;
+
+  FixedPointProblem<VectorType>
+  make_fixed_point_problem_dirichlet_neumann() const;
+
+  FixedPointProblem<VectorType>
+  make_fixed_point_problem_parallel_jacobi() const;
+
+  bool
+  check_convergence_dirichlet_neumann(VectorType const & residual) const;
+
+  bool
+  check_convergence_parallel_jacobi(VectorType const & residual, VectorType const & x_tilde) const;
+
   void
   apply_dirichlet_neumann_scheme(VectorType &       d_tilde,
                                  VectorType const & d,
                                  unsigned int       iteration) const;
 
+  /*
+   * Parallel Jacobi scheme: x = (d, s) contains the interface displacement d and the fluid stress
+   * s acting on the structure, and the structure solve (given s) and the fluid solve (given d) are
+   * independent of each other.
+   */
+  void
+  apply_parallel_jacobi_scheme(VectorType &       x_tilde,
+                               VectorType const & x,
+                               unsigned int       iteration) const;
+
+  void
+  initialize_vectors_parallel_jacobi(VectorType & d, VectorType & s) const;
+
+  // x = (d, s)
+  void
+  merge_parallel_jacobi(VectorType & x, VectorType const & d, VectorType const & s) const;
+
+  // (d, s) = x
+  void
+  split_parallel_jacobi(VectorType & d, VectorType & s, VectorType const & x) const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
+  // distribution of the processes onto fluid and structure
+  std::shared_ptr<ProcessPartitioning const> partitioning;
+
   // output to std::cout
   dealii::ConditionalOStream pcout;
 
@@ -112,7 +209,13 @@ private:
   mutable TimerTree timer_tree;
 
   // Partitioned FSI solver
-  std::shared_ptr<PartitionedSolver<dim, Number>> partitioned_solver;
+  std::shared_ptr<PartitionedSolver<Number>> partitioned_solver;
+
+  // parallel Jacobi: parallel layout of the stacked vector of displacement and stress
+  std::shared_ptr<dealii::Utilities::MPI::Partitioner const> partitioner_parallel_jacobi;
+
+  // quasi-Newton methods: rows of the fixed-point vector at the interface (if restricted)
+  std::shared_ptr<std::vector<unsigned int> const> interface_rows;
 };
 
 } // namespace FSI
@@ -29,11 +29,9 @@
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
+#include <exadg/fluid_structure_interaction/precice/solver_interface.h>
 #include <exadg/matrix_free/integrators.h>
 
-// preCICE
-#include <precice/SolverInterface.hpp>
-
 namespace ExaDG
 {
 namespace preCICE
@@ -64,7 +62,7 @@ class CouplingBase
 {
 public:
   CouplingBase(std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> data,
-               std::shared_ptr<precice::SolverInterface>                                   precice,
+               std::shared_ptr<SolverInterface>                                            precice,
                std::string const                mesh_name,
                dealii::types::boundary_id const surface_id);
 
@@ -140,7 +138,7 @@ protected:
   std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> matrix_free;
 
   /// public precice solverinterface
-  std::shared_ptr<precice::SolverInterface> precice;
+  std::shared_ptr<SolverInterface> precice;
 
   /// Configuration parameters
   std::string const mesh_name;
@@ -162,7 +160,7 @@ protected:
 template<int dim, int data_dim, typename VectorizedArrayType>
 CouplingBase<dim, data_dim, VectorizedArrayType>::CouplingBase(
   std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> matrix_free_,
-  std::shared_ptr<precice::SolverInterface>                                   precice,
+  std::shared_ptr<SolverInterface>                                            precice,
   std::string const                                                           mesh_name,
   dealii::types::boundary_id const                                            surface_id)
   : matrix_free(matrix_free_),
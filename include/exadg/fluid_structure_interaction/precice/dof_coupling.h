@@ -44,7 +44,7 @@ class DoFCoupling : public CouplingBase<dim, data_dim, VectorizedArrayType>
 {
 public:
   DoFCoupling(std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> data,
-              std::shared_ptr<precice::SolverInterface>                                   precice,
+              std::shared_ptr<SolverInterface>                                            precice,
               std::string const                                                           mesh_name,
               dealii::types::boundary_id const surface_id,
               int const                        mf_dof_index);
@@ -87,7 +87,7 @@ private:
 template<int dim, int data_dim, typename VectorizedArrayType>
 DoFCoupling<dim, data_dim, VectorizedArrayType>::DoFCoupling(
   std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> data,
-  std::shared_ptr<precice::SolverInterface>                                   precice,
+  std::shared_ptr<SolverInterface>                                            precice,
   std::string const                                                           mesh_name,
   dealii::types::boundary_id const                                            surface_id,
   int const                                                                   mf_dof_index)
@@ -214,6 +214,7 @@ public:
     this->timer_tree.insert({"FSI"}, total_time);
 
     this->timer_tree.insert({"FSI"}, structure->time_integrator->get_timings(), "Structure");
+    this->timer_tree.insert({"FSI"}, this->precice->get_timings(), "Coupling");
 
     this->pcout << std::endl << "Timings for level 1:" << std::endl;
     this->timer_tree.print_level(this->pcout, 1);
@@ -40,7 +40,7 @@ class ExaDGCoupling : public CouplingBase<dim, data_dim, VectorizedArrayType>
 public:
   ExaDGCoupling(
     std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> data,
-    std::shared_ptr<precice::SolverInterface>                                   precice,
+    std::shared_ptr<SolverInterface>                                            precice,
     std::string const                                                           mesh_name,
     std::shared_ptr<ContainerInterfaceData<dim, data_dim, double>>              interface_data_,
     dealii::types::boundary_id const surface_id = dealii::numbers::invalid_unsigned_int);
@@ -83,7 +83,7 @@ private:
 template<int dim, int data_dim, typename VectorizedArrayType>
 ExaDGCoupling<dim, data_dim, VectorizedArrayType>::ExaDGCoupling(
   std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> data,
-  std::shared_ptr<precice::SolverInterface>                                   precice,
+  std::shared_ptr<SolverInterface>                                            precice,
   std::string const                                                           mesh_name,
   std::shared_ptr<ContainerInterfaceData<dim, data_dim, double>>              interface_data_,
   dealii::types::boundary_id const                                            surface_id)
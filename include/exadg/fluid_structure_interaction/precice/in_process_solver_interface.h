@@ -0,0 +1,405 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2022 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PRECICE_IN_PROCESS_SOLVER_INTERFACE_H_
+#define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PRECICE_IN_PROCESS_SOLVER_INTERFACE_H_
+
+// C/C++
+#include <cmath>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+#include <deal.II/numerics/rtree.h>
+
+// ExaDG
+#include <exadg/fluid_structure_interaction/precice/solver_interface.h>
+
+namespace ExaDG
+{
+namespace preCICE
+{
+/**
+ * In-process implementation of SolverInterface for partitioned simulations in which all
+ * participants run within one executable on disjoint sets of processes of a common communicator
+ * (e.g. MPI_COMM_WORLD split into a fluid and a structure communicator). It serves as a stand-in
+ * for preCICE to measure the costs of data mapping and communication without an installation of
+ * preCICE.
+ *
+ * The implementation corresponds to an explicit parallel coupling scheme with a nearest-neighbor
+ * mapping between the coupling meshes in preCICE terminology:
+ *
+ *  - Data is identified by its name only, i.e., data written by one participant is read by all
+ *    meshes of the other participant that use a data with the same name. Mesh names are local to a
+ *    participant.
+ *  - At the end of each time window (and in initializeData()), all data written since the last
+ *    exchange is gathered on all processes of the common communicator and the values at the read
+ *    vertices are taken from the nearest write vertex. The nearest neighbors are determined in the
+ *    first exchange of a data and reused afterwards (coupling meshes do not change).
+ *  - Implicit coupling (checkpointing) and data initialization are not supported, i.e., no action
+ *    is ever required from the participants.
+ *
+ * All participants have to call initialize(), initializeData(), and advance() collectively, with
+ * the same time window size and end time.
+ */
+template<int dim>
+class InProcessSolverInterface : public SolverInterface
+{
+public:
+  InProcessSolverInterface(MPI_Comm const & coupling_comm,
+                           double const     time_window_size,
+                           double const     end_time)
+    : coupling_comm(coupling_comm),
+      time_window_size(time_window_size),
+      end_time(end_time),
+      time(0.0),
+      time_window_time(0.0),
+      time_window_complete(false)
+  {
+    AssertThrow(time_window_size > 0.0,
+                dealii::ExcMessage("Time window size has to be larger than zero."));
+  }
+
+  int
+  getDimensions() const final
+  {
+    return dim;
+  }
+
+  int
+  getMeshID(std::string const & mesh_name) const final
+  {
+    auto const it = mesh_ids.find(mesh_name);
+    if(it != mesh_ids.end())
+      return it->second;
+
+    mesh_ids.emplace(mesh_name, meshes.size());
+    meshes.emplace_back();
+    return meshes.size() - 1;
+  }
+
+  int
+  getDataID(std::string const & data_name, int const mesh_id) final
+  {
+    for(unsigned int i = 0; i < data.size(); ++i)
+      if(data[i].name == data_name and data[i].mesh_id == mesh_id)
+        return i;
+
+    data.emplace_back(data_name, mesh_id);
+    return data.size() - 1;
+  }
+
+  int
+  setMeshVertex(int const mesh_id, double const * position) final
+  {
+    std::vector<double> & positions = meshes[mesh_id];
+    positions.insert(positions.end(), position, position + dim);
+
+    return positions.size() / dim - 1;
+  }
+
+  void
+  setMeshVertices(int const mesh_id, int const size, double const * positions, int * ids) final
+  {
+    for(int i = 0; i < size; ++i)
+      ids[i] = setMeshVertex(mesh_id, positions + dim * i);
+  }
+
+  int
+  getMeshVertexSize(int const mesh_id) const final
+  {
+    return meshes[mesh_id].size() / dim;
+  }
+
+  double
+  initialize() final
+  {
+    for(auto & entry : data)
+      entry.values.assign(meshes[entry.mesh_id].size(), 0.0);
+
+    return std::min(time_window_size, end_time - time);
+  }
+
+  void
+  initializeData() final
+  {
+    exchange_data();
+  }
+
+  double
+  advance(double const computed_time_step_size) final
+  {
+    AssertThrow(computed_time_step_size <=
+                  (time_window_size - time_window_time) * (1.0 + 1.e-12),
+                dealii::ExcMessage("The time step size exceeds the end of the time window."));
+
+    time_window_time += computed_time_step_size;
+
+    time_window_complete = (time_window_time >= time_window_size * (1.0 - 1.e-12));
+    if(time_window_complete)
+    {
+      time += time_window_size;
+      time_window_time = 0.0;
+
+      exchange_data();
+    }
+
+    return std::min(time_window_size - time_window_time, end_time - time);
+  }
+
+  bool
+  isCouplingOngoing() const final
+  {
+    return time < end_time - 1.e-12 * time_window_size;
+  }
+
+  bool
+  isTimeWindowComplete() const final
+  {
+    return time_window_complete;
+  }
+
+  bool
+  isWriteDataRequired(double const) const final
+  {
+    return true;
+  }
+
+  bool
+  isActionRequired(Action const) const final
+  {
+    return false;
+  }
+
+  void
+  markActionFulfilled(Action const) final
+  {
+  }
+
+  void
+  writeBlockVectorData(int const      data_id,
+                       int const      size,
+                       int const *    value_indices,
+                       double const * values) final
+  {
+    for(int i = 0; i < size; ++i)
+      writeVectorData(data_id, value_indices[i], values + dim * i);
+  }
+
+  void
+  writeBlockScalarData(int const      data_id,
+                       int const      size,
+                       int const *    value_indices,
+                       double const * values) final
+  {
+    for(int i = 0; i < size; ++i)
+      writeScalarData(data_id, value_indices[i], values[i]);
+  }
+
+  void
+  writeVectorData(int const data_id, int const value_index, double const * value) final
+  {
+    Data & entry   = data[data_id];
+    entry.is_write = true;
+    for(unsigned int d = 0; d < dim; ++d)
+      entry.values[dim * value_index + d] = value[d];
+  }
+
+  void
+  writeScalarData(int const data_id, int const value_index, double const value) final
+  {
+    // scalar data is stored in the first component
+    Data & entry                    = data[data_id];
+    entry.is_write                  = true;
+    entry.values[dim * value_index] = value;
+  }
+
+  void
+  readBlockVectorData(int const   data_id,
+                      int const   size,
+                      int const * value_indices,
+                      double *    values) const final
+  {
+    Data const & entry = data[data_id];
+    for(int i = 0; i < size; ++i)
+      for(unsigned int d = 0; d < dim; ++d)
+        values[dim * i + d] = entry.values[dim * value_indices[i] + d];
+  }
+
+private:
+  struct Data
+  {
+    Data(std::string const & name, int const mesh_id)
+      : name(name), mesh_id(mesh_id), is_write(false)
+    {
+    }
+
+    std::string name;
+    int         mesh_id;
+
+    // true if the data is written by this participant
+    bool is_write;
+
+    // values at all vertices of the mesh (dim components per vertex)
+    std::vector<double> values;
+
+    // read data: index of the nearest write vertex (in the gathered write mesh) of each vertex
+    std::vector<unsigned int> nearest_write_vertex;
+  };
+
+  /*
+   * Collective operation on coupling_comm: transfers the values of all write data to the read data
+   * of the same name.
+   */
+  void
+  exchange_data()
+  {
+    // names of all data written on any process
+    std::vector<std::string> local_write_names;
+    for(auto const & entry : data)
+      if(entry.is_write)
+        local_write_names.push_back(entry.name);
+
+    std::set<std::string> write_names;
+    for(auto const & names : dealii::Utilities::MPI::all_gather(coupling_comm, local_write_names))
+      write_names.insert(names.begin(), names.end());
+
+    for(auto const & name : write_names)
+    {
+      // vertices and values of the write data on this process (if any)
+      std::vector<double> local_positions, local_values;
+      for(auto const & entry : data)
+      {
+        if(entry.is_write and entry.name == name)
+        {
+          local_positions = meshes[entry.mesh_id];
+          local_values    = entry.values;
+        }
+      }
+
+      // the write vertices are only gathered in the first exchange of a data
+      bool const need_positions =
+        dealii::Utilities::MPI::max(has_read_data_without_mapping(name) ? 1 : 0, coupling_comm) ==
+        1;
+
+      std::vector<double> write_positions;
+      if(need_positions)
+        write_positions = concatenate(
+          dealii::Utilities::MPI::all_gather(coupling_comm, local_positions));
+
+      std::vector<double> const write_values =
+        concatenate(dealii::Utilities::MPI::all_gather(coupling_comm, local_values));
+
+      for(auto & entry : data)
+      {
+        if(entry.is_write or entry.name != name)
+          continue;
+
+        if(entry.nearest_write_vertex.empty() and meshes[entry.mesh_id].size() > 0)
+          entry.nearest_write_vertex = find_nearest_vertices(meshes[entry.mesh_id], write_positions);
+
+        for(unsigned int i = 0; i < entry.nearest_write_vertex.size(); ++i)
+          for(unsigned int d = 0; d < dim; ++d)
+            entry.values[dim * i + d] = write_values[dim * entry.nearest_write_vertex[i] + d];
+      }
+    }
+  }
+
+  bool
+  has_read_data_without_mapping(std::string const & name) const
+  {
+    for(auto const & entry : data)
+      if(not(entry.is_write) and entry.name == name and entry.nearest_write_vertex.empty() and
+         meshes[entry.mesh_id].size() > 0)
+        return true;
+
+    return false;
+  }
+
+  static std::vector<double>
+  concatenate(std::vector<std::vector<double>> const & vectors)
+  {
+    std::vector<double> result;
+    for(auto const & vector : vectors)
+      result.insert(result.end(), vector.begin(), vector.end());
+
+    return result;
+  }
+
+  static std::vector<unsigned int>
+  find_nearest_vertices(std::vector<double> const & read_positions,
+                        std::vector<double> const & write_positions)
+  {
+    AssertThrow(write_positions.size() > 0,
+                dealii::ExcMessage("No write vertices found for read data."));
+
+    std::vector<std::pair<dealii::Point<dim>, unsigned int>> write_points;
+    for(unsigned int i = 0; i < write_positions.size() / dim; ++i)
+      write_points.emplace_back(to_point(write_positions.data() + dim * i), i);
+
+    auto const rtree = dealii::pack_rtree(write_points);
+
+    std::vector<unsigned int> nearest(read_positions.size() / dim);
+    for(unsigned int i = 0; i < nearest.size(); ++i)
+    {
+      std::vector<std::pair<dealii::Point<dim>, unsigned int>> result;
+      rtree.query(boost::geometry::index::nearest(to_point(read_positions.data() + dim * i), 1),
+                  std::back_inserter(result));
+      nearest[i] = result[0].second;
+    }
+
+    return nearest;
+  }
+
+  static dealii::Point<dim>
+  to_point(double const * position)
+  {
+    dealii::Point<dim> point;
+    for(unsigned int d = 0; d < dim; ++d)
+      point[d] = position[d];
+    return point;
+  }
+
+  MPI_Comm const coupling_comm;
+
+  double const time_window_size;
+  double const end_time;
+
+  double time;
+  double time_window_time;
+  bool   time_window_complete;
+
+  // vertex positions of each mesh (dim coordinates per vertex)
+  mutable std::map<std::string, int>       mesh_ids;
+  mutable std::vector<std::vector<double>> meshes;
+
+  std::vector<Data> data;
+};
+
+} // namespace preCICE
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PRECICE_IN_PROCESS_SOLVER_INTERFACE_H_ */
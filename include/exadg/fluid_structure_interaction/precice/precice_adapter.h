@@ -25,6 +25,7 @@
 // deal.II
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/fe/fe.h>
@@ -35,10 +36,10 @@
 // ExaDG
 #include <exadg/fluid_structure_interaction/precice/dof_coupling.h>
 #include <exadg/fluid_structure_interaction/precice/exadg_coupling.h>
+#include <exadg/fluid_structure_interaction/precice/in_process_solver_interface.h>
 #include <exadg/fluid_structure_interaction/precice/quad_coupling.h>
-
-// preCICE
-#include <precice/SolverInterface.hpp>
+#include <exadg/fluid_structure_interaction/precice/solver_interface.h>
+#include <exadg/utilities/timer_tree.h>
 
 #include <ostream>
 
@@ -185,11 +186,17 @@ public:
   bool
   is_time_window_complete() const;
 
+  /**
+   * @brief get_timings Returns the accumulated wall times of writing data, advancing the coupling
+   *        library (including the data exchange), and reading data
+   */
+  std::shared_ptr<TimerTree>
+  get_timings() const;
 
 private:
   // public precice solverinterface, needed in order to steer the time loop
   // inside the solver.
-  std::shared_ptr<precice::SolverInterface> precice;
+  std::shared_ptr<SolverInterface> precice;
 
   /// The objects handling reading and writing data
   std::map<std::string, std::shared_ptr<CouplingBase<dim, data_dim, VectorizedArrayType>>> writer;
@@ -200,6 +207,9 @@ private:
 
   // Container to store time dependent data in case of an implicit coupling
   std::vector<VectorType> old_state_data;
+
+  // Computation time (wall clock time) of write, advance, and read
+  std::shared_ptr<TimerTree> timer_tree;
 };
 
 
@@ -208,13 +218,34 @@ template<int dim, int data_dim, typename VectorType, typename VectorizedArrayTyp
 template<typename ParameterClass>
 Adapter<dim, data_dim, VectorType, VectorizedArrayType>::Adapter(ParameterClass const & parameters,
                                                                  MPI_Comm               mpi_comm)
-
+  : timer_tree(std::make_shared<TimerTree>())
 {
-  precice =
-    std::make_shared<precice::SolverInterface>(parameters.participant_name,
+  if(parameters.coupling_library == "InProcess")
+  {
+    // all participants run within the same executable on disjoint subsets of MPI_COMM_WORLD
+    precice = std::make_shared<InProcessSolverInterface<dim>>(MPI_COMM_WORLD,
+                                                              parameters.time_window_size,
+                                                              parameters.end_time);
+  }
+  else if(parameters.coupling_library == "preCICE")
+  {
+#ifdef EXADG_WITH_PRECICE
+    precice =
+      std::make_shared<PreciceSolverInterface>(parameters.participant_name,
                                                parameters.config_file,
                                                dealii::Utilities::MPI::this_mpi_process(mpi_comm),
                                                dealii::Utilities::MPI::n_mpi_processes(mpi_comm));
+#else
+    (void)mpi_comm;
+    AssertThrow(false,
+                dealii::ExcMessage("ExaDG has been built without preCICE. Set "
+                                   "EXADG_WITH_PRECICE=ON or use the InProcess coupling library."));
+#endif
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Unknown coupling library."));
+  }
 
   AssertThrow(dim == precice->getDimensions(), dealii::ExcInternalError());
   AssertThrow(dim > 1, dealii::ExcNotImplemented());
@@ -304,11 +335,11 @@ Adapter<dim, data_dim, VectorType, VectorizedArrayType>::initialize_precice(
   // writer->process_coupling_mesh();
 
   // write initial writeData to preCICE if required
-  if(precice->isActionRequired(precice::constants::actionWriteInitialData()))
+  if(precice->isActionRequired(Action::WriteInitialData))
   {
     writer[0]->write_data(dealii_to_precice, "");
 
-    precice->markActionFulfilled(precice::constants::actionWriteInitialData());
+    precice->markActionFulfilled(Action::WriteInitialData);
   }
   precice->initializeData();
 
@@ -330,8 +361,13 @@ Adapter<dim, data_dim, VectorType, VectorizedArrayType>::write_data(
   VectorType const &  dealii_to_precice,
   double const        computed_timestep_length)
 {
+  dealii::Timer timer;
+  timer.restart();
+
   if(precice->isWriteDataRequired(computed_timestep_length))
     writer.at(write_mesh_name)->write_data(dealii_to_precice, write_data_name);
+
+  timer_tree->insert({"Write"}, timer.wall_time());
 }
 
 template<int dim, int data_dim, typename VectorType, typename VectorizedArrayType>
@@ -339,9 +375,16 @@ double
 Adapter<dim, data_dim, VectorType, VectorizedArrayType>::advance(
   double const computed_timestep_length)
 {
+  dealii::Timer timer;
+  timer.restart();
+
   // Here, we need to specify the computed time step length and pass it to
   // preCICE
-  return precice->advance(computed_timestep_length);
+  double const allowed_time_step_size = precice->advance(computed_timestep_length);
+
+  timer_tree->insert({"Advance"}, timer.wall_time());
+
+  return allowed_time_step_size;
 }
 
 
@@ -352,7 +395,12 @@ Adapter<dim, data_dim, VectorType, VectorizedArrayType>::read_block_data(
   std::string const & mesh_name,
   std::string const & data_name) const
 {
+  dealii::Timer timer;
+  timer.restart();
+
   reader.at(mesh_name)->read_block_data(data_name);
+
+  timer_tree->insert({"Read"}, timer.wall_time());
 }
 
 
@@ -364,10 +412,10 @@ Adapter<dim, data_dim, VectorType, VectorizedArrayType>::save_current_state_if_r
 {
   // First, we let preCICE check, whether we need to store the variables.
   // Then, the data is stored in the class
-  if(precice->isActionRequired(precice::constants::actionWriteIterationCheckpoint()))
+  if(precice->isActionRequired(Action::WriteIterationCheckpoint))
   {
     save_state();
-    precice->markActionFulfilled(precice::constants::actionWriteIterationCheckpoint());
+    precice->markActionFulfilled(Action::WriteIterationCheckpoint);
   }
 }
 
@@ -380,10 +428,10 @@ Adapter<dim, data_dim, VectorType, VectorizedArrayType>::reload_old_state_if_req
 {
   // In case we need to reload a state, we just take the internally stored
   // data vectors and write then in to the input data
-  if(precice->isActionRequired(precice::constants::actionReadIterationCheckpoint()))
+  if(precice->isActionRequired(Action::ReadIterationCheckpoint))
   {
     reload_old_state();
-    precice->markActionFulfilled(precice::constants::actionReadIterationCheckpoint());
+    precice->markActionFulfilled(Action::ReadIterationCheckpoint);
   }
 }
 
@@ -406,6 +454,15 @@ Adapter<dim, data_dim, VectorType, VectorizedArrayType>::is_time_window_complete
 }
 
 
+
+template<int dim, int data_dim, typename VectorType, typename VectorizedArrayType>
+std::shared_ptr<TimerTree>
+Adapter<dim, data_dim, VectorType, VectorizedArrayType>::get_timings() const
+{
+  return timer_tree;
+}
+
+
 } // namespace preCICE
 } // namespace ExaDG
 
@@ -43,6 +43,7 @@ struct ConfigurationParameters
 
   ConfigurationParameters(std::string const & input_file);
 
+  std::string coupling_library         = "preCICE";
   std::string config_file              = "precice config-file";
   std::string physics                  = "undefined";
   std::string participant_name         = "exadg";
@@ -56,6 +57,10 @@ struct ConfigurationParameters
 
   WriteDataType write_data_type = WriteDataType::undefined;
 
+  // only used by the in-process coupling library (specified in precice-config.xml otherwise)
+  double time_window_size = 0.0;
+  double end_time         = 0.0;
+
   void
   add_parameters(dealii::ParameterHandler & prm);
 
@@ -81,6 +86,10 @@ ConfigurationParameters::add_parameters(dealii::ParameterHandler & prm)
 {
   prm.enter_subsection("preciceConfiguration");
   {
+    prm.add_parameter("CouplingLibrary",
+                      coupling_library,
+                      "Coupling library (preCICE or in-process coupling within one executable)",
+                      dealii::Patterns::Selection("preCICE|InProcess"));
     prm.add_parameter("preciceConfigFile",
                       config_file,
                       "Name of the precice configuration file",
@@ -123,6 +132,14 @@ ConfigurationParameters::add_parameters(dealii::ParameterHandler & prm)
                       stress_data_name,
                       "Name of the Stress data in the precice-config.xml file",
                       dealii::Patterns::Anything());
+    prm.add_parameter("InProcessTimeWindowSize",
+                      time_window_size,
+                      "Time window size of the in-process coupling library",
+                      dealii::Patterns::Double(0.0));
+    prm.add_parameter("InProcessEndTime",
+                      end_time,
+                      "End time of the in-process coupling library",
+                      dealii::Patterns::Double(0.0));
   }
   prm.leave_subsection();
 }
@@ -42,7 +42,7 @@ class QuadCoupling : public CouplingBase<dim, data_dim, VectorizedArrayType>
 {
 public:
   QuadCoupling(std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> data,
-               std::shared_ptr<precice::SolverInterface>                                   precice,
+               std::shared_ptr<SolverInterface>                                            precice,
                std::string const                mesh_name,
                dealii::types::boundary_id const surface_id,
                int const                        mf_dof_index,
@@ -110,7 +110,7 @@ private:
 template<int dim, int data_dim, typename VectorizedArrayType>
 QuadCoupling<dim, data_dim, VectorizedArrayType>::QuadCoupling(
   std::shared_ptr<dealii::MatrixFree<dim, double, VectorizedArrayType> const> data,
-  std::shared_ptr<precice::SolverInterface>                                   precice,
+  std::shared_ptr<SolverInterface>                                            precice,
   std::string const                                                           mesh_name,
   dealii::types::boundary_id const                                            surface_id,
   int const                                                                   mf_dof_index_,
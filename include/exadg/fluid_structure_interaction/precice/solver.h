@@ -123,7 +123,9 @@ main(int argc, char ** argv)
     {
       // clang-format off
       std::cout << "To run the program, use:      ./solver input_file" << std::endl
-                << "To setup the input file, use: ./solver input_file --help" << std::endl;
+                << "To setup the input file, use: ./solver input_file --help" << std::endl
+                << "To run two participants coupled in-process, use:" << std::endl
+                << "                              ./solver input_file_1 input_file_2" << std::endl;
       // clang-format on
     }
 
@@ -142,6 +144,24 @@ main(int argc, char ** argv)
     }
   }
 
+  // In-process coupling: both participants run within this executable on disjoint halves of
+  // MPI_COMM_WORLD, each with its own input file.
+  bool const in_process = (argc == 3 and std::string(argv[2]) != "--help");
+  if(in_process)
+  {
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+    unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+    AssertThrow(n_processes >= 2,
+                dealii::ExcMessage("In-process coupling requires at least two MPI processes."));
+
+    unsigned int const participant = (rank < n_processes / 2) ? 0 : 1;
+    input_file                     = std::string(argv[1 + participant]);
+
+    int const ierr = MPI_Comm_split(MPI_COMM_WORLD, participant, rank, &mpi_comm);
+    AssertThrowMPI(ierr);
+  }
+
   ExaDG::GeneralParameters general(input_file);
 
   // run the simulation
@@ -152,6 +172,9 @@ main(int argc, char ** argv)
   else
     AssertThrow(false, dealii::ExcMessage("Only dim = 2|3 and precision=double implemented."));
 
+  if(in_process)
+    MPI_Comm_free(&mpi_comm);
+
   return EXIT_SUCCESS;
 }
 
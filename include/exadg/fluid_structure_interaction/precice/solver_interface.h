@@ -0,0 +1,289 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2022 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PRECICE_SOLVER_INTERFACE_H_
+#define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PRECICE_SOLVER_INTERFACE_H_
+
+// C/C++
+#include <string>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// preCICE
+#ifdef EXADG_WITH_PRECICE
+#  include <precice/SolverInterface.hpp>
+#endif
+
+namespace ExaDG
+{
+namespace preCICE
+{
+/**
+ * Actions of the coupling library that might be required from the solver.
+ */
+enum class Action
+{
+  WriteInitialData,
+  WriteIterationCheckpoint,
+  ReadIterationCheckpoint
+};
+
+/**
+ * Abstract interface to the coupling library used by the Adapter and the CouplingBase classes.
+ * The functions are a subset of the preCICE (v2) API and have the same names and semantics, so
+ * that the coupling library can be exchanged (e.g. preCICE or the in-process implementation
+ * InProcessSolverInterface) without changes in the drivers of the participants.
+ */
+class SolverInterface
+{
+public:
+  virtual ~SolverInterface() = default;
+
+  virtual int
+  getDimensions() const = 0;
+
+  virtual int
+  getMeshID(std::string const & mesh_name) const = 0;
+
+  virtual int
+  getDataID(std::string const & data_name, int const mesh_id) = 0;
+
+  virtual int
+  setMeshVertex(int const mesh_id, double const * position) = 0;
+
+  virtual void
+  setMeshVertices(int const mesh_id, int const size, double const * positions, int * ids) = 0;
+
+  virtual int
+  getMeshVertexSize(int const mesh_id) const = 0;
+
+  virtual double
+  initialize() = 0;
+
+  virtual void
+  initializeData() = 0;
+
+  virtual double
+  advance(double const computed_time_step_size) = 0;
+
+  virtual bool
+  isCouplingOngoing() const = 0;
+
+  virtual bool
+  isTimeWindowComplete() const = 0;
+
+  virtual bool
+  isWriteDataRequired(double const computed_time_step_size) const = 0;
+
+  virtual bool
+  isActionRequired(Action const action) const = 0;
+
+  virtual void
+  markActionFulfilled(Action const action) = 0;
+
+  virtual void
+  writeBlockVectorData(int const      data_id,
+                       int const      size,
+                       int const *    value_indices,
+                       double const * values) = 0;
+
+  virtual void
+  writeBlockScalarData(int const      data_id,
+                       int const      size,
+                       int const *    value_indices,
+                       double const * values) = 0;
+
+  virtual void
+  writeVectorData(int const data_id, int const value_index, double const * value) = 0;
+
+  virtual void
+  writeScalarData(int const data_id, int const value_index, double const value) = 0;
+
+  virtual void
+  readBlockVectorData(int const   data_id,
+                      int const   size,
+                      int const * value_indices,
+                      double *    values) const = 0;
+};
+
+#ifdef EXADG_WITH_PRECICE
+/**
+ * Implementation of SolverInterface forwarding all calls to preCICE.
+ */
+class PreciceSolverInterface : public SolverInterface
+{
+public:
+  PreciceSolverInterface(std::string const & participant_name,
+                         std::string const & config_file,
+                         int const           process_index,
+                         int const           n_processes)
+    : precice(participant_name, config_file, process_index, n_processes)
+  {
+  }
+
+  int
+  getDimensions() const final
+  {
+    return precice.getDimensions();
+  }
+
+  int
+  getMeshID(std::string const & mesh_name) const final
+  {
+    return precice.getMeshID(mesh_name);
+  }
+
+  int
+  getDataID(std::string const & data_name, int const mesh_id) final
+  {
+    return precice.getDataID(data_name, mesh_id);
+  }
+
+  int
+  setMeshVertex(int const mesh_id, double const * position) final
+  {
+    return precice.setMeshVertex(mesh_id, position);
+  }
+
+  void
+  setMeshVertices(int const mesh_id, int const size, double const * positions, int * ids) final
+  {
+    precice.setMeshVertices(mesh_id, size, positions, ids);
+  }
+
+  int
+  getMeshVertexSize(int const mesh_id) const final
+  {
+    return precice.getMeshVertexSize(mesh_id);
+  }
+
+  double
+  initialize() final
+  {
+    return precice.initialize();
+  }
+
+  void
+  initializeData() final
+  {
+    precice.initializeData();
+  }
+
+  double
+  advance(double const computed_time_step_size) final
+  {
+    return precice.advance(computed_time_step_size);
+  }
+
+  bool
+  isCouplingOngoing() const final
+  {
+    return precice.isCouplingOngoing();
+  }
+
+  bool
+  isTimeWindowComplete() const final
+  {
+    return precice.isTimeWindowComplete();
+  }
+
+  bool
+  isWriteDataRequired(double const computed_time_step_size) const final
+  {
+    return precice.isWriteDataRequired(computed_time_step_size);
+  }
+
+  bool
+  isActionRequired(Action const action) const final
+  {
+    return precice.isActionRequired(get_action_name(action));
+  }
+
+  void
+  markActionFulfilled(Action const action) final
+  {
+    precice.markActionFulfilled(get_action_name(action));
+  }
+
+  void
+  writeBlockVectorData(int const      data_id,
+                       int const      size,
+                       int const *    value_indices,
+                       double const * values) final
+  {
+    precice.writeBlockVectorData(data_id, size, value_indices, values);
+  }
+
+  void
+  writeBlockScalarData(int const      data_id,
+                       int const      size,
+                       int const *    value_indices,
+                       double const * values) final
+  {
+    precice.writeBlockScalarData(data_id, size, value_indices, values);
+  }
+
+  void
+  writeVectorData(int const data_id, int const value_index, double const * value) final
+  {
+    precice.writeVectorData(data_id, value_index, value);
+  }
+
+  void
+  writeScalarData(int const data_id, int const value_index, double const value) final
+  {
+    precice.writeScalarData(data_id, value_index, value);
+  }
+
+  void
+  readBlockVectorData(int const   data_id,
+                      int const   size,
+                      int const * value_indices,
+                      double *    values) const final
+  {
+    precice.readBlockVectorData(data_id, size, value_indices, values);
+  }
+
+private:
+  static std::string const &
+  get_action_name(Action const action)
+  {
+    if(action == Action::WriteInitialData)
+      return precice::constants::actionWriteInitialData();
+    else if(action == Action::WriteIterationCheckpoint)
+      return precice::constants::actionWriteIterationCheckpoint();
+    else if(action == Action::ReadIterationCheckpoint)
+      return precice::constants::actionReadIterationCheckpoint();
+
+    AssertThrow(false, dealii::ExcNotImplemented());
+    return precice::constants::actionWriteInitialData();
+  }
+
+  precice::SolverInterface precice;
+};
+#endif
+
+} // namespace preCICE
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PRECICE_SOLVER_INTERFACE_H_ */
@@ -0,0 +1,132 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PROCESS_PARTITIONING_H_
+#define INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PROCESS_PARTITIONING_H_
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/fluid_structure_interaction/acceleration_schemes/parameters.h>
+
+namespace ExaDG
+{
+namespace FSI
+{
+/*
+ * Distribution of the processes of mpi_comm onto the fluid and the structure solver. By default,
+ * all processes solve both fields. For the parallel Jacobi scheme, the first
+ * n_processes_structure processes may solve the structure and the remaining processes the fluid,
+ * so that both field solves of a partitioned iteration run concurrently. In this case, each field
+ * lives on its own sub-communicator, and the interface data is exchanged over mpi_comm.
+ */
+class ProcessPartitioning
+{
+public:
+  ProcessPartitioning(MPI_Comm const & mpi_comm, Parameters const & parameters)
+    : field_comm(mpi_comm),
+      rank(dealii::Utilities::MPI::this_mpi_process(mpi_comm)),
+      n_processes_structure(parameters.n_processes_structure)
+  {
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    if(n_processes_structure > 0)
+    {
+      AssertThrow(parameters.coupling_scheme == "ParallelJacobi",
+                  dealii::ExcMessage("Fluid and structure can only be solved on disjoint sets of "
+                                     "processes for the ParallelJacobi coupling scheme."));
+
+      AssertThrow(n_processes_structure < n_processes,
+                  dealii::ExcMessage("The number of processes of the structure has to be smaller "
+                                     "than the total number of processes."));
+
+      int const ierr =
+        MPI_Comm_split(mpi_comm, rank < n_processes_structure ? 0 : 1, rank, &field_comm);
+      AssertThrowMPI(ierr);
+    }
+  }
+
+  ~ProcessPartitioning()
+  {
+    if(is_disjoint())
+      MPI_Comm_free(&field_comm);
+  }
+
+  ProcessPartitioning(ProcessPartitioning const &) = delete;
+
+  ProcessPartitioning &
+  operator=(ProcessPartitioning const &) = delete;
+
+  /*
+   * Returns true if fluid and structure are solved on disjoint sets of processes.
+   */
+  bool
+  is_disjoint() const
+  {
+    return n_processes_structure > 0;
+  }
+
+  bool
+  is_structure_process() const
+  {
+    return not(is_disjoint()) or rank < n_processes_structure;
+  }
+
+  bool
+  is_fluid_process() const
+  {
+    return not(is_disjoint()) or rank >= n_processes_structure;
+  }
+
+  /*
+   * Rank (in mpi_comm) of the first process solving the fluid.
+   */
+  unsigned int
+  get_root_fluid() const
+  {
+    return n_processes_structure;
+  }
+
+  /*
+   * Communicator of the field(s) solved by this process, i.e., mpi_comm if both fields are solved
+   * by all processes and the sub-communicator of the fluid or the structure otherwise.
+   */
+  MPI_Comm const &
+  get_field_communicator() const
+  {
+    return field_comm;
+  }
+
+private:
+  MPI_Comm field_comm;
+
+  // rank of this process in mpi_comm
+  unsigned int const rank;
+
+  unsigned int const n_processes_structure;
+};
+
+} // namespace FSI
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FLUID_STRUCTURE_INTERACTION_PROCESS_PARTITIONING_H_ */
@@ -30,6 +30,7 @@
 #include <exadg/fluid_structure_interaction/driver.h>
 #include <exadg/fluid_structure_interaction/user_interface/declare_get_application.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/kernel_profiler.h>
 
 namespace ExaDG
 {
@@ -63,11 +64,17 @@ run(std::string const & input_file, MPI_Comm const & mpi_comm, bool const is_tes
   dealii::Timer timer;
   timer.restart();
 
+  // distribute the processes onto fluid and structure
+  std::shared_ptr<FSI::ProcessPartitioning const> partitioning =
+    std::make_shared<FSI::ProcessPartitioning>(mpi_comm, FSI::Parameters(input_file));
+
+  // Both fields of the application are created on the communicator of the field(s) solved by this
+  // process, but only the field(s) of this process are set up by the driver.
   std::shared_ptr<FSI::ApplicationBase<dim, Number>> application =
-    FSI::get_application<dim, Number>(input_file, mpi_comm);
+    FSI::get_application<dim, Number>(input_file, partitioning->get_field_communicator());
 
-  std::shared_ptr<FSI::Driver<dim, Number>> driver =
-    std::make_shared<FSI::Driver<dim, Number>>(input_file, mpi_comm, application, is_test);
+  std::shared_ptr<FSI::Driver<dim, Number>> driver = std::make_shared<FSI::Driver<dim, Number>>(
+    input_file, mpi_comm, partitioning, application, is_test);
 
   driver->setup();
 
@@ -114,6 +121,8 @@ main(int argc, char ** argv)
 
   ExaDG::GeneralParameters general(input_file);
 
+  ExaDG::KernelProfiler::enable(general.kernel_profiling);
+
   // run the simulation
   if(general.dim == 2 && general.precision == "float")
     ExaDG::run<2, float>(input_file, mpi_comm, general.is_test);
@@ -127,6 +136,8 @@ main(int argc, char ** argv)
     AssertThrow(false,
                 dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
 
+  ExaDG::KernelProfiler::print_results(mpi_comm);
+
   return 0;
 }
 
@@ -33,14 +33,17 @@
 
 namespace ExaDG
 {
-template<int rank, int dim, typename Number>
+template<int rank,
+         int dim,
+         typename Number,
+         typename VectorizedArrayType = dealii::VectorizedArray<Number>>
 struct FunctionEvaluator
 {
   static inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
-    value(std::shared_ptr<dealii::Function<dim>>                      function,
-          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
-          double const &                                              time)
+    dealii::Tensor<rank, dim, VectorizedArrayType>
+    value(std::shared_ptr<dealii::Function<dim>>          function,
+          dealii::Point<dim, VectorizedArrayType> const & q_points,
+          double const &                                  time)
   {
     (void)function;
     (void)q_points;
@@ -48,11 +51,11 @@ struct FunctionEvaluator
 
     AssertThrow(false, dealii::ExcMessage("should not arrive here."));
 
-    return dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>();
+    return dealii::Tensor<rank, dim, VectorizedArrayType>();
   }
 
   static inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+    dealii::Tensor<rank, dim, VectorizedArrayType>
     value(std::shared_ptr<FunctionCached<rank, dim>> function,
           unsigned int const                         face,
           unsigned int const                         q,
@@ -65,15 +68,15 @@ struct FunctionEvaluator
 
     AssertThrow(false, dealii::ExcMessage("should not arrive here."));
 
-    return dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>();
+    return dealii::Tensor<rank, dim, VectorizedArrayType>();
   }
 
   static inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
-    value(std::shared_ptr<dealii::Function<dim>>                          function,
-          dealii::Point<dim, dealii::VectorizedArray<Number>> const &     q_points,
-          dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & normals,
-          double const &                                                  time)
+    dealii::Tensor<rank, dim, VectorizedArrayType>
+    value(std::shared_ptr<dealii::Function<dim>>              function,
+          dealii::Point<dim, VectorizedArrayType> const &     q_points,
+          dealii::Tensor<1, dim, VectorizedArrayType> const & normals,
+          double const &                                      time)
   {
     (void)function;
     (void)q_points;
@@ -82,23 +85,23 @@ struct FunctionEvaluator
 
     AssertThrow(false, dealii::ExcMessage("not implemented."));
 
-    return dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>();
+    return dealii::Tensor<rank, dim, VectorizedArrayType>();
   }
 };
 
-template<int dim, typename Number>
-struct FunctionEvaluator<0, dim, Number>
+template<int dim, typename Number, typename VectorizedArrayType>
+struct FunctionEvaluator<0, dim, Number, VectorizedArrayType>
 {
   static inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<0, dim, dealii::VectorizedArray<Number>>
-    value(std::shared_ptr<dealii::Function<dim>>                      function,
-          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
-          double const &                                              time)
+    dealii::Tensor<0, dim, VectorizedArrayType>
+    value(std::shared_ptr<dealii::Function<dim>>          function,
+          dealii::Point<dim, VectorizedArrayType> const & q_points,
+          double const &                                  time)
   {
-    dealii::VectorizedArray<Number> value = dealii::make_vectorized_array<Number>(0.0);
+    VectorizedArrayType value = dealii::make_vectorized_array<VectorizedArrayType>(0.0);
 
-    Number array[dealii::VectorizedArray<Number>::size()];
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    Number array[VectorizedArrayType::size()];
+    for(unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
     {
       dealii::Point<dim> q_point;
       for(unsigned int d = 0; d < dim; ++d)
@@ -113,16 +116,16 @@ struct FunctionEvaluator<0, dim, Number>
   }
 
   static inline DEAL_II_ALWAYS_INLINE //
-      dealii::Tensor<0, dim, dealii::VectorizedArray<Number>>
+      dealii::Tensor<0, dim, VectorizedArrayType>
       value(std::shared_ptr<FunctionCached<0, dim>> function,
             unsigned int const                      face,
             unsigned int const                      q,
             unsigned int const                      quad_index)
   {
-    dealii::VectorizedArray<Number> value = dealii::make_vectorized_array<Number>(0.0);
+    VectorizedArrayType value = dealii::make_vectorized_array<VectorizedArrayType>(0.0);
 
-    Number array[dealii::VectorizedArray<Number>::size()];
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    Number array[VectorizedArrayType::size()];
+    for(unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
     {
       array[v] = function->tensor_value(face, q, v, quad_index);
     }
@@ -132,21 +135,21 @@ struct FunctionEvaluator<0, dim, Number>
   }
 };
 
-template<int dim, typename Number>
-struct FunctionEvaluator<1, dim, Number>
+template<int dim, typename Number, typename VectorizedArrayType>
+struct FunctionEvaluator<1, dim, Number, VectorizedArrayType>
 {
   static inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
-    value(std::shared_ptr<dealii::Function<dim>>                      function,
-          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
-          double const &                                              time)
+    dealii::Tensor<1, dim, VectorizedArrayType>
+    value(std::shared_ptr<dealii::Function<dim>>          function,
+          dealii::Point<dim, VectorizedArrayType> const & q_points,
+          double const &                                  time)
   {
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+    dealii::Tensor<1, dim, VectorizedArrayType> value;
 
     for(unsigned int d = 0; d < dim; ++d)
     {
-      Number array[dealii::VectorizedArray<Number>::size()];
-      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+      Number array[VectorizedArrayType::size()];
+      for(unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
       {
         dealii::Point<dim> q_point;
         for(unsigned int d = 0; d < dim; ++d)
@@ -162,24 +165,24 @@ struct FunctionEvaluator<1, dim, Number>
   }
 
   static inline DEAL_II_ALWAYS_INLINE //
-      dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
+      dealii::Tensor<1, dim, VectorizedArrayType>
       value(std::shared_ptr<FunctionCached<1, dim>> function,
             unsigned int const                      face,
             unsigned int const                      q,
             unsigned int const                      quad_index)
   {
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+    dealii::Tensor<1, dim, VectorizedArrayType> value;
 
-    dealii::Tensor<1, dim, Number> tensor_array[dealii::VectorizedArray<Number>::size()];
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    dealii::Tensor<1, dim, Number> tensor_array[VectorizedArrayType::size()];
+    for(unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
     {
       tensor_array[v] = function->tensor_value(face, q, v, quad_index);
     }
 
     for(unsigned int d = 0; d < dim; ++d)
     {
-      dealii::VectorizedArray<Number> array;
-      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+      VectorizedArrayType array;
+      for(unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
         array[v] = tensor_array[v][d];
 
       value[d].load(&array[0]);
@@ -189,20 +192,20 @@ struct FunctionEvaluator<1, dim, Number>
   }
 
   static inline DEAL_II_ALWAYS_INLINE //
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
-    value(std::shared_ptr<dealii::Function<dim>>                          function,
-          dealii::Point<dim, dealii::VectorizedArray<Number>> const &     q_points,
-          dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & normals,
-          double const &                                                  time)
+    dealii::Tensor<1, dim, VectorizedArrayType>
+    value(std::shared_ptr<dealii::Function<dim>>              function,
+          dealii::Point<dim, VectorizedArrayType> const &     q_points,
+          dealii::Tensor<1, dim, VectorizedArrayType> const & normals,
+          double const &                                      time)
   {
     auto function_with_normal = std::dynamic_pointer_cast<FunctionWithNormal<dim>>(function);
 
-    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+    dealii::Tensor<1, dim, VectorizedArrayType> value;
 
     for(unsigned int d = 0; d < dim; ++d)
     {
-      Number array[dealii::VectorizedArray<Number>::size()];
-      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+      Number array[VectorizedArrayType::size()];
+      for(unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
       {
         dealii::Point<dim>     q_point;
         dealii::Tensor<1, dim> normal;
@@ -116,7 +116,12 @@ ContainerInterfaceData<dim, n_components, Number>::get_array_solution(quad_index
 }
 
 template<int dim, int n_components, typename Number>
-InterfaceCoupling<dim, n_components, Number>::InterfaceCoupling() : dof_handler_src(nullptr)
+InterfaceCoupling<dim, n_components, Number>::InterfaceCoupling()
+  : dof_handler_src(nullptr),
+    mapping_src(nullptr),
+    dof_vector_src_pending(nullptr),
+    disjoint_processes(false),
+    exchange_comm(MPI_COMM_NULL)
 {
 }
 
@@ -141,6 +146,14 @@ InterfaceCoupling<dim, n_components, Number>::setup(
 
   interface_data_dst = interface_data_dst_;
   dof_handler_src    = &dof_handler_src_;
+  mapping_src        = &mapping_src_;
+
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+  fe_point_evaluation =
+    std::make_shared<dealii::FEPointEvaluation<n_components, dim, dim, Number>>(
+      mapping_src_, dof_handler_src_.get_fe(), dealii::update_values);
+  solution_values.resize(dof_handler_src_.get_fe().dofs_per_cell);
+#endif
 
   for(auto quad_index : interface_data_dst->get_quad_indices())
   {
@@ -169,33 +182,257 @@ InterfaceCoupling<dim, n_components, Number>::setup(
   }
 }
 
+template<int dim, int n_components, typename Number>
+void
+InterfaceCoupling<dim, n_components, Number>::setup(
+  std::shared_ptr<ContainerInterfaceData<dim, n_components, Number>> interface_data_dst_,
+  dealii::DoFHandler<dim> const *                                    dof_handler_src_,
+  dealii::Mapping<dim> const *                                       mapping_src_,
+  std::vector<bool> const &                                          marked_vertices_src_,
+  double const                                                       tolerance_,
+  MPI_Comm const &                                                   comm)
+{
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+  bool const has_src = (dof_handler_src_ != nullptr);
+  bool const has_dst = (interface_data_dst_.get() != nullptr);
+
+  AssertThrow(has_src == (mapping_src_ != nullptr),
+              dealii::ExcMessage("DoFHandler and Mapping of the src-side have to be provided "
+                                 "together."));
+
+  if(has_src and marked_vertices_src_.size() > 0)
+  {
+    AssertThrow(marked_vertices_src_.size() ==
+                  (unsigned int)dof_handler_src_->get_triangulation().n_vertices(),
+                dealii::ExcMessage("Vector marked_vertices_src_ has invalid size."));
+  }
+
+  interface_data_dst = interface_data_dst_;
+  dof_handler_src    = dof_handler_src_;
+  mapping_src        = mapping_src_;
+  disjoint_processes = true;
+  exchange_comm      = comm;
+
+  if(has_src)
+  {
+    fe_point_evaluation =
+      std::make_shared<dealii::FEPointEvaluation<n_components, dim, dim, Number>>(
+        *mapping_src_, dof_handler_src_->get_fe(), dealii::update_values);
+    solution_values.resize(dof_handler_src_->get_fe().dofs_per_cell);
+  }
+
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(comm);
+  unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(comm);
+
+  // processes of the src-side
+  std::vector<unsigned int> ranks_src;
+  std::vector<unsigned int> const has_src_all =
+    dealii::Utilities::MPI::all_gather(comm, (unsigned int)has_src);
+  for(unsigned int p = 0; p < n_processes; ++p)
+    if(has_src_all[p])
+      ranks_src.push_back(p);
+
+  AssertThrow(ranks_src.size() > 0, dealii::ExcMessage("The src-side has no processes."));
+
+  unsigned int const n_processes_src = ranks_src.size();
+
+  // the quadrature indices of the dst-side are only known on the processes of the dst-side
+  std::vector<quad_index> quad_indices;
+  for(auto const & quad_indices_of_process : dealii::Utilities::MPI::all_gather(
+        comm, has_dst ? interface_data_dst->get_quad_indices() : std::vector<quad_index>()))
+  {
+    if(quad_indices.empty())
+      quad_indices = quad_indices_of_process;
+  }
+
+  // number of elements of the interval [a_begin, a_end) contained in [b_begin, b_end)
+  auto const n_intersection = [](unsigned long long const a_begin,
+                                 unsigned long long const a_end,
+                                 unsigned long long const b_begin,
+                                 unsigned long long const b_end) {
+    unsigned long long const begin = std::max(a_begin, b_begin);
+    unsigned long long const end   = std::min(a_end, b_end);
+    return (end > begin) ? (int)(end - begin) : 0;
+  };
+
+  for(auto const quad_index : quad_indices)
+  {
+    std::vector<dealii::Point<dim>> points_dst;
+    if(has_dst)
+      points_dst = interface_data_dst->get_array_q_points(quad_index);
+
+    // numbering of all points of the dst-side in the order of the processes
+    std::vector<unsigned int> const n_points_dst =
+      dealii::Utilities::MPI::all_gather(comm, (unsigned int)points_dst.size());
+
+    std::vector<unsigned long long> offsets_dst(n_processes + 1, 0);
+    for(unsigned int p = 0; p < n_processes; ++p)
+      offsets_dst[p + 1] = offsets_dst[p] + n_points_dst[p];
+
+    // the i-th process of the src-side evaluates the points [begin(i), begin(i+1))
+    unsigned long long const n_points_total = offsets_dst[n_processes];
+    auto const begin = [&](unsigned int const i) { return n_points_total * i / n_processes_src; };
+
+    PointExchange & exchange = map_point_exchange[quad_index];
+    exchange.n_points_send.assign(n_processes, 0);
+    exchange.n_points_receive.assign(n_processes, 0);
+    for(unsigned int i = 0; i < n_processes_src; ++i)
+    {
+      exchange.n_points_send[ranks_src[i]] =
+        n_intersection(offsets_dst[rank], offsets_dst[rank + 1], begin(i), begin(i + 1));
+
+      if(ranks_src[i] == rank)
+      {
+        for(unsigned int p = 0; p < n_processes; ++p)
+          exchange.n_points_receive[p] =
+            n_intersection(offsets_dst[p], offsets_dst[p + 1], begin(i), begin(i + 1));
+      }
+    }
+
+    exchange.offsets_send.assign(n_processes + 1, 0);
+    exchange.offsets_receive.assign(n_processes + 1, 0);
+    for(unsigned int p = 0; p < n_processes; ++p)
+    {
+      exchange.offsets_send[p + 1]    = exchange.offsets_send[p] + exchange.n_points_send[p];
+      exchange.offsets_receive[p + 1] = exchange.offsets_receive[p] + exchange.n_points_receive[p];
+    }
+
+    // send the points of the dst-side to the processes of the src-side evaluating them, where the
+    // points of one process are contiguous in the send buffer since the processes of the src-side
+    // evaluate contiguous ranges of the numbering
+    std::vector<int> n_coordinates_send(n_processes), offsets_coordinates_send(n_processes);
+    std::vector<int> n_coordinates_receive(n_processes), offsets_coordinates_receive(n_processes);
+    for(unsigned int p = 0; p < n_processes; ++p)
+    {
+      n_coordinates_send[p]          = dim * exchange.n_points_send[p];
+      offsets_coordinates_send[p]    = dim * exchange.offsets_send[p];
+      n_coordinates_receive[p]       = dim * exchange.n_points_receive[p];
+      offsets_coordinates_receive[p] = dim * exchange.offsets_receive[p];
+    }
+
+    std::vector<double> coordinates_send(dim * points_dst.size());
+    for(unsigned int q = 0; q < points_dst.size(); ++q)
+      for(unsigned int d = 0; d < dim; ++d)
+        coordinates_send[dim * q + d] = points_dst[q][d];
+
+    std::vector<double> coordinates_receive(dim * exchange.offsets_receive[n_processes]);
+
+    int const ierr = MPI_Alltoallv(coordinates_send.data(),
+                                   n_coordinates_send.data(),
+                                   offsets_coordinates_send.data(),
+                                   MPI_DOUBLE,
+                                   coordinates_receive.data(),
+                                   n_coordinates_receive.data(),
+                                   offsets_coordinates_receive.data(),
+                                   MPI_DOUBLE,
+                                   comm);
+    AssertThrowMPI(ierr);
+
+    map_values_dst[quad_index].resize(points_dst.size());
+
+    // search the received points on the src-side (collective on the processes of the src-side)
+    if(has_src)
+    {
+      std::vector<dealii::Point<dim>> points_src(exchange.offsets_receive[n_processes]);
+      for(unsigned int q = 0; q < points_src.size(); ++q)
+        for(unsigned int d = 0; d < dim; ++d)
+          points_src[q][d] = coordinates_receive[dim * q + d];
+
+      map_evaluator.emplace(quad_index,
+                            dealii::Utilities::MPI::RemotePointEvaluation<dim>(
+                              tolerance_, false, 0, [marked_vertices_src_]() {
+                                return marked_vertices_src_;
+                              }));
+
+      map_evaluator[quad_index].reinit(points_src,
+                                       dof_handler_src_->get_triangulation(),
+                                       *mapping_src_);
+
+      AssertThrow(
+        map_evaluator[quad_index].all_points_found() == true,
+        dealii::ExcMessage(
+          "Setup of InterfaceCoupling was not successful. Not all points have been found."));
+
+      map_values_src[quad_index].resize(points_src.size());
+    }
+  }
+#else
+  (void)interface_data_dst_;
+  (void)dof_handler_src_;
+  (void)mapping_src_;
+  (void)marked_vertices_src_;
+  (void)tolerance_;
+  (void)comm;
+  AssertThrow(false, dealii::ExcMessage("Requires deal.II version 9.4 or higher."));
+#endif
+}
+
 template<int dim, int n_components, typename Number>
 void
 InterfaceCoupling<dim, n_components, Number>::update_data(VectorType const & dof_vector_src)
 {
+  update_data_start(dof_vector_src);
+  update_data_finish();
+}
+
+template<int dim, int n_components, typename Number>
+void
+InterfaceCoupling<dim, n_components, Number>::update_data_start(
+  VectorType const & dof_vector_src,
+  unsigned int const communication_channel)
+{
+  AssertThrow(dof_vector_src_pending == nullptr,
+              dealii::ExcMessage("update_data_finish() has to be called first."));
+
+  dof_vector_src_pending = &dof_vector_src;
+
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+  // processes without src-side do not access dof_vector_src
+  if(dof_handler_src != nullptr)
+    dof_vector_src.update_ghost_values_start(communication_channel);
+#else
+  (void)communication_channel;
+#endif
+}
+
+template<int dim, int n_components, typename Number>
+void
+InterfaceCoupling<dim, n_components, Number>::update_data_finish()
+{
+  AssertThrow(dof_vector_src_pending != nullptr,
+              dealii::ExcMessage("update_data_start() has to be called first."));
+
+  VectorType const & dof_vector_src = *dof_vector_src_pending;
+  dof_vector_src_pending            = nullptr;
+
 #if DEAL_II_VERSION_GTE(9, 4, 0)
-  dof_vector_src.update_ghost_values();
+  if(disjoint_processes)
+  {
+    if(dof_handler_src != nullptr)
+      dof_vector_src.update_ghost_values_finish();
+
+    for(auto const & quadrature_and_exchange : map_point_exchange)
+      evaluate_and_send_to_dst(dof_vector_src, quadrature_and_exchange.first);
+  }
+  else
+  {
+    dof_vector_src.update_ghost_values_finish();
+
+    for(auto quadrature : interface_data_dst->get_quad_indices())
+      evaluate_and_write_to_dst(dof_vector_src, quadrature);
+  }
 #else
   dealii::LinearAlgebra::distributed::Vector<double> dof_vector_src_double;
   dof_vector_src_double = dof_vector_src;
   dof_vector_src_double.update_ghost_values();
-#endif
 
   for(auto quadrature : interface_data_dst->get_quad_indices())
   {
-#if DEAL_II_VERSION_GTE(9, 4, 0)
-    auto const result =
-      dealii::VectorTools::point_values<n_components>(map_evaluator[quadrature],
-                                                      *dof_handler_src,
-                                                      dof_vector_src,
-                                                      dealii::VectorTools::EvaluationFlags::avg);
-#else
     auto const result =
       dealii::VectorTools::point_values<n_components>(map_evaluator[quadrature],
                                                       *dof_handler_src,
                                                       dof_vector_src_double,
                                                       dealii::VectorTools::EvaluationFlags::avg);
-#endif
 
     auto & array_solution = interface_data_dst->get_array_solution(quadrature);
 
@@ -205,6 +442,164 @@ InterfaceCoupling<dim, n_components, Number>::update_data(VectorType const & dof
     for(unsigned int i = 0; i < result.size(); ++i)
       array_solution[i] = result[i];
   }
+#endif
+}
+
+template<int dim, int n_components, typename Number>
+std::vector<typename InterfaceCoupling<dim, n_components, Number>::value_type_src> const &
+InterfaceCoupling<dim, n_components, Number>::evaluate(VectorType const & dof_vector_src,
+                                                       quad_index const   quadrature)
+{
+  std::vector<value_type_src> & point_values = map_point_values[quadrature];
+
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+  auto const & evaluator = map_evaluator[quadrature];
+
+  // evaluate the src vector on the cells owned by this process, reading the cell DoFs of the
+  // vector directly (i.e., without conversion of the whole vector to double)
+  auto const evaluation_function =
+    [&](dealii::ArrayView<value_type_src> const &                                   values,
+        typename dealii::Utilities::MPI::RemotePointEvaluation<dim>::CellData const & cell_data) {
+      for(unsigned int i = 0; i < cell_data.cells.size(); ++i)
+      {
+        typename dealii::DoFHandler<dim>::active_cell_iterator cell(
+          &dof_handler_src->get_triangulation(),
+          cell_data.cells[i].first,
+          cell_data.cells[i].second,
+          dof_handler_src);
+
+        cell->get_dof_values(dof_vector_src, solution_values.begin(), solution_values.end());
+
+        unsigned int const begin = cell_data.reference_point_ptrs[i];
+        unsigned int const end   = cell_data.reference_point_ptrs[i + 1];
+
+        fe_point_evaluation->reinit(
+          cell,
+          dealii::make_array_view(cell_data.reference_point_values.begin() + begin,
+                                  cell_data.reference_point_values.begin() + end));
+        fe_point_evaluation->evaluate(solution_values, dealii::EvaluationFlags::values);
+
+        for(unsigned int q = 0; q < end - begin; ++q)
+          values[begin + q] = fe_point_evaluation->get_value(q);
+      }
+    };
+
+  evaluator.template evaluate_and_process<value_type_src>(point_values,
+                                                          map_buffer[quadrature],
+                                                          evaluation_function);
+#else
+  (void)dof_vector_src;
+  AssertThrow(false, dealii::ExcMessage("Requires deal.II version 9.4 or higher."));
+#endif
+
+  return point_values;
+}
+
+template<int dim, int n_components, typename Number>
+void
+InterfaceCoupling<dim, n_components, Number>::evaluate_and_write_to_dst(
+  VectorType const & dof_vector_src,
+  quad_index const   quadrature)
+{
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+  std::vector<value_type_src> const & point_values = evaluate(dof_vector_src, quadrature);
+
+  // write to dst-side: points shared by several cells of the src-side obtain the average value
+  auto &       array_solution = interface_data_dst->get_array_solution(quadrature);
+  auto const & point_ptrs     = map_evaluator[quadrature].get_point_ptrs();
+
+  Assert(point_ptrs.size() == array_solution.size() + 1,
+         dealii::ExcMessage("Vectors must have the same length."));
+
+  for(unsigned int i = 0; i < array_solution.size(); ++i)
+  {
+    array_solution[i] = value_type_dst();
+    for(unsigned int j = point_ptrs[i]; j < point_ptrs[i + 1]; ++j)
+      array_solution[i] += value_type_dst(point_values[j]);
+    if(point_ptrs[i + 1] > point_ptrs[i] + 1)
+      array_solution[i] /= (double)(point_ptrs[i + 1] - point_ptrs[i]);
+  }
+#else
+  (void)dof_vector_src;
+  (void)quadrature;
+  AssertThrow(false, dealii::ExcMessage("Requires deal.II version 9.4 or higher."));
+#endif
+}
+
+template<int dim, int n_components, typename Number>
+void
+InterfaceCoupling<dim, n_components, Number>::evaluate_and_send_to_dst(
+  VectorType const & dof_vector_src,
+  quad_index const   quadrature)
+{
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+  std::vector<value_type_src> & values_src = map_values_src[quadrature];
+  std::vector<value_type_src> & values_dst = map_values_dst[quadrature];
+
+  // src-side: points shared by several cells obtain the average value
+  if(dof_handler_src != nullptr)
+  {
+    std::vector<value_type_src> const & point_values = evaluate(dof_vector_src, quadrature);
+    auto const & point_ptrs = map_evaluator[quadrature].get_point_ptrs();
+
+    Assert(point_ptrs.size() == values_src.size() + 1,
+           dealii::ExcMessage("Vectors must have the same length."));
+
+    for(unsigned int i = 0; i < values_src.size(); ++i)
+    {
+      values_src[i] = value_type_src();
+      for(unsigned int j = point_ptrs[i]; j < point_ptrs[i + 1]; ++j)
+        values_src[i] += point_values[j];
+      if(point_ptrs[i + 1] > point_ptrs[i] + 1)
+        values_src[i] /= (Number)(point_ptrs[i + 1] - point_ptrs[i]);
+    }
+  }
+
+  // send the values back to the processes of the dst-side, i.e., in the opposite direction of
+  // the points in setup()
+  PointExchange const & exchange = map_point_exchange[quadrature];
+
+  unsigned int const n_processes = exchange.n_points_send.size();
+
+  int const size = sizeof(value_type_src);
+
+  std::vector<int> n_bytes_send(n_processes), offsets_bytes_send(n_processes);
+  std::vector<int> n_bytes_receive(n_processes), offsets_bytes_receive(n_processes);
+  for(unsigned int p = 0; p < n_processes; ++p)
+  {
+    n_bytes_send[p]          = size * exchange.n_points_receive[p];
+    offsets_bytes_send[p]    = size * exchange.offsets_receive[p];
+    n_bytes_receive[p]       = size * exchange.n_points_send[p];
+    offsets_bytes_receive[p] = size * exchange.offsets_send[p];
+  }
+
+  int const ierr = MPI_Alltoallv(values_src.data(),
+                                 n_bytes_send.data(),
+                                 offsets_bytes_send.data(),
+                                 MPI_BYTE,
+                                 values_dst.data(),
+                                 n_bytes_receive.data(),
+                                 offsets_bytes_receive.data(),
+                                 MPI_BYTE,
+                                 exchange_comm);
+  AssertThrowMPI(ierr);
+
+  // dst-side
+  if(interface_data_dst.get() != nullptr)
+  {
+    auto & array_solution = interface_data_dst->get_array_solution(quadrature);
+
+    Assert(values_dst.size() == array_solution.size(),
+           dealii::ExcMessage("Vectors must have the same length."));
+
+    for(unsigned int i = 0; i < array_solution.size(); ++i)
+      array_solution[i] = value_type_dst(values_dst[i]);
+  }
+#else
+  (void)dof_vector_src;
+  (void)quadrature;
+  AssertThrow(false, dealii::ExcMessage("Requires deal.II version 9.4 or higher."));
+#endif
 }
 
 template class ContainerInterfaceData<2, 1, float>;
@@ -23,6 +23,8 @@
 #define INCLUDE_FUNCTIONALITIES_INTERFACE_COUPLING_H_
 
 // deal.II
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
@@ -93,6 +95,11 @@ private:
 
   using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
 
+  using value_type_src =
+    typename dealii::FEPointEvaluation<n_components, dim, dim, Number>::value_type;
+
+  typedef typename FunctionCached<rank, dim, double>::value_type value_type_dst;
+
 public:
   InterfaceCoupling();
 
@@ -113,10 +120,69 @@ public:
         std::vector<bool> const &                                          marked_vertices_src_,
         double const                                                       tolerance_);
 
+  /**
+   * setup() function for the case that the src-side and the dst-side are solved on disjoint sets of
+   * processes of the communicator @param comm (for example, if fluid and structure are solved
+   * concurrently). Processes without src-side pass nullptr for dof_handler_src_ and mapping_src_,
+   * processes without dst-side pass nullptr for interface_data_dst_. The points of the dst-side
+   * are distributed evenly onto the processes of the src-side, evaluated there, and the values are
+   * sent back over comm. Hence, all processes of comm have to call this function and
+   * update_data() (or update_data_start() and update_data_finish()), where dof_vector_src is not
+   * accessed on processes without src-side.
+   */
+  void
+  setup(std::shared_ptr<ContainerInterfaceData<dim, n_components, Number>> interface_data_dst_,
+        dealii::DoFHandler<dim> const *                                    dof_handler_src_,
+        dealii::Mapping<dim> const *                                       mapping_src_,
+        std::vector<bool> const &                                          marked_vertices_src_,
+        double const                                                       tolerance_,
+        MPI_Comm const &                                                   comm);
+
+  /**
+   * Evaluates dof_vector_src in the points of the dst-side and writes the result into the
+   * interface data of the dst-side. Equivalent to update_data_start() followed by
+   * update_data_finish().
+   */
   void
   update_data(VectorType const & dof_vector_src);
 
+  /**
+   * Split-phase version of update_data(): update_data_start() initiates the ghost value exchange of
+   * dof_vector_src and update_data_finish() evaluates the solution and communicates the point
+   * values. Other work not modifying dof_vector_src can be done in between. dof_vector_src has to
+   * remain valid until update_data_finish() has been called. Several ghost value exchanges that are
+   * in flight at the same time have to use different communication channels.
+   */
+  void
+  update_data_start(VectorType const & dof_vector_src,
+                    unsigned int const communication_channel = 0);
+
+  void
+  update_data_finish();
+
 private:
+  /*
+   * Evaluates the src vector (with ghost values updated) in all points of the evaluator and
+   * returns the values of all cells containing the points, see get_point_ptrs() of the evaluator.
+   */
+  std::vector<value_type_src> const &
+  evaluate(VectorType const & dof_vector_src, quad_index const quadrature);
+
+  /*
+   * Evaluates the src vector (with ghost values updated) in all points requested by the dst-side
+   * and writes the values, averaged over all cells sharing a point, directly into the interface
+   * data of the dst-side.
+   */
+  void
+  evaluate_and_write_to_dst(VectorType const & dof_vector_src, quad_index const quadrature);
+
+  /*
+   * Same as evaluate_and_write_to_dst() for src-side and dst-side on disjoint processes: the
+   * averaged values are sent from the src-side to the dst-side.
+   */
+  void
+  evaluate_and_send_to_dst(VectorType const & dof_vector_src, quad_index const quadrature);
+
   /*
    * dst-side
    */
@@ -127,10 +193,49 @@ private:
    */
   std::map<quad_index, dealii::Utilities::MPI::RemotePointEvaluation<dim>> map_evaluator;
 
+  /*
+   * Persistent buffers for the point values (and their communication) used by the evaluator. The
+   * memory is allocated in the first call and reused by all subsequent calls of update_data().
+   */
+  std::map<quad_index, std::vector<value_type_src>> map_point_values;
+  std::map<quad_index, std::vector<value_type_src>> map_buffer;
+
   /*
    * src-side
    */
   dealii::DoFHandler<dim> const * dof_handler_src;
+  dealii::Mapping<dim> const *    mapping_src;
+
+  std::shared_ptr<dealii::FEPointEvaluation<n_components, dim, dim, Number>> fe_point_evaluation;
+  std::vector<Number>                                                        solution_values;
+
+  // vector passed to update_data_start()
+  VectorType const * dof_vector_src_pending;
+
+  /*
+   * src-side and dst-side on disjoint processes
+   */
+  bool disjoint_processes;
+
+  // communicator containing the processes of both sides
+  MPI_Comm exchange_comm;
+
+  /*
+   * Number of points sent to / received from every process of exchange_comm and offsets into the
+   * respective buffers. On the dst-side, the points are sent to the processes of the src-side
+   * which evaluate them (send), on the src-side, the points are received from the processes of
+   * the dst-side (receive). The point values are communicated in the opposite direction.
+   */
+  struct PointExchange
+  {
+    std::vector<int> n_points_send, offsets_send;
+    std::vector<int> n_points_receive, offsets_receive;
+  };
+
+  std::map<quad_index, PointExchange> map_point_exchange;
+
+  // averaged point values on the src-side (values_src) and received values on the dst-side
+  std::map<quad_index, std::vector<value_type_src>> map_values_src, map_values_dst;
 };
 
 } // namespace ExaDG
@@ -30,6 +30,15 @@ namespace ExaDG
 {
 /**
  * Base class for moving grid problems.
+ *
+ * The grid motion is computed on the whole domain and the geometry of all cells is updated in
+ * every call of update(), also if only a band of cells close to a moving boundary is deformed
+ * noticeably. A restriction to the deforming region is not implemented: the mesh-motion operators
+ * (Poisson, elasticity) are set up on the full dof_handler and matrix_free objects, so that a solve
+ * restricted to a subset of cells would require a separate discretization of that subset (e.g.
+ * FE_Nothing outside the region) together with the transfer of its solution; and neither
+ * dealii::MappingQCache::initialize() nor dealii::MatrixFree::update_mapping() allow to update the
+ * geometry of a subset of cells.
  */
 template<int dim, typename Number>
 class GridMotionBase : public GridMotionInterface<dim, Number>
@@ -22,6 +22,9 @@
 #ifndef INCLUDE_FUNCTIONALITIES_MESH_H_
 #define INCLUDE_FUNCTIONALITIES_MESH_H_
 
+// C/C++
+#include <algorithm>
+
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mg_level_object.h>
@@ -57,7 +60,7 @@ public:
    * Constructor.
    */
   MappingDoFVector(unsigned int const mapping_degree_q_cache)
-    : dealii::MappingQCache<dim>(mapping_degree_q_cache)
+    : dealii::MappingQCache<dim>(mapping_degree_q_cache), cached_triangulation(nullptr)
   {
     hierarchic_to_lexicographic_numbering =
       dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(mapping_degree_q_cache);
@@ -70,6 +73,7 @@ public:
    */
   virtual ~MappingDoFVector()
   {
+    triangulation_listener.disconnect();
   }
 
   /**
@@ -177,6 +181,16 @@ public:
    *
    * If the displacement_vector is empty or uninitialized, this implies that no displacements will
    * be added to the grid coordinates of the reference configuration described by mapping.
+   *
+   * The grid coordinates of the reference configuration are evaluated only once for the locally
+   * relevant cells and are cached for subsequent calls with the same mapping, so that repeated
+   * updates of a moving mesh only add the displacements. The cache is invalidated automatically
+   * when the triangulation changes, and has to be invalidated via
+   * invalidate_reference_coordinates() if the mapping object is modified.
+   *
+   * Note that all cells are updated in every call, also those with zero displacement: both
+   * dealii::MappingQCache::initialize() and dealii::MatrixFree::update_mapping() recompute the
+   * geometry of all cells and do not provide an interface to update a subset of cells.
    */
   void
   initialize_mapping_q_cache(std::shared_ptr<dealii::Mapping<dim> const> mapping,
@@ -197,17 +211,8 @@ public:
       displacement_vector_ghosted.update_ghost_values();
     }
 
-    std::shared_ptr<dealii::FEValues<dim>> fe_values;
-
-    dealii::FE_Nothing<dim> fe_nothing;
     if(mapping.get() != 0)
-    {
-      fe_values =
-        std::make_shared<dealii::FEValues<dim>>(*mapping,
-                                                fe_nothing,
-                                                dealii::QGaussLobatto<dim>(this->get_degree() + 1),
-                                                dealii::update_quadrature_points);
-    }
+      cache_reference_coordinates(mapping, dof_handler.get_triangulation());
 
     // update mapping according to mesh deformation described by displacement vector
     dealii::MappingQCache<dim>::initialize(
@@ -219,15 +224,14 @@ public:
 
         std::vector<dealii::Point<dim>> grid_coordinates(scalar_dofs_per_cell);
 
-        if(mapping.get() != 0)
+        // the geometry of artificial cells is never used and remains zero
+        if(mapping.get() != 0 and is_locally_relevant(cell_tria))
         {
-          fe_values->reinit(cell_tria);
-          // extract displacement and add to original position
-          for(unsigned int i = 0; i < scalar_dofs_per_cell; ++i)
-          {
-            grid_coordinates[i] =
-              fe_values->quadrature_point(this->hierarchic_to_lexicographic_numbering[i]);
-          }
+          unsigned int const offset =
+            reference_coordinates_offsets[cell_tria->level()][cell_tria->index()];
+          std::copy(reference_coordinates.begin() + offset,
+                    reference_coordinates.begin() + offset + scalar_dofs_per_cell,
+                    grid_coordinates.begin());
         }
 
         // if this function is called with an empty dof-vector, this indicates that the
@@ -269,6 +273,101 @@ public:
 
   std::vector<unsigned int> hierarchic_to_lexicographic_numbering;
   std::vector<unsigned int> lexicographic_to_hierarchic_numbering;
+
+  /**
+   * Invalidates the cached grid coordinates of the reference configuration, e.g. if the mapping
+   * describing the reference configuration has been modified. Changes of the triangulation are
+   * detected automatically.
+   */
+  void
+  invalidate_reference_coordinates()
+  {
+    reference_coordinates.clear();
+    reference_coordinates_offsets.clear();
+    cached_reference_mapping.reset();
+  }
+
+private:
+  /**
+   * Locally owned and ghost cells (active cells), and cells that are not artificial on their level
+   * (non-active cells, e.g. for multigrid).
+   */
+  static bool
+  is_locally_relevant(typename dealii::Triangulation<dim>::cell_iterator const & cell)
+  {
+    if(cell->is_active())
+      return not(cell->is_artificial());
+    else
+      return cell->level_subdomain_id() != dealii::numbers::artificial_subdomain_id;
+  }
+
+  /**
+   * Evaluates the grid coordinates of the locally relevant cells of the triangulation for the
+   * given mapping describing the reference configuration (in hierarchic numbering), unless these
+   * have already been computed for the same mapping and triangulation.
+   */
+  void
+  cache_reference_coordinates(std::shared_ptr<dealii::Mapping<dim> const> mapping,
+                              dealii::Triangulation<dim> const &          triangulation)
+  {
+    if(mapping == cached_reference_mapping and &triangulation == cached_triangulation)
+      return;
+
+    // the cache is invalidated whenever the triangulation changes (refinement, repartitioning)
+    if(&triangulation != cached_triangulation)
+    {
+      triangulation_listener.disconnect();
+      triangulation_listener =
+        triangulation.signals.any_change.connect([this]() { invalidate_reference_coordinates(); });
+      cached_triangulation = &triangulation;
+    }
+
+    dealii::FE_Nothing<dim> fe_nothing;
+    dealii::FEValues<dim>   fe_values(*mapping,
+                                    fe_nothing,
+                                    dealii::QGaussLobatto<dim>(this->get_degree() + 1),
+                                    dealii::update_quadrature_points);
+
+    unsigned int const scalar_dofs_per_cell = dealii::Utilities::pow(this->get_degree() + 1, dim);
+
+    reference_coordinates.clear();
+    reference_coordinates_offsets.resize(triangulation.n_levels());
+    for(unsigned int level = 0; level < triangulation.n_levels(); ++level)
+    {
+      reference_coordinates_offsets[level].assign(triangulation.n_raw_cells(level),
+                                                  dealii::numbers::invalid_unsigned_int);
+
+      for(auto cell = triangulation.begin(level); cell != triangulation.end(level); ++cell)
+      {
+        if(is_locally_relevant(cell))
+        {
+          reference_coordinates_offsets[level][cell->index()] = reference_coordinates.size();
+
+          fe_values.reinit(cell);
+          for(unsigned int i = 0; i < scalar_dofs_per_cell; ++i)
+          {
+            reference_coordinates.push_back(
+              fe_values.quadrature_point(this->hierarchic_to_lexicographic_numbering[i]));
+          }
+        }
+      }
+    }
+
+    cached_reference_mapping = mapping;
+  }
+
+  // grid coordinates of the reference configuration of all locally relevant cells
+  std::vector<dealii::Point<dim>> reference_coordinates;
+
+  // position of the first grid coordinate of each cell in reference_coordinates (indexed by level
+  // and index), numbers::invalid_unsigned_int for cells that are not locally relevant
+  std::vector<std::vector<unsigned int>> reference_coordinates_offsets;
+
+  // mapping and triangulation the cached grid coordinates refer to
+  std::shared_ptr<dealii::Mapping<dim> const> cached_reference_mapping;
+  dealii::Triangulation<dim> const *          cached_triangulation;
+
+  boost::signals2::connection triangulation_listener;
 };
 
 
@@ -276,7 +276,8 @@ Driver<dim, Number>::setup()
     }
   }
 
-  // setup solvers in case of BDF time integration (solution of linear systems of equations)
+  // setup solvers in case of BDF or IMEX Runge-Kutta time integration (solution of linear
+  // systems of equations)
   for(unsigned int i = 0; i < n_scalars; ++i)
   {
     AssertThrow(application->get_parameters_scalar(i).analytical_velocity_field == false,
@@ -297,6 +298,20 @@ Driver<dim, Number>::setup()
 
       scalar_operator[i]->setup_solver(scaling_factor, velocity);
     }
+    else if(application->get_parameters_scalar(i).temporal_discretization ==
+            ConvDiff::TemporalDiscretization::IMEXRK)
+    {
+      std::shared_ptr<ConvDiff::TimeIntIMEXRK<dim, Number>> scalar_time_integrator_IMEX =
+        std::dynamic_pointer_cast<ConvDiff::TimeIntIMEXRK<dim, Number>>(scalar_time_integrator[i]);
+      double const scaling_factor =
+        scalar_time_integrator_IMEX->get_scaling_factor_time_derivative_term();
+
+      dealii::LinearAlgebra::distributed::Vector<Number> vector;
+      fluid_operator->initialize_vector_velocity(vector);
+      dealii::LinearAlgebra::distributed::Vector<Number> const * velocity = &vector;
+
+      scalar_operator[i]->setup_solver(scaling_factor, velocity);
+    }
     else
     {
       AssertThrow(application->get_parameters_scalar(i).temporal_discretization ==
@@ -437,6 +452,13 @@ Driver<dim, Number>::communicate_scalar_to_fluid() const
         std::dynamic_pointer_cast<ConvDiff::TimeIntBDF<dim, Number>>(scalar_time_integrator[0]);
       time_int_scalar->extrapolate_solution(temperature);
     }
+    else if(application->get_parameters_scalar(0).temporal_discretization ==
+            ConvDiff::TemporalDiscretization::IMEXRK)
+    {
+      std::shared_ptr<ConvDiff::TimeIntIMEXRK<dim, Number>> time_int_scalar =
+        std::dynamic_pointer_cast<ConvDiff::TimeIntIMEXRK<dim, Number>>(scalar_time_integrator[0]);
+      time_int_scalar->extrapolate_solution(temperature);
+    }
     else
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
@@ -489,6 +511,13 @@ Driver<dim, Number>::communicate_fluid_to_all_scalars() const
         std::dynamic_pointer_cast<ConvDiff::TimeIntBDF<dim, Number>>(scalar_time_integrator[i]);
       time_int_scalar->set_velocities_and_times(velocities, times);
     }
+    else if(application->get_parameters_scalar(i).temporal_discretization ==
+            ConvDiff::TemporalDiscretization::IMEXRK)
+    {
+      std::shared_ptr<ConvDiff::TimeIntIMEXRK<dim, Number>> time_int_scalar =
+        std::dynamic_pointer_cast<ConvDiff::TimeIntIMEXRK<dim, Number>>(scalar_time_integrator[i]);
+      time_int_scalar->set_velocities_and_times(velocities, times);
+    }
     else
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
@@ -652,7 +681,7 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   {
     this->pcout << std::endl << "Convection-diffusion solver for scalar " << i << ":" << std::endl;
 
-    // only relevant for BDF time integrator
+    // only relevant for BDF and IMEX Runge-Kutta time integrators
     if(application->get_parameters_scalar(i).temporal_discretization ==
        ConvDiff::TemporalDiscretization::BDF)
     {
@@ -660,6 +689,13 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
         std::dynamic_pointer_cast<ConvDiff::TimeIntBDF<dim, Number>>(scalar_time_integrator[i]);
       time_integrator_bdf->print_iterations();
     }
+    else if(application->get_parameters_scalar(i).temporal_discretization ==
+            ConvDiff::TemporalDiscretization::IMEXRK)
+    {
+      std::shared_ptr<ConvDiff::TimeIntIMEXRK<dim, Number>> time_integrator_imex =
+        std::dynamic_pointer_cast<ConvDiff::TimeIntIMEXRK<dim, Number>>(scalar_time_integrator[i]);
+      time_integrator_imex->print_iterations();
+    }
     else if(application->get_parameters_scalar(i).temporal_discretization ==
             ConvDiff::TemporalDiscretization::ExplRK)
     {
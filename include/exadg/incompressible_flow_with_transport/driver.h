@@ -35,6 +35,7 @@
 // ConvDiff
 #include <exadg/convection_diffusion/time_integration/time_int_bdf.h>
 #include <exadg/convection_diffusion/time_integration/time_int_explicit_runge_kutta.h>
+#include <exadg/convection_diffusion/time_integration/time_int_imex_runge_kutta.h>
 
 // IncNS
 #include <exadg/convection_diffusion/spatial_discretization/operator.h>
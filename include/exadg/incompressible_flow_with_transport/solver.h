@@ -35,6 +35,7 @@
 
 // utilities
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/kernel_profiler.h>
 #include <exadg/utilities/resolution_parameters.h>
 
 // application
@@ -119,6 +120,8 @@ main(int argc, char ** argv)
 
   ExaDG::GeneralParameters general(input_file);
 
+  ExaDG::KernelProfiler::enable(general.kernel_profiling);
+
   // run the simulation
   if(general.dim == 2 && general.precision == "float")
     ExaDG::run<2, float>(input_file, mpi_comm, general.is_test);
@@ -132,6 +135,8 @@ main(int argc, char ** argv)
     AssertThrow(false,
                 dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
 
+  ExaDG::KernelProfiler::print_results(mpi_comm);
+
   return 0;
 }
 
@@ -30,6 +30,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
 #include <exadg/incompressible_navier_stokes/time_integration/create_time_integrator.h>
 #include <exadg/utilities/print_solver_results.h>
+#include <exadg/utilities/solver_benchmark.h>
 #include <exadg/utilities/throughput_parameters.h>
 
 namespace ExaDG
@@ -148,8 +149,14 @@ Driver<dim, Number>::setup()
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
   if(application->get_parameters().use_cell_based_face_loops)
+  {
     Categorization::do_cell_based_loops(*application->get_grid()->triangulation,
                                         matrix_free_data->data);
+
+    if(application->get_parameters().use_cell_batching_by_conditioning)
+      Categorization::do_conditioning_based_categories(*application->get_grid()->triangulation,
+                                                       matrix_free_data->data);
+  }
   std::shared_ptr<dealii::Mapping<dim> const> mapping =
     get_dynamic_mapping<dim, Number>(application->get_grid(), grid_motion);
   matrix_free->reinit(*mapping,
@@ -158,6 +165,9 @@ Driver<dim, Number>::setup()
                       matrix_free_data->get_quadrature_vector(),
                       matrix_free_data->data);
 
+  if(not(is_test))
+    print_batch_fill_ratio(pcout, *matrix_free, mpi_comm);
+
   // setup Navier-Stokes operator
   pde_operator->setup(matrix_free, matrix_free_data);
 
@@ -605,6 +615,112 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
                                                                            throughput);
 }
 
+template<int dim, typename Number>
+std::tuple<double, dealii::types::global_dof_index, double, std::vector<double>>
+Driver<dim, Number>::apply_solver(std::string const & solver_type_string,
+                                  unsigned int const  n_repetitions) const
+{
+  Parameters const & param = application->get_parameters();
+
+  AssertThrow(not(is_throughput_study),
+              dealii::ExcMessage("The solver benchmark requires the setup of the solvers."));
+
+  AssertThrow(param.solver_type == SolverType::Unsteady and
+                (param.temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme or
+                 param.temporal_discretization == TemporalDiscretization::BDFPressureCorrection),
+              dealii::ExcMessage("The solver benchmark is only implemented for the pressure "
+                                 "Poisson and momentum solvers of projection methods."));
+
+  AssertThrow(solver_type_string == "PressurePoisson" or solver_type_string == "Momentum",
+              dealii::ExcMessage("Unknown solver type " + solver_type_string + "."));
+
+  pcout << std::endl << "Solving linear system of equations ..." << std::endl;
+
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  // deterministic, non-constant vector independent of the parallel partitioning
+  auto const fill_vector = [](VectorType & vector) {
+    for(unsigned int i = 0; i < vector.locally_owned_size(); ++i)
+      vector.local_element(i) = std::sin((double)vector.get_partitioner()->local_to_global(i));
+  };
+
+  VectorType rhs, sol;
+
+  std::function<unsigned int(void)> solve;
+
+  std::shared_ptr<TimerTree> preconditioner_timings;
+
+  if(solver_type_string == "PressurePoisson")
+  {
+    std::shared_ptr<OperatorProjectionMethods<dim, Number>> operator_projection_methods =
+      std::dynamic_pointer_cast<OperatorProjectionMethods<dim, Number>>(pde_operator);
+
+    pde_operator->initialize_vector_pressure(rhs);
+    pde_operator->initialize_vector_pressure(sol);
+
+    // consistent right-hand side (also for pure Neumann problems)
+    fill_vector(sol);
+    operator_projection_methods->apply_laplace_operator(rhs, sol);
+
+    solve = [&, operator_projection_methods](void) {
+      sol = 0.0;
+      return operator_projection_methods->do_solve_pressure(sol, rhs, false);
+    };
+
+    preconditioner_timings =
+      operator_projection_methods->get_timings_preconditioner_pressure_poisson();
+  }
+  else if(solver_type_string == "Momentum")
+  {
+    AssertThrow(param.viscous_problem() and not(param.nonlinear_problem_has_to_be_solved()),
+                dealii::ExcMessage("The momentum solver benchmark requires a linear viscous "
+                                   "problem."));
+
+    pde_operator->initialize_vector_velocity(rhs);
+    pde_operator->initialize_vector_velocity(sol);
+    fill_vector(rhs);
+
+    double const scaling_factor_mass = time_integrator->get_scaling_factor_time_derivative_term();
+
+    if(param.temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme)
+    {
+      std::shared_ptr<OperatorDualSplitting<dim, Number>> operator_dual_splitting =
+        std::dynamic_pointer_cast<OperatorDualSplitting<dim, Number>>(pde_operator);
+
+      solve = [&, operator_dual_splitting, scaling_factor_mass](void) {
+        sol = 0.0;
+        return operator_dual_splitting->solve_viscous(sol, rhs, false, scaling_factor_mass);
+      };
+
+      preconditioner_timings = operator_dual_splitting->get_timings_helmholtz_preconditioner();
+    }
+    else
+    {
+      std::shared_ptr<OperatorPressureCorrection<dim, Number>> operator_pressure_correction =
+        std::dynamic_pointer_cast<OperatorPressureCorrection<dim, Number>>(pde_operator);
+
+      solve = [&, operator_pressure_correction, scaling_factor_mass](void) {
+        sol = 0.0;
+        return operator_pressure_correction->solve_linear_momentum_equation(sol,
+                                                                            rhs,
+                                                                            false,
+                                                                            scaling_factor_mass);
+      };
+
+      preconditioner_timings = operator_pressure_correction->get_timings_momentum_preconditioner();
+    }
+  }
+
+  std::tuple<double, double, std::vector<double>> const iterations_and_time =
+    measure_solver_time(solve, n_repetitions, mpi_comm, preconditioner_timings);
+
+  pcout << std::endl << " ... done." << std::endl << std::endl;
+
+  return std::make_tuple(std::get<0>(iterations_and_time),
+                         sol.size(),
+                         std::get<1>(iterations_and_time),
+                         std::get<2>(iterations_and_time));
+}
 
 template class Driver<2, float>;
 template class Driver<3, float>;
@@ -34,6 +34,7 @@
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf_dual_splitting.h>
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf_pressure_correction.h>
 #include <exadg/incompressible_navier_stokes/user_interface/application_base.h>
+#include <exadg/matrix_free/batch_fill_ratio.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/utilities/print_general_infos.h>
 
@@ -191,6 +192,13 @@ public:
                  unsigned int const  n_repetitions_inner,
                  unsigned int const  n_repetitions_outer) const;
 
+  /*
+   * Solver benchmark: returns the average number of iterations, the number of degrees of freedom,
+   * the wall time of one solve, and the wall time per solve spent on each multigrid level.
+   */
+  std::tuple<double, dealii::types::global_dof_index, double, std::vector<double>>
+  apply_solver(std::string const & solver_type_string, unsigned int const n_repetitions) const;
+
 private:
   void
   ale_update() const;
@@ -80,6 +80,16 @@ public:
 
   typedef DivergenceAndMassErrorCalculator<dim, Number> This;
 
+  /*
+   * Computes divergence error, mass error, and the respective reference values as defined in
+   * do_evaluate().
+   */
+  typedef std::function<void(Number & div_error,
+                             Number & div_error_reference,
+                             Number & mass_error,
+                             Number & mass_error_reference)>
+    ErrorEvaluator;
+
   DivergenceAndMassErrorCalculator(MPI_Comm const & comm);
 
   void
@@ -88,6 +98,13 @@ public:
         unsigned int const                      quad_index_in,
         MassConservationData const &            data_in);
 
+  /*
+   * Replaces the matrix-free loop of this class by an external evaluation routine, e.g., a
+   * matrix-free loop that evaluates several integral quantities at once.
+   */
+  void
+  set_error_evaluator(ErrorEvaluator const & error_evaluator_in);
+
   void
   evaluate(VectorType const & velocity, double const & time, int const & time_step_number);
 
@@ -149,6 +166,8 @@ private:
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   MassConservationData                    data;
+
+  ErrorEvaluator error_evaluator;
 };
 
 
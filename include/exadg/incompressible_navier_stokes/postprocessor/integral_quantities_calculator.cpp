@@ -0,0 +1,535 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <array>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/integral_quantities_calculator.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+namespace
+{
+/*
+ * Evaluates one component of a function (and optionally its gradient) in all points of a
+ * vectorized batch of quadrature points.
+ */
+template<int dim, typename Number>
+void
+evaluate_function(dealii::Function<dim> const &                               function,
+                  dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+                  unsigned int const                                          component,
+                  bool const                                                  evaluate_gradient,
+                  dealii::VectorizedArray<Number> &                           value,
+                  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> &   gradient)
+{
+  for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+  {
+    dealii::Point<dim> q_point;
+    for(unsigned int d = 0; d < dim; ++d)
+      q_point[d] = q_points[d][v];
+
+    value[v] = function.value(q_point, component);
+
+    if(evaluate_gradient)
+    {
+      dealii::Tensor<1, dim> const grad = function.gradient(q_point, component);
+      for(unsigned int d = 0; d < dim; ++d)
+        gradient[d][v] = grad[d];
+    }
+  }
+}
+} // namespace
+
+template<int dim, typename Number>
+IntegralQuantitiesCalculator<dim, Number>::IntegralQuantitiesCalculator(MPI_Comm const & comm)
+  : mpi_comm(comm),
+    matrix_free(nullptr),
+    dof_index_velocity(0),
+    dof_index_pressure(1),
+    quad_index(0),
+    quad_index_error(0),
+    velocity(nullptr),
+    pressure(nullptr),
+    time(0.0),
+    up_to_date(false),
+    sums(n_entries, 0.0),
+    max_vorticity(0.0),
+    max_vorticity_local(0.0)
+{
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::setup(
+  dealii::MatrixFree<dim, Number> const & matrix_free_in,
+  unsigned int const                      dof_index_velocity_in,
+  unsigned int const                      dof_index_pressure_in,
+  unsigned int const                      quad_index_in,
+  unsigned int const                      quad_index_error_in,
+  ErrorCalculationData<dim> const &       error_data_u_in,
+  ErrorCalculationData<dim> const &       error_data_p_in,
+  KineticEnergyData const &               kinetic_energy_data_in,
+  MassConservationData const &            mass_data_in,
+  LiftAndDragData const &                 lift_and_drag_data_in)
+{
+  matrix_free         = &matrix_free_in;
+  dof_index_velocity  = dof_index_velocity_in;
+  dof_index_pressure  = dof_index_pressure_in;
+  quad_index          = quad_index_in;
+  quad_index_error    = quad_index_error_in;
+  error_data_u        = error_data_u_in;
+  error_data_p        = error_data_p_in;
+  kinetic_energy_data = kinetic_energy_data_in;
+  mass_data           = mass_data_in;
+  lift_and_drag_data  = lift_and_drag_data_in;
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::reinit(VectorType const & velocity_in,
+                                                  VectorType const & pressure_in,
+                                                  double const       time_in)
+{
+  velocity   = &velocity_in;
+  pressure   = &pressure_in;
+  time       = time_in;
+  up_to_date = false;
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::get_error_velocity(
+  double &                              error_norm,
+  double &                              solution_norm,
+  dealii::VectorTools::NormType const & norm_type)
+{
+  AssertThrow(need_error_velocity(), dealii::ExcMessage("Velocity error has not been computed."));
+
+  evaluate_if_necessary();
+
+  if(norm_type == dealii::VectorTools::L2_norm)
+  {
+    error_norm    = std::sqrt(sums[error_u_L2]);
+    solution_norm = std::sqrt(sums[solution_u_L2]);
+  }
+  else if(norm_type == dealii::VectorTools::H1_seminorm)
+  {
+    AssertThrow(error_data_u.calculate_H1_seminorm_error,
+                dealii::ExcMessage("H1-seminorm error has not been computed."));
+
+    error_norm    = std::sqrt(sums[error_u_H1_seminorm]);
+    solution_norm = std::sqrt(sums[solution_u_H1_seminorm]);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Norm type is not implemented."));
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::get_error_pressure(
+  double &                              error_norm,
+  double &                              solution_norm,
+  dealii::VectorTools::NormType const & norm_type)
+{
+  AssertThrow(need_error_pressure(), dealii::ExcMessage("Pressure error has not been computed."));
+
+  evaluate_if_necessary();
+
+  if(norm_type == dealii::VectorTools::L2_norm)
+  {
+    error_norm    = std::sqrt(sums[error_p_L2]);
+    solution_norm = std::sqrt(sums[solution_p_L2]);
+  }
+  else if(norm_type == dealii::VectorTools::H1_seminorm)
+  {
+    AssertThrow(error_data_p.calculate_H1_seminorm_error,
+                dealii::ExcMessage("H1-seminorm error has not been computed."));
+
+    error_norm    = std::sqrt(sums[error_p_H1_seminorm]);
+    solution_norm = std::sqrt(sums[solution_p_H1_seminorm]);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Norm type is not implemented."));
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::get_kinetic_energy(Number & volume_out,
+                                                              Number & energy_out,
+                                                              Number & enstrophy_out,
+                                                              Number & dissipation_out,
+                                                              Number & max_vorticity_out)
+{
+  AssertThrow(kinetic_energy_data.calculate,
+              dealii::ExcMessage("Kinetic energy has not been computed."));
+
+  evaluate_if_necessary();
+
+  volume_out        = sums[volume];
+  energy_out        = sums[kinetic_energy];
+  enstrophy_out     = sums[enstrophy];
+  dissipation_out   = sums[dissipation];
+  max_vorticity_out = max_vorticity;
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::get_divergence_and_mass_error(
+  Number & div_error_out,
+  Number & div_error_reference_out,
+  Number & mass_error_out,
+  Number & mass_error_reference_out)
+{
+  AssertThrow(mass_data.calculate,
+              dealii::ExcMessage("Divergence and mass error have not been computed."));
+
+  evaluate_if_necessary();
+
+  div_error_out            = sums[div_error];
+  div_error_reference_out  = sums[div_error_reference];
+  mass_error_out           = sums[mass_error];
+  mass_error_reference_out = sums[mass_error_reference];
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::get_force(dealii::Tensor<1, dim, Number> & force_out)
+{
+  AssertThrow(lift_and_drag_data.calculate, dealii::ExcMessage("Forces have not been computed."));
+
+  evaluate_if_necessary();
+
+  for(unsigned int d = 0; d < dim; ++d)
+    force_out[d] = sums[force + d];
+}
+
+template<int dim, typename Number>
+bool
+IntegralQuantitiesCalculator<dim, Number>::need_error_velocity() const
+{
+  return error_data_u.analytical_solution_available;
+}
+
+template<int dim, typename Number>
+bool
+IntegralQuantitiesCalculator<dim, Number>::need_error_pressure() const
+{
+  return error_data_p.analytical_solution_available;
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::evaluate_if_necessary()
+{
+  if(up_to_date)
+    return;
+
+  AssertThrow(velocity != nullptr and pressure != nullptr,
+              dealii::ExcMessage("Solution vectors have not been set, call reinit() first."));
+
+  if(need_error_velocity())
+    error_data_u.analytical_solution->set_time(time);
+  if(need_error_pressure())
+    error_data_p.analytical_solution->set_time(time);
+
+  std::vector<double> dst(n_entries, 0.0);
+  max_vorticity_local = 0.0;
+
+  if(mass_data.calculate or lift_and_drag_data.calculate)
+    matrix_free->loop(
+      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, *velocity);
+  else
+    matrix_free->cell_loop(&This::cell_loop, this, dst, *velocity);
+
+  // a single reduction for all quantities that are summed up over the MPI processes
+  dealii::Utilities::MPI::sum(dst, mpi_comm, sums);
+
+  if(kinetic_energy_data.calculate)
+    max_vorticity = dealii::Utilities::MPI::max(max_vorticity_local, mpi_comm);
+
+  up_to_date = true;
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::cell_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<double> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & cell_range)
+{
+  bool const error_u    = need_error_velocity();
+  bool const error_u_H1 = error_u and error_data_u.calculate_H1_seminorm_error;
+  bool const error_p    = need_error_pressure();
+  bool const error_p_H1 = error_p and error_data_p.calculate_H1_seminorm_error;
+  bool const energy     = kinetic_energy_data.calculate;
+  bool const divergence = mass_data.calculate;
+
+  bool const evaluate_velocity = energy or divergence;
+
+  scalar const viscosity = dealii::make_vectorized_array<Number>(kinetic_energy_data.viscosity);
+
+  CellIntegratorU integrator_u(matrix_free, dof_index_velocity, quad_index);
+  CellIntegratorU integrator_u_error(matrix_free, dof_index_velocity, quad_index_error);
+  CellIntegratorP integrator_p(matrix_free, dof_index_pressure, quad_index_error);
+
+  std::array<scalar, n_entries> values;
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    for(unsigned int i = 0; i < n_entries; ++i)
+      values[i] = dealii::make_vectorized_array<Number>(0.);
+
+    scalar max_vorticity_vec = dealii::make_vectorized_array<Number>(0.);
+
+    // volume, kinetic energy, enstrophy, dissipation, and divergence error
+    integrator_u.reinit(cell);
+    if(evaluate_velocity)
+    {
+      integrator_u.read_dof_values(src);
+      integrator_u.evaluate(true, true);
+    }
+
+    for(unsigned int q = 0; q < integrator_u.n_q_points; ++q)
+    {
+      scalar const JxW = integrator_u.JxW(q);
+
+      values[volume] += JxW;
+
+      if(energy)
+      {
+        vector const u      = integrator_u.get_value(q);
+        tensor const grad_u = integrator_u.get_gradient(q);
+
+        values[kinetic_energy] += JxW * dealii::make_vectorized_array<Number>(0.5) * u * u;
+        values[dissipation] += JxW * viscosity * scalar_product(grad_u, grad_u);
+
+        dealii::Tensor<1, number_vorticity_components, scalar> omega = integrator_u.get_curl(q);
+
+        scalar const norm_omega = omega * omega;
+        values[enstrophy] += JxW * dealii::make_vectorized_array<Number>(0.5) * norm_omega;
+
+        max_vorticity_vec = std::max(max_vorticity_vec, std::sqrt(norm_omega));
+      }
+
+      if(divergence)
+      {
+        values[div_error] += JxW * std::abs(integrator_u.get_divergence(q));
+        values[div_error_reference] += JxW * integrator_u.get_value(q).norm();
+      }
+    }
+
+    // errors with respect to the analytical solution
+    if(error_u)
+    {
+      integrator_u_error.reinit(cell);
+      integrator_u_error.read_dof_values(src);
+      integrator_u_error.evaluate(true, error_u_H1);
+
+      for(unsigned int q = 0; q < integrator_u_error.n_q_points; ++q)
+      {
+        scalar const JxW = integrator_u_error.JxW(q);
+
+        vector const u = integrator_u_error.get_value(q);
+        tensor       grad_u;
+        if(error_u_H1)
+          grad_u = integrator_u_error.get_gradient(q);
+
+        dealii::Point<dim, scalar> const q_points = integrator_u_error.quadrature_point(q);
+
+        for(unsigned int c = 0; c < dim; ++c)
+        {
+          scalar u_exact;
+          vector grad_u_exact;
+          evaluate_function<dim, Number>(
+            *error_data_u.analytical_solution, q_points, c, error_u_H1, u_exact, grad_u_exact);
+
+          scalar const error = u[c] - u_exact;
+          values[error_u_L2] += JxW * error * error;
+          values[solution_u_L2] += JxW * u_exact * u_exact;
+
+          if(error_u_H1)
+          {
+            vector const grad_error = grad_u[c] - grad_u_exact;
+            values[error_u_H1_seminorm] += JxW * grad_error * grad_error;
+            values[solution_u_H1_seminorm] += JxW * grad_u_exact * grad_u_exact;
+          }
+        }
+      }
+    }
+
+    if(error_p)
+    {
+      integrator_p.reinit(cell);
+      integrator_p.read_dof_values(*pressure);
+      integrator_p.evaluate(true, error_p_H1);
+
+      for(unsigned int q = 0; q < integrator_p.n_q_points; ++q)
+      {
+        scalar const JxW = integrator_p.JxW(q);
+
+        dealii::Point<dim, scalar> const q_points = integrator_p.quadrature_point(q);
+
+        scalar p_exact;
+        vector grad_p_exact;
+        evaluate_function<dim, Number>(
+          *error_data_p.analytical_solution, q_points, 0, error_p_H1, p_exact, grad_p_exact);
+
+        scalar const error = integrator_p.get_value(q) - p_exact;
+        values[error_p_L2] += JxW * error * error;
+        values[solution_p_L2] += JxW * p_exact * p_exact;
+
+        if(error_p_H1)
+        {
+          vector const grad_error = integrator_p.get_gradient(q) - grad_p_exact;
+          values[error_p_H1_seminorm] += JxW * grad_error * grad_error;
+          values[solution_p_H1_seminorm] += JxW * grad_p_exact * grad_p_exact;
+        }
+      }
+    }
+
+    values[div_error] *= dealii::make_vectorized_array<Number>(mass_data.reference_length_scale);
+
+    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+    {
+      for(unsigned int i = 0; i < n_entries; ++i)
+        dst[i] += values[i][v];
+
+      max_vorticity_local = std::max(max_vorticity_local, double(max_vorticity_vec[v]));
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::face_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<double> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & face_range)
+{
+  if(not mass_data.calculate)
+    return;
+
+  FaceIntegratorU integrator_m(matrix_free, true, dof_index_velocity, quad_index);
+  FaceIntegratorU integrator_p(matrix_free, false, dof_index_velocity, quad_index);
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_m.read_dof_values(src);
+    integrator_m.evaluate(true, false);
+    integrator_p.reinit(face);
+    integrator_p.read_dof_values(src);
+    integrator_p.evaluate(true, false);
+
+    scalar diff_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
+    scalar mean_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
+
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+    {
+      vector const u_m    = integrator_m.get_value(q);
+      vector const u_p    = integrator_p.get_value(q);
+      vector const normal = integrator_m.get_normal_vector(q);
+
+      diff_mass_flux_vec += integrator_m.JxW(q) * std::abs((u_m - u_p) * normal);
+      mean_mass_flux_vec += integrator_m.JxW(q) * std::abs(0.5 * (u_m + u_p) * normal);
+    }
+
+    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      dst[mass_error] += diff_mass_flux_vec[v];
+      dst[mass_error_reference] += mean_mass_flux_vec[v];
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::boundary_face_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<double> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & face_range)
+{
+  if(not lift_and_drag_data.calculate)
+    return;
+
+  FaceIntegratorU integrator_u(matrix_free, true, dof_index_velocity, quad_index);
+  FaceIntegratorP integrator_p(matrix_free, true, dof_index_pressure, quad_index);
+
+  scalar const viscosity = dealii::make_vectorized_array<Number>(lift_and_drag_data.viscosity);
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    // only evaluate the solution on faces that belong to the surface of interest
+    if(lift_and_drag_data.boundary_IDs.find(matrix_free.get_boundary_id(face)) ==
+       lift_and_drag_data.boundary_IDs.end())
+      continue;
+
+    integrator_u.reinit(face);
+    integrator_u.read_dof_values(src);
+    integrator_u.evaluate(false, true);
+
+    integrator_p.reinit(face);
+    integrator_p.read_dof_values(*pressure);
+    integrator_p.evaluate(true, false);
+
+    vector force_vec;
+
+    for(unsigned int q = 0; q < integrator_u.n_q_points; ++q)
+    {
+      vector const normal = integrator_u.get_normal_vector(q);
+      tensor const grad_u = integrator_u.get_gradient(q);
+
+      vector const tau =
+        integrator_p.get_value(q) * normal - viscosity * (grad_u + transpose(grad_u)) * normal;
+
+      force_vec += integrator_u.JxW(q) * tau;
+    }
+
+    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      for(unsigned int d = 0; d < dim; ++d)
+        dst[force + d] += force_vec[d][v];
+    }
+  }
+}
+
+template class IntegralQuantitiesCalculator<2, float>;
+template class IntegralQuantitiesCalculator<2, double>;
+
+template class IntegralQuantitiesCalculator<3, float>;
+template class IntegralQuantitiesCalculator<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
@@ -0,0 +1,205 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INTEGRAL_QUANTITIES_CALCULATOR_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INTEGRAL_QUANTITIES_CALCULATOR_H_
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/divergence_and_mass_error.h>
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/error_calculation.h>
+#include <exadg/postprocessor/kinetic_energy_calculation.h>
+#include <exadg/postprocessor/lift_and_drag_calculation.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+/*
+ * This class evaluates all integral quantities of the incompressible Navier-Stokes postprocessor
+ * (errors with respect to analytical solutions, kinetic energy/enstrophy/dissipation, divergence
+ * and mass errors, as well as forces acting on surfaces) in a single matrix-free loop over cells
+ * and faces, followed by a single MPI reduction of all quantities. This avoids separate passes over
+ * the mesh for each of the individual postprocessing tools.
+ *
+ * Kinetic energy, enstrophy, dissipation, divergence and mass errors, as well as forces are
+ * integrated with the quadrature rule given by quad_index (the one used by the individual
+ * postprocessing tools), whereas the errors with respect to the analytical solution are integrated
+ * with the (typically more accurate) quadrature rule given by quad_index_error.
+ *
+ * The evaluation is lazy: reinit() only stores the solution vectors and the time, and the loop is
+ * performed once the first quantity is requested by one of the postprocessing tools. Hence, the
+ * loop is done at most once per call to reinit() and not at all if no tool needs to evaluate its
+ * quantities at the current time.
+ */
+template<int dim, typename Number>
+class IntegralQuantitiesCalculator
+{
+public:
+  static unsigned int const number_vorticity_components = (dim == 2) ? 1 : dim;
+
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
+  typedef CellIntegrator<dim, 1, Number>   CellIntegratorP;
+  typedef FaceIntegrator<dim, dim, Number> FaceIntegratorU;
+  typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorP;
+
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
+  typedef IntegralQuantitiesCalculator<dim, Number> This;
+
+  IntegralQuantitiesCalculator(MPI_Comm const & comm);
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+        unsigned int const                      dof_index_velocity_in,
+        unsigned int const                      dof_index_pressure_in,
+        unsigned int const                      quad_index_in,
+        unsigned int const                      quad_index_error_in,
+        ErrorCalculationData<dim> const &       error_data_u_in,
+        ErrorCalculationData<dim> const &       error_data_p_in,
+        KineticEnergyData const &               kinetic_energy_data_in,
+        MassConservationData const &            mass_data_in,
+        LiftAndDragData const &                 lift_and_drag_data_in);
+
+  /*
+   * Sets the solution for which integral quantities are evaluated. The actual evaluation is
+   * deferred until the first quantity is requested.
+   */
+  void
+  reinit(VectorType const & velocity, VectorType const & pressure, double const time);
+
+  void
+  get_error_velocity(double &                              error_norm,
+                     double &                              solution_norm,
+                     dealii::VectorTools::NormType const & norm_type);
+
+  void
+  get_error_pressure(double &                              error_norm,
+                     double &                              solution_norm,
+                     dealii::VectorTools::NormType const & norm_type);
+
+  void
+  get_kinetic_energy(Number & volume,
+                     Number & energy,
+                     Number & enstrophy,
+                     Number & dissipation,
+                     Number & max_vorticity);
+
+  void
+  get_divergence_and_mass_error(Number & div_error,
+                                Number & div_error_reference,
+                                Number & mass_error,
+                                Number & mass_error_reference);
+
+  void
+  get_force(dealii::Tensor<1, dim, Number> & force);
+
+private:
+  /*
+   * Indices of the quantities that are summed over all cells/faces and over all MPI processes.
+   */
+  enum Entry : unsigned int
+  {
+    volume = 0,
+    error_u_L2,
+    solution_u_L2,
+    error_u_H1_seminorm,
+    solution_u_H1_seminorm,
+    error_p_L2,
+    solution_p_L2,
+    error_p_H1_seminorm,
+    solution_p_H1_seminorm,
+    kinetic_energy,
+    enstrophy,
+    dissipation,
+    div_error,
+    div_error_reference,
+    mass_error,
+    mass_error_reference,
+    force,
+    n_entries = force + dim
+  };
+
+  void
+  evaluate_if_necessary();
+
+  void
+  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<double> &                         dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & cell_range);
+
+  void
+  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<double> &                         dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & face_range);
+
+  void
+  boundary_face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                     std::vector<double> &                         dst,
+                     VectorType const &                            src,
+                     std::pair<unsigned int, unsigned int> const & face_range);
+
+  bool
+  need_error_velocity() const;
+
+  bool
+  need_error_pressure() const;
+
+  MPI_Comm const mpi_comm;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+  unsigned int                            dof_index_velocity, dof_index_pressure;
+  unsigned int                            quad_index, quad_index_error;
+
+  ErrorCalculationData<dim> error_data_u, error_data_p;
+  KineticEnergyData         kinetic_energy_data;
+  MassConservationData      mass_data;
+  LiftAndDragData           lift_and_drag_data;
+
+  VectorType const * velocity;
+  VectorType const * pressure;
+  double             time;
+
+  bool up_to_date;
+
+  // results of the evaluation (global quantities after MPI reduction)
+  std::vector<double> sums;
+  double              max_vorticity;
+
+  // local maximum vorticity, accumulated during the cell loop
+  double max_vorticity_local;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INTEGRAL_QUANTITIES_CALCULATOR_H_ \
+        */
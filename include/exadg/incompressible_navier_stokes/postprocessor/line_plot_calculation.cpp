@@ -41,7 +41,8 @@ void
 LinePlotCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_velocity_in,
                                        dealii::DoFHandler<dim> const & dof_handler_pressure_in,
                                        dealii::Mapping<dim> const &    mapping_in,
-                                       LinePlotDataInstantaneous<dim> const & line_plot_data_in)
+                                       LinePlotDataInstantaneous<dim> const & line_plot_data_in,
+                                       bool const                             moving_mesh)
 {
   dof_handler_velocity = &dof_handler_velocity_in;
   dof_handler_pressure = &dof_handler_pressure_in;
@@ -49,7 +50,39 @@ LinePlotCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handl
   data                 = line_plot_data_in;
 
   if(data.calculate)
+  {
     create_directories(data.line_data.directory, mpi_comm);
+
+    for(auto const & line : data.line_data.lines)
+    {
+      // we consider straight lines with an equidistant distribution of points along the line
+      unsigned int const              n_points = line->n_points;
+      std::vector<dealii::Point<dim>> line_points(n_points);
+      for(unsigned int i = 0; i < n_points; ++i)
+        line_points[i] = line->begin + double(i) / double(n_points - 1) * (line->end - line->begin);
+
+      std::shared_ptr<ProbeSet<dim, dim, Number>> probe_velocity;
+      std::shared_ptr<ProbeSet<dim, 1, Number>>   probe_pressure;
+
+      for(auto const & quantity : line->quantities)
+      {
+        if(quantity->type == QuantityType::Velocity and not probe_velocity)
+        {
+          probe_velocity = std::make_shared<ProbeSet<dim, dim, Number>>(mpi_comm);
+          probe_velocity->setup(line_points, *dof_handler_velocity, *mapping, moving_mesh);
+        }
+        else if(quantity->type == QuantityType::Pressure and not probe_pressure)
+        {
+          probe_pressure = std::make_shared<ProbeSet<dim, 1, Number>>(mpi_comm);
+          probe_pressure->setup(line_points, *dof_handler_pressure, *mapping, moving_mesh);
+        }
+      }
+
+      points.push_back(line_points);
+      probes_velocity.push_back(probe_velocity);
+      probes_pressure.push_back(probe_pressure);
+    }
+  }
 }
 
 template<int dim, typename Number>
@@ -63,41 +96,27 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
     unsigned int const precision = data.line_data.precision;
 
     // loop over all lines
-    for(typename std::vector<std::shared_ptr<Line<dim>>>::const_iterator line =
-          data.line_data.lines.begin();
-        line != data.line_data.lines.end();
-        ++line)
+    for(unsigned int l = 0; l < data.line_data.lines.size(); ++l)
     {
-      // store all points along current line in a vector
-      unsigned int                    n_points = (*line)->n_points;
-      std::vector<dealii::Point<dim>> points(n_points);
+      auto const & line = data.line_data.lines[l];
 
-      // we consider straight lines with an equidistant distribution of points along the line
-      for(unsigned int i = 0; i < n_points; ++i)
-        points[i] =
-          (*line)->begin + double(i) / double(n_points - 1) * ((*line)->end - (*line)->begin);
+      // all points along current line
+      unsigned int const                      n_points = line->n_points;
+      std::vector<dealii::Point<dim>> const & points   = this->points[l];
 
       // filename prefix for current line
-      std::string filename_prefix = data.line_data.directory + (*line)->name;
+      std::string filename_prefix = data.line_data.directory + line->name;
 
       // write output for all specified quantities
       for(std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            (*line)->quantities.begin();
-          quantity != (*line)->quantities.end();
+            line->quantities.begin();
+          quantity != line->quantities.end();
           ++quantity)
       {
         if((*quantity)->type == QuantityType::Velocity)
         {
-          std::vector<dealii::Tensor<1, dim, Number>> solution_vector(n_points);
-
-          // calculate velocity for all points along line
-          for(unsigned int i = 0; i < n_points; ++i)
-          {
-            dealii::Tensor<1, dim, Number> u;
-            evaluate_vectorial_quantity_in_point(
-              u, *dof_handler_velocity, *mapping, velocity, points[i], mpi_comm);
-            solution_vector[i] = u;
-          }
+          // calculate velocity for all points along line (only available on rank 0)
+          auto const & solution_vector = probes_velocity[l]->evaluate(velocity);
 
           // write output to file
           if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
@@ -140,16 +159,8 @@ LinePlotCalculator<dim, Number>::evaluate(VectorType const & velocity,
         }
         else if((*quantity)->type == QuantityType::Pressure)
         {
-          std::vector<Number> solution_vector(n_points);
-
-          // calculate pressure for all points along line
-          for(unsigned int i = 0; i < n_points; ++i)
-          {
-            Number p;
-            evaluate_scalar_quantity_in_point(
-              p, *dof_handler_pressure, *mapping, pressure, points[i], mpi_comm);
-            solution_vector[i] = p;
-          }
+          // calculate pressure for all points along line (only available on rank 0)
+          auto const & solution_vector = probes_pressure[l]->evaluate(pressure);
 
           // write output to file
           if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
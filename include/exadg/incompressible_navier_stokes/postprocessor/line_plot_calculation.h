@@ -23,7 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_LINE_PLOT_CALCULATION_H_
 
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
-#include <exadg/vector_tools/point_value.h>
+#include <exadg/vector_tools/probe_set.h>
 
 namespace ExaDG
 {
@@ -50,7 +50,8 @@ public:
   setup(dealii::DoFHandler<dim> const &        dof_handler_velocity_in,
         dealii::DoFHandler<dim> const &        dof_handler_pressure_in,
         dealii::Mapping<dim> const &           mapping_in,
-        LinePlotDataInstantaneous<dim> const & line_plot_data_in);
+        LinePlotDataInstantaneous<dim> const & line_plot_data_in,
+        bool const                             moving_mesh = false);
 
   void
   evaluate(VectorType const & velocity, VectorType const & pressure) const;
@@ -65,6 +66,13 @@ private:
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
   LinePlotDataInstantaneous<dim> data;
+
+  // points along each line (same ordering as data.line_data.lines)
+  std::vector<std::vector<dealii::Point<dim>>> points;
+
+  // the points of each line are located once and evaluated at once for all points of a line
+  std::vector<std::shared_ptr<ProbeSet<dim, dim, Number>>> probes_velocity;
+  std::vector<std::shared_ptr<ProbeSet<dim, 1, Number>>>   probes_pressure;
 };
 
 } // namespace IncNS
@@ -32,6 +32,7 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
                                           MPI_Comm const &               comm)
   : mpi_comm(comm),
     pp_data(postprocessor_data),
+    integral_quantities_calculator(comm),
     output_generator(comm),
     error_calculator_u(comm),
     error_calculator_p(comm),
@@ -76,7 +77,8 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
 
   pressure_difference_calculator.setup(pde_operator.get_dof_handler_p(),
                                        *pde_operator.get_mapping(),
-                                       pp_data.pressure_difference_data);
+                                       pp_data.pressure_difference_data,
+                                       pde_operator.grid_is_moving());
 
   div_and_mass_error_calculator.setup(pde_operator.get_matrix_free(),
                                       pde_operator.get_dof_index_velocity(),
@@ -96,7 +98,66 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
   line_plot_calculator.setup(pde_operator.get_dof_handler_u(),
                              pde_operator.get_dof_handler_p(),
                              *pde_operator.get_mapping(),
-                             pp_data.line_plot_data);
+                             pp_data.line_plot_data,
+                             pde_operator.grid_is_moving());
+
+  if(pp_data.fused_integral_quantities)
+  {
+    integral_quantities_calculator.setup(pde_operator.get_matrix_free(),
+                                         pde_operator.get_dof_index_velocity(),
+                                         pde_operator.get_dof_index_pressure(),
+                                         pde_operator.get_quad_index_velocity_linear(),
+                                         pde_operator.get_quad_index_velocity_nonlinear(),
+                                         pp_data.error_data_u,
+                                         pp_data.error_data_p,
+                                         pp_data.kinetic_energy_data,
+                                         pp_data.mass_data,
+                                         pp_data.lift_and_drag_data);
+
+    auto & calculator = integral_quantities_calculator;
+
+    if(pp_data.error_data_u.analytical_solution_available)
+      error_calculator_u.set_norm_evaluator(
+        [&calculator](double &                              error,
+                      double &                              solution,
+                      dealii::VectorTools::NormType const & norm_type) {
+          calculator.get_error_velocity(error, solution, norm_type);
+        });
+
+    if(pp_data.error_data_p.analytical_solution_available)
+      error_calculator_p.set_norm_evaluator(
+        [&calculator](double &                              error,
+                      double &                              solution,
+                      dealii::VectorTools::NormType const & norm_type) {
+          calculator.get_error_pressure(error, solution, norm_type);
+        });
+
+    if(pp_data.lift_and_drag_data.calculate)
+      lift_and_drag_calculator.set_force_evaluator(
+        [&calculator](dealii::Tensor<1, dim, Number> & force) { calculator.get_force(force); });
+
+    if(pp_data.mass_data.calculate)
+      div_and_mass_error_calculator.set_error_evaluator(
+        [&calculator](Number & div_error,
+                      Number & div_error_reference,
+                      Number & mass_error,
+                      Number & mass_error_reference) {
+          calculator.get_divergence_and_mass_error(div_error,
+                                                   div_error_reference,
+                                                   mass_error,
+                                                   mass_error_reference);
+        });
+
+    if(pp_data.kinetic_energy_data.calculate)
+      kinetic_energy_calculator.set_integral_evaluator(
+        [&calculator](Number & volume,
+                      Number & energy,
+                      Number & enstrophy,
+                      Number & dissipation,
+                      Number & max_vorticity) {
+          calculator.get_kinetic_energy(volume, energy, enstrophy, dissipation, max_vorticity);
+        });
+  }
 }
 
 template<int dim, typename Number>
@@ -106,6 +167,12 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const & velocity,
                                               double const       time,
                                               int const          time_step_number)
 {
+  /*
+   *  integral quantities are evaluated (lazily) in a single loop for all tools below
+   */
+  if(pp_data.fused_integral_quantities)
+    integral_quantities_calculator.reinit(velocity, pressure, time);
+
   /*
    *  write output
    */
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_H_
 
 #include <exadg/incompressible_navier_stokes/postprocessor/divergence_and_mass_error.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/integral_quantities_calculator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/kinetic_energy_dissipation_detailed.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/output_generator.h>
@@ -39,10 +40,16 @@ namespace IncNS
 template<int dim>
 struct PostProcessorData
 {
-  PostProcessorData()
+  PostProcessorData() : fused_integral_quantities(false)
   {
   }
 
+  // Evaluate all integral quantities (errors, kinetic energy, divergence and mass error, lift and
+  // drag) in a single matrix-free loop instead of separate loops for each postprocessing tool.
+  // Note that the errors are then computed with the over-integration quadrature rule of the
+  // nonlinear convective term instead of dealii::VectorTools::integrate_difference().
+  bool fused_integral_quantities;
+
   OutputData                     output_data;
   ErrorCalculationData<dim>      error_data_u;
   ErrorCalculationData<dim>      error_data_p;
@@ -83,6 +90,9 @@ protected:
 private:
   PostProcessorData<dim> pp_data;
 
+  // evaluate integral quantities required by the tools below in a single matrix-free loop
+  IntegralQuantitiesCalculator<dim, Number> integral_quantities_calculator;
+
   // write output for visualization of results (e.g., using paraview)
   OutputGenerator<dim, Number> output_generator;
 
@@ -27,6 +27,7 @@
 
 // utilities
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/kernel_profiler.h>
 #include <exadg/utilities/resolution_parameters.h>
 
 // application
@@ -150,6 +151,8 @@ main(int argc, char ** argv)
   ExaDG::SpatialResolutionParameters  spatial(input_file);
   ExaDG::TemporalResolutionParameters temporal(input_file);
 
+  ExaDG::KernelProfiler::enable(general.kernel_profiling);
+
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
   {
@@ -188,6 +191,8 @@ main(int argc, char ** argv)
   MPI_Comm_free(&sub_comm);
 #endif
 
+  ExaDG::KernelProfiler::print_results(mpi_comm);
+
   return 0;
 }
 
@@ -19,12 +19,15 @@
  *  ______________________________________________________________________
  */
 
+// deal.II
+#include <deal.II/base/timer.h>
+
+// ExaDG
 #include <exadg/incompressible_navier_stokes/preconditioners/multigrid_preconditioner_momentum.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_coupled.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
 #include <exadg/poisson/spatial_discretization/laplace_operator.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
-#include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/utilities/check_multigrid.h>
 
@@ -48,7 +51,8 @@ OperatorCoupled<dim, Number>::OperatorCoupled(
          parameters_in,
          field_in,
          mpi_comm_in),
-    scaling_factor_continuity(1.0)
+    scaling_factor_continuity(1.0),
+    velocity_pressure_conv_diff(nullptr)
 {
 }
 
@@ -282,9 +286,16 @@ OperatorCoupled<dim, Number>::evaluate_nonlinear_residual(BlockVectorType &
   // velocity-block
 
   if(this->unsteady_problem_has_to_be_solved())
+  {
     this->mass_operator.apply_scale(dst.block(0), scaling_factor_mass, src.block(0));
+
+    if(this->local_time_steps_are_used())
+      this->apply_local_time_step_scaling(dst.block(0));
+  }
   else
+  {
     dst.block(0) = 0.0;
+  }
 
   AssertThrow(this->param.convective_problem() == true, dealii::ExcMessage("Invalid parameters."));
 
@@ -520,6 +531,8 @@ OperatorCoupled<dim, Number>::initialize_preconditioner_pressure_block()
   {
     setup_multigrid_preconditioner_schur_complement();
 
+    setup_laplace_operator_schur_complement();
+
     if(this->param.exact_inversion_of_laplace_operator == true)
     {
       setup_iterative_solver_schur_complement();
@@ -533,6 +546,8 @@ OperatorCoupled<dim, Number>::initialize_preconditioner_pressure_block()
 
     setup_multigrid_preconditioner_schur_complement();
 
+    setup_laplace_operator_schur_complement();
+
     if(this->param.exact_inversion_of_laplace_operator == true)
     {
       setup_iterative_solver_schur_complement();
@@ -544,9 +559,6 @@ OperatorCoupled<dim, Number>::initialize_preconditioner_pressure_block()
       std::make_shared<InverseMassPreconditioner<dim, 1, Number>>(this->get_matrix_free(),
                                                                   this->get_dof_index_pressure(),
                                                                   this->get_quad_index_pressure());
-
-    // initialize tmp vector
-    this->initialize_vector_pressure(tmp_scp_pressure);
   }
   else if(type == SchurComplementPreconditioner::PressureConvectionDiffusion)
   {
@@ -555,6 +567,8 @@ OperatorCoupled<dim, Number>::initialize_preconditioner_pressure_block()
     // I. multigrid for negative Laplace operator (classical or compatible discretization)
     setup_multigrid_preconditioner_schur_complement();
 
+    setup_laplace_operator_schur_complement();
+
     if(this->param.exact_inversion_of_laplace_operator == true)
     {
       setup_iterative_solver_schur_complement();
@@ -610,22 +624,18 @@ OperatorCoupled<dim, Number>::setup_multigrid_preconditioner_schur_complement()
 
 template<int dim, typename Number>
 void
-OperatorCoupled<dim, Number>::setup_iterative_solver_schur_complement()
+OperatorCoupled<dim, Number>::setup_laplace_operator_schur_complement()
 {
-  AssertThrow(
-    multigrid_preconditioner_schur_complement.get() != 0,
-    dealii::ExcMessage(
-      "Setup of iterative solver for Schur complement preconditioner: Multigrid preconditioner is uninitialized"));
-
-  Krylov::SolverDataCG solver_data;
-  solver_data.max_iter             = this->param.solver_data_pressure_block.max_iter;
-  solver_data.solver_tolerance_abs = this->param.solver_data_pressure_block.abs_tol;
-  solver_data.solver_tolerance_rel = this->param.solver_data_pressure_block.rel_tol;
-  solver_data.use_preconditioner   = true;
+  // The Laplace operator is only needed by the inner solver, i.e., if the Laplace operator is
+  // inverted exactly or by more than one multigrid cycle.
+  if(this->param.exact_inversion_of_laplace_operator == false and
+     this->param.n_cycles_laplace_operator == 1)
+    return;
 
   Poisson::LaplaceOperatorData<0, dim> laplace_operator_data;
   laplace_operator_data.dof_index             = this->get_dof_index_pressure();
   laplace_operator_data.quad_index            = this->get_quad_index_pressure();
+  laplace_operator_data.operator_is_singular  = this->is_pressure_level_undefined();
   laplace_operator_data.bc                    = this->boundary_descriptor_laplace;
   laplace_operator_data.kernel_data.IP_factor = 1.0;
 
@@ -634,6 +644,30 @@ OperatorCoupled<dim, Number>::setup_iterative_solver_schur_complement()
                                this->get_constraint_p(),
                                laplace_operator_data);
 
+  // temporary vectors of the inner solver, allocated once and reused for every application
+  this->initialize_vector_pressure(tmp_laplace_residual);
+  this->initialize_vector_pressure(tmp_laplace_correction);
+}
+
+template<int dim, typename Number>
+void
+OperatorCoupled<dim, Number>::setup_iterative_solver_schur_complement()
+{
+  AssertThrow(
+    multigrid_preconditioner_schur_complement.get() != 0,
+    dealii::ExcMessage(
+      "Setup of iterative solver for Schur complement preconditioner: Multigrid preconditioner is uninitialized"));
+
+  AssertThrow(laplace_operator.get() != 0,
+              dealii::ExcMessage("Setup of iterative solver for Schur complement preconditioner: "
+                                 "Laplace operator is uninitialized"));
+
+  Krylov::SolverDataCG solver_data;
+  solver_data.max_iter             = this->param.solver_data_pressure_block.max_iter;
+  solver_data.solver_tolerance_abs = this->param.solver_data_pressure_block.abs_tol;
+  solver_data.solver_tolerance_rel = this->param.solver_data_pressure_block.rel_tol;
+  solver_data.use_preconditioner   = true;
+
   solver_pressure_block =
     std::make_shared<Krylov::SolverCG<Poisson::LaplaceOperator<dim, Number, 1>,
                                       PreconditionerBase<Number>,
@@ -708,7 +742,9 @@ OperatorCoupled<dim, Number>::setup_pressure_convection_diffusion_operator()
   operator_data.bc                   = boundary_descriptor;
   operator_data.use_cell_based_loops = this->param.use_cell_based_face_loops;
 
-  operator_data.unsteady_problem   = this->unsteady_problem_has_to_be_solved();
+  // The mass term of A_p is not evaluated by this operator but added after the application of the
+  // inverse mass operator, see apply_preconditioner_pressure_block().
+  operator_data.unsteady_problem   = false;
   operator_data.convective_problem = this->param.nonlinear_problem_has_to_be_solved();
   operator_data.diffusive_problem  = this->param.viscous_problem();
 
@@ -844,7 +880,7 @@ OperatorCoupled<dim, Number>::update_block_preconditioner()
        type == SchurComplementPreconditioner::CahouetChabard ||
        type == SchurComplementPreconditioner::PressureConvectionDiffusion)
     {
-      if(this->param.exact_inversion_of_laplace_operator == true)
+      if(laplace_operator.get() != 0)
       {
         laplace_operator->update_penalty_parameter();
       }
@@ -1075,111 +1111,166 @@ void
 OperatorCoupled<dim, Number>::apply_preconditioner_pressure_block(VectorType &       dst,
                                                                   VectorType const & src) const
 {
+  dealii::Timer timer;
+  timer.restart();
+
   auto type = this->param.preconditioner_pressure_block;
 
+  // scaling_factor_continuity: Since the Schur complement includes both the velocity divergence
+  // and the pressure gradient operators as factors, we have to scale by
+  // 1/(scaling_factor*scaling_factor) when applying (an approximation of) the inverse Schur
+  // complement. This factor is merged with the last operation applied to dst, so that no separate
+  // pass over the vector is needed.
+  double const inverse_scaling_factor =
+    1.0 / (scaling_factor_continuity * scaling_factor_continuity);
+
+  unsigned int n_cycles = 0;
+
   if(type == SchurComplementPreconditioner::None)
   {
     // No preconditioner for Schur-complement block
-    dst = src;
+    dst.equ(inverse_scaling_factor, src);
   }
   else if(type == SchurComplementPreconditioner::InverseMassMatrix)
   {
     // - S^{-1} = nu M_p^{-1}
-    inverse_mass_preconditioner_schur_complement->vmult(dst, src);
-    dst *= this->get_viscosity();
+    inverse_mass_preconditioner_schur_complement->vmult_scale(dst,
+                                                              inverse_scaling_factor *
+                                                                this->get_viscosity(),
+                                                              src);
   }
   else if(type == SchurComplementPreconditioner::LaplaceOperator)
   {
     // -S^{-1} = 1/dt  (-L)^{-1}
-    apply_inverse_negative_laplace_operator(dst, src);
-    dst *= this->momentum_operator.get_scaling_factor_mass_operator();
+    n_cycles = apply_inverse_negative_laplace_operator(dst, src);
+    dst *= inverse_scaling_factor * this->momentum_operator.get_scaling_factor_mass_operator();
   }
   else if(type == SchurComplementPreconditioner::CahouetChabard)
   {
     // - S^{-1} = nu M_p^{-1} + 1/dt (-L)^{-1}
 
-    // I. 1/dt (-L)^{-1}
-    apply_inverse_negative_laplace_operator(dst, src);
-    dst *= this->momentum_operator.get_scaling_factor_mass_operator();
+    // I. (-L)^{-1}
+    n_cycles = apply_inverse_negative_laplace_operator(dst, src);
 
-    // II. M_p^{-1}, apply inverse pressure mass operator to src-vector and store the result in a
-    // temporary vector
-    inverse_mass_preconditioner_schur_complement->vmult(tmp_scp_pressure, src);
-
-    // III. add temporary vector scaled by viscosity
-    dst.add(this->get_viscosity(), tmp_scp_pressure);
+    // II. nu M_p^{-1} src + 1/dt dst, computed in a single cell loop
+    inverse_mass_preconditioner_schur_complement->vmult_scale_add(
+      dst,
+      inverse_scaling_factor * this->get_viscosity(),
+      src,
+      inverse_scaling_factor * this->momentum_operator.get_scaling_factor_mass_operator(),
+      dst);
   }
   else if(type == SchurComplementPreconditioner::PressureConvectionDiffusion)
   {
-    // -S^{-1} = M_p^{-1} A_p (-L)^{-1}
-
-    // I. inverse, negative Laplace operator (-L)^{-1}
-    apply_inverse_negative_laplace_operator(tmp_scp_pressure, src);
-
-    // II. pressure convection-diffusion operator A_p
-    if(this->unsteady_problem_has_to_be_solved())
+    // -S^{-1} = M_p^{-1} A_p (-L)^{-1} with A_p = 1/dt M_p + C_p + nu D_p
+    //
+    // The mass term of A_p cancels against M_p^{-1}, i.e.,
+    //
+    //   M_p^{-1} A_p z = M_p^{-1} (C_p + nu D_p) z + 1/dt z ,
+    //
+    // so that only the convective and diffusive terms are evaluated by the pressure
+    // convection-diffusion operator, and the time derivative term is added in the cell loop of the
+    // inverse mass operator.
+
+    // I. inverse, negative Laplace operator z = (-L)^{-1} src
+    n_cycles = apply_inverse_negative_laplace_operator(tmp_scp_pressure, src);
+
+    // II. convective and diffusive terms of the pressure convection-diffusion operator
+    if(this->param.nonlinear_problem_has_to_be_solved())
     {
-      pressure_conv_diff_operator->set_scaling_factor_mass_operator(
-        this->momentum_operator.get_scaling_factor_mass_operator());
+      // The ghost values of the linearization velocity have already been updated when setting the
+      // velocity of the convective kernel. Hence, the pointer of the pressure convection-diffusion
+      // operator only needs to be reset (including another ghost value exchange) if the velocity
+      // vector changes.
+      VectorType const & velocity = this->convective_kernel->get_velocity();
+      if(&velocity != velocity_pressure_conv_diff)
+      {
+        pressure_conv_diff_operator->set_velocity_ptr(velocity);
+        velocity_pressure_conv_diff = &velocity;
+      }
     }
 
-    if(this->param.nonlinear_problem_has_to_be_solved())
-      pressure_conv_diff_operator->set_velocity_ptr(this->convective_kernel->get_velocity());
-
     pressure_conv_diff_operator->apply(dst, tmp_scp_pressure);
 
-    // III. inverse pressure mass operator M_p^{-1}
-    inverse_mass_preconditioner_schur_complement->vmult(dst, dst);
+    // III. inverse pressure mass operator M_p^{-1} and time derivative term 1/dt z
+    if(this->unsteady_problem_has_to_be_solved())
+    {
+      inverse_mass_preconditioner_schur_complement->vmult_scale_add(
+        dst,
+        inverse_scaling_factor,
+        dst,
+        inverse_scaling_factor * this->momentum_operator.get_scaling_factor_mass_operator(),
+        tmp_scp_pressure);
+    }
+    else
+    {
+      inverse_mass_preconditioner_schur_complement->vmult_scale(dst, inverse_scaling_factor, dst);
+    }
   }
   else
   {
     AssertThrow(false, dealii::ExcNotImplemented());
   }
 
-  // scaling_factor_continuity: Since the Schur complement includes both the velocity divergence
-  // and the pressure gradient operators as factors, we have to scale by
-  // 1/(scaling_factor*scaling_factor) when applying (an approximation of) the inverse Schur
-  // complement.
-  double inverse_scaling_factor = 1.0 / scaling_factor_continuity;
-  dst *= inverse_scaling_factor * inverse_scaling_factor;
+  statistics_pressure_block.n_applications += 1;
+  statistics_pressure_block.n_cycles += n_cycles;
+  statistics_pressure_block.wall_time += timer.wall_time();
 }
 
 template<int dim, typename Number>
-void
+unsigned int
 OperatorCoupled<dim, Number>::apply_inverse_negative_laplace_operator(VectorType &       dst,
                                                                       VectorType const & src) const
 {
   if(this->param.exact_inversion_of_laplace_operator == false)
   {
-    // perform one multigrid V-cycle in order to approximately invert the negative Laplace
-    // operator (classical or compatible)
+    // perform a fixed number of multigrid cycles in order to approximately invert the negative
+    // Laplace operator (classical or compatible)
     multigrid_preconditioner_schur_complement->vmult(dst, src);
+
+    // Richardson iteration preconditioned by multigrid: dst += P^{-1} (src - (-L) dst). Since the
+    // number of iterations is fixed, this is a linear operator as required by the outer solver.
+    for(unsigned int cycle = 1; cycle < this->param.n_cycles_laplace_operator; ++cycle)
+    {
+      laplace_operator->vmult(tmp_laplace_residual, dst);
+      tmp_laplace_residual.sadd(-1.0, 1.0, src);
+
+      if(laplace_operator->operator_is_singular())
+        set_zero_mean_value(tmp_laplace_residual);
+
+      multigrid_preconditioner_schur_complement->vmult(tmp_laplace_correction,
+                                                       tmp_laplace_residual);
+      dst += tmp_laplace_correction;
+    }
+
+    return this->param.n_cycles_laplace_operator;
   }
   else // exact_inversion_of_laplace_operator == true
   {
     // solve a linear system of equations for negative Laplace operator to given (relative)
     // tolerance using the PCG method
     VectorType const * pointer_to_src = &src;
-    if(this->is_pressure_level_undefined())
+    if(laplace_operator->operator_is_singular())
     {
-      VectorType vector_zero_mean;
-      vector_zero_mean = src;
-
-      if(laplace_operator->operator_is_singular())
-      {
-        set_zero_mean_value(vector_zero_mean);
-      }
-
-      pointer_to_src = &vector_zero_mean;
+      tmp_laplace_residual = src;
+      set_zero_mean_value(tmp_laplace_residual);
+      pointer_to_src = &tmp_laplace_residual;
     }
 
     dst = 0.0;
     // Note that update of preconditioner is set to false here since the preconditioner has
     // already been updated in the function update_block_preconditioner().
-    solver_pressure_block->solve(dst, *pointer_to_src, /* update_preconditioner = */ false);
+    return solver_pressure_block->solve(dst, *pointer_to_src, /* update_preconditioner = */ false);
   }
 }
 
+template<int dim, typename Number>
+StatisticsPressureBlock const &
+OperatorCoupled<dim, Number>::get_statistics_pressure_block() const
+{
+  return statistics_pressure_block;
+}
+
 
 template class OperatorCoupled<2, float>;
 template class OperatorCoupled<2, double>;
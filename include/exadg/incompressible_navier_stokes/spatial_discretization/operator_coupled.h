@@ -25,6 +25,8 @@
 #include <exadg/convection_diffusion/spatial_discretization/operators/combined_operator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
 #include <exadg/solvers_and_preconditioners/newton/newton_solver.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
+#include <exadg/utilities/kernel_profiler.h>
 
 namespace ExaDG
 {
@@ -81,6 +83,25 @@ private:
   double             scaling_factor_mass;
 };
 
+/*
+ * Cost of the preconditioner of the pressure/Schur-complement block accumulated over all
+ * applications. The preconditioner is applied once per iteration of the outer Krylov solver.
+ */
+struct StatisticsPressureBlock
+{
+  StatisticsPressureBlock() : n_applications(0), n_cycles(0), wall_time(0.0)
+  {
+  }
+
+  unsigned long long n_applications;
+
+  // number of multigrid cycles (one per PCG iteration in case of an exact inversion of the
+  // Laplace operator)
+  unsigned long long n_cycles;
+
+  double wall_time;
+};
+
 template<int dim, typename Number>
 class LinearOperatorCoupled : public dealii::Subscriptor
 {
@@ -125,6 +146,8 @@ public:
   void
   vmult(BlockVectorType & dst, BlockVectorType const & src) const
   {
+    ScopedOperatorTiming operator_timing;
+
     pde_operator->apply_linearized_problem(dst, src, time, scaling_factor_mass);
   }
 
@@ -322,6 +345,9 @@ public:
   void
   apply_block_preconditioner(BlockVectorType & dst, BlockVectorType const & src) const;
 
+  StatisticsPressureBlock const &
+  get_statistics_pressure_block() const;
+
 private:
   void
   initialize_solver_coupled();
@@ -350,6 +376,9 @@ private:
   void
   setup_multigrid_preconditioner_schur_complement();
 
+  void
+  setup_laplace_operator_schur_complement();
+
   void
   setup_iterative_solver_schur_complement();
 
@@ -362,7 +391,10 @@ private:
   void
   apply_preconditioner_pressure_block(VectorType & dst, VectorType const & src) const;
 
-  void
+  /*
+   * Returns the number of multigrid cycles.
+   */
+  unsigned int
   apply_inverse_negative_laplace_operator(VectorType & dst, VectorType const & src) const;
 
   /*
@@ -403,10 +435,14 @@ private:
 
   // preconditioner pressure/Schur-complement block
   std::shared_ptr<PreconditionerBase<Number>> multigrid_preconditioner_schur_complement;
-  std::shared_ptr<PreconditionerBase<Number>> inverse_mass_preconditioner_schur_complement;
+  std::shared_ptr<InverseMassPreconditioner<dim, 1, Number>>
+    inverse_mass_preconditioner_schur_complement;
 
   std::shared_ptr<ConvDiff::CombinedOperator<dim, Number>> pressure_conv_diff_operator;
 
+  // velocity vector the pressure convection-diffusion operator currently points to
+  VectorType const mutable * velocity_pressure_conv_diff;
+
   std::shared_ptr<Poisson::LaplaceOperator<dim, Number, 1>> laplace_operator;
 
   std::shared_ptr<Krylov::SolverBase<VectorType>> solver_pressure_block;
@@ -418,6 +454,11 @@ private:
   // temporary vectors that are necessary when applying the Schur-complement preconditioner (scp)
   VectorType mutable tmp_scp_pressure;
   VectorType mutable tmp_scp_velocity, tmp_scp_velocity_2;
+
+  // temporary vectors of the inner solver for the Laplace operator
+  VectorType mutable tmp_laplace_residual, tmp_laplace_correction;
+
+  StatisticsPressureBlock mutable statistics_pressure_block;
 };
 
 } // namespace IncNS
@@ -754,6 +754,16 @@ OperatorDualSplitting<dim, Number>::solve_viscous(VectorType &       dst,
   return n_iter;
 }
 
+template<int dim, typename Number>
+std::shared_ptr<TimerTree>
+OperatorDualSplitting<dim, Number>::get_timings_helmholtz_preconditioner() const
+{
+  if(helmholtz_preconditioner.get() != nullptr)
+    return helmholtz_preconditioner->get_timings();
+
+  return nullptr;
+}
+
 template<int dim, typename Number>
 void
 OperatorDualSplitting<dim, Number>::interpolate_velocity_dirichlet_bc(VectorType &   dst,
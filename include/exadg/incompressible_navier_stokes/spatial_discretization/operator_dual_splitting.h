@@ -127,6 +127,12 @@ public:
                 bool const &       update_preconditioner,
                 double const &     scaling_factor_mass);
 
+  /*
+   * Returns the timings of the preconditioner of the viscous step (used for solver benchmarks).
+   */
+  std::shared_ptr<TimerTree>
+  get_timings_helmholtz_preconditioner() const;
+
   /*
    * Fill a DoF vector with velocity Dirichlet values on Dirichlet boundaries.
    *
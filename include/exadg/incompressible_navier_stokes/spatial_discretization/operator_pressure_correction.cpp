@@ -260,6 +260,16 @@ OperatorPressureCorrection<dim, Number>::solve_linear_momentum_equation(
   return linear_iterations;
 }
 
+template<int dim, typename Number>
+std::shared_ptr<TimerTree>
+OperatorPressureCorrection<dim, Number>::get_timings_momentum_preconditioner() const
+{
+  if(momentum_preconditioner.get() != nullptr)
+    return momentum_preconditioner->get_timings();
+
+  return nullptr;
+}
+
 template<int dim, typename Number>
 void
 OperatorPressureCorrection<dim, Number>::rhs_add_viscous_term(VectorType & dst,
@@ -142,6 +142,12 @@ public:
                                  bool const &       update_preconditioner,
                                  double const &     scaling_factor_mass);
 
+  /*
+   * Returns the timings of the preconditioner of the momentum step (used for solver benchmarks).
+   */
+  std::shared_ptr<TimerTree>
+  get_timings_momentum_preconditioner() const;
+
   /*
    * Calculation of right-hand side vector:
    */
@@ -298,6 +298,16 @@ OperatorProjectionMethods<dim, Number>::apply_laplace_operator(VectorType &
   this->laplace_operator.vmult(dst, src);
 }
 
+template<int dim, typename Number>
+std::shared_ptr<TimerTree>
+OperatorProjectionMethods<dim, Number>::get_timings_preconditioner_pressure_poisson() const
+{
+  if(preconditioner_pressure_poisson.get() != nullptr)
+    return preconditioner_pressure_poisson->get_timings();
+
+  return nullptr;
+}
+
 template<int dim, typename Number>
 void
 OperatorProjectionMethods<dim, Number>::apply_projection_operator(VectorType &       dst,
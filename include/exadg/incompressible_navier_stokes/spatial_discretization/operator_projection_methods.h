@@ -92,6 +92,13 @@ public:
                     VectorType const & src,
                     bool const         update_preconditioner) const;
 
+  /*
+   * Returns the timings of the preconditioner of the pressure Poisson equation (used for solver
+   * benchmarks).
+   */
+  std::shared_ptr<TimerTree>
+  get_timings_preconditioner_pressure_poisson() const;
+
   /*
    * This function applies the projection operator (used for throughput measurements).
    */
@@ -88,6 +88,23 @@ ConvectiveOperator<dim, Number>::evaluate_nonlinear_operator_add(VectorType &
                           dealii::MatrixFree<dim, Number>::DataAccessOnFaces::values);
 }
 
+template<int dim, typename Number>
+double
+ConvectiveOperator<dim, Number>::evaluate_nonlinear_operator_and_calculate_time_step_cfl(
+  VectorType &           dst,
+  VectorType const &     src,
+  Number const           time,
+  unsigned int const     degree,
+  double const           exponent_fe_degree,
+  CFLConditionType const cfl_condition_type) const
+{
+  time_step_calculator_cfl.start(degree, exponent_fe_degree, cfl_condition_type);
+
+  evaluate_nonlinear_operator(dst, src, time);
+
+  return time_step_calculator_cfl.finish(src.get_mpi_communicator());
+}
+
 template<int dim, typename Number>
 void
 ConvectiveOperator<dim, Number>::evaluate_linear_transport(
@@ -189,6 +206,19 @@ ConvectiveOperator<dim, Number>::cell_loop_nonlinear_operator(
       integrator_grid_velocity.gather_evaluate(kernel->get_grid_velocity(), true, false, false);
     }
 
+    // the velocity values are overwritten by do_cell_integral_nonlinear_operator()
+    if(time_step_calculator_cfl.is_active())
+    {
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      {
+        vector u = integrator.get_value(q);
+        if(operator_data.kernel_data.ale)
+          u -= integrator_grid_velocity.get_value(q);
+
+        time_step_calculator_cfl.submit(u, integrator.inverse_jacobian(q));
+      }
+    }
+
     do_cell_integral_nonlinear_operator(integrator, integrator_grid_velocity);
 
     integrator.integrate_scatter(this->integrator_flags.cell_integrate.value,
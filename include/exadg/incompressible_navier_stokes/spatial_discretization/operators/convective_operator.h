@@ -12,6 +12,7 @@
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/operator_base.h>
+#include <exadg/time_integration/time_step_calculation.h>
 
 namespace ExaDG
 {
@@ -1002,6 +1003,21 @@ public:
                                   VectorType const & src,
                                   Number const       time) const;
 
+  /*
+   * Evaluate nonlinear operator and calculate the time step size according to the local CFL
+   * condition (CFL = 1.0) as a by-product of the same cell loop, using the (relative) velocity in
+   * the quadrature points of the nonlinear operator. The returned time step size is the minimum
+   * over all processors.
+   */
+  double
+  evaluate_nonlinear_operator_and_calculate_time_step_cfl(
+    VectorType &           dst,
+    VectorType const &     src,
+    Number const           time,
+    unsigned int const     degree,
+    double const           exponent_fe_degree,
+    CFLConditionType const cfl_condition_type) const;
+
   /*
    * Evaluate operator (linear transport with a divergence-free velocity). This function
    * is required in case of operator-integration-factor (OIF) splitting.
@@ -1161,6 +1177,9 @@ private:
   // OIF substepping
   mutable VectorType const * velocity_linear_transport;
 
+  // time step calculation as a by-product of the evaluation of the nonlinear operator
+  mutable TimeStepCalculatorCFL<dim, Number> time_step_calculator_cfl;
+
   std::shared_ptr<Operators::ConvectiveKernel<dim, Number>> kernel;
 };
 
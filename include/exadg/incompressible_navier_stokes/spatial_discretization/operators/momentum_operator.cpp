@@ -5,7 +5,8 @@ namespace ExaDG
 namespace IncNS
 {
 template<int dim, typename Number>
-MomentumOperator<dim, Number>::MomentumOperator() : scaling_factor_mass(1.0)
+MomentumOperator<dim, Number>::MomentumOperator()
+  : scaling_factor_mass(1.0), cellwise_scaling_mass(nullptr)
 {
 }
 
@@ -165,6 +166,14 @@ MomentumOperator<dim, Number>::set_scaling_factor_mass_operator(Number const & n
   this->scaling_factor_mass = number;
 }
 
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::set_cellwise_scaling_mass_operator(
+  dealii::AlignedVector<scalar> const * scaling)
+{
+  this->cellwise_scaling_mass = scaling;
+}
+
 template<int dim, typename Number>
 void
 MomentumOperator<dim, Number>::rhs(VectorType & dst) const
@@ -218,6 +227,9 @@ MomentumOperator<dim, Number>::reinit_cell(unsigned int const cell) const
 
   if(operator_data.convective_problem)
     convective_kernel->reinit_cell(cell);
+
+  if(operator_data.viscous_problem)
+    viscous_kernel->reinit_cell(*this->integrator);
 }
 
 template<int dim, typename Number>
@@ -266,6 +278,10 @@ template<int dim, typename Number>
 void
 MomentumOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) const
 {
+  scalar scaling_mass = dealii::make_vectorized_array<Number>(scaling_factor_mass);
+  if(cellwise_scaling_mass != nullptr)
+    scaling_mass *= integrator.read_cell_data(*cellwise_scaling_mass);
+
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
     vector value_flux;
@@ -281,7 +297,7 @@ MomentumOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) con
 
     if(operator_data.unsteady_problem)
     {
-      value_flux += mass_kernel->get_volume_flux(scaling_factor_mass, value);
+      value_flux += mass_kernel->get_volume_flux(scaling_mass, value);
     }
 
     if(operator_data.convective_problem)
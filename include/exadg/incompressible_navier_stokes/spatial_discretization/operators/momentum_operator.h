@@ -103,6 +103,14 @@ public:
   void
   set_scaling_factor_mass_operator(Number const & number);
 
+  /*
+   * Cellwise scaling of the mass operator in addition to the scaling factor, e.g., for local
+   * pseudo time steps. The vector contains one entry per cell batch. nullptr disables the cellwise
+   * scaling.
+   */
+  void
+  set_cellwise_scaling_mass_operator(dealii::AlignedVector<scalar> const * scaling);
+
   /*
    * Interfaces of OperatorBase.
    */
@@ -172,6 +180,8 @@ private:
   std::shared_ptr<Operators::ViscousKernel<dim, Number>>    viscous_kernel;
 
   double scaling_factor_mass;
+
+  dealii::AlignedVector<scalar> const * cellwise_scaling_mass;
 };
 
 } // namespace IncNS
@@ -8,10 +8,16 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_VISCOUS_OPERATOR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_VISCOUS_OPERATOR_H_
 
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <vector>
+
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/weak_boundary_conditions.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/interior_penalty_parameter.h>
+#include <exadg/operators/lazy_ptr.h>
 #include <exadg/operators/operator_base.h>
 #include <exadg/operators/variable_coefficients.h>
 
@@ -54,8 +60,21 @@ private:
   typedef CellIntegrator<dim, dim, Number> IntegratorCell;
   typedef FaceIntegrator<dim, dim, Number> IntegratorFace;
 
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
 public:
-  ViscousKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  /*
+   * Adds the eddy viscosity for a given filter width and velocity gradient to the first argument.
+   */
+  typedef std::function<void(scalar &, scalar const &, tensor const &)> EddyViscosityModel;
+
+  ViscousKernel()
+    : degree(1),
+      tau(dealii::make_vectorized_array<Number>(0.0)),
+      filter_width_vector(nullptr),
+      cache_viscosity(false),
+      viscosity_m(nullptr),
+      viscosity_p(nullptr)
   {
   }
 
@@ -93,6 +112,88 @@ public:
     return this->data;
   }
 
+  /*
+   * On-the-fly evaluation of the viscosity (instead of a separate loop over the mesh filling
+   * tables of variable coefficients): the eddy viscosity is computed from the gradient of the
+   * velocity set via set_velocity_copy() at the quadrature points of a cell or face whenever the
+   * kernel is reinitialized for this cell or face, so that no viscosity is stored for the mesh.
+   * quad_indices are the quadrature formulas of all operators using this kernel.
+   *
+   * If cache is true, the viscosity is only computed when a cell or face is visited for the first
+   * time after set_velocity_copy() and stored until the velocity changes, so that all further
+   * operator evaluations for the same linearization (e.g. within a linear solver) only read the
+   * viscosity. This trades the repeated evaluation of the velocity gradient for memory comparable
+   * to that of the tables of variable coefficients.
+   */
+  void
+  initialize_viscosity_on_the_fly(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                  unsigned int const                      dof_index,
+                                  std::vector<unsigned int> const &       quad_indices,
+                                  dealii::AlignedVector<scalar> const &   filter_width,
+                                  EddyViscosityModel const &              eddy_viscosity_model_in,
+                                  bool const                              cache)
+  {
+    cache_viscosity = cache;
+
+    // without cache, only the viscosity of the current cell or face is stored
+    unsigned int const n_cells = cache_viscosity ? matrix_free.n_cell_batches() : 1;
+    unsigned int const n_faces =
+      cache_viscosity ?
+        matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches() :
+        1;
+    unsigned int const n_inner_faces = cache_viscosity ? matrix_free.n_inner_face_batches() : 1;
+
+    for(unsigned int const quad_index : quad_indices)
+    {
+      integrator_velocity[quad_index] =
+        std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index);
+      integrator_velocity_m[quad_index] =
+        std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index);
+      integrator_velocity_p[quad_index] =
+        std::make_shared<IntegratorFace>(matrix_free, false, dof_index, quad_index);
+
+      ViscosityCache & cache = viscosity_cache[quad_index];
+      cache.n_q_points_cell  = integrator_velocity[quad_index]->n_q_points;
+      cache.n_q_points_face  = integrator_velocity_m[quad_index]->n_q_points;
+      cache.cell.resize(n_cells * cache.n_q_points_cell);
+      cache.face_m.resize(n_faces * cache.n_q_points_face);
+      cache.face_p.resize(n_inner_faces * cache.n_q_points_face);
+      if(cache_viscosity)
+      {
+        cache.cell_is_computed.assign(n_cells, false);
+        cache.face_is_computed.assign(n_faces, false);
+      }
+    }
+
+    filter_width_vector  = &filter_width;
+    eddy_viscosity_model = eddy_viscosity_model_in;
+  }
+
+  bool
+  viscosity_is_computed_on_the_fly() const
+  {
+    return eddy_viscosity_model != nullptr;
+  }
+
+  /*
+   * Velocity field from which the viscosity is computed on the fly.
+   */
+  void
+  set_velocity_copy(VectorType const & src) const
+  {
+    velocity.own() = src;
+
+    velocity->update_ghost_values();
+
+    // the cached viscosity refers to the previous velocity
+    for(auto & quad_index_and_cache : viscosity_cache)
+    {
+      ViscosityCache & cache = quad_index_and_cache.second;
+      std::fill(cache.cell_is_computed.begin(), cache.cell_is_computed.end(), false);
+      std::fill(cache.face_is_computed.begin(), cache.face_is_computed.end(), false);
+    }
+  }
+
   void
   set_coefficient_cell(unsigned int const cell, unsigned int const q, scalar const & value)
   {
@@ -117,6 +218,31 @@ public:
     viscosity_coefficients.set_coefficient_face_neighbor(face, q, value);
   }
 
+  void
+  reinit_cell(IntegratorCell const & integrator) const
+  {
+    if(viscosity_is_computed_on_the_fly())
+    {
+      unsigned int const quad_index = integrator.get_quadrature_index();
+      unsigned int const cell       = integrator.get_current_cell_index();
+
+      ViscosityCache &   cache  = get_viscosity_cache(quad_index);
+      unsigned int const offset = cache_viscosity ? cell * cache.n_q_points_cell : 0;
+      viscosity_m               = &cache.cell[offset];
+
+      if(not(cache_viscosity and cache.cell_is_computed[cell]))
+      {
+        IntegratorCell & integrator_u = *get_integrator_velocity(integrator_velocity, quad_index);
+        integrator_u.reinit(cell);
+        integrator_u.gather_evaluate(*velocity, false, true, false);
+        calculate_viscosity(&cache.cell[offset], integrator_u);
+
+        if(cache_viscosity)
+          cache.cell_is_computed[cell] = true;
+      }
+    }
+  }
+
   IntegratorFlags
   get_integrator_flags() const
   {
@@ -154,6 +280,35 @@ public:
     tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
                    integrator_p.read_cell_data(array_penalty_parameter)) *
           IP::get_penalty_factor<Number>(degree, data.IP_factor);
+
+    if(viscosity_is_computed_on_the_fly())
+    {
+      unsigned int const quad_index = integrator_m.get_quadrature_index();
+      unsigned int const face       = integrator_m.get_current_cell_index();
+
+      ViscosityCache &   cache  = get_viscosity_cache(quad_index);
+      unsigned int const offset = cache_viscosity ? face * cache.n_q_points_face : 0;
+      viscosity_m               = &cache.face_m[offset];
+      viscosity_p               = &cache.face_p[offset];
+
+      if(not(cache_viscosity and cache.face_is_computed[face]))
+      {
+        IntegratorFace & integrator_u_m =
+          *get_integrator_velocity(integrator_velocity_m, quad_index);
+        integrator_u_m.reinit(face);
+        integrator_u_m.gather_evaluate(*velocity, false, true);
+        calculate_viscosity(&cache.face_m[offset], integrator_u_m);
+
+        IntegratorFace & integrator_u_p =
+          *get_integrator_velocity(integrator_velocity_p, quad_index);
+        integrator_u_p.reinit(face);
+        integrator_u_p.gather_evaluate(*velocity, false, true);
+        calculate_viscosity(&cache.face_p[offset], integrator_u_p);
+
+        if(cache_viscosity)
+          cache.face_is_computed[face] = true;
+      }
+    }
   }
 
   void
@@ -161,6 +316,28 @@ public:
   {
     tau = integrator_m.read_cell_data(array_penalty_parameter) *
           IP::get_penalty_factor<Number>(degree, data.IP_factor);
+
+    if(viscosity_is_computed_on_the_fly())
+    {
+      unsigned int const quad_index = integrator_m.get_quadrature_index();
+      unsigned int const face       = integrator_m.get_current_cell_index();
+
+      ViscosityCache &   cache  = get_viscosity_cache(quad_index);
+      unsigned int const offset = cache_viscosity ? face * cache.n_q_points_face : 0;
+      viscosity_m               = &cache.face_m[offset];
+
+      if(not(cache_viscosity and cache.face_is_computed[face]))
+      {
+        IntegratorFace & integrator_u_m =
+          *get_integrator_velocity(integrator_velocity_m, quad_index);
+        integrator_u_m.reinit(face);
+        integrator_u_m.gather_evaluate(*velocity, false, true);
+        calculate_viscosity(&cache.face_m[offset], integrator_u_m);
+
+        if(cache_viscosity)
+          cache.face_is_computed[face] = true;
+      }
+    }
   }
 
   void
@@ -168,6 +345,10 @@ public:
                          IntegratorFace &                 integrator_m,
                          IntegratorFace &                 integrator_p) const
   {
+    AssertThrow(not(viscosity_is_computed_on_the_fly()),
+                dealii::ExcMessage("On-the-fly evaluation of the viscosity is not implemented "
+                                   "for cell-based face loops."));
+
     if(boundary_id == dealii::numbers::internal_face_boundary_id) // internal face
     {
       tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
@@ -190,7 +371,11 @@ public:
   {
     scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
 
-    if(data.viscosity_is_variable)
+    if(viscosity_is_computed_on_the_fly())
+    {
+      viscosity = viscosity_m[q];
+    }
+    else if(data.viscosity_is_variable)
     {
       viscosity = viscosity_coefficients.get_coefficient_cell(cell, q);
     }
@@ -203,14 +388,11 @@ public:
    */
   inline DEAL_II_ALWAYS_INLINE //
     scalar
-    calculate_average_viscosity(unsigned int const face, unsigned int const q) const
+    calculate_average_viscosity(scalar const & coefficient_face,
+                                scalar const & coefficient_face_neighbor) const
   {
     scalar average_viscosity = dealii::make_vectorized_array<Number>(0.0);
 
-    scalar coefficient_face = viscosity_coefficients.get_coefficient_face(face, q);
-    scalar coefficient_face_neighbor =
-      viscosity_coefficients.get_coefficient_face_neighbor(face, q);
-
     // harmonic mean (harmonic weighting according to Schott and Rasthofer et al. (2015))
     average_viscosity = 2.0 * coefficient_face * coefficient_face_neighbor /
                         (coefficient_face + coefficient_face_neighbor);
@@ -233,9 +415,15 @@ public:
   {
     scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
 
-    if(data.viscosity_is_variable)
+    if(viscosity_is_computed_on_the_fly())
+    {
+      viscosity = calculate_average_viscosity(viscosity_m[q], viscosity_p[q]);
+    }
+    else if(data.viscosity_is_variable)
     {
-      viscosity = calculate_average_viscosity(face, q);
+      viscosity = calculate_average_viscosity(
+        viscosity_coefficients.get_coefficient_face(face, q),
+        viscosity_coefficients.get_coefficient_face_neighbor(face, q));
     }
 
     return viscosity;
@@ -250,7 +438,11 @@ public:
   {
     scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
 
-    if(data.viscosity_is_variable)
+    if(viscosity_is_computed_on_the_fly())
+    {
+      viscosity = viscosity_m[q];
+    }
+    else if(data.viscosity_is_variable)
     {
       viscosity = viscosity_coefficients.get_coefficient_face(face, q);
     }
@@ -485,6 +677,68 @@ public:
   }
 
 private:
+  /*
+   * Viscosity at the quadrature points of all cells and faces (interior side, and exterior side of
+   * interior faces) for one quadrature formula, computed for the current velocity. Without cache,
+   * only the viscosity of the current cell or face is stored.
+   */
+  struct ViscosityCache
+  {
+    ViscosityCache() : n_q_points_cell(0), n_q_points_face(0)
+    {
+    }
+
+    unsigned int n_q_points_cell;
+    unsigned int n_q_points_face;
+
+    dealii::AlignedVector<scalar> cell, face_m, face_p;
+
+    std::vector<bool> cell_is_computed, face_is_computed;
+  };
+
+  template<typename Integrator>
+  static std::shared_ptr<Integrator>
+  get_integrator_velocity(std::map<unsigned int, std::shared_ptr<Integrator>> const & integrators,
+                          unsigned int const                                          quad_index)
+  {
+    auto it = integrators.find(quad_index);
+
+    AssertThrow(it != integrators.end(),
+                dealii::ExcMessage("The viscosity can not be computed on the fly for this "
+                                   "quadrature formula."));
+
+    return it->second;
+  }
+
+  ViscosityCache &
+  get_viscosity_cache(unsigned int const quad_index) const
+  {
+    auto it = viscosity_cache.find(quad_index);
+
+    AssertThrow(it != viscosity_cache.end(),
+                dealii::ExcMessage("The viscosity can not be computed on the fly for this "
+                                   "quadrature formula."));
+
+    return it->second;
+  }
+
+  /*
+   * Laminar plus eddy viscosity at the quadrature points of the given integrator, which has
+   * evaluated the gradient of the velocity.
+   */
+  template<typename Integrator>
+  void
+  calculate_viscosity(scalar * viscosity, Integrator const & integrator) const
+  {
+    scalar const filter_width = integrator.read_cell_data(*filter_width_vector);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      viscosity[q] = dealii::make_vectorized_array<Number>(data.viscosity);
+      eddy_viscosity_model(viscosity[q], filter_width, integrator.get_gradient(q));
+    }
+  }
+
   ViscousKernelData data;
 
   unsigned int degree;
@@ -494,6 +748,27 @@ private:
   mutable scalar tau;
 
   VariableCoefficients<dim, Number> viscosity_coefficients;
+
+  // on-the-fly evaluation of the viscosity
+  EddyViscosityModel eddy_viscosity_model;
+
+  dealii::AlignedVector<scalar> const * filter_width_vector;
+
+  mutable lazy_ptr<VectorType> velocity;
+
+  // velocity integrators for each quadrature index
+  std::map<unsigned int, std::shared_ptr<IntegratorCell>> integrator_velocity;
+  std::map<unsigned int, std::shared_ptr<IntegratorFace>> integrator_velocity_m;
+  std::map<unsigned int, std::shared_ptr<IntegratorFace>> integrator_velocity_p;
+
+  // store the viscosity of all cells and faces until the velocity changes
+  bool cache_viscosity;
+
+  mutable std::map<unsigned int, ViscosityCache> viscosity_cache;
+
+  // viscosity at the quadrature points of the current cell or face (interior and exterior side)
+  mutable scalar const * viscosity_m;
+  mutable scalar const * viscosity_p;
 };
 
 } // namespace Operators
@@ -535,6 +810,9 @@ public:
   update();
 
 private:
+  void
+  reinit_cell(unsigned int const cell) const;
+
   void
   reinit_face(unsigned int const face) const;
 
@@ -312,8 +312,10 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   viscous_kernel_data.formulation_viscous_term     = param.formulation_viscous_term;
   viscous_kernel_data.penalty_term_div_formulation = param.penalty_term_div_formulation;
   viscous_kernel_data.IP_formulation               = param.IP_formulation_viscous;
-  viscous_kernel_data.viscosity_is_variable        = param.use_turbulence_model;
   viscous_kernel_data.variable_normal_vector       = param.neumann_with_variable_normal_vector;
+  // no tables of variable coefficients if the turbulent viscosity is evaluated on the fly
+  viscous_kernel_data.viscosity_is_variable =
+    param.use_turbulence_model and not(param.turbulence_model_on_the_fly);
   viscous_kernel = std::make_shared<Operators::ViscousKernel<dim, Number>>();
   viscous_kernel->reinit(*matrix_free, viscous_kernel_data, get_dof_index_velocity());
 
@@ -521,6 +523,11 @@ SpatialOperatorBase<dim, Number>::initialize_turbulence_model()
   model_data.dof_index           = get_dof_index_velocity();
   model_data.quad_index          = get_quad_index_velocity_linear();
   model_data.degree              = param.degree_u;
+  model_data.on_the_fly          = param.turbulence_model_on_the_fly;
+  model_data.cache_on_the_fly    = param.turbulence_model_on_the_fly_cache;
+  // viscous operator and momentum operator
+  model_data.quad_indices_on_the_fly = {get_quad_index_velocity_linear(),
+                                        get_quad_index_velocity_linearized()};
   turbulence_model.initialize(*matrix_free, *get_mapping(), viscous_kernel, model_data);
 }
 
@@ -739,6 +746,13 @@ SpatialOperatorBase<dim, Number>::get_viscosity() const
   return param.viscosity;
 }
 
+template<int dim, typename Number>
+bool
+SpatialOperatorBase<dim, Number>::grid_is_moving() const
+{
+  return param.ale_formulation;
+}
+
 template<int dim, typename Number>
 dealii::VectorizedArray<Number>
 SpatialOperatorBase<dim, Number>::get_viscosity_boundary_face(unsigned int const face,
@@ -747,7 +761,8 @@ SpatialOperatorBase<dim, Number>::get_viscosity_boundary_face(unsigned int const
   dealii::VectorizedArray<Number> viscosity =
     dealii::make_vectorized_array<Number>(get_viscosity());
 
-  bool const viscosity_is_variable = param.use_turbulence_model;
+  bool const viscosity_is_variable =
+    param.use_turbulence_model and not(param.turbulence_model_on_the_fly);
   if(viscosity_is_variable)
     viscous_kernel->get_coefficient_face(face, q);
 
@@ -900,6 +915,22 @@ SpatialOperatorBase<dim, Number>::calculate_time_step_cfl(VectorType const & vel
                                                     mpi_comm);
 }
 
+template<int dim, typename Number>
+double
+SpatialOperatorBase<dim, Number>::calculate_time_step_cfl(VectorType const & velocity,
+                                                          VectorType const & grid_velocity) const
+{
+  return calculate_time_step_cfl_local<dim, Number>(*matrix_free,
+                                                    get_dof_index_velocity(),
+                                                    get_quad_index_velocity_linear(),
+                                                    velocity,
+                                                    param.degree_u,
+                                                    param.cfl_exponent_fe_degree_velocity,
+                                                    param.adaptive_time_stepping_cfl_type,
+                                                    mpi_comm,
+                                                    &grid_velocity);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::calculate_cfl_from_time_step(VectorType &       cfl,
@@ -917,6 +948,84 @@ SpatialOperatorBase<dim, Number>::calculate_cfl_from_time_step(VectorType &
                              param.cfl_exponent_fe_degree_velocity);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::calculate_local_time_step_scaling(VectorType const & velocity,
+                                                                    double const       max_ratio)
+{
+  CellIntegratorU integrator(*matrix_free,
+                             get_dof_index_velocity(),
+                             get_quad_index_velocity_linear());
+
+  local_time_step_scaling.resize(matrix_free->n_cell_batches());
+
+  // local time step sizes for CFL = 1 (constant factors such as the polynomial degree cancel out)
+  double time_step_min = std::numeric_limits<double>::max();
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.gather_evaluate(velocity, true, false, false);
+
+    scalar time_step = dealii::make_vectorized_array<Number>(std::numeric_limits<Number>::max());
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      time_step = std::min(time_step,
+                           calculate_time_step_cfl_local_point<dim, Number>(
+                             integrator.get_value(q),
+                             integrator.inverse_jacobian(q),
+                             1.0,
+                             param.adaptive_time_stepping_cfl_type));
+    }
+
+    local_time_step_scaling[cell] = time_step;
+
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+      time_step_min = std::min(time_step_min, (double)time_step[v]);
+  }
+
+  time_step_min = dealii::Utilities::MPI::min(time_step_min, mpi_comm);
+
+  // scaling = dt_global / dt_local in [1/max_ratio, 1]
+  scalar const scaling_min = dealii::make_vectorized_array<Number>(1.0 / max_ratio);
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    local_time_step_scaling[cell] =
+      std::max(scaling_min, Number(time_step_min) / local_time_step_scaling[cell]);
+    local_time_step_scaling[cell] =
+      std::min(local_time_step_scaling[cell], dealii::make_vectorized_array<Number>(1.0));
+  }
+
+  momentum_operator.set_cellwise_scaling_mass_operator(&local_time_step_scaling);
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::apply_local_time_step_scaling(VectorType & dst) const
+{
+  CellIntegratorU integrator(*matrix_free,
+                             get_dof_index_velocity(),
+                             get_quad_index_velocity_linear());
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(dst);
+
+    scalar const scaling = integrator.read_cell_data(local_time_step_scaling);
+    for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+      integrator.begin_dof_values()[i] *= scaling;
+
+    integrator.set_dof_values(dst);
+  }
+}
+
+template<int dim, typename Number>
+bool
+SpatialOperatorBase<dim, Number>::local_time_steps_are_used() const
+{
+  return local_time_step_scaling.size() > 0;
+}
+
 template<int dim, typename Number>
 double
 SpatialOperatorBase<dim, Number>::calculate_characteristic_element_length() const
@@ -1189,6 +1298,22 @@ SpatialOperatorBase<dim, Number>::evaluate_convective_term(VectorType &       ds
   convective_operator.evaluate_nonlinear_operator(dst, src, time);
 }
 
+template<int dim, typename Number>
+double
+SpatialOperatorBase<dim, Number>::evaluate_convective_term_and_calculate_time_step_cfl(
+  VectorType &       dst,
+  VectorType const & src,
+  Number const       time) const
+{
+  return convective_operator.evaluate_nonlinear_operator_and_calculate_time_step_cfl(
+    dst,
+    src,
+    time,
+    param.degree_u,
+    param.cfl_exponent_fe_degree_velocity,
+    param.adaptive_time_stepping_cfl_type);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::evaluate_pressure_gradient_term(VectorType &       dst,
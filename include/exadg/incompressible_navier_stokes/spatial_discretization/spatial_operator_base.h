@@ -139,6 +139,7 @@ protected:
 
   typedef std::pair<unsigned int, unsigned int> Range;
 
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
   typedef FaceIntegrator<dim, dim, Number> FaceIntegratorU;
   typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorP;
 
@@ -200,6 +201,9 @@ public:
   unsigned int
   get_quad_index_velocity_linear() const;
 
+  unsigned int
+  get_quad_index_velocity_nonlinear() const;
+
 protected:
   unsigned int
   get_dof_index_velocity_scalar() const;
@@ -207,9 +211,6 @@ protected:
   unsigned int
   get_quad_index_pressure() const;
 
-  unsigned int
-  get_quad_index_velocity_nonlinear() const;
-
   unsigned int
   get_quad_index_velocity_gauss_lobatto() const;
 
@@ -247,6 +248,10 @@ public:
   double
   get_viscosity() const;
 
+  // returns true if the grid is moved over time (ALE formulation)
+  bool
+  grid_is_moving() const;
+
   dealii::VectorizedArray<Number>
   get_viscosity_boundary_face(unsigned int const face, unsigned int const q) const;
 
@@ -305,12 +310,38 @@ public:
   double
   calculate_time_step_cfl(VectorType const & velocity) const;
 
+  // Calculate time step size according to local CFL criterion for the velocity relative to the
+  // grid velocity (ALE formulation)
+  double
+  calculate_time_step_cfl(VectorType const & velocity, VectorType const & grid_velocity) const;
+
   // Calculate CFL numbers of cells
   void
   calculate_cfl_from_time_step(VectorType &       cfl,
                                VectorType const & velocity,
                                double const       time_step_size) const;
 
+  /*
+   * Local pseudo time steps for steady problems: calculates for each cell the ratio of the global
+   * time step size (minimum over all cells) to the time step size according to the local CFL
+   * condition, bounded from below by 1/max_ratio, and uses it to scale the mass term of the
+   * momentum operator cellwise.
+   */
+  void
+  calculate_local_time_step_scaling(VectorType const & velocity, double const max_ratio);
+
+  /*
+   * Multiplies the degrees of freedom of each cell by the local time step scaling of that cell.
+   * Since the velocity is discontinuous, this scaling commutes with the mass operator, i.e., the
+   * mass operator with local time steps is obtained by applying this function before or after the
+   * mass operator.
+   */
+  void
+  apply_local_time_step_scaling(VectorType & dst) const;
+
+  bool
+  local_time_steps_are_used() const;
+
   /*
    * Calculates characteristic element length h
    */
@@ -387,6 +418,12 @@ public:
   void
   evaluate_convective_term(VectorType & dst, VectorType const & src, Number const time) const;
 
+  // convective term and time step size according to local CFL criterion (same loop)
+  double
+  evaluate_convective_term_and_calculate_time_step_cfl(VectorType &       dst,
+                                                       VectorType const & src,
+                                                       Number const       time) const;
+
   // pressure gradient term
   void
   evaluate_pressure_gradient_term(VectorType &       dst,
@@ -611,6 +648,9 @@ protected:
    */
   mutable MomentumOperator<dim, Number> momentum_operator;
 
+  // local pseudo time steps: cellwise scaling of the time derivative term (one entry per cell batch)
+  dealii::AlignedVector<scalar> local_time_step_scaling;
+
   /*
    * Inverse mass operator.
    */
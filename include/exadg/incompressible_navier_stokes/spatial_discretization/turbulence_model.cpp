@@ -43,20 +43,43 @@ TurbulenceModel<dim, Number>::initialize(
   turb_model_data = data_in;
 
   calculate_filter_width(mapping_in);
+
+  if(turb_model_data.on_the_fly)
+  {
+    viscous_kernel->initialize_viscosity_on_the_fly(
+      *matrix_free,
+      turb_model_data.dof_index,
+      turb_model_data.quad_indices_on_the_fly,
+      filter_width_vector,
+      [this](scalar & viscosity, scalar const & filter_width, tensor const & velocity_gradient) {
+        add_turbulent_viscosity(viscosity,
+                                filter_width,
+                                velocity_gradient,
+                                turb_model_data.constant);
+      },
+      turb_model_data.cache_on_the_fly);
+  }
 }
 
 template<int dim, typename Number>
 void
 TurbulenceModel<dim, Number>::calculate_turbulent_viscosity(VectorType const & velocity) const
 {
-  VectorType dummy;
-
-  matrix_free->loop(&This::cell_loop_set_coefficients,
-                    &This::face_loop_set_coefficients,
-                    &This::boundary_face_loop_set_coefficients,
-                    this,
-                    dummy,
-                    velocity);
+  if(turb_model_data.on_the_fly)
+  {
+    viscous_kernel->set_velocity_copy(velocity);
+  }
+  else
+  {
+    VectorType dummy;
+
+    matrix_free->loop(&This::cell_loop_set_coefficients,
+                      &This::face_loop_set_coefficients,
+                      &This::boundary_face_loop_set_coefficients,
+                      this,
+                      dummy,
+                      velocity);
+  }
 }
 
 template<int dim, typename Number>
@@ -22,6 +22,9 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_TURBULENCE_MODEL_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_TURBULENCE_MODEL_H_
 
+// C/C++
+#include <vector>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
@@ -45,7 +48,9 @@ struct TurbulenceModelData
       kinematic_viscosity(1.0),
       dof_index(0),
       quad_index(0),
-      degree(1)
+      degree(1),
+      on_the_fly(false),
+      cache_on_the_fly(false)
   {
   }
 
@@ -61,6 +66,15 @@ struct TurbulenceModelData
 
   // required for calculation of filter width
   unsigned int degree;
+
+  // evaluate the turbulent viscosity within the viscous kernel instead of storing it in tables
+  bool on_the_fly;
+
+  // store the turbulent viscosity evaluated on the fly until the velocity changes
+  bool cache_on_the_fly;
+
+  // quadrature formulas of the operators using the viscous kernel (on-the-fly evaluation only)
+  std::vector<unsigned int> quad_indices_on_the_fly;
 };
 
 
@@ -99,7 +113,9 @@ public:
              TurbulenceModelData const &                            data_in);
 
   /*
-   *  This function calculates the turbulent viscosity for a given velocity field.
+   *  This function calculates the turbulent viscosity for a given velocity field. If the turbulent
+   *  viscosity is evaluated on the fly, this function only hands over a copy of the velocity field
+   *  to the viscous kernel.
    */
   void
   calculate_turbulent_viscosity(VectorType const & velocity) const;
@@ -55,8 +55,15 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
     use_extrapolation(true),
     store_solution(false),
     postprocessor(postprocessor_in),
-    vec_grid_coordinates(param_in.order_time_integrator)
+    vec_grid_coordinates(param_in.order_time_integrator),
+    time_step_cfl_np_available(false),
+    time_step_cfl_np(std::numeric_limits<double>::max()),
+    ser_factor(1.0),
+    ser_residual_last(-1.0),
+    anderson_time_step_size(-1.0)
 {
+  if(param.use_anderson_acceleration)
+    anderson = std::make_shared<AndersonAcceleration<BlockVectorType>>(param.anderson_depth);
 }
 
 template<int dim, typename Number>
@@ -438,12 +445,23 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
               dealii::ExcMessage(
                 "Adaptive time step is not implemented for this type of time step calculation."));
 
-  VectorType u_relative = get_velocity();
-  if(param.ale_formulation == true)
-    u_relative -= grid_velocity;
-
-  double new_time_step_size = operator_base->calculate_time_step_cfl(u_relative);
-  new_time_step_size *= cfl;
+  double new_time_step_size = std::numeric_limits<double>::max();
+  if(time_step_cfl_np_available)
+  {
+    // the velocity at the end of the last time step has already been used to evaluate the
+    // convective term, which also provided the time step size
+    new_time_step_size         = time_step_cfl_np;
+    time_step_cfl_np_available = false;
+  }
+  else if(param.ale_formulation == true)
+  {
+    new_time_step_size = operator_base->calculate_time_step_cfl(get_velocity(), grid_velocity);
+  }
+  else
+  {
+    new_time_step_size = operator_base->calculate_time_step_cfl(get_velocity());
+  }
+  new_time_step_size *= cfl * ser_factor;
 
   // make sure that time step size does not exceed maximum allowable time step size
   new_time_step_size = std::min(new_time_step_size, param.time_step_size_max);
@@ -459,6 +477,103 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
   return new_time_step_size;
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::update_time_step_size_steady_problem(double const residual)
+{
+  if(param.use_switched_evolution_relaxation)
+  {
+    if(ser_residual_last > 0.0 and residual > 0.0)
+    {
+      double const ser_factor_last = ser_factor;
+
+      ser_factor *= ser_residual_last / residual;
+      ser_factor = std::min(std::max(ser_factor, 1.0), param.ser_max_factor);
+
+      // the time step size of the next time step has already been calculated with the old factor
+      this->time_steps[0] *= ser_factor / ser_factor_last;
+      this->time_steps[0] = std::min(this->time_steps[0], param.time_step_size_max);
+
+      if(this->print_solver_info())
+      {
+        this->pcout << std::endl
+                    << "Switched evolution relaxation:" << std::endl
+                    << "  factor = " << std::scientific << std::setprecision(4) << ser_factor
+                    << std::endl;
+      }
+    }
+
+    ser_residual_last = residual;
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::accelerate_pseudo_time_step(VectorType const & velocity_last,
+                                                     VectorType const & pressure_last,
+                                                     double const       time_step_size)
+{
+  // The fixed-point map of a pseudo time step depends on the time step size, which changes in
+  // every time step for switched evolution relaxation or adaptive time stepping. The iterates of
+  // a different map must not be combined, so that the history is discarded in this case.
+  if(time_step_size != anderson_time_step_size)
+  {
+    anderson->reset();
+    anderson_time_step_size = time_step_size;
+  }
+
+  if(anderson_iterate.n_blocks() == 0)
+  {
+    anderson_iterate.reinit(2);
+    anderson_iterate.block(0).reinit(velocity_last);
+    anderson_iterate.block(1).reinit(pressure_last);
+    anderson_iterate.collect_sizes();
+
+    anderson_iterate_last.reinit(anderson_iterate);
+  }
+
+  anderson_iterate_last.block(0) = velocity_last;
+  anderson_iterate_last.block(1) = pressure_last;
+
+  anderson_iterate.block(0) = get_velocity();
+  anderson_iterate.block(1) = get_pressure();
+
+  anderson->update(anderson_iterate, anderson_iterate_last);
+
+  set_velocity(anderson_iterate.block(0), 0);
+  set_pressure(anderson_iterate.block(1), 0);
+
+  // the explicit convective term of the current time step has been evaluated for the
+  // non-accelerated velocity
+  if(param.convective_problem() and
+     param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+  {
+    operator_base->evaluate_convective_term(vec_convective_term[0],
+                                            anderson_iterate.block(0),
+                                            this->get_time());
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::evaluate_convective_term_np(VectorType const & velocity_np)
+{
+  if(this->adaptive_time_stepping)
+  {
+    time_step_cfl_np =
+      operator_base->evaluate_convective_term_and_calculate_time_step_cfl(convective_term_np,
+                                                                          velocity_np,
+                                                                          this->get_next_time());
+    time_step_cfl_np_available = true;
+  }
+  else
+  {
+    operator_base->evaluate_convective_term(convective_term_np,
+                                            velocity_np,
+                                            this->get_next_time());
+  }
+}
+
 template<int dim, typename Number>
 bool
 TimeIntBDF<dim, Number>::print_solver_info() const
@@ -26,6 +26,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/anderson_acceleration.h>
 #include <exadg/time_integration/explicit_runge_kutta.h>
 #include <exadg/time_integration/time_int_bdf_base.h>
 
@@ -121,6 +122,33 @@ protected:
                                           double const cfl,
                                           double const cfl_oif) final;
 
+  /*
+   * Evaluates the convective term for the velocity at the end of the current time step. In case of
+   * adaptive time stepping, the time step size according to the local CFL criterion is calculated
+   * within the same loop and reused by recalculate_time_step_size().
+   */
+  void
+  evaluate_convective_term_np(VectorType const & velocity_np);
+
+  /*
+   * Acceleration of pseudo-timestepping for steady problems, to be called after each pseudo time
+   * step with the residual used to check convergence (or the norm of the solution increment).
+   * Switched evolution relaxation updates the factor by which the time step size according to
+   * the CFL condition is multiplied.
+   */
+  void
+  update_time_step_size_steady_problem(double const residual);
+
+  /*
+   * Anderson acceleration of pseudo-timestepping: replaces the solution of the current time step,
+   * which has been obtained by one pseudo time step of size time_step_size starting from
+   * velocity_last and pressure_last, by the accelerated iterate.
+   */
+  void
+  accelerate_pseudo_time_step(VectorType const & velocity_last,
+                              VectorType const & pressure_last,
+                              double const       time_step_size);
+
   Parameters const & param;
 
   // number of refinement steps, where the time step size is reduced in
@@ -199,6 +227,23 @@ private:
   VectorType              grid_velocity;
   std::vector<VectorType> vec_grid_coordinates;
   VectorType              grid_coordinates_np;
+
+  // time step size according to local CFL criterion (CFL = 1) calculated as a by-product of
+  // evaluate_convective_term_np()
+  mutable bool   time_step_cfl_np_available;
+  mutable double time_step_cfl_np;
+
+  // switched evolution relaxation: factor multiplying the CFL time step size and residual of the
+  // last pseudo time step
+  double ser_factor;
+  double ser_residual_last;
+
+  // Anderson acceleration of pseudo-timestepping acting on (velocity, pressure)
+  std::shared_ptr<AndersonAcceleration<BlockVectorType>> anderson;
+  BlockVectorType                                         anderson_iterate, anderson_iterate_last;
+
+  // time step size of the fixed-point map the history of the Anderson acceleration belongs to
+  double anderson_time_step_size;
 };
 
 } // namespace IncNS
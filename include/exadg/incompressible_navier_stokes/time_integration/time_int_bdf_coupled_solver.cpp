@@ -161,6 +161,9 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
   dealii::Timer timer;
   timer.restart();
 
+  StatisticsPressureBlock const statistics_pressure_block =
+    pde_operator->get_statistics_pressure_block();
+
   // extrapolate old solutions to obtain a good initial guess for the solver, or
   // to update the turbulence model or the penalty parameters based on this
   // extrapolated solution
@@ -275,6 +278,9 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
       }
     }
 
+    if(pde_operator->local_time_steps_are_used())
+      pde_operator->apply_local_time_step_scaling(sum_alphai_ui);
+
     // apply mass operator to sum_alphai_ui and add to rhs vector
     pde_operator->apply_mass_operator_add(rhs_vector.block(0), sum_alphai_ui);
 
@@ -293,6 +299,7 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     {
       this->pcout << std::endl << "Solve linear problem:";
       print_solver_info_linear(this->pcout, n_iter, timer.wall_time());
+      print_statistics_pressure_block(statistics_pressure_block);
     }
   }
   else // a nonlinear system of equations has to be solved
@@ -306,6 +313,9 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
       sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), solution[i].block(0));
     }
 
+    if(pde_operator->local_time_steps_are_used())
+      pde_operator->apply_local_time_step_scaling(sum_alphai_ui);
+
     VectorType rhs(sum_alphai_ui);
     pde_operator->apply_mass_operator(rhs, sum_alphai_ui);
     if(this->param.right_hand_side)
@@ -331,6 +341,7 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
                                   std::get<0>(iter),
                                   std::get<1>(iter),
                                   timer.wall_time());
+      print_statistics_pressure_block(statistics_pressure_block);
     }
   }
 
@@ -348,6 +359,9 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
   }
 
   this->timer_tree->insert({"Timeloop", "Coupled system"}, timer.wall_time());
+  this->timer_tree->insert({"Timeloop", "Coupled system", "Pressure block"},
+                           pde_operator->get_statistics_pressure_block().wall_time -
+                             statistics_pressure_block.wall_time);
 
   // If the penalty terms are applied in a postprocessing step
   if(this->param.apply_penalty_terms_in_postprocessing_step == true)
@@ -370,15 +384,33 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
   {
     if(this->param.ale_formulation == false) // Eulerian case
     {
-      pde_operator->evaluate_convective_term(this->convective_term_np,
-                                             solution_np.block(0),
-                                             this->get_next_time());
+      this->evaluate_convective_term_np(solution_np.block(0));
     }
   }
 
   this->timer_tree->insert({"Timeloop", "Coupled system"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDFCoupled<dim, Number>::print_statistics_pressure_block(
+  StatisticsPressureBlock const & statistics_before) const
+{
+  StatisticsPressureBlock const & statistics = pde_operator->get_statistics_pressure_block();
+
+  double const n_applications =
+    (double)(statistics.n_applications - statistics_before.n_applications);
+
+  if(n_applications > 0)
+  {
+    this->pcout << std::endl << "  Pressure block preconditioner (per outer iteration):";
+    print_cost_per_iteration(this->pcout,
+                             (statistics.n_cycles - statistics_before.n_cycles) / n_applications,
+                             (statistics.wall_time - statistics_before.wall_time) /
+                               n_applications);
+  }
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDFCoupled<dim, Number>::penalty_step()
@@ -540,6 +572,13 @@ TimeIntBDFCoupled<dim, Number>::solve_steady_problem()
       double const norm_p = pressure_tmp.l2_norm();
       double const norm   = std::sqrt(norm_u * norm_u + norm_p * norm_p);
 
+      // time step size of this pseudo time step
+      double const time_step_size = this->get_time_step_size();
+
+      if(this->param.use_local_pseudo_time_steps)
+        pde_operator->calculate_local_time_step_scaling(this->solution[0].block(0),
+                                                        this->param.local_time_step_max_ratio);
+
       // solve time step
       this->do_timestep();
 
@@ -569,6 +608,9 @@ TimeIntBDFCoupled<dim, Number>::solve_steady_problem()
                     << std::endl;
       }
 
+      // the increment divided by the time step size approximates the steady-state residual
+      this->update_time_step_size_steady_problem(incr / time_step_size);
+
       // check convergence
       if(incr < this->param.abs_tol_steady || incr_rel < this->param.rel_tol_steady)
       {
@@ -582,12 +624,18 @@ TimeIntBDFCoupled<dim, Number>::solve_steady_problem()
     while(!converged && this->time < (this->end_time - this->eps) &&
           this->get_time_step_number() <= this->param.max_number_of_time_steps)
     {
+      if(this->param.use_local_pseudo_time_steps)
+        pde_operator->calculate_local_time_step_scaling(this->solution[0].block(0),
+                                                        this->param.local_time_step_max_ratio);
+
       this->do_timestep();
 
       // check convergence by evaluating the residual of
       // the steady-state incompressible Navier-Stokes equations
       double const residual = evaluate_residual();
 
+      this->update_time_step_size_steady_problem(residual);
+
       if(residual < this->param.abs_tol_steady ||
          residual / initial_residual < this->param.rel_tol_steady)
       {
@@ -664,6 +712,14 @@ TimeIntBDFCoupled<dim, Number>::print_iterations() const
       iterations_avg[2] = iterations_avg[1];
   }
 
+  StatisticsPressureBlock const & statistics = pde_operator->get_statistics_pressure_block();
+  if(statistics.n_cycles > 0)
+  {
+    names.push_back("Multigrid cycles pressure block (per linear)");
+    iterations_avg.push_back((double)statistics.n_cycles /
+                             std::max(1., (double)statistics.n_applications));
+  }
+
   if(this->param.apply_penalty_terms_in_postprocessing_step)
   {
     names.push_back("Penalty terms");
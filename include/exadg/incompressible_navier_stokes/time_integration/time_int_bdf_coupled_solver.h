@@ -36,6 +36,8 @@ namespace IncNS
 template<int dim, typename Number>
 class OperatorCoupled;
 
+struct StatisticsPressureBlock;
+
 template<int dim, typename Number>
 class TimeIntBDFCoupled : public TimeIntBDF<dim, Number>
 {
@@ -98,6 +100,13 @@ private:
   void
   penalty_step();
 
+  /*
+   * Prints the cost of the pressure block preconditioner per outer iteration since the given
+   * statistics were recorded.
+   */
+  void
+  print_statistics_pressure_block(StatisticsPressureBlock const & statistics_before) const;
+
   void
   prepare_vectors_for_next_timestep() final;
 
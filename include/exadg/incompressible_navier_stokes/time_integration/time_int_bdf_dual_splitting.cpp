@@ -407,9 +407,7 @@ TimeIntBDFDualSplitting<dim, Number>::evaluate_convective_term()
   {
     if(this->param.ale_formulation == false) // Eulerian case
     {
-      pde_operator->evaluate_convective_term(this->convective_term_np,
-                                             velocity_np,
-                                             this->get_next_time());
+      this->evaluate_convective_term_np(velocity_np);
     }
   }
 
@@ -866,9 +864,15 @@ TimeIntBDFDualSplitting<dim, Number>::solve_steady_problem()
       double const norm_p = pressure_tmp.l2_norm();
       double const norm   = std::sqrt(norm_u * norm_u + norm_p * norm_p);
 
+      // time step size of this pseudo time step
+      double const time_step_size = this->get_time_step_size();
+
       // solve time step
       this->do_timestep();
 
+      if(this->param.use_anderson_acceleration)
+        this->accelerate_pseudo_time_step(velocity_tmp, pressure_tmp, time_step_size);
+
       // calculate increment:
       // increment = solution_{n+1} - solution_{n}
       //           = solution[0] - solution_tmp
@@ -895,6 +899,9 @@ TimeIntBDFDualSplitting<dim, Number>::solve_steady_problem()
                     << std::endl;
       }
 
+      // the increment divided by the time step size approximates the steady-state residual
+      this->update_time_step_size_steady_problem(incr / time_step_size);
+
       // check convergence
       if(incr < this->param.abs_tol_steady || incr_rel < this->param.rel_tol_steady)
       {
@@ -852,9 +852,7 @@ TimeIntBDFPressureCorrection<dim, Number>::evaluate_convective_term()
   {
     if(this->param.ale_formulation == false) // Eulerian case
     {
-      pde_operator->evaluate_convective_term(this->convective_term_np,
-                                             velocity_np,
-                                             this->get_next_time());
+      this->evaluate_convective_term_np(velocity_np);
     }
   }
 
@@ -910,9 +908,15 @@ TimeIntBDFPressureCorrection<dim, Number>::solve_steady_problem()
       double const norm_p = pressure_tmp.l2_norm();
       double const norm   = std::sqrt(norm_u * norm_u + norm_p * norm_p);
 
+      // time step size of this pseudo time step
+      double const time_step_size = this->get_time_step_size();
+
       // solve time step
       this->do_timestep();
 
+      if(this->param.use_anderson_acceleration)
+        this->accelerate_pseudo_time_step(velocity_tmp, pressure_tmp, time_step_size);
+
       // calculate increment:
       // increment = solution_{n+1} - solution_{n}
       //           = solution[0] - solution_tmp
@@ -939,6 +943,9 @@ TimeIntBDFPressureCorrection<dim, Number>::solve_steady_problem()
                     << std::endl;
       }
 
+      // the increment divided by the time step size approximates the steady-state residual
+      this->update_time_step_size_steady_problem(incr / time_step_size);
+
       // check convergence
       if(incr < this->param.abs_tol_steady || incr_rel < this->param.rel_tol_steady)
       {
@@ -951,15 +958,32 @@ TimeIntBDFPressureCorrection<dim, Number>::solve_steady_problem()
   {
     double const initial_residual = evaluate_residual();
 
+    VectorType velocity_tmp;
+    VectorType pressure_tmp;
+
     while(!converged && this->time < (this->end_time - this->eps) &&
           this->get_time_step_number() <= this->param.max_number_of_time_steps)
     {
+      if(this->param.use_anderson_acceleration)
+      {
+        velocity_tmp = velocity[0];
+        pressure_tmp = pressure[0];
+      }
+
+      // time step size of this pseudo time step
+      double const time_step_size = this->get_time_step_size();
+
       this->do_timestep();
 
+      if(this->param.use_anderson_acceleration)
+        this->accelerate_pseudo_time_step(velocity_tmp, pressure_tmp, time_step_size);
+
       // check convergence by evaluating the residual of
       // the steady-state incompressible Navier-Stokes equations
       double const residual = evaluate_residual();
 
+      this->update_time_step_size_steady_problem(residual);
+
       if(residual < this->param.abs_tol_steady ||
          residual / initial_residual < this->param.rel_tol_steady)
       {
@@ -80,6 +80,12 @@ Parameters::Parameters()
     convergence_criterion_steady_problem(ConvergenceCriterionSteadyProblem::Undefined),
     abs_tol_steady(1.e-20),
     rel_tol_steady(1.e-12),
+    use_switched_evolution_relaxation(false),
+    ser_max_factor(1.e3),
+    use_local_pseudo_time_steps(false),
+    local_time_step_max_ratio(1.e2),
+    use_anderson_acceleration(false),
+    anderson_depth(5),
 
     // output of solver information
     solver_info_data(SolverInfoData()),
@@ -133,10 +139,13 @@ Parameters::Parameters()
     use_turbulence_model(false),
     turbulence_model_constant(1.0),
     turbulence_model(TurbulenceEddyViscosityModel::Undefined),
+    turbulence_model_on_the_fly(false),
+    turbulence_model_on_the_fly_cache(false),
 
     // NUMERICAL PARAMETERS
     implement_block_diagonal_preconditioner_matrix_free(false),
     use_cell_based_face_loops(false),
+    use_cell_batching_by_conditioning(false),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
     quad_rule_linearization(QuadratureRuleLinearization::Overintegration32k),
 
@@ -225,6 +234,7 @@ Parameters::Parameters()
     preconditioner_pressure_block(SchurComplementPreconditioner::PressureConvectionDiffusion),
     multigrid_data_pressure_block(MultigridData()),
     exact_inversion_of_laplace_operator(false),
+    n_cycles_laplace_operator(1),
     solver_data_pressure_block(SolverData(1e4, 1.e-12, 1.e-6, 100))
 {
 }
@@ -341,6 +351,46 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
     }
   }
 
+  if(use_switched_evolution_relaxation or use_local_pseudo_time_steps or use_anderson_acceleration)
+  {
+    AssertThrow(problem_type == ProblemType::Steady && solver_type == SolverType::Unsteady,
+                dealii::ExcMessage("Acceleration of pseudo-timestepping can only be used to solve "
+                                   "steady problems with an unsteady solver."));
+    AssertThrow(ale_formulation == false,
+                dealii::ExcMessage("Acceleration of pseudo-timestepping is not implemented for "
+                                   "the ALE formulation."));
+  }
+
+  if(use_switched_evolution_relaxation)
+  {
+    AssertThrow(adaptive_time_stepping == true,
+                dealii::ExcMessage(
+                  "Switched evolution relaxation requires adaptive time stepping."));
+    AssertThrow(ser_max_factor >= 1.0, dealii::ExcMessage("parameter must be >= 1."));
+  }
+
+  if(use_local_pseudo_time_steps)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::BDFCoupledSolution,
+                dealii::ExcMessage("Local pseudo time steps are only implemented for the coupled "
+                                   "solution approach."));
+    AssertThrow(local_time_step_max_ratio >= 1.0, dealii::ExcMessage("parameter must be >= 1."));
+  }
+
+  if(use_anderson_acceleration)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme ||
+                  temporal_discretization == TemporalDiscretization::BDFPressureCorrection,
+                dealii::ExcMessage("Anderson acceleration is only implemented for the projection "
+                                   "methods."));
+    AssertThrow(order_time_integrator == 1,
+                dealii::ExcMessage("Anderson acceleration requires a one-step method, i.e., "
+                                   "order_time_integrator = 1."));
+    AssertThrow(treatment_of_convective_term != TreatmentOfConvectiveTerm::ExplicitOIF,
+                dealii::ExcMessage("Anderson acceleration is not implemented for OIF splitting."));
+    AssertThrow(anderson_depth > 0, dealii::ExcMessage("parameter must be > 0."));
+  }
+
   // SPATIAL DISCRETIZATION
 
   grid.check();
@@ -477,6 +527,9 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                       "Invalid parameter. Convective term is treated explicitly."));
       }
     }
+
+    AssertThrow(n_cycles_laplace_operator > 0,
+                dealii::ExcMessage("Number of multigrid cycles has to be larger than zero."));
   }
 
   // OPERATOR-INTEGRATION-FACTOR SPLITTING
@@ -510,6 +563,13 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                 dealii::ExcMessage("parameter must be defined"));
     AssertThrow(turbulence_model_constant > 0,
                 dealii::ExcMessage("parameter must be greater than zero"));
+
+    if(turbulence_model_on_the_fly)
+    {
+      AssertThrow(use_cell_based_face_loops == false,
+                  dealii::ExcMessage("On-the-fly evaluation of the turbulence model is not "
+                                     "implemented for cell-based face loops."));
+    }
   }
 }
 
@@ -720,6 +780,18 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
     print_parameter(pcout, "Absolute tolerance", abs_tol_steady);
     print_parameter(pcout, "Relative tolerance", rel_tol_steady);
+
+    print_parameter(pcout, "Switched evolution relaxation", use_switched_evolution_relaxation);
+    if(use_switched_evolution_relaxation)
+      print_parameter(pcout, "Maximum SER factor", ser_max_factor);
+
+    print_parameter(pcout, "Local pseudo time steps", use_local_pseudo_time_steps);
+    if(use_local_pseudo_time_steps)
+      print_parameter(pcout, "Maximum local time step ratio", local_time_step_max_ratio);
+
+    print_parameter(pcout, "Anderson acceleration", use_anderson_acceleration);
+    if(use_anderson_acceleration)
+      print_parameter(pcout, "Anderson depth", anderson_depth);
   }
 
   // output of solver information
@@ -828,6 +900,9 @@ Parameters::print_parameters_turbulence(dealii::ConditionalOStream const & pcout
   {
     print_parameter(pcout, "Turbulence model", enum_to_string(turbulence_model));
     print_parameter(pcout, "Turbulence model constant", turbulence_model_constant);
+    print_parameter(pcout, "Turbulence model on the fly", turbulence_model_on_the_fly);
+    if(turbulence_model_on_the_fly)
+      print_parameter(pcout, "Cache turbulence model", turbulence_model_on_the_fly_cache);
   }
 }
 
@@ -842,6 +917,9 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
 
   print_parameter(pcout, "Use cell-based face loops", use_cell_based_face_loops);
 
+  if(use_cell_based_face_loops)
+    print_parameter(pcout, "Cell batching by conditioning", use_cell_batching_by_conditioning);
+
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
     solver_data_block_diagonal.print(pcout);
@@ -1132,6 +1210,10 @@ Parameters::print_parameters_coupled_solver(dealii::ConditionalOStream const & p
     {
       solver_data_pressure_block.print(pcout);
     }
+    else
+    {
+      print_parameter(pcout, "Number of multigrid cycles", n_cycles_laplace_operator);
+    }
   }
 
   // projection_step
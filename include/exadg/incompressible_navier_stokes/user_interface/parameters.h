@@ -268,6 +268,28 @@ public:
   double abs_tol_steady;
   double rel_tol_steady;
 
+  // Acceleration of pseudo-timestepping for steady-state problems:
+  //
+  // switched evolution relaxation (SER): the time step size calculated according to the CFL
+  // condition (adaptive time stepping) is multiplied by a factor that grows (shrinks) with the
+  // reduction (increase) of the steady-state residual from one pseudo time step to the next. The
+  // factor is bounded by 1 and ser_max_factor.
+  bool   use_switched_evolution_relaxation;
+  double ser_max_factor;
+
+  // local pseudo time steps (coupled solution approach only): the time derivative term is scaled
+  // cellwise such that each cell is advanced with the time step size according to its local CFL
+  // condition, bounded by local_time_step_max_ratio times the global time step size.
+  bool   use_local_pseudo_time_steps;
+  double local_time_step_max_ratio;
+
+  // Anderson acceleration of the fixed-point iteration defined by one pseudo time step of the
+  // projection methods (dual splitting, pressure correction). anderson_depth is the number of
+  // previous iterates used. The history is discarded whenever the pseudo time step size changes,
+  // e.g., for switched evolution relaxation.
+  bool         use_anderson_acceleration;
+  unsigned int anderson_depth;
+
   // show solver performance (wall time, number of iterations) every ... timesteps
   SolverInfoData solver_info_data;
 
@@ -388,6 +410,16 @@ public:
   // turbulence model
   TurbulenceEddyViscosityModel turbulence_model;
 
+  // evaluate the turbulent viscosity at the quadrature points within the matrix-free loops of the
+  // operators (fused with the operator evaluation) instead of precomputing and storing it for all
+  // cells and faces
+  bool turbulence_model_on_the_fly;
+
+  // store the turbulent viscosity evaluated on the fly for all cells and faces until the velocity
+  // changes, so that it is computed only once per linearization (at the cost of memory comparable
+  // to precomputing it)
+  bool turbulence_model_on_the_fly_cache;
+
 
   /**************************************************************************************/
   /*                                                                                    */
@@ -412,6 +444,12 @@ public:
   // can be changed to such an algorithm (cell_based_face_loops).
   bool use_cell_based_face_loops;
 
+  // Group cells of similar size and aspect ratio into the same cell batches (vectorization
+  // categories). This can reduce the cost of the matrix-free block Jacobi preconditioner, where
+  // the elementwise iterative solver of a cell batch iterates until all lanes have converged.
+  // Only relevant if cell-based face loops are used.
+  bool use_cell_batching_by_conditioning;
+
   // Solver data for block Jacobi preconditioner. Accordingly, this parameter is only
   // relevant if the block diagonal preconditioner is implemented in a matrix-free way
   // using an elementwise iterative solution procedure for which solver tolerances have to
@@ -651,6 +689,13 @@ public:
   // by solving the Laplace problem to a given relative tolerance
   bool exact_inversion_of_laplace_operator;
 
+  // Number of multigrid cycles used to approximately invert the Laplace operator in the block
+  // preconditioner (only relevant if exact_inversion_of_laplace_operator == false). Values larger
+  // than 1 result in a stationary Richardson iteration preconditioned by multigrid with a fixed
+  // number of iterations, so that the Schur-complement preconditioner remains a fixed linear
+  // operator for the outer Krylov solver.
+  unsigned int n_cycles_laplace_operator;
+
   // solver data for Schur complement
   // (only relevant if exact_inversion_of_laplace_operator == true)
   SolverData solver_data_pressure_block;
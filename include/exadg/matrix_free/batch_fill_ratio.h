@@ -0,0 +1,213 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_BATCH_FILL_RATIO_H_
+#define INCLUDE_EXADG_MATRIX_FREE_BATCH_FILL_RATIO_H_
+
+// C/C++
+#include <iomanip>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Fill ratio of the cell and face batches of a MatrixFree object, i.e., the number of filled SIMD
+ * lanes divided by the total number of lanes, for the vectorization width MatrixFree has been
+ * compiled with and for all narrower widths (e.g. AVX2 or SSE instead of AVX-512).
+ *
+ * Batches are only filled with cells/faces of the same category (see Categorization) and the same
+ * boundary id. For narrower widths, the number of batches is estimated by regrouping the cells and
+ * faces of each run of consecutive batches that belongs to the same category or boundary id and
+ * that ends with a partially filled batch.
+ */
+struct BatchFillRatio
+{
+  // widths in number of lanes: n_lanes, n_lanes / 2, ..., 1
+  std::vector<unsigned int> widths;
+
+  // fill ratios for each width
+  std::vector<double> cells;
+  std::vector<double> inner_faces;
+  std::vector<double> boundary_faces;
+};
+
+namespace internal
+{
+/*
+ * Computes the number of filled lanes and the number of batches for each width, given the number
+ * of filled lanes of each batch and an identifier of the group (category, boundary id) of each
+ * batch.
+ */
+inline void
+accumulate_batches(std::vector<unsigned int> const & filled_lanes,
+                   std::vector<unsigned int> const & group,
+                   std::vector<unsigned int> const & widths,
+                   std::vector<double> &             n_filled,
+                   std::vector<double> &             n_available)
+{
+  n_filled.assign(widths.size(), 0.0);
+  n_available.assign(widths.size(), 0.0);
+
+  unsigned int const n_lanes = widths[0];
+
+  unsigned int run = 0;
+  for(unsigned int batch = 0; batch < filled_lanes.size(); ++batch)
+  {
+    run += filled_lanes[batch];
+
+    bool const end_of_run = (batch + 1 == filled_lanes.size()) or
+                            (filled_lanes[batch] < n_lanes) or (group[batch + 1] != group[batch]);
+
+    if(end_of_run)
+    {
+      for(unsigned int w = 0; w < widths.size(); ++w)
+      {
+        n_filled[w] += run;
+        n_available[w] += widths[w] * ((run + widths[w] - 1) / widths[w]);
+      }
+      run = 0;
+    }
+  }
+}
+
+inline std::vector<double>
+compute_ratio(std::vector<double> const & n_filled,
+              std::vector<double> const & n_available,
+              MPI_Comm const &            mpi_comm)
+{
+  std::vector<double> const filled    = dealii::Utilities::MPI::sum(n_filled, mpi_comm);
+  std::vector<double> const available = dealii::Utilities::MPI::sum(n_available, mpi_comm);
+
+  std::vector<double> ratio(filled.size(), 1.0);
+  for(unsigned int i = 0; i < ratio.size(); ++i)
+    if(available[i] > 0.0)
+      ratio[i] = filled[i] / available[i];
+
+  return ratio;
+}
+} // namespace internal
+
+template<int dim, typename Number>
+BatchFillRatio
+compute_batch_fill_ratio(dealii::MatrixFree<dim, Number> const & matrix_free,
+                         MPI_Comm const &                        mpi_comm)
+{
+  BatchFillRatio result;
+
+  for(unsigned int w = dealii::VectorizedArray<Number>::size(); w >= 1; w /= 2)
+    result.widths.push_back(w);
+
+  std::vector<double> n_filled, n_available;
+
+  // cells
+  {
+    std::vector<unsigned int> filled_lanes(matrix_free.n_cell_batches());
+    std::vector<unsigned int> category(matrix_free.n_cell_batches());
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      filled_lanes[cell] = matrix_free.n_active_entries_per_cell_batch(cell);
+      category[cell]     = matrix_free.get_cell_category(cell);
+    }
+
+    internal::accumulate_batches(filled_lanes, category, result.widths, n_filled, n_available);
+    result.cells = internal::compute_ratio(n_filled, n_available, mpi_comm);
+  }
+
+  // inner faces
+  {
+    unsigned int const n_faces = matrix_free.n_inner_face_batches();
+
+    std::vector<unsigned int> filled_lanes(n_faces);
+    std::vector<unsigned int> group(n_faces, 0);
+    for(unsigned int face = 0; face < n_faces; ++face)
+      filled_lanes[face] = matrix_free.n_active_entries_per_face_batch(face);
+
+    internal::accumulate_batches(filled_lanes, group, result.widths, n_filled, n_available);
+    result.inner_faces = internal::compute_ratio(n_filled, n_available, mpi_comm);
+  }
+
+  // boundary faces
+  {
+    unsigned int const begin   = matrix_free.n_inner_face_batches();
+    unsigned int const n_faces = matrix_free.n_boundary_face_batches();
+
+    std::vector<unsigned int> filled_lanes(n_faces);
+    std::vector<unsigned int> boundary_id(n_faces);
+    for(unsigned int face = 0; face < n_faces; ++face)
+    {
+      filled_lanes[face] = matrix_free.n_active_entries_per_face_batch(begin + face);
+      boundary_id[face]  = matrix_free.get_boundary_id(begin + face);
+    }
+
+    internal::accumulate_batches(filled_lanes, boundary_id, result.widths, n_filled, n_available);
+    result.boundary_faces = internal::compute_ratio(n_filled, n_available, mpi_comm);
+  }
+
+  return result;
+}
+
+/*
+ * Prints the batch fill ratio of cells and faces for the vectorization width of MatrixFree and
+ * for narrower widths. Has to be called by all processes of mpi_comm.
+ */
+template<int dim, typename Number>
+void
+print_batch_fill_ratio(dealii::ConditionalOStream const &      pcout,
+                       dealii::MatrixFree<dim, Number> const & matrix_free,
+                       MPI_Comm const &                        mpi_comm)
+{
+  BatchFillRatio const ratio = compute_batch_fill_ratio(matrix_free, mpi_comm);
+
+  // clang-format off
+  pcout << std::endl
+        << "Batch fill ratio (filled SIMD lanes / available lanes):" << std::endl
+        << std::endl
+        << "  " << std::setw(10) << std::left << "lanes"
+        << std::setw(10) << std::left << "bits"
+        << std::setw(15) << std::left << "cells"
+        << std::setw(15) << std::left << "inner faces"
+        << std::setw(15) << std::left << "boundary faces"
+        << std::endl;
+
+  for(unsigned int w = 0; w < ratio.widths.size(); ++w)
+  {
+    pcout << "  " << std::setw(10) << std::left << ratio.widths[w]
+          << std::setw(10) << std::left << 8 * sizeof(Number) * ratio.widths[w]
+          << std::fixed << std::setprecision(1)
+          << std::setw(15) << std::left << 100.0 * ratio.cells[w]
+          << std::setw(15) << std::left << 100.0 * ratio.inner_faces[w]
+          << std::setw(15) << std::left << 100.0 * ratio.boundary_faces[w]
+          << std::endl;
+  }
+  // clang-format on
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_BATCH_FILL_RATIO_H_ */
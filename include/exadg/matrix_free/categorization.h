@@ -22,7 +22,16 @@
 #ifndef OPERATOR_BASE_CATEGORIZATION_H
 #define OPERATOR_BASE_CATEGORIZATION_H
 
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
 // deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
 #include <deal.II/grid/tria.h>
 
 namespace ExaDG
@@ -99,6 +108,179 @@ do_cell_based_loops(dealii::Triangulation<dim> const & tria,
     data.mapping_update_flags_inner_faces | data.mapping_update_flags_boundary_faces;
 }
 
+/*
+ * Same as do_cell_based_loops(), but cells are categorized by a face-type mask instead of the
+ * boundary IDs of their faces. The face type of a boundary face is given by
+ * get_face_type(boundary_id), which typically returns the boundary type of the boundary
+ * descriptor. Interior faces and faces with a periodic neighbor (which are interior faces in
+ * MatrixFree) have face type 0. Hence, all cells whose faces are treated identically end up in the
+ * same category, irrespective of how many boundary IDs of the same type the mesh contains, which
+ * reduces the number of partially filled cell batches on meshes with many boundary IDs.
+ *
+ * Note that cell-based face loops then only see the boundary ID of the first lane of a cell batch
+ * for a given face. This is sufficient for the homogeneous part of the boundary face integrals,
+ * which only depends on the boundary type.
+ */
+template<int dim, typename AdditionalData, typename FaceTypeFunction>
+void
+do_cell_based_loops_by_face_type(dealii::Triangulation<dim> const & tria,
+                                 AdditionalData &                   data,
+                                 FaceTypeFunction const &           get_face_type,
+                                 unsigned int const level = dealii::numbers::invalid_unsigned_int)
+{
+  bool is_mg = (level != dealii::numbers::invalid_unsigned_int);
+
+  // ... create list for the category of each cell
+  if(is_mg)
+    data.cell_vectorization_category.resize(std::distance(tria.begin(level), tria.end(level)));
+  else
+    data.cell_vectorization_category.resize(tria.n_active_cells());
+
+  // ... enumerate the face-type masks that occur on this process
+  std::map<std::vector<unsigned int>, unsigned int> categories;
+
+  auto to_category = [&](auto & cell) {
+    std::vector<unsigned int> mask(dim * 2, 0);
+    for(unsigned int i = 0; i < dim * 2; i++)
+    {
+      if(cell->at_boundary(i) and not(cell->has_periodic_neighbor(i)))
+        mask[i] = 1 + static_cast<unsigned int>(get_face_type(cell->face(i)->boundary_id()));
+    }
+    return categories.emplace(mask, categories.size()).first->second;
+  };
+
+  if(!is_mg)
+  {
+    for(auto cell = tria.begin_active(); cell != tria.end(); ++cell)
+    {
+      if(cell->is_locally_owned())
+        data.cell_vectorization_category[cell->active_cell_index()] = to_category(cell);
+    }
+  }
+  else
+  {
+    for(auto cell = tria.begin(level); cell != tria.end(level); ++cell)
+    {
+      if(cell->is_locally_owned_on_level())
+        data.cell_vectorization_category[cell->index()] = to_category(cell);
+    }
+  }
+
+  // ... finalize setup of matrix_free
+  data.hold_all_faces_to_owned_cells        = true;
+  data.cell_vectorization_categories_strict = true;
+  data.mapping_update_flags_faces_by_cells =
+    data.mapping_update_flags_inner_faces | data.mapping_update_flags_boundary_faces;
+}
+
+/*
+ * Refine the categories in MatrixFree::AdditionalData such that cells of similar size and aspect
+ * ratio are put into the same category and, hence, into the same cell batch. Cell-local problems
+ * on such cells have a similar conditioning, so that elementwise iterative solvers (e.g. of the
+ * matrix-free block Jacobi preconditioner), which iterate until all lanes of a cell batch have
+ * converged, require a similar number of iterations for all lanes. Existing categories (e.g. from
+ * do_cell_based_loops()) are retained. Cell size and aspect ratio are grouped into bins of factor
+ * two, measured relative to the smallest cell on the current process.
+ */
+template<int dim, typename AdditionalData>
+void
+do_conditioning_based_categories(dealii::Triangulation<dim> const & tria,
+                                 AdditionalData &                   data,
+                                 unsigned int const level = dealii::numbers::invalid_unsigned_int)
+{
+  bool is_mg = (level != dealii::numbers::invalid_unsigned_int);
+
+  unsigned int const n_cells = is_mg ? std::distance(tria.begin(level), tria.end(level)) :
+                                       tria.n_active_cells();
+
+  if(data.cell_vectorization_category.size() != n_cells)
+    data.cell_vectorization_category.assign(n_cells, 0);
+
+  auto for_each_cell = [&](auto const & function) {
+    if(is_mg)
+    {
+      for(auto cell = tria.begin(level); cell != tria.end(level); ++cell)
+        if(cell->is_locally_owned_on_level())
+          function(cell, cell->index());
+    }
+    else
+    {
+      for(auto cell = tria.begin_active(); cell != tria.end(); ++cell)
+        if(cell->is_locally_owned())
+          function(cell, cell->active_cell_index());
+    }
+  };
+
+  // reference cell size
+  double h_min = std::numeric_limits<double>::max();
+  for_each_cell(
+    [&](auto const & cell, unsigned int const) { h_min = std::min(h_min, cell->diameter()); });
+
+  unsigned int const n_bins = 8;
+
+  auto to_bin = [&](double const ratio) {
+    return std::min(n_bins - 1, static_cast<unsigned int>(std::log2(std::max(1.0, ratio))));
+  };
+
+  for_each_cell([&](auto const & cell, unsigned int const index) {
+    unsigned int const size_bin = to_bin(cell->diameter() / h_min);
+    unsigned int const aspect_ratio_bin =
+      to_bin(cell->diameter() / (std::sqrt(double(dim)) * cell->minimum_vertex_distance()));
+
+    unsigned int & category = data.cell_vectorization_category[index];
+    category                = (category * n_bins + size_bin) * n_bins + aspect_ratio_bin;
+  });
+}
+
+/*
+ * Local time stepping: returns the time step level of all active cells (locally owned and ghost
+ * cells) indexed by the active cell index. Level l is advanced with time step size dt / 2^l, where
+ * dt is the time step size of the coarsest level 0. The level of a cell is derived from its
+ * minimum vertex distance h relative to the global minimum h_min, i.e., cells with
+ * h_min * 2^(n_levels-1-l) <= h < h_min * 2^(n_levels-l) are assigned to level l, and all cells
+ * larger than that to level 0. Hence, the time step size of each level satisfies the CFL
+ * condition of its cells if dt is chosen as 2^(n_levels-1) times the global CFL time step size.
+ */
+template<int dim>
+std::vector<unsigned int>
+get_time_step_levels(dealii::Triangulation<dim> const & tria, unsigned int const n_levels)
+{
+  double h_min = std::numeric_limits<double>::max();
+  for(auto const & cell : tria.active_cell_iterators())
+    if(cell->is_locally_owned())
+      h_min = std::min(h_min, cell->minimum_vertex_distance());
+  h_min = dealii::Utilities::MPI::min(h_min, tria.get_communicator());
+
+  std::vector<unsigned int> levels(tria.n_active_cells(), 0);
+  for(auto const & cell : tria.active_cell_iterators())
+  {
+    if(cell->is_artificial())
+      continue;
+
+    unsigned int const size_bin =
+      static_cast<unsigned int>(std::log2(std::max(1.0, cell->minimum_vertex_distance() / h_min)));
+
+    levels[cell->active_cell_index()] = n_levels - 1 - std::min(n_levels - 1, size_bin);
+  }
+
+  return levels;
+}
+
+/*
+ * Local time stepping: put cells of the same time step level (see get_time_step_levels()) into
+ * the same category. Categories are strict so that no cell batch contains cells of different
+ * levels.
+ */
+template<int dim, typename AdditionalData>
+void
+do_time_step_level_categories(dealii::Triangulation<dim> const & tria,
+                              AdditionalData &                   data,
+                              unsigned int const                 n_levels)
+{
+  data.cell_vectorization_category          = get_time_step_levels(tria, n_levels);
+  data.cell_vectorization_categories_strict = true;
+}
+
 } // namespace Categorization
 } // namespace ExaDG
 
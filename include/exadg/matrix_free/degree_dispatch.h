@@ -0,0 +1,109 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_DEGREE_DISPATCH_H_
+#define INCLUDE_EXADG_MATRIX_FREE_DEGREE_DISPATCH_H_
+
+// C/C++
+#include <type_traits>
+#include <utility>
+
+// ExaDG
+#include <exadg/configuration/config.h>
+
+namespace ExaDG
+{
+/*
+ * List of polynomial degrees for which kernels with compile-time polynomial degree are generated.
+ * The list is empty by default and can be set via the cmake variable SPECIALIZED_DEGREES.
+ */
+typedef std::integer_sequence<int
+#ifdef EXADG_SPECIALIZED_DEGREES
+                              ,
+                              EXADG_SPECIALIZED_DEGREES
+#endif
+                              >
+  SpecializedDegrees;
+
+namespace internal
+{
+template<int degree, int... degrees, typename Function>
+bool
+dispatch_degree(unsigned int const fe_degree,
+                unsigned int const n_q_points_1d,
+                std::integer_sequence<int, degree, degrees...>,
+                Function const & function)
+{
+  if(fe_degree == degree)
+  {
+    // standard quadrature and 3/2-overintegration
+    if(n_q_points_1d == degree + 1)
+    {
+      function(std::integral_constant<int, degree>(), std::integral_constant<int, degree + 1>());
+      return true;
+    }
+    else if(n_q_points_1d == degree + (degree + 2) / 2)
+    {
+      function(std::integral_constant<int, degree>(),
+               std::integral_constant<int, degree + (degree + 2) / 2>());
+      return true;
+    }
+
+    return false;
+  }
+
+  if constexpr(sizeof...(degrees) > 0)
+    return dispatch_degree(fe_degree,
+                           n_q_points_1d,
+                           std::integer_sequence<int, degrees...>(),
+                           function);
+  else
+    return false;
+}
+} // namespace internal
+
+/*
+ * Calls function(std::integral_constant<int, fe_degree>, std::integral_constant<int,
+ * n_q_points_1d>) with compile-time constants if the given polynomial degree and number of 1D
+ * quadrature points are among the specialized ones (see SpecializedDegrees), and with the
+ * runtime-dispatch values (-1, 0) otherwise. Inside the function, the template arguments are
+ * obtained via decltype(fe_degree)::value. Typical usage is to select a templated cell loop once
+ * per operator evaluation.
+ */
+template<typename Function>
+void
+dispatch_degree(unsigned int const fe_degree,
+                unsigned int const n_q_points_1d,
+                Function const &   function)
+{
+  bool specialized = false;
+
+  if constexpr(SpecializedDegrees::size() > 0)
+    specialized =
+      internal::dispatch_degree(fe_degree, n_q_points_1d, SpecializedDegrees(), function);
+
+  if(not specialized)
+    function(std::integral_constant<int, -1>(), std::integral_constant<int, 0>());
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_DEGREE_DISPATCH_H_ */
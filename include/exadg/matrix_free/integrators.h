@@ -39,4 +39,26 @@ template<int dim,
 using FaceIntegrator =
   dealii::FEFaceEvaluation<dim, -1, 0, n_components, Number, VectorizedArrayType>;
 
+/*
+ * Integrators with polynomial degree and number of 1D quadrature points known at compile time,
+ * see degree_dispatch.h. For fe_degree = -1, these types coincide with the integrators above.
+ */
+template<int dim,
+         int fe_degree,
+         int n_q_points_1d,
+         int n_components,
+         typename Number,
+         typename VectorizedArrayType = dealii::VectorizedArray<Number>>
+using CellIntegratorFixedDegree =
+  dealii::FEEvaluation<dim, fe_degree, n_q_points_1d, n_components, Number, VectorizedArrayType>;
+
+template<int dim,
+         int fe_degree,
+         int n_q_points_1d,
+         int n_components,
+         typename Number,
+         typename VectorizedArrayType = dealii::VectorizedArray<Number>>
+using FaceIntegratorFixedDegree = dealii::
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components, Number, VectorizedArrayType>;
+
 #endif
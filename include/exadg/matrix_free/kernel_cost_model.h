@@ -0,0 +1,211 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_KERNEL_COST_MODEL_H_
+#define INCLUDE_EXADG_MATRIX_FREE_KERNEL_COST_MODEL_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+
+// deal.II
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/utilities/kernel_profiler.h>
+
+namespace ExaDG
+{
+/*
+ * Analytic leading-order model for the memory transfer and the arithmetic operations of
+ * matrix-free cell and face integrals with sum factorization, depending on the polynomial degree,
+ * the number of quadrature points, the number of components, and the mapping type of each cell
+ * and face batch (Cartesian, affine, or general geometry).
+ *
+ * Assumptions: Caches are ideal within a loop over cells and faces, i.e., the solution vectors
+ * are read/written once per cell (attributed to the cell integrals) and the face integrals only
+ * load geometry data. One-dimensional sum-factorization kernels are counted with
+ * 2 * n_in * n_out operations per line.
+ */
+template<int dim, typename Number>
+class KernelCostModel
+{
+private:
+  typedef dealii::internal::MatrixFreeFunctions::GeometryType GeometryType;
+
+public:
+  KernelCostModel()
+    : matrix_free(nullptr),
+      n_components(1),
+      n_dofs_1d(1),
+      n_q_points_1d(1),
+      unique_dofs_per_cell(1.0)
+  {
+  }
+
+  void
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+         unsigned int const                      dof_index,
+         unsigned int const                      quad_index,
+         unsigned int const                      n_components_in)
+  {
+    matrix_free  = &matrix_free_in;
+    n_components = n_components_in;
+
+    auto const & shape_info = matrix_free->get_shape_info(dof_index, quad_index);
+    n_dofs_1d               = shape_info.data[0].fe_degree + 1;
+    n_q_points_1d           = shape_info.data[0].n_q_points_1d;
+
+    // continuous elements share degrees of freedom between cells
+    dealii::DoFHandler<dim> const & dof_handler = matrix_free->get_dof_handler(dof_index);
+    unique_dofs_per_cell =
+      (double)dof_handler.n_dofs() /
+      (double)std::max<dealii::types::global_cell_index>(
+        1, dof_handler.get_triangulation().n_global_active_cells());
+  }
+
+  /*
+   * Cost of cell integrals of the cell batches [begin, end). n_vector_accesses is the number of
+   * vector entries read/written per degree of freedom (e.g., 3 for dst += A * src).
+   */
+  KernelCost
+  get_cell_cost(unsigned int const begin,
+                unsigned int const end,
+                bool const         gradients,
+                unsigned int const n_vector_accesses = 3) const
+  {
+    KernelCost cost;
+    for(unsigned int cell = begin; cell < end; ++cell)
+    {
+      double const n_lanes = matrix_free->n_active_entries_per_cell_batch(cell);
+
+      GeometryType const type = matrix_free->get_mapping_info().cell_type[cell];
+
+      double const n_q = std::pow(n_q_points_1d, dim);
+
+      // vectors and geometry (inverse Jacobian and JxW)
+      double geometry = 0.0;
+      if(type == GeometryType::cartesian)
+        geometry = gradients ? dim + 1 : 1;
+      else if(type == GeometryType::affine)
+        geometry = gradients ? dim * dim + 1 : 1;
+      else
+        geometry = n_q * (gradients ? dim * dim + 1 : 1);
+
+      cost.bytes +=
+        n_lanes * sizeof(Number) * (n_vector_accesses * unique_dofs_per_cell + geometry);
+
+      // sum factorization (evaluate and integrate) and operations at quadrature points
+      double const n_max             = std::max(n_dofs_1d, n_q_points_1d);
+      double       sum_factorization = 2.0 * dim * 2.0 * std::pow(n_max, dim + 1);
+      if(gradients)
+        sum_factorization += 2.0 * dim * 2.0 * std::pow(n_q_points_1d, dim + 1);
+
+      double quadrature_point = 2.0;
+      if(gradients)
+        quadrature_point += (type == GeometryType::cartesian) ? 4.0 * dim : 4.0 * dim * dim;
+
+      cost.flops += n_lanes * n_components * (2.0 * sum_factorization + n_q * quadrature_point);
+    }
+
+    return cost;
+  }
+
+  /*
+   * Cost of the application of the inverse mass matrix by sum factorization on the cell batches
+   * [begin, end), reading src and writing dst.
+   */
+  KernelCost
+  get_inverse_mass_cost(unsigned int const begin, unsigned int const end) const
+  {
+    KernelCost cost;
+    for(unsigned int cell = begin; cell < end; ++cell)
+    {
+      double const n_lanes = matrix_free->n_active_entries_per_cell_batch(cell);
+
+      GeometryType const type = matrix_free->get_mapping_info().cell_type[cell];
+
+      double const n_dofs   = std::pow(n_dofs_1d, dim);
+      double const geometry = (type == GeometryType::cartesian or type == GeometryType::affine) ?
+                                1.0 :
+                                std::pow(n_q_points_1d, dim);
+
+      cost.bytes += n_lanes * sizeof(Number) * (2.0 * unique_dofs_per_cell + geometry);
+      cost.flops += n_lanes * n_components *
+                    (2.0 * 2.0 * dim * std::pow(n_dofs_1d, dim + 1) + n_dofs);
+    }
+
+    return cost;
+  }
+
+  /*
+   * Cost of face integrals of the (interior or boundary) face batches [begin, end).
+   */
+  KernelCost
+  get_face_cost(unsigned int const begin,
+                unsigned int const end,
+                bool const         gradients,
+                bool const         interior_face) const
+  {
+    KernelCost cost;
+    for(unsigned int face = begin; face < end; ++face)
+    {
+      double const n_lanes = matrix_free->n_active_entries_per_face_batch(face);
+
+      GeometryType const type = matrix_free->get_mapping_info().face_type[face];
+
+      double const n_q     = std::pow(n_q_points_1d, dim - 1);
+      double const n_sides = interior_face ? 2.0 : 1.0;
+
+      // geometry (normal vector, JxW, and inverse Jacobians of adjacent cells)
+      double geometry = dim + 1 + (gradients ? n_sides * dim * dim : 0.0);
+      if(type != GeometryType::cartesian and type != GeometryType::affine)
+        geometry *= n_q;
+
+      cost.bytes += n_lanes * sizeof(Number) * geometry;
+
+      // interpolation to face, sum factorization on face (evaluate and integrate), flux
+      double const n_max    = std::max(n_dofs_1d, n_q_points_1d);
+      double       per_side = 2.0 * std::pow(n_dofs_1d, dim) * (gradients ? 2.0 : 1.0);
+      per_side += 2.0 * (dim - 1) * 2.0 * std::pow(n_max, dim);
+      if(gradients)
+        per_side += 2.0 * (dim - 1) * 2.0 * std::pow(n_q_points_1d, dim);
+
+      double const flux = n_q * (gradients ? 10.0 + 4.0 * dim * dim : 4.0);
+
+      cost.flops += n_lanes * n_components * (2.0 * n_sides * per_side + flux);
+    }
+
+    return cost;
+  }
+
+private:
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  unsigned int n_components;
+  double       n_dofs_1d;
+  double       n_q_points_1d;
+  double       unique_dofs_per_cell;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_KERNEL_COST_MODEL_H_ */
@@ -0,0 +1,195 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_TIME_STEP_LEVELS_H_
+#define INCLUDE_EXADG_MATRIX_FREE_TIME_STEP_LEVELS_H_
+
+// C/C++
+#include <algorithm>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/vectorization.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/categorization.h>
+
+namespace ExaDG
+{
+/*
+ * Time step levels of cell batches and face batches for local time stepping.
+ *
+ * The level of a cell is given by Categorization::get_time_step_levels(). Cells are expected to
+ * be categorized strictly according to their level (see
+ * Categorization::do_time_step_level_categories()) so that all lanes of a cell batch belong to
+ * the same level. The level of a face is the finest (maximum) level of the adjacent cells, i.e.,
+ * the flux over a face is evaluated with the time step size of the finer neighbor. Since face
+ * batches may combine faces of different levels, the lanes of a face batch are masked
+ * individually.
+ */
+template<int dim, typename Number>
+class TimeStepLevels
+{
+public:
+  typedef dealii::VectorizedArray<Number>                    VectorizedArrayType;
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  static unsigned int const n_lanes = VectorizedArrayType::size();
+
+  TimeStepLevels() : n_levels(1)
+  {
+  }
+
+  void
+  initialize(dealii::MatrixFree<dim, Number> const & matrix_free,
+             unsigned int const                      dof_index,
+             unsigned int const                      n_levels_in)
+  {
+    n_levels = n_levels_in;
+
+    dealii::DoFHandler<dim> const & dof_handler = matrix_free.get_dof_handler(dof_index);
+
+    std::vector<unsigned int> const cell_levels =
+      Categorization::get_time_step_levels(dof_handler.get_triangulation(), n_levels);
+
+    auto const get_level = [&](unsigned int const cell_index) {
+      auto const cell =
+        matrix_free.get_cell_iterator(cell_index / n_lanes, cell_index % n_lanes, dof_index);
+      return cell_levels[cell->active_cell_index()];
+    };
+
+    // cell batches
+    unsigned int const n_cell_batches =
+      matrix_free.n_cell_batches() + matrix_free.n_ghost_cell_batches();
+    cell_batch_levels.resize(n_cell_batches);
+    for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      cell_batch_levels[cell] = get_level(cell * n_lanes);
+
+      for(unsigned int v = 1; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        AssertThrow(get_level(cell * n_lanes + v) == cell_batch_levels[cell],
+                    dealii::ExcMessage("Cell batches have to be categorized according to the "
+                                       "time step levels, see do_time_step_level_categories()."));
+      }
+    }
+
+    // face batches (inner faces first, followed by boundary faces)
+    unsigned int const n_face_batches =
+      matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+    face_lane_levels.assign(n_face_batches * n_lanes, dealii::numbers::invalid_unsigned_int);
+    for(unsigned int face = 0; face < n_face_batches; ++face)
+    {
+      auto const & face_info = matrix_free.get_face_info(face);
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+      {
+        unsigned int level = get_level(face_info.cells_interior[v]);
+        if(face < matrix_free.n_inner_face_batches())
+          level = std::max(level, get_level(face_info.cells_exterior[v]));
+        face_lane_levels[face * n_lanes + v] = level;
+      }
+    }
+
+    // locally owned degrees of freedom of each level
+    VectorType vector;
+    matrix_free.initialize_dof_vector(vector, dof_index);
+
+    dof_indices.clear();
+    dof_indices.resize(n_levels);
+    std::vector<dealii::types::global_dof_index> dof_indices_cell(
+      dof_handler.get_fe().n_dofs_per_cell());
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+      {
+        cell->get_dof_indices(dof_indices_cell);
+        for(auto const index : dof_indices_cell)
+          dof_indices[cell_levels[cell->active_cell_index()]].push_back(
+            vector.get_partitioner()->global_to_local(index));
+      }
+    }
+  }
+
+  unsigned int
+  get_n_levels() const
+  {
+    return n_levels;
+  }
+
+  bool
+  cell_batch_is_on_level(unsigned int const cell, unsigned int const level) const
+  {
+    return cell_batch_levels[cell] == level;
+  }
+
+  /*
+   * Returns whether any lane of the face batch belongs to the given level. In that case,
+   * all_lanes_on_level indicates whether all (active) lanes belong to the level, and otherwise
+   * lane_mask contains 1 for the lanes on the level and 0 for all other lanes.
+   */
+  bool
+  face_batch_is_on_level(unsigned int const    face,
+                         unsigned int const    level,
+                         bool &                all_lanes_on_level,
+                         VectorizedArrayType & lane_mask) const
+  {
+    bool any_lane_on_level = false;
+    all_lanes_on_level     = true;
+    lane_mask              = 0.0;
+    for(unsigned int v = 0; v < n_lanes; ++v)
+    {
+      unsigned int const lane_level = face_lane_levels[face * n_lanes + v];
+      if(lane_level == level)
+      {
+        any_lane_on_level = true;
+        lane_mask[v]      = 1.0;
+      }
+      else if(lane_level != dealii::numbers::invalid_unsigned_int)
+      {
+        all_lanes_on_level = false;
+      }
+    }
+
+    return any_lane_on_level;
+  }
+
+  // local indices of the locally owned degrees of freedom of the cells on the given level
+  std::vector<unsigned int> const &
+  get_dof_indices(unsigned int const level) const
+  {
+    return dof_indices[level];
+  }
+
+private:
+  unsigned int n_levels;
+
+  std::vector<unsigned int> cell_batch_levels;
+  std::vector<unsigned int> face_lane_levels;
+
+  std::vector<std::vector<unsigned int>> dof_indices;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_TIME_STEP_LEVELS_H_ */
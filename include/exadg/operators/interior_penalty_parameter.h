@@ -36,12 +36,12 @@ namespace IP // IP = interior penalty
  *  This function calculates the penalty parameter of the interior
  *  penalty method for each cell.
  */
-template<int dim, typename Number>
+template<int dim, typename Number, typename VectorizedArrayType = dealii::VectorizedArray<Number>>
 void
 calculate_penalty_parameter(
-  dealii::AlignedVector<dealii::VectorizedArray<Number>> & array_penalty_parameter,
-  dealii::MatrixFree<dim, Number> const &                  matrix_free,
-  unsigned int const                                       dof_index = 0)
+  dealii::AlignedVector<VectorizedArrayType> &                 array_penalty_parameter,
+  dealii::MatrixFree<dim, Number, VectorizedArrayType> const & matrix_free,
+  unsigned int const                                           dof_index = 0)
 {
   unsigned int n_cells = matrix_free.n_cell_batches() + matrix_free.n_ghost_cell_batches();
   array_penalty_parameter.resize(n_cells);
@@ -28,6 +28,8 @@
 
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/matrix_free/kernel_cost_model.h>
+#include <exadg/matrix_free/time_step_levels.h>
 
 namespace ExaDG
 {
@@ -48,7 +50,15 @@ private:
   typedef std::pair<unsigned int, unsigned int> Range;
 
 public:
-  InverseMassOperator() : matrix_free(nullptr), dof_index(0), quad_index(0)
+  InverseMassOperator()
+    : matrix_free(nullptr),
+      dof_index(0),
+      quad_index(0),
+      time_step_levels(nullptr),
+      time_step_level(dealii::numbers::invalid_unsigned_int),
+      fused_factor(1.0),
+      fused_factor_add(0.0),
+      fused_vector_add(nullptr)
   {
   }
 
@@ -60,16 +70,86 @@ public:
     this->matrix_free = &matrix_free_in;
     dof_index         = dof_index_in;
     quad_index        = quad_index_in;
+
+    kernel_cost_model.reinit(*matrix_free, dof_index, quad_index, n_components);
   }
 
   void
   apply(VectorType & dst, VectorType const & src) const
   {
+    ScopedKernelProfiling profiling("InverseMassOperator::apply", [&]() {
+      return kernel_cost_model.get_inverse_mass_cost(0, matrix_free->n_cell_batches());
+    });
+
     dst.zero_out_ghost_values();
 
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Computes dst = factor * M^{-1} src in a single cell loop. dst may coincide with src.
+   */
+  void
+  apply_scale(VectorType & dst, Number const factor, VectorType const & src) const
+  {
+    ScopedKernelProfiling profiling("InverseMassOperator::apply_scale", [&]() {
+      return kernel_cost_model.get_inverse_mass_cost(0, matrix_free->n_cell_batches());
+    });
+
+    fused_factor = factor;
+
+    dst.zero_out_ghost_values();
+
+    matrix_free->cell_loop(&This::cell_loop_scale_add, this, dst, src);
+  }
+
+  /*
+   * Computes dst = factor * M^{-1} src + factor_add * vector_add in a single cell loop, i.e.,
+   * without separate passes over the vectors for the scaling and the addition. dst may coincide
+   * with src or vector_add.
+   */
+  void
+  apply_scale_add(VectorType &       dst,
+                  Number const       factor,
+                  VectorType const & src,
+                  Number const       factor_add,
+                  VectorType const & vector_add) const
+  {
+    ScopedKernelProfiling profiling("InverseMassOperator::apply_scale_add", [&]() {
+      return kernel_cost_model.get_inverse_mass_cost(0, matrix_free->n_cell_batches());
+    });
+
+    fused_factor     = factor;
+    fused_factor_add = factor_add;
+    fused_vector_add = &vector_add;
+
+    dst.zero_out_ghost_values();
+
+    matrix_free->cell_loop(&This::cell_loop_scale_add, this, dst, src);
+
+    fused_vector_add = nullptr;
+  }
+
+  /*
+   * Local time stepping: apply the inverse mass operator on the cells of the given time step
+   * level only. The degrees of freedom of all other cells in dst remain unchanged, so that this
+   * function is typically called with dst = src.
+   */
+  void
+  apply_time_step_level(VectorType &                        dst,
+                        VectorType const &                  src,
+                        TimeStepLevels<dim, Number> const & time_step_levels,
+                        unsigned int const                  time_step_level) const
+  {
+    this->time_step_levels = &time_step_levels;
+    this->time_step_level  = time_step_level;
+
+    apply(dst, src);
+
+    this->time_step_levels = nullptr;
+    this->time_step_level  = dealii::numbers::invalid_unsigned_int;
+  }
+
 private:
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &,
@@ -82,6 +162,10 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(time_step_levels != nullptr and
+         not time_step_levels->cell_batch_is_on_level(cell, time_step_level))
+        continue;
+
       integrator.reinit(cell);
       integrator.read_dof_values(src, 0);
 
@@ -91,9 +175,57 @@ private:
     }
   }
 
+  void
+  cell_loop_scale_add(dealii::MatrixFree<dim, Number> const &,
+                      VectorType &       dst,
+                      VectorType const & src,
+                      Range const &      cell_range) const
+  {
+    Integrator          integrator(*matrix_free, dof_index, quad_index);
+    Integrator          integrator_add(*matrix_free, dof_index, quad_index);
+    CellwiseInverseMass inverse(integrator);
+
+    unsigned int const n_dofs = integrator.dofs_per_cell;
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src, 0);
+
+      inverse.apply(integrator.begin_dof_values(), integrator.begin_dof_values());
+
+      dealii::VectorizedArray<Number> * values = integrator.begin_dof_values();
+      if(fused_vector_add != nullptr)
+      {
+        integrator_add.reinit(cell);
+        integrator_add.read_dof_values(*fused_vector_add, 0);
+
+        dealii::VectorizedArray<Number> const * values_add = integrator_add.begin_dof_values();
+        for(unsigned int i = 0; i < n_dofs; ++i)
+          values[i] = fused_factor * values[i] + fused_factor_add * values_add[i];
+      }
+      else
+      {
+        for(unsigned int i = 0; i < n_dofs; ++i)
+          values[i] *= fused_factor;
+      }
+
+      integrator.set_dof_values(dst, 0);
+    }
+  }
+
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
   unsigned int dof_index, quad_index;
+
+  KernelCostModel<dim, Number> kernel_cost_model;
+
+  mutable TimeStepLevels<dim, Number> const * time_step_levels;
+  mutable unsigned int                        time_step_level;
+
+  // scaling factors and vector of the fused variants apply_scale() and apply_scale_add()
+  mutable Number             fused_factor, fused_factor_add;
+  mutable VectorType const * fused_vector_add;
 };
 
 } // namespace ExaDG
@@ -69,6 +69,18 @@ public:
   {
     return scaling_factor * value;
   }
+
+  /*
+   * Same as above for a scaling factor that varies between cells, e.g., in case of local time
+   * steps.
+   */
+  template<typename T>
+  inline DEAL_II_ALWAYS_INLINE //
+    T
+    get_volume_flux(dealii::VectorizedArray<Number> const & scaling_factor, T const & value) const
+  {
+    return scaling_factor * value;
+  }
 };
 
 } // namespace ExaDG
@@ -164,6 +164,21 @@ public:
   }
 #endif
 
+  virtual void
+  init_system_matrix(dealii::SparsityPattern &      sparsity_pattern,
+                     dealii::SparseMatrix<double> & system_matrix,
+                     MPI_Comm const &               mpi_comm) const
+  {
+    pde_operator->init_system_matrix(sparsity_pattern, system_matrix, mpi_comm);
+  }
+
+  virtual void
+  calculate_system_matrix(dealii::SparseMatrix<double> & system_matrix,
+                          MPI_Comm const &               mpi_comm) const
+  {
+    pde_operator->calculate_system_matrix(system_matrix, mpi_comm);
+  }
+
 private:
   std::shared_ptr<Operator> pde_operator;
 };
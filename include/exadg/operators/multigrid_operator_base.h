@@ -25,6 +25,8 @@
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
@@ -104,6 +106,15 @@ public:
   virtual void
   calculate_system_matrix(dealii::PETScWrappers::MPI::SparseMatrix & system_matrix) const = 0;
 #endif
+
+  virtual void
+  init_system_matrix(dealii::SparsityPattern &      sparsity_pattern,
+                     dealii::SparseMatrix<double> & system_matrix,
+                     MPI_Comm const &               mpi_comm) const = 0;
+
+  virtual void
+  calculate_system_matrix(dealii::SparseMatrix<double> & system_matrix,
+                          MPI_Comm const &               mpi_comm) const = 0;
 };
 
 } // namespace ExaDG
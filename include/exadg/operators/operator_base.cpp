@@ -37,6 +37,8 @@ OperatorBase<dim, Number, n_components>::OperatorBase()
   : dealii::Subscriptor(),
     matrix_free(),
     time(0.0),
+    time_step_levels(nullptr),
+    time_step_level(dealii::numbers::invalid_unsigned_int),
     is_mg(false),
     is_dg(true),
     data(OperatorBaseData()),
@@ -104,6 +106,16 @@ OperatorBase<dim, Number, n_components>::reinit(
     this->matrix_free->get_dof_handler(this->data.dof_index);
 
   n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(dof_handler.get_communicator());
+
+  // kernel profiling
+  kernel_name = dealii::Utilities::type_to_string(*this);
+  if(kernel_name.compare(0, 7, "ExaDG::") == 0)
+    kernel_name.erase(0, 7);
+
+  kernel_cost_model.reinit(*this->matrix_free,
+                           this->data.dof_index,
+                           this->data.quad_index,
+                           n_components);
 }
 
 template<int dim, typename Number, int n_components>
@@ -166,6 +178,9 @@ template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::vmult(VectorType & dst, VectorType const & src) const
 {
+  // vmult() is the entry point of Krylov solvers, see KernelProfiler::get_operator_time()
+  ScopedOperatorTiming operator_timing;
+
   this->apply(dst, src);
 }
 
@@ -257,6 +272,9 @@ template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::apply(VectorType & dst, VectorType const & src) const
 {
+  ScopedKernelProfiling profiling([&]() { return kernel_name + "::apply"; },
+                                  [&]() { return get_apply_cost(); });
+
   if(is_dg)
   {
     if(evaluate_face_integrals())
@@ -307,6 +325,9 @@ template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::apply_add(VectorType & dst, VectorType const & src) const
 {
+  ScopedKernelProfiling profiling([&]() { return kernel_name + "::apply"; },
+                                  [&]() { return get_apply_cost(); });
+
   if(is_dg)
   {
     if(evaluate_face_integrals())
@@ -400,10 +421,33 @@ void
 OperatorBase<dim, Number, n_components>::evaluate_add(VectorType &       dst,
                                                       VectorType const & src) const
 {
+  ScopedKernelProfiling profiling([&]() { return kernel_name + "::evaluate"; },
+                                  [&]() { return get_apply_cost(); });
+
   matrix_free->loop(
     &This::cell_loop, &This::face_loop, &This::boundary_face_loop_full_operator, this, dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::evaluate_add_time_step_level(
+  VectorType &                        dst,
+  VectorType const &                  src,
+  TimeStepLevels<dim, Number> const & time_step_levels,
+  unsigned int const                  time_step_level) const
+{
+  AssertThrow(not data.use_cell_based_loops,
+              dealii::ExcMessage("Local time stepping requires face loops."));
+
+  this->time_step_levels = &time_step_levels;
+  this->time_step_level  = time_step_level;
+
+  evaluate_add(dst, src);
+
+  this->time_step_levels = nullptr;
+  this->time_step_level  = dealii::numbers::invalid_unsigned_int;
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::calculate_diagonal(VectorType & diagonal) const
@@ -786,6 +830,66 @@ OperatorBase<dim, Number, n_components>::calculate_system_matrix(
 }
 #endif
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::init_system_matrix(
+  dealii::SparsityPattern &      sparsity_pattern,
+  dealii::SparseMatrix<double> & system_matrix,
+  MPI_Comm const &               mpi_comm) const
+{
+  dealii::DoFHandler<dim> const & dof_handler =
+    this->matrix_free->get_dof_handler(this->data.dof_index);
+
+  dealii::types::global_dof_index const n_dofs =
+    is_mg ? dof_handler.n_dofs(this->level) : dof_handler.n_dofs();
+
+  // each process fills the entries of its own cells/faces ...
+  dealii::DynamicSparsityPattern dsp_local(n_dofs, n_dofs);
+  internal_make_sparsity_pattern(dsp_local);
+
+  std::vector<dealii::types::global_dof_index> entries;
+  for(auto const & entry : dsp_local)
+  {
+    entries.push_back(entry.row());
+    entries.push_back(entry.column());
+  }
+
+  // ... and the pattern of the complete matrix is gathered on all processes
+  std::vector<std::vector<dealii::types::global_dof_index>> const all_entries =
+    dealii::Utilities::MPI::all_gather(mpi_comm, entries);
+
+  dealii::DynamicSparsityPattern dsp(n_dofs, n_dofs);
+  for(auto const & entries_of_rank : all_entries)
+    for(unsigned int i = 0; i < entries_of_rank.size(); i += 2)
+      dsp.add(entries_of_rank[i], entries_of_rank[i + 1]);
+
+  sparsity_pattern.copy_from(dsp);
+  system_matrix.reinit(sparsity_pattern);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::calculate_system_matrix(
+  dealii::SparseMatrix<double> & system_matrix,
+  MPI_Comm const &               mpi_comm) const
+{
+  // assemble matrix locally on each process
+  internal_assemble_system_matrix(system_matrix);
+
+  // sum the contributions of all processes, relying on the identical sparsity pattern (and hence
+  // identical ordering of the matrix entries) on all processes
+  std::vector<double> values;
+  values.reserve(system_matrix.n_nonzero_elements());
+  for(auto const & entry : system_matrix)
+    values.push_back(entry.value());
+
+  dealii::Utilities::MPI::sum(values, mpi_comm, values);
+
+  unsigned int counter = 0;
+  for(auto & entry : system_matrix)
+    entry.value() = values[counter++];
+}
+
 template<int dim, typename Number, int n_components>
 template<typename SparseMatrix>
 void
@@ -820,17 +924,7 @@ OperatorBase<dim, Number, n_components>::internal_init_system_matrix(
     dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, relevant_dofs);
   dealii::DynamicSparsityPattern dsp(relevant_dofs);
 
-  if(is_dg && is_mg)
-    dealii::MGTools::make_flux_sparsity_pattern(dof_handler, dsp, this->level);
-  else if(is_dg && !is_mg)
-    dealii::DoFTools::make_flux_sparsity_pattern(dof_handler, dsp);
-  else if(/*!is_dg &&*/ is_mg)
-    make_sparsity_pattern<dim, dim, dealii::DynamicSparsityPattern, Number>(dof_handler,
-                                                                            dsp,
-                                                                            this->level,
-                                                                            *this->constraint);
-  else /* if (!is_dg && !is_mg)*/
-    dealii::DoFTools::make_sparsity_pattern(dof_handler, dsp, *this->constraint);
+  internal_make_sparsity_pattern(dsp);
 
   if(my_rank_is_part_of_subcommunicator)
   {
@@ -846,6 +940,18 @@ OperatorBase<dim, Number, n_components>::internal_calculate_system_matrix(
   SparseMatrix & system_matrix) const
 {
   // assemble matrix locally on each process
+  internal_assemble_system_matrix(system_matrix);
+
+  // communicate overlapping matrix parts
+  system_matrix.compress(dealii::VectorOperation::add);
+}
+
+template<int dim, typename Number, int n_components>
+template<typename SparseMatrix>
+void
+OperatorBase<dim, Number, n_components>::internal_assemble_system_matrix(
+  SparseMatrix & system_matrix) const
+{
   if(evaluate_face_integrals() && is_dg)
   {
     matrix_free->loop(&This::cell_loop_calculate_system_matrix,
@@ -862,9 +968,27 @@ OperatorBase<dim, Number, n_components>::internal_calculate_system_matrix(
                            system_matrix,
                            system_matrix);
   }
+}
 
-  // communicate overlapping matrix parts
-  system_matrix.compress(dealii::VectorOperation::add);
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::internal_make_sparsity_pattern(
+  dealii::DynamicSparsityPattern & dsp) const
+{
+  dealii::DoFHandler<dim> const & dof_handler =
+    this->matrix_free->get_dof_handler(this->data.dof_index);
+
+  if(is_dg && is_mg)
+    dealii::MGTools::make_flux_sparsity_pattern(dof_handler, dsp, this->level);
+  else if(is_dg && !is_mg)
+    dealii::DoFTools::make_flux_sparsity_pattern(dof_handler, dsp);
+  else if(/*!is_dg &&*/ is_mg)
+    make_sparsity_pattern<dim, dim, dealii::DynamicSparsityPattern, Number>(dof_handler,
+                                                                            dsp,
+                                                                            this->level,
+                                                                            *this->constraint);
+  else /* if (!is_dg && !is_mg)*/
+    dealii::DoFTools::make_sparsity_pattern(dof_handler, dsp, *this->constraint);
 }
 
 template<int dim, typename Number, int n_components>
@@ -1002,6 +1126,33 @@ OperatorBase<dim, Number, n_components>::do_face_int_integral_cell_based(
   this->do_face_int_integral(integrator_m, integrator_p);
 }
 
+template<int dim, typename Number, int n_components>
+bool
+OperatorBase<dim, Number, n_components>::reinit_tensor_product_diagonal() const
+{
+  if(not(this->data.use_tensor_product_diagonal))
+    return false;
+
+  return tensor_product_diagonal.reinit(
+    matrix_free->get_shape_info(this->data.dof_index, this->data.quad_index),
+    integrator_flags.cell_evaluate.value,
+    integrator_flags.cell_evaluate.gradient,
+    integrator_flags.cell_evaluate.hessian,
+    integrator_flags.cell_integrate.value,
+    integrator_flags.cell_integrate.gradient);
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::compute_quadrature_point_operator() const
+{
+  tensor_product_diagonal.compute_quadrature_point_operator(*integrator,
+                                                            [&](IntegratorCell & cell_integrator) {
+                                                              this->do_cell_integral(
+                                                                cell_integrator);
+                                                            });
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::create_standard_basis(unsigned int     j,
@@ -1079,21 +1230,9 @@ OperatorBase<dim, Number, n_components>::cell_loop(
 {
   (void)matrix_free;
 
-  for(auto cell = range.first; cell < range.second; ++cell)
-  {
-    this->reinit_cell(cell);
-
-    integrator->gather_evaluate(src,
-                                integrator_flags.cell_evaluate.value,
-                                integrator_flags.cell_evaluate.gradient,
-                                integrator_flags.cell_evaluate.hessian);
-
-    this->do_cell_integral(*integrator);
-
-    integrator->integrate_scatter(integrator_flags.cell_integrate.value,
-                                  integrator_flags.cell_integrate.gradient,
-                                  dst);
-  }
+  cell_loop_with_integrator(*integrator, dst, src, range, [&](IntegratorCell & cell_integrator) {
+    this->do_cell_integral(cell_integrator);
+  });
 }
 
 template<int dim, typename Number, int n_components>
@@ -1108,6 +1247,15 @@ OperatorBase<dim, Number, n_components>::face_loop(
 
   for(auto face = range.first; face < range.second; ++face)
   {
+    bool                            all_lanes_on_level = true;
+    dealii::VectorizedArray<Number> lane_mask;
+    if(time_step_levels != nullptr and
+       not time_step_levels->face_batch_is_on_level(face,
+                                                    time_step_level,
+                                                    all_lanes_on_level,
+                                                    lane_mask))
+      continue;
+
     this->reinit_face(face);
 
     integrator_m->gather_evaluate(src,
@@ -1119,12 +1267,27 @@ OperatorBase<dim, Number, n_components>::face_loop(
 
     this->do_face_integral(*integrator_m, *integrator_p);
 
-    integrator_m->integrate_scatter(integrator_flags.face_integrate.value,
-                                    integrator_flags.face_integrate.gradient,
-                                    dst);
-    integrator_p->integrate_scatter(integrator_flags.face_integrate.value,
-                                    integrator_flags.face_integrate.gradient,
-                                    dst);
+    if(all_lanes_on_level)
+    {
+      integrator_m->integrate_scatter(integrator_flags.face_integrate.value,
+                                      integrator_flags.face_integrate.gradient,
+                                      dst);
+      integrator_p->integrate_scatter(integrator_flags.face_integrate.value,
+                                      integrator_flags.face_integrate.gradient,
+                                      dst);
+    }
+    else
+    {
+      // discard the contributions of lanes that belong to a different time step level
+      for(IntegratorFace * integrator_face : {integrator_m.get(), integrator_p.get()})
+      {
+        integrator_face->integrate(integrator_flags.face_integrate.value,
+                                   integrator_flags.face_integrate.gradient);
+        for(unsigned int i = 0; i < integrator_face->dofs_per_cell; ++i)
+          integrator_face->begin_dof_values()[i] *= lane_mask;
+        integrator_face->distribute_local_to_global(dst);
+      }
+    }
   }
 }
 
@@ -1210,6 +1373,15 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_full_operator(
 {
   for(unsigned int face = range.first; face < range.second; face++)
   {
+    bool                            all_lanes_on_level = true;
+    dealii::VectorizedArray<Number> lane_mask;
+    if(time_step_levels != nullptr and
+       not time_step_levels->face_batch_is_on_level(face,
+                                                    time_step_level,
+                                                    all_lanes_on_level,
+                                                    lane_mask))
+      continue;
+
     this->reinit_boundary_face(face);
 
     integrator_m->gather_evaluate(src,
@@ -1218,9 +1390,21 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_full_operator(
 
     do_boundary_integral(*integrator_m, OperatorType::full, matrix_free.get_boundary_id(face));
 
-    integrator_m->integrate_scatter(integrator_flags.face_integrate.value,
-                                    integrator_flags.face_integrate.gradient,
-                                    dst);
+    if(all_lanes_on_level)
+    {
+      integrator_m->integrate_scatter(integrator_flags.face_integrate.value,
+                                      integrator_flags.face_integrate.gradient,
+                                      dst);
+    }
+    else
+    {
+      // discard the contributions of lanes that belong to a different time step level
+      integrator_m->integrate(integrator_flags.face_integrate.value,
+                              integrator_flags.face_integrate.gradient);
+      for(unsigned int i = 0; i < integrator_m->dofs_per_cell; ++i)
+        integrator_m->begin_dof_values()[i] *= lane_mask;
+      integrator_m->distribute_local_to_global(dst);
+    }
   }
 }
 
@@ -1271,26 +1455,39 @@ OperatorBase<dim, Number, n_components>::cell_loop_diagonal(
   unsigned int const                                     dofs_per_cell = integrator->dofs_per_cell;
   dealii::AlignedVector<dealii::VectorizedArray<Number>> local_diag(dofs_per_cell);
 
+  bool const use_tensor_product_diagonal = this->reinit_tensor_product_diagonal();
+
   for(auto cell = range.first; cell < range.second; ++cell)
   {
     this->reinit_cell(cell);
 
-    for(unsigned int j = 0; j < dofs_per_cell; ++j)
+    if(use_tensor_product_diagonal)
     {
-      // write standard basis into dof values of dealii::FEEvaluation
-      this->create_standard_basis(j, *integrator);
+      this->compute_quadrature_point_operator();
 
-      integrator->evaluate(integrator_flags.cell_evaluate.value,
-                           integrator_flags.cell_evaluate.gradient,
-                           integrator_flags.cell_evaluate.hessian);
+      for(unsigned int j = 0; j < dofs_per_cell; ++j)
+        local_diag[j] = dealii::make_vectorized_array<Number>(0.);
+      tensor_product_diagonal.add_diagonal(local_diag.data());
+    }
+    else
+    {
+      for(unsigned int j = 0; j < dofs_per_cell; ++j)
+      {
+        // write standard basis into dof values of dealii::FEEvaluation
+        this->create_standard_basis(j, *integrator);
 
-      this->do_cell_integral(*integrator);
+        integrator->evaluate(integrator_flags.cell_evaluate.value,
+                             integrator_flags.cell_evaluate.gradient,
+                             integrator_flags.cell_evaluate.hessian);
 
-      integrator->integrate(integrator_flags.cell_integrate.value,
-                            integrator_flags.cell_integrate.gradient);
+        this->do_cell_integral(*integrator);
+
+        integrator->integrate(integrator_flags.cell_integrate.value,
+                              integrator_flags.cell_integrate.gradient);
 
-      // extract single value from result vector and temporally store it
-      local_diag[j] = integrator->begin_dof_values()[j];
+        // extract single value from result vector and temporally store it
+        local_diag[j] = integrator->begin_dof_values()[j];
+      }
     }
     // copy local diagonal entries into dof values of dealii::FEEvaluation ...
     for(unsigned int j = 0; j < dofs_per_cell; ++j)
@@ -1421,24 +1618,37 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_diagonal(
   unsigned int const                                     dofs_per_cell = integrator->dofs_per_cell;
   dealii::AlignedVector<dealii::VectorizedArray<Number>> local_diag(dofs_per_cell);
 
+  bool const use_tensor_product_diagonal = this->reinit_tensor_product_diagonal();
+
   for(auto cell = range.first; cell < range.second; ++cell)
   {
     this->reinit_cell(cell);
 
-    for(unsigned int j = 0; j < dofs_per_cell; ++j)
+    if(use_tensor_product_diagonal)
     {
-      this->create_standard_basis(j, *integrator);
+      this->compute_quadrature_point_operator();
 
-      integrator->evaluate(integrator_flags.cell_evaluate.value,
-                           integrator_flags.cell_evaluate.gradient,
-                           integrator_flags.cell_evaluate.hessian);
+      for(unsigned int j = 0; j < dofs_per_cell; ++j)
+        local_diag[j] = dealii::make_vectorized_array<Number>(0.);
+      tensor_product_diagonal.add_diagonal(local_diag.data());
+    }
+    else
+    {
+      for(unsigned int j = 0; j < dofs_per_cell; ++j)
+      {
+        this->create_standard_basis(j, *integrator);
 
-      this->do_cell_integral(*integrator);
+        integrator->evaluate(integrator_flags.cell_evaluate.value,
+                             integrator_flags.cell_evaluate.gradient,
+                             integrator_flags.cell_evaluate.hessian);
 
-      integrator->integrate(integrator_flags.cell_integrate.value,
-                            integrator_flags.cell_integrate.gradient);
+        this->do_cell_integral(*integrator);
+
+        integrator->integrate(integrator_flags.cell_integrate.value,
+                              integrator_flags.cell_integrate.gradient);
 
-      local_diag[j] = integrator->begin_dof_values()[j];
+        local_diag[j] = integrator->begin_dof_values()[j];
+      }
     }
 
     // loop over all faces and gather results into local diagonal local_diag
@@ -1451,11 +1661,15 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_diagonal(
       this->reinit_face_cell_based(cell, face, bid);
 
 #ifdef DEBUG
+      // lanes might have different boundary IDs of the same boundary type, see
+      // Categorization::do_cell_based_loops_by_face_type(), but no mix of interior and boundary
+      // faces
       unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
       for(unsigned int v = 0; v < n_filled_lanes; v++)
-        Assert(bid == bids[v],
+        Assert((bid == dealii::numbers::internal_face_boundary_id) ==
+                 (bids[v] == dealii::numbers::internal_face_boundary_id),
                dealii::ExcMessage(
-                 "Cell-based face loop encountered face batch with different bids."));
+                 "Cell-based face loop encountered face batch with interior and boundary faces."));
 #endif
 
       for(unsigned int j = 0; j < dofs_per_cell; ++j)
@@ -1571,24 +1785,36 @@ OperatorBase<dim, Number, n_components>::cell_loop_block_diagonal(
 {
   unsigned int const dofs_per_cell = integrator->dofs_per_cell;
 
+  bool const use_tensor_product_diagonal = this->reinit_tensor_product_diagonal();
+
   for(auto cell = range.first; cell < range.second; ++cell)
   {
     unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
 
     this->reinit_cell(cell);
 
+    if(use_tensor_product_diagonal)
+      this->compute_quadrature_point_operator();
+
     for(unsigned int j = 0; j < dofs_per_cell; ++j)
     {
-      this->create_standard_basis(j, *integrator);
+      if(use_tensor_product_diagonal)
+      {
+        tensor_product_diagonal.compute_column(j, *integrator);
+      }
+      else
+      {
+        this->create_standard_basis(j, *integrator);
 
-      integrator->evaluate(integrator_flags.cell_evaluate.value,
-                           integrator_flags.cell_evaluate.gradient,
-                           integrator_flags.cell_evaluate.hessian);
+        integrator->evaluate(integrator_flags.cell_evaluate.value,
+                             integrator_flags.cell_evaluate.gradient,
+                             integrator_flags.cell_evaluate.hessian);
 
-      this->do_cell_integral(*integrator);
+        this->do_cell_integral(*integrator);
 
-      integrator->integrate(integrator_flags.cell_integrate.value,
-                            integrator_flags.cell_integrate.gradient);
+        integrator->integrate(integrator_flags.cell_integrate.value,
+                              integrator_flags.cell_integrate.gradient);
+      }
 
       for(unsigned int i = 0; i < dofs_per_cell; ++i)
         for(unsigned int v = 0; v < n_filled_lanes; ++v)
@@ -1708,24 +1934,36 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_block_diagonal(
 {
   unsigned int const dofs_per_cell = integrator->dofs_per_cell;
 
+  bool const use_tensor_product_diagonal = this->reinit_tensor_product_diagonal();
+
   for(auto cell = range.first; cell < range.second; ++cell)
   {
     unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
 
     this->reinit_cell(cell);
 
+    if(use_tensor_product_diagonal)
+      this->compute_quadrature_point_operator();
+
     for(unsigned int j = 0; j < dofs_per_cell; ++j)
     {
-      this->create_standard_basis(j, *integrator);
+      if(use_tensor_product_diagonal)
+      {
+        tensor_product_diagonal.compute_column(j, *integrator);
+      }
+      else
+      {
+        this->create_standard_basis(j, *integrator);
 
-      integrator->evaluate(integrator_flags.cell_evaluate.value,
-                           integrator_flags.cell_evaluate.gradient,
-                           integrator_flags.cell_evaluate.hessian);
+        integrator->evaluate(integrator_flags.cell_evaluate.value,
+                             integrator_flags.cell_evaluate.gradient,
+                             integrator_flags.cell_evaluate.hessian);
 
-      this->do_cell_integral(*integrator);
+        this->do_cell_integral(*integrator);
 
-      integrator->integrate(integrator_flags.cell_integrate.value,
-                            integrator_flags.cell_integrate.gradient);
+        integrator->integrate(integrator_flags.cell_integrate.value,
+                              integrator_flags.cell_integrate.gradient);
+      }
 
       for(unsigned int i = 0; i < dofs_per_cell; ++i)
         for(unsigned int v = 0; v < n_filled_lanes; ++v)
@@ -1742,10 +1980,12 @@ OperatorBase<dim, Number, n_components>::cell_based_loop_block_diagonal(
       this->reinit_face_cell_based(cell, face, bid);
 
 #ifdef DEBUG
+      // see cell_based_loop_diagonal() for the boundary IDs of the lanes
       for(unsigned int v = 0; v < n_filled_lanes; v++)
-        Assert(bid == bids[v],
+        Assert((bid == dealii::numbers::internal_face_boundary_id) ==
+                 (bids[v] == dealii::numbers::internal_face_boundary_id),
                dealii::ExcMessage(
-                 "Cell-based face loop encountered face batch with different bids."));
+                 "Cell-based face loop encountered face batch with interior and boundary faces."));
 #endif
 
       for(unsigned int j = 0; j < dofs_per_cell; ++j)
@@ -2093,6 +2333,45 @@ OperatorBase<dim, Number, n_components>::evaluate_face_integrals() const
   return integrator_flags.face_evaluate.do_eval() || integrator_flags.face_integrate.do_eval();
 }
 
+template<int dim, typename Number, int n_components>
+KernelCost
+OperatorBase<dim, Number, n_components>::get_cell_loop_cost(Range const & range) const
+{
+  bool const gradients =
+    integrator_flags.cell_evaluate.gradient or integrator_flags.cell_integrate.gradient;
+
+  return kernel_cost_model.get_cell_cost(range.first, range.second, gradients);
+}
+
+template<int dim, typename Number, int n_components>
+KernelCost
+OperatorBase<dim, Number, n_components>::get_face_loop_cost(Range const & range,
+                                                            bool const    interior_face) const
+{
+  bool const gradients =
+    integrator_flags.face_evaluate.gradient or integrator_flags.face_integrate.gradient;
+
+  return kernel_cost_model.get_face_cost(range.first, range.second, gradients, interior_face);
+}
+
+template<int dim, typename Number, int n_components>
+KernelCost
+OperatorBase<dim, Number, n_components>::get_apply_cost() const
+{
+  KernelCost cost = get_cell_loop_cost(Range(0, matrix_free->n_cell_batches()));
+
+  if(is_dg and evaluate_face_integrals())
+  {
+    unsigned int const n_inner_faces    = matrix_free->n_inner_face_batches();
+    unsigned int const n_boundary_faces = matrix_free->n_boundary_face_batches();
+
+    cost += get_face_loop_cost(Range(0, n_inner_faces), true);
+    cost += get_face_loop_cost(Range(n_inner_faces, n_inner_faces + n_boundary_faces), false);
+  }
+
+  return cost;
+}
+
 template class OperatorBase<2, float, 1>;
 template class OperatorBase<2, float, 2>;
 
@@ -22,12 +22,18 @@
 #ifndef OPERATION_BASE_H
 #define OPERATION_BASE_H
 
+// C++
+#include <type_traits>
+
 // deal.II
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
 #ifdef DEAL_II_WITH_TRILINOS
 #  include <deal.II/lac/trilinos_sparse_matrix.h>
 #endif
@@ -39,6 +45,8 @@
 // ExaDG
 #include <exadg/matrix_free/categorization.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/matrix_free/kernel_cost_model.h>
+#include <exadg/matrix_free/time_step_levels.h>
 
 #include <exadg/solvers_and_preconditioners/preconditioners/elementwise_preconditioners.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
@@ -51,6 +59,7 @@
 #include <exadg/operators/lazy_ptr.h>
 #include <exadg/operators/mapping_flags.h>
 #include <exadg/operators/operator_type.h>
+#include <exadg/operators/tensor_product_diagonal.h>
 
 namespace ExaDG
 {
@@ -61,6 +70,7 @@ struct OperatorBaseData
       quad_index(0),
       operator_is_singular(false),
       use_cell_based_loops(false),
+      use_tensor_product_diagonal(true),
       implement_block_diagonal_preconditioner_matrix_free(false),
       solver_block_diagonal(Elementwise::Solver::GMRES),
       preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
@@ -76,6 +86,11 @@ struct OperatorBaseData
 
   bool use_cell_based_loops;
 
+  // Computes the cell contributions to the diagonal and block-diagonal by sum factorization if the
+  // element is of tensor-product type (see TensorProductDiagonal). Otherwise, or if set to false,
+  // the cell operator is applied to all unit vectors.
+  bool use_tensor_product_diagonal;
+
   // block Jacobi preconditioner
   bool implement_block_diagonal_preconditioner_matrix_free;
 
@@ -210,6 +225,21 @@ public:
   calculate_system_matrix(dealii::PETScWrappers::MPI::SparseMatrix & system_matrix) const;
 #endif
 
+  /*
+   * Sparse matrix methods for a serial matrix that is replicated on all processes of mpi_comm.
+   * This variant does not depend on external linear algebra packages and is intended for small
+   * problems like the coarse level of multigrid. The sparsity pattern is set up once in
+   * init_system_matrix(), while calculate_system_matrix() only (re-)computes the matrix entries.
+   */
+  void
+  init_system_matrix(dealii::SparsityPattern &      sparsity_pattern,
+                     dealii::SparseMatrix<double> & system_matrix,
+                     MPI_Comm const &               mpi_comm) const;
+
+  void
+  calculate_system_matrix(dealii::SparseMatrix<double> & system_matrix,
+                          MPI_Comm const &               mpi_comm) const;
+
   /*
    * Evaluate the homogeneous part of an operator. The homogeneous operator is the operator that is
    * obtained for homogeneous boundary conditions. This operation is typically applied in linear
@@ -250,6 +280,19 @@ public:
   virtual void
   evaluate_add(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Local time stepping: evaluate_add() restricted to the cell integrals of the given time step
+   * level and to the face integrals of faces whose finer adjacent cell is on the given level, see
+   * TimeStepLevels. The integrals of faces between different levels are added to the degrees of
+   * freedom of both adjacent cells, so that each face flux is evaluated once per time step of the
+   * finer level.
+   */
+  void
+  evaluate_add_time_step_level(VectorType &                        dst,
+                               VectorType const &                  src,
+                               TimeStepLevels<dim, Number> const & time_step_levels,
+                               unsigned int const                  time_step_level) const;
+
   /*
    * point Jacobi preconditioner (diagonal)
    */
@@ -350,6 +393,55 @@ protected:
   do_face_int_integral_cell_based(IntegratorFace & integrator_m,
                                   IntegratorFace & integrator_p) const;
 
+  /*
+   * This function loops over all cells and calculates cell integrals. Derived classes may override
+   * this function, e.g. to evaluate the cell integrals with compile-time polynomial degree.
+   */
+  virtual void
+  cell_loop(dealii::MatrixFree<dim, Number> const & matrix_free,
+            VectorType &                            dst,
+            VectorType const &                      src,
+            Range const &                           range) const;
+
+  /*
+   * Loop over the cells of the given range shared by cell_loop() and derived classes that
+   * evaluate the cell integrals with a different integrator, e.g. one with compile-time
+   * polynomial degree. Cells not on the current time step level are skipped, and reinit_cell()
+   * is called for every cell so that operator-specific data is set up as well.
+   */
+  template<typename Integrator, typename CellIntegral>
+  void
+  cell_loop_with_integrator(Integrator &         integrator,
+                            VectorType &         dst,
+                            VectorType const &   src,
+                            Range const &        range,
+                            CellIntegral const & cell_integral) const
+  {
+    for(auto cell = range.first; cell < range.second; ++cell)
+    {
+      if(time_step_levels != nullptr and
+         not time_step_levels->cell_batch_is_on_level(cell, time_step_level))
+        continue;
+
+      this->reinit_cell(cell);
+
+      // reinit_cell() only initializes the integrator of this class
+      if constexpr(not std::is_same_v<Integrator, IntegratorCell>)
+        integrator.reinit(cell);
+
+      integrator.gather_evaluate(src,
+                                 integrator_flags.cell_evaluate.value,
+                                 integrator_flags.cell_evaluate.gradient,
+                                 integrator_flags.cell_evaluate.hessian);
+
+      cell_integral(integrator);
+
+      integrator.integrate_scatter(integrator_flags.cell_integrate.value,
+                                   integrator_flags.cell_integrate.gradient,
+                                   dst);
+    }
+  }
+
   /*
    * Matrix-free object.
    */
@@ -360,6 +452,13 @@ protected:
    */
   mutable double time;
 
+  /*
+   * Local time stepping: time step level to which cell and face loops are restricted, see
+   * evaluate_add_time_step_level(). No restriction applies if the pointer is not set.
+   */
+  mutable TimeStepLevels<dim, Number> const * time_step_levels;
+  mutable unsigned int                        time_step_level;
+
   /*
    * Constraint matrix.
    */
@@ -386,6 +485,11 @@ protected:
   std::shared_ptr<IntegratorFace> integrator_m;
   std::shared_ptr<IntegratorFace> integrator_p;
 
+  /*
+   * Sum-factorized computation of cell contributions to the (block-)diagonal.
+   */
+  mutable TensorProductDiagonal<dim, n_components, Number> tensor_product_diagonal;
+
   /*
    * Block Jacobi preconditioner/smoother: matrix-free version with elementwise iterative solver
    */
@@ -428,15 +532,6 @@ private:
                 VectorType const &                      src,
                 Range const &                           range) const;
 
-  /*
-   * This function loops over all cells and calculates cell integrals.
-   */
-  void
-  cell_loop(dealii::MatrixFree<dim, Number> const & matrix_free,
-            VectorType &                            dst,
-            VectorType const &                      src,
-            Range const &                           range) const;
-
   /*
    * This function loops over all interior faces and calculates face integrals.
    */
@@ -579,6 +674,20 @@ private:
   void
   internal_calculate_system_matrix(SparseMatrix & system_matrix) const;
 
+  /*
+   * Add the contributions of the locally owned cells/faces to the sparse matrix without any
+   * communication.
+   */
+  template<typename SparseMatrix>
+  void
+  internal_assemble_system_matrix(SparseMatrix & system_matrix) const;
+
+  /*
+   * Fill the sparsity pattern of the locally relevant part of the matrix.
+   */
+  void
+  internal_make_sparsity_pattern(dealii::DynamicSparsityPattern & dsp) const;
+
   /*
    * Calculate sparse matrix.
    */
@@ -603,6 +712,18 @@ private:
                                              SparseMatrix const &                    src,
                                              Range const &                           range) const;
 
+  /*
+   * Sum-factorized computation of cell contributions to the diagonal and block-diagonal for
+   * tensor-product elements (see TensorProductDiagonal). reinit_tensor_product_diagonal() returns
+   * whether this fast path is applicable, compute_quadrature_point_operator() extracts the
+   * quadrature-point operator of the current cell.
+   */
+  bool
+  reinit_tensor_product_diagonal() const;
+
+  void
+  compute_quadrature_point_operator() const;
+
   /*
    * This function sets entries in the diagonal corresponding to constraint DoFs to one.
    */
@@ -616,6 +737,19 @@ private:
   bool
   evaluate_face_integrals() const;
 
+  /*
+   * Kernel profiling: analytic cost of the cell loop and of the (interior or boundary) face loop
+   * over the given range of cell/face batches, and of the whole operator evaluation.
+   */
+  KernelCost
+  get_cell_loop_cost(Range const & range) const;
+
+  KernelCost
+  get_face_loop_cost(Range const & range, bool const interior_face) const;
+
+  KernelCost
+  get_apply_cost() const;
+
   /*
    * Data structure containing all operator-specific data.
    */
@@ -641,6 +775,13 @@ private:
 
   unsigned int n_mpi_processes;
 
+  /*
+   * Kernel profiling: name of the operator as reported by the kernel profiler and analytic model
+   * of memory transfer and arithmetic operations.
+   */
+  std::string                  kernel_name;
+  KernelCostModel<dim, Number> kernel_cost_model;
+
   /*
    * for CG
    */
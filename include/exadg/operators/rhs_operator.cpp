@@ -24,7 +24,11 @@
 namespace ExaDG
 {
 template<int dim, typename Number, int n_components>
-RHSOperator<dim, Number, n_components>::RHSOperator() : matrix_free(nullptr), time(0.0)
+RHSOperator<dim, Number, n_components>::RHSOperator()
+  : matrix_free(nullptr),
+    time(0.0),
+    time_step_levels(nullptr),
+    time_step_level(dealii::numbers::invalid_unsigned_int)
 {
 }
 
@@ -60,6 +64,23 @@ RHSOperator<dim, Number, n_components>::evaluate_add(VectorType & dst,
   matrix_free->cell_loop(&This::cell_loop, this, dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+RHSOperator<dim, Number, n_components>::evaluate_add_time_step_level(
+  VectorType &                        dst,
+  double const                        evaluation_time,
+  TimeStepLevels<dim, Number> const & time_step_levels,
+  unsigned int const                  time_step_level) const
+{
+  this->time_step_levels = &time_step_levels;
+  this->time_step_level  = time_step_level;
+
+  evaluate_add(dst, evaluation_time);
+
+  this->time_step_levels = nullptr;
+  this->time_step_level  = dealii::numbers::invalid_unsigned_int;
+}
+
 template<int dim, typename Number, int n_components>
 void
 RHSOperator<dim, Number, n_components>::do_cell_integral(IntegratorCell & integrator) const
@@ -86,6 +107,10 @@ RHSOperator<dim, Number, n_components>::cell_loop(
 
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
+    if(time_step_levels != nullptr and
+       not time_step_levels->cell_batch_is_on_level(cell, time_step_level))
+      continue;
+
     integrator.reinit(cell);
 
     do_cell_integral(integrator);
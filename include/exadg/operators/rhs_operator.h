@@ -24,6 +24,7 @@
 
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/matrix_free/time_step_levels.h>
 #include <exadg/operators/mapping_flags.h>
 
 namespace ExaDG
@@ -139,6 +140,16 @@ public:
   void
   evaluate_add(VectorType & dst, double const evaluation_time) const;
 
+  /*
+   * Local time stepping: evaluate operator on the cells of the given time step level and add to
+   * dst-vector.
+   */
+  void
+  evaluate_add_time_step_level(VectorType &                        dst,
+                               double const                        evaluation_time,
+                               TimeStepLevels<dim, Number> const & time_step_levels,
+                               unsigned int const                  time_step_level) const;
+
 private:
   void
   do_cell_integral(IntegratorCell & integrator) const;
@@ -159,6 +170,9 @@ private:
 
   mutable double time;
 
+  mutable TimeStepLevels<dim, Number> const * time_step_levels;
+  mutable unsigned int                        time_step_level;
+
   Operators::RHSKernel<dim, Number, n_components> kernel;
 };
 
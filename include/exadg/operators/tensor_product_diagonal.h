@@ -0,0 +1,418 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_OPERATORS_TENSOR_PRODUCT_DIAGONAL_H_
+#define INCLUDE_EXADG_OPERATORS_TENSOR_PRODUCT_DIAGONAL_H_
+
+// C/C++
+#include <algorithm>
+#include <array>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/matrix_free/shape_info.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+/*
+ * Fast computation of the cell contributions to the diagonal and the block-diagonal of an operator
+ * discretized with tensor-product shape functions.
+ *
+ * The cell integral of an operator is a linear map from the values and reference-cell gradients
+ * at a quadrature point to the values and gradients submitted at the same quadrature point. In a
+ * first step, this map (including the geometry terms and JxW) is extracted by applying the cell
+ * kernel to unit vectors in the (1 + dim) * n_components quadrature-point slots. The entries of
+ * the element matrix are then given by A_ij = sum_q sum_{a,b} S_b,i(q) K_ba(q) S_a,j(q), where
+ * S_a,i(q) is the value (a = 0) or the derivative in direction a - 1 of shape function i. Since
+ * S_a,i is a product of 1D shape values/derivatives, the diagonal A_ii can be computed by
+ * sum-factorization with the products of two 1D shape functions at a cost of O(k^(d+1)) per cell
+ * (instead of dofs_per_cell applications of the cell operator, O(k^(2d+1))). Columns of the
+ * block-diagonal are computed by writing the quadrature-point data of a rank-one shape function
+ * directly, which avoids the evaluation step and the cell kernel for each column.
+ *
+ * This requires the cell kernel to be pointwise in the quadrature points and to not depend on
+ * hessians, which is the case for all operators of OperatorBase type.
+ */
+template<int dim, int n_components, typename Number>
+class TensorProductDiagonal
+{
+public:
+  typedef CellIntegrator<dim, n_components, Number> Integrator;
+
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  TensorProductDiagonal()
+    : n_dofs_1d(0),
+      n_q_points_1d(0),
+      n_q_points(0),
+      evaluate_values(false),
+      evaluate_gradients(false),
+      integrate_values(false),
+      integrate_gradients(false)
+  {
+  }
+
+  /*
+   * Returns whether the fast computation is applicable to the given element and integrator flags.
+   */
+  template<typename ShapeInfo>
+  bool
+  reinit(ShapeInfo const & shape_info,
+         bool const        evaluate_values_in,
+         bool const        evaluate_gradients_in,
+         bool const        evaluate_hessians,
+         bool const        integrate_values_in,
+         bool const        integrate_gradients_in)
+  {
+    using namespace dealii::internal::MatrixFreeFunctions;
+
+    if(evaluate_hessians)
+      return false;
+
+    if(shape_info.element_type != tensor_symmetric &&
+       shape_info.element_type != tensor_symmetric_collocation &&
+       shape_info.element_type != tensor_symmetric_hermite)
+      return false;
+
+    n_dofs_1d     = shape_info.data[0].fe_degree + 1;
+    n_q_points_1d = shape_info.data[0].n_q_points_1d;
+    n_q_points    = dealii::Utilities::pow(n_q_points_1d, dim);
+
+    if(shape_info.dofs_per_component_on_cell != dealii::Utilities::pow(n_dofs_1d, dim) ||
+       shape_info.n_q_points != n_q_points ||
+       shape_info.data[0].shape_values.size() != n_dofs_1d * n_q_points_1d)
+      return false;
+
+    evaluate_values     = evaluate_values_in;
+    evaluate_gradients  = evaluate_gradients_in;
+    integrate_values    = integrate_values_in;
+    integrate_gradients = integrate_gradients_in;
+
+    unsigned int const n_1d = n_dofs_1d * n_q_points_1d;
+    shape_values.resize(n_1d);
+    shape_gradients.resize(n_1d);
+    shape_products.resize(3 * n_1d);
+    for(unsigned int i = 0; i < n_1d; ++i)
+    {
+      shape_values[i]    = get_scalar(shape_info.data[0].shape_values[i]);
+      shape_gradients[i] = get_scalar(shape_info.data[0].shape_gradients[i]);
+
+      shape_products[i]            = shape_values[i] * shape_values[i];
+      shape_products[n_1d + i]     = shape_values[i] * shape_gradients[i];
+      shape_products[2 * n_1d + i] = shape_gradients[i] * shape_gradients[i];
+    }
+
+    unsigned int const n_slots = n_components * (dim + 1);
+    quadrature_point_operator.resize(n_slots * n_slots * n_q_points);
+
+    basis_function.resize((dim + 1) * n_q_points);
+
+    unsigned int const n_max = dealii::Utilities::pow(std::max(n_dofs_1d, n_q_points_1d), dim);
+    buffer_1.resize(n_max);
+    buffer_2.resize(n_max);
+
+    return true;
+  }
+
+  /*
+   * Extracts the quadrature-point operator of the current cell by applying cell_kernel (i.e., the
+   * do_cell_integral() function of the operator) to unit vectors. The integrator has to be
+   * reinitialized for the current cell.
+   */
+  template<typename CellKernel>
+  void
+  compute_quadrature_point_operator(Integrator & integrator, CellKernel const & cell_kernel)
+  {
+    // evaluate once with zero dof values to set up the integrator for access to quadrature data
+    for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+      integrator.begin_dof_values()[i] = dealii::make_vectorized_array<Number>(0.);
+    integrator.evaluate(evaluate_values, evaluate_gradients, false);
+
+    for(unsigned int c_in = 0; c_in < n_components; ++c_in)
+    {
+      for(unsigned int a = 0; a < dim + 1; ++a)
+      {
+        if(not is_active(a, evaluate_values, evaluate_gradients))
+          continue;
+
+        for(unsigned int c = 0; c < n_components; ++c)
+          for(unsigned int s = 0; s < dim + 1; ++s)
+            if(is_active(s, evaluate_values, evaluate_gradients))
+              for(unsigned int q = 0; q < n_q_points; ++q)
+                entry(integrator, c, s, q) = dealii::make_vectorized_array<Number>(0.);
+
+        for(unsigned int q = 0; q < n_q_points; ++q)
+          entry(integrator, c_in, a, q) = dealii::make_vectorized_array<Number>(1.);
+
+        cell_kernel(integrator);
+
+        for(unsigned int c_out = 0; c_out < n_components; ++c_out)
+          for(unsigned int b = 0; b < dim + 1; ++b)
+            if(is_active(b, integrate_values, integrate_gradients))
+            {
+              scalar * K = operator_entry(c_out, b, c_in, a);
+              for(unsigned int q = 0; q < n_q_points; ++q)
+                K[q] = entry(integrator, c_out, b, q);
+            }
+      }
+    }
+  }
+
+  /*
+   * Adds the cell contributions to the diagonal of the element matrix (lexicographic numbering
+   * of FEEvaluation, components running slowest).
+   */
+  void
+  add_diagonal(scalar * diagonal)
+  {
+    unsigned int const dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+
+    for(unsigned int c = 0; c < n_components; ++c)
+      for(unsigned int b = 0; b < dim + 1; ++b)
+      {
+        if(not is_active(b, integrate_values, integrate_gradients))
+          continue;
+
+        for(unsigned int a = 0; a < dim + 1; ++a)
+        {
+          if(not is_active(a, evaluate_values, evaluate_gradients))
+            continue;
+
+          // 1D matrices with products of two 1D shape functions (or derivatives) for each
+          // direction
+          std::array<Number const *, dim> matrices;
+          for(unsigned int d = 0; d < dim; ++d)
+          {
+            bool const derivative_b = (b == d + 1);
+            bool const derivative_a = (a == d + 1);
+            if(derivative_a and derivative_b)
+              matrices[d] = products_gradients_gradients();
+            else if(derivative_a or derivative_b)
+              matrices[d] = products_values_gradients();
+            else
+              matrices[d] = products_values_values();
+          }
+
+          scalar const * result = contract(matrices, operator_entry(c, b, c, a));
+
+          for(unsigned int i = 0; i < dofs_per_component; ++i)
+            diagonal[c * dofs_per_component + i] += result[i];
+        }
+      }
+  }
+
+  /*
+   * Computes column j of the element matrix and writes it into the dof values of the integrator.
+   * The quadrature-point operator has to be computed for the same cell beforehand.
+   */
+  void
+  compute_column(unsigned int const j, Integrator & integrator)
+  {
+    unsigned int const dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+    unsigned int const c_in               = j / dofs_per_component;
+
+    std::array<unsigned int, dim> j_1d;
+    for(unsigned int d = 0, index = j % dofs_per_component; d < dim; ++d, index /= n_dofs_1d)
+      j_1d[d] = index % n_dofs_1d;
+
+    // quadrature data of the shape function (rank-one tensor) and its derivatives
+    for(unsigned int a = 0; a < dim + 1; ++a)
+    {
+      if(not is_active(a, evaluate_values, evaluate_gradients))
+        continue;
+
+      scalar * shape = basis_function_slot(a);
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        Number value = 1.;
+        for(unsigned int d = 0, index = q; d < dim; ++d, index /= n_q_points_1d)
+        {
+          unsigned int const i = j_1d[d] * n_q_points_1d + index % n_q_points_1d;
+          value *= (a == d + 1) ? shape_gradients[i] : shape_values[i];
+        }
+        shape[q] = value;
+      }
+    }
+
+    for(unsigned int c_out = 0; c_out < n_components; ++c_out)
+      for(unsigned int b = 0; b < dim + 1; ++b)
+      {
+        if(not is_active(b, integrate_values, integrate_gradients))
+          continue;
+
+        for(unsigned int q = 0; q < n_q_points; ++q)
+          entry(integrator, c_out, b, q) = dealii::make_vectorized_array<Number>(0.);
+
+        for(unsigned int a = 0; a < dim + 1; ++a)
+        {
+          if(not is_active(a, evaluate_values, evaluate_gradients))
+            continue;
+
+          scalar const * K     = operator_entry(c_out, b, c_in, a);
+          scalar const * shape = basis_function_slot(a);
+          for(unsigned int q = 0; q < n_q_points; ++q)
+            entry(integrator, c_out, b, q) += K[q] * shape[q];
+        }
+      }
+
+    integrator.integrate(integrate_values, integrate_gradients);
+  }
+
+private:
+  static bool
+  is_active(unsigned int const slot, bool const values, bool const gradients)
+  {
+    return (slot == 0) ? values : gradients;
+  }
+
+  template<typename T>
+  static Number
+  get_scalar(T const & value)
+  {
+    return value;
+  }
+
+  template<typename T>
+  static Number
+  get_scalar(dealii::VectorizedArray<T> const & value)
+  {
+    return value[0];
+  }
+
+  /*
+   * Access to the values (slot 0) and reference-cell gradients (slots 1, ..., dim) of the
+   * integrator in quadrature points.
+   */
+  scalar &
+  entry(Integrator &       integrator,
+        unsigned int const component,
+        unsigned int const slot,
+        unsigned int const q) const
+  {
+    if(slot == 0)
+      return integrator.begin_values()[component * n_q_points + q];
+
+#if DEAL_II_VERSION_GTE(9, 5, 0)
+    return integrator.begin_gradients()[(component * n_q_points + q) * dim + slot - 1];
+#else
+    return integrator.begin_gradients()[(component * dim + slot - 1) * n_q_points + q];
+#endif
+  }
+
+  scalar *
+  operator_entry(unsigned int const c_out,
+                 unsigned int const b,
+                 unsigned int const c_in,
+                 unsigned int const a)
+  {
+    unsigned int const n_slots = n_components * (dim + 1);
+    unsigned int const row     = c_out * (dim + 1) + b;
+    unsigned int const col     = c_in * (dim + 1) + a;
+    return quadrature_point_operator.data() + (row * n_slots + col) * n_q_points;
+  }
+
+  scalar *
+  basis_function_slot(unsigned int const a)
+  {
+    return basis_function.data() + a * n_q_points;
+  }
+
+  Number const *
+  products_values_values() const
+  {
+    return shape_products.data();
+  }
+
+  Number const *
+  products_values_gradients() const
+  {
+    return shape_products.data() + n_dofs_1d * n_q_points_1d;
+  }
+
+  Number const *
+  products_gradients_gradients() const
+  {
+    return shape_products.data() + 2 * n_dofs_1d * n_q_points_1d;
+  }
+
+  /*
+   * Sum-factorized contraction of quadrature data with 1D matrices of size n_dofs_1d x
+   * n_q_points_1d (one for each direction). Returns a pointer to the result.
+   */
+  scalar const *
+  contract(std::array<Number const *, dim> const & matrices, scalar const * src)
+  {
+    scalar * out = buffer_1.data();
+    scalar * tmp = buffer_2.data();
+
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      unsigned int const stride  = dealii::Utilities::pow(n_dofs_1d, d);
+      unsigned int const n_outer = dealii::Utilities::pow(n_q_points_1d, dim - 1 - d);
+
+      for(unsigned int outer = 0; outer < n_outer; ++outer)
+        for(unsigned int i = 0; i < n_dofs_1d; ++i)
+          for(unsigned int inner = 0; inner < stride; ++inner)
+          {
+            scalar sum = dealii::make_vectorized_array<Number>(0.);
+            for(unsigned int q = 0; q < n_q_points_1d; ++q)
+              sum += matrices[d][i * n_q_points_1d + q] *
+                     src[(outer * n_q_points_1d + q) * stride + inner];
+            out[(outer * n_dofs_1d + i) * stride + inner] = sum;
+          }
+
+      src = out;
+      std::swap(out, tmp);
+    }
+
+    return src;
+  }
+
+  unsigned int n_dofs_1d;
+  unsigned int n_q_points_1d;
+  unsigned int n_q_points;
+
+  bool evaluate_values, evaluate_gradients;
+  bool integrate_values, integrate_gradients;
+
+  dealii::AlignedVector<Number> shape_values;
+  dealii::AlignedVector<Number> shape_gradients;
+
+  // products of 1D shape values/gradients: values-values, values-gradients, gradients-gradients
+  dealii::AlignedVector<Number> shape_products;
+
+  // quadrature-point operator K, entries ordered as (c_out, b, c_in, a, q)
+  dealii::AlignedVector<scalar> quadrature_point_operator;
+
+  // quadrature data of a single shape function for block-diagonal columns
+  dealii::AlignedVector<scalar> basis_function;
+
+  dealii::AlignedVector<scalar> buffer_1, buffer_2;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_TENSOR_PRODUCT_DIAGONAL_H_ */
@@ -29,6 +29,7 @@
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
 #include <exadg/utilities/print_solver_results.h>
+#include <exadg/utilities/solver_benchmark.h>
 #include <exadg/utilities/throughput_parameters.h>
 
 namespace ExaDG
@@ -66,6 +67,9 @@ Driver<dim, Number>::setup()
 
   poisson->setup(application, mpi_comm, is_throughput_study);
 
+  if(not(is_test))
+    print_batch_fill_ratio(pcout, poisson->get_matrix_free(), mpi_comm);
+
   timer_tree.insert({"Poisson", "Setup"}, timer.wall_time());
 }
 
@@ -247,6 +251,39 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
     application->get_parameters().degree, dofs, throughput);
 }
 
+template<int dim, typename Number>
+std::tuple<double, dealii::types::global_dof_index, double, std::vector<double>>
+Driver<dim, Number>::apply_solver(std::string const & solver_type_string,
+                                  unsigned int const  n_repetitions) const
+{
+  AssertThrow(not(is_throughput_study),
+              dealii::ExcMessage("The solver benchmark requires the setup of the solver."));
+
+  AssertThrow(solver_type_string == "Poisson",
+              dealii::ExcMessage("Unknown solver type " + solver_type_string + "."));
+
+  pcout << std::endl << "Solving linear system of equations ..." << std::endl;
+
+  dealii::LinearAlgebra::distributed::Vector<Number> rhs, sol;
+  poisson->pde_operator->initialize_dof_vector(rhs);
+  poisson->pde_operator->initialize_dof_vector(sol);
+  poisson->pde_operator->rhs(rhs);
+
+  std::function<unsigned int(void)> const solve = [&](void) {
+    sol = 0.0;
+    return poisson->pde_operator->solve(sol, rhs, 0.0 /* time */);
+  };
+
+  std::tuple<double, double, std::vector<double>> const iterations_and_time = measure_solver_time(
+    solve, n_repetitions, mpi_comm, poisson->pde_operator->get_timings_preconditioner());
+
+  pcout << std::endl << " ... done." << std::endl << std::endl;
+
+  return std::make_tuple(std::get<0>(iterations_and_time),
+                         poisson->pde_operator->get_number_of_dofs(),
+                         std::get<1>(iterations_and_time),
+                         std::get<2>(iterations_and_time));
+}
 
 template class Driver<2, float>;
 template class Driver<3, float>;
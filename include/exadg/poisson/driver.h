@@ -27,6 +27,7 @@
 #include <deal.II/base/timer.h>
 
 // ExaDG
+#include <exadg/matrix_free/batch_fill_ratio.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/poisson/solver_poisson.h>
 #include <exadg/poisson/spatial_discretization/operator.h>
@@ -127,6 +128,13 @@ public:
                  unsigned int const  n_repetitions_inner,
                  unsigned int const  n_repetitions_outer) const;
 
+  /*
+   * Solver benchmark: returns the average number of iterations, the number of degrees of freedom,
+   * the wall time of one solve, and the wall time per solve spent on each multigrid level.
+   */
+  std::tuple<double, dealii::types::global_dof_index, double, std::vector<double>>
+  apply_solver(std::string const & solver_type_string, unsigned int const n_repetitions) const;
+
 private:
   // MPI communicator
   MPI_Comm const mpi_comm;
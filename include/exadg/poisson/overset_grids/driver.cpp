@@ -121,11 +121,16 @@ DriverOversetGrids<dim, n_components, Number>::solve()
     poisson2->pde_operator->rhs(rhs_2);
     poisson2->pde_operator->solve(sol_2, rhs_2, 0.0 /* time */);
 
-    // Transfer data from 2 to 1
-    second_to_first->update_data(sol_2);
+    // Transfer data from 2 to 1, overlapping with the postprocessing of domain 1 (which does not
+    // access sol_2). A communication channel different from the one used for the ghost values of
+    // sol_1 in the postprocessing is required.
+    second_to_first->update_data_start(sol_2, 1 /* communication channel */);
 
     // postprocessing of results
     poisson1->postprocessor->do_postprocessing(sol_1);
+
+    second_to_first->update_data_finish();
+
     poisson2->postprocessor->do_postprocessing(sol_2);
 
     // TODO check convergence
@@ -93,7 +93,11 @@ MultigridPreconditioner<dim, Number, n_components>::fill_matrix_free_data(
   {
     auto tria = dynamic_cast<dealii::parallel::distributed::Triangulation<dim> const *>(
       &this->dof_handlers[level]->get_triangulation());
-    Categorization::do_cell_based_loops(*tria, matrix_free_data.data, h_level);
+    Categorization::do_cell_based_loops_by_face_type(
+      *tria,
+      matrix_free_data.data,
+      [&](dealii::types::boundary_id const id) { return data.bc->get_boundary_type(id); },
+      h_level);
   }
 
   matrix_free_data.insert_dof_handler(&(*this->dof_handlers[level]), "laplace_dof_handler");
@@ -30,6 +30,7 @@
 // utilities
 #include <exadg/utilities/general_parameters.h>
 #include <exadg/utilities/hypercube_resolution_parameters.h>
+#include <exadg/utilities/kernel_profiler.h>
 
 // application
 #include <exadg/poisson/user_interface/declare_get_application.h>
@@ -123,6 +124,8 @@ main(int argc, char ** argv)
   ExaDG::GeneralParameters             general(input_file);
   ExaDG::HypercubeResolutionParameters resolution(input_file, general.dim);
 
+  ExaDG::KernelProfiler::enable(general.kernel_profiling);
+
   // fill resolution vector
   resolution.fill_resolution_vector(&ExaDG::Poisson::get_dofs_per_element, input_file);
 
@@ -155,6 +158,8 @@ main(int argc, char ** argv)
   if(not(general.is_test))
     print_results(results, mpi_comm);
 
+  ExaDG::KernelProfiler::print_results(mpi_comm);
+
   return 0;
 }
 
@@ -53,8 +53,13 @@ public:
 
     matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
     if(application->get_parameters().enable_cell_based_face_loops)
-      Categorization::do_cell_based_loops(*application->get_grid()->triangulation,
-                                          matrix_free_data->data);
+    {
+      auto const bc = application->get_boundary_descriptor();
+      Categorization::do_cell_based_loops_by_face_type(
+        *application->get_grid()->triangulation,
+        matrix_free_data->data,
+        [&](dealii::types::boundary_id const id) { return bc->get_boundary_type(id); });
+    }
     matrix_free->reinit(*application->get_grid()->mapping,
                         matrix_free_data->get_dof_handler_vector(),
                         matrix_free_data->get_constraint_vector(),
@@ -72,6 +77,12 @@ public:
     }
   }
 
+  dealii::MatrixFree<dim, Number> const &
+  get_matrix_free() const
+  {
+    return *matrix_free;
+  }
+
   std::shared_ptr<Operator<dim, n_components, Number>> pde_operator;
   std::shared_ptr<PostProcessorBase<dim, Number>>      postprocessor;
 
@@ -116,6 +116,14 @@ LaplaceOperator<dim, Number, n_components>::reinit_face_cell_based(
 template<int dim, typename Number, int n_components>
 void
 LaplaceOperator<dim, Number, n_components>::do_cell_integral(IntegratorCell & integrator) const
+{
+  compute_cell_integral(integrator);
+}
+
+template<int dim, typename Number, int n_components>
+template<typename Integrator>
+void
+LaplaceOperator<dim, Number, n_components>::compute_cell_integral(Integrator & integrator) const
 {
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
@@ -123,6 +131,50 @@ LaplaceOperator<dim, Number, n_components>::do_cell_integral(IntegratorCell & in
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+LaplaceOperator<dim, Number, n_components>::cell_loop(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  auto const & shape_data =
+    matrix_free.get_shape_info(this->get_dof_index(), this->get_quad_index()).data[0];
+
+  dispatch_degree(shape_data.fe_degree,
+                  shape_data.n_q_points_1d,
+                  [&](auto fe_degree, auto n_q_points_1d) {
+                    this->template cell_loop_fixed_degree<decltype(fe_degree)::value,
+                                                          decltype(n_q_points_1d)::value>(
+                      matrix_free, dst, src, range);
+                  });
+}
+
+template<int dim, typename Number, int n_components>
+template<int fe_degree, int n_q_points_1d>
+void
+LaplaceOperator<dim, Number, n_components>::cell_loop_fixed_degree(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  if constexpr(fe_degree == -1)
+  {
+    Base::cell_loop(matrix_free, dst, src, range);
+  }
+  else
+  {
+    CellIntegratorFixedDegree<dim, fe_degree, n_q_points_1d, n_components, Number> integrator(
+      matrix_free, this->get_dof_index(), this->get_quad_index());
+
+    this->cell_loop_with_integrator(integrator, dst, src, range, [&](auto & cell_integrator) {
+      compute_cell_integral(cell_integrator);
+    });
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 LaplaceOperator<dim, Number, n_components>::do_face_integral(IntegratorFace & integrator_m,
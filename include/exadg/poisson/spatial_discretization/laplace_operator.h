@@ -22,6 +22,7 @@
 #ifndef LAPLACE_OPERATOR_H
 #define LAPLACE_OPERATOR_H
 
+#include <exadg/matrix_free/degree_dispatch.h>
 #include <exadg/operators/interior_penalty_parameter.h>
 #include <exadg/operators/operator_base.h>
 #include <exadg/operators/operator_type.h>
@@ -269,6 +270,24 @@ private:
   void
   do_cell_integral(IntegratorCell & integrator) const final;
 
+  template<typename Integrator>
+  void
+  compute_cell_integral(Integrator & integrator) const;
+
+  // cell integrals with compile-time polynomial degree (if available for the given degree)
+  void
+  cell_loop(dealii::MatrixFree<dim, Number> const & matrix_free,
+            VectorType &                            dst,
+            VectorType const &                      src,
+            Range const &                           range) const final;
+
+  template<int fe_degree, int n_q_points_1d>
+  void
+  cell_loop_fixed_degree(dealii::MatrixFree<dim, Number> const & matrix_free,
+                         VectorType &                            dst,
+                         VectorType const &                      src,
+                         Range const &                           range) const;
+
   void
   do_face_integral(IntegratorFace & integrator_m, IntegratorFace & integrator_p) const final;
 
@@ -589,6 +589,16 @@ Operator<dim, n_components, Number>::get_timings() const
   return iterative_solver->get_timings();
 }
 
+template<int dim, int n_components, typename Number>
+std::shared_ptr<TimerTree>
+Operator<dim, n_components, Number>::get_timings_preconditioner() const
+{
+  if(preconditioner.get() != nullptr)
+    return preconditioner->get_timings();
+
+  return nullptr;
+}
+
 template class Operator<2, 1, float>;
 template class Operator<2, 1, double>;
 template class Operator<2, 2, float>;
@@ -105,6 +105,12 @@ public:
   std::shared_ptr<TimerTree>
   get_timings() const;
 
+  /*
+   * Returns the timings of the preconditioner (used for solver benchmarks).
+   */
+  std::shared_ptr<TimerTree>
+  get_timings_preconditioner() const;
+
 #ifdef DEAL_II_WITH_TRILINOS
   void
   init_system_matrix(dealii::TrilinosWrappers::SparseMatrix & system_matrix,
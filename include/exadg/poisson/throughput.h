@@ -39,6 +39,7 @@
 // utilities
 #include <exadg/utilities/general_parameters.h>
 #include <exadg/utilities/hypercube_resolution_parameters.h>
+#include <exadg/utilities/kernel_profiler.h>
 #include <exadg/utilities/throughput_parameters.h>
 
 // application
@@ -146,6 +147,8 @@ main(int argc, char ** argv)
   ExaDG::HypercubeResolutionParameters resolution(input_file, general.dim);
   ExaDG::ThroughputParameters          throughput(input_file);
 
+  ExaDG::KernelProfiler::enable(general.kernel_profiling);
+
   // fill resolution vector depending on the operator_type
   resolution.fill_resolution_vector(&ExaDG::Poisson::get_dofs_per_element, input_file);
 
@@ -180,6 +183,8 @@ main(int argc, char ** argv)
   LIKWID_MARKER_CLOSE;
 #endif
 
+  ExaDG::KernelProfiler::print_results(mpi_comm);
+
   return 0;
 }
 
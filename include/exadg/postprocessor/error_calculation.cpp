@@ -22,9 +22,6 @@
 // C/C++
 #include <fstream>
 
-// deal.II
-#include <deal.II/numerics/vector_tools.h>
-
 // ExaDG
 #include <exadg/postprocessor/error_calculation.h>
 #include <exadg/utilities/create_directories.h>
@@ -122,6 +119,13 @@ ErrorCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const &   dof_handle
     create_directories(error_data.directory, mpi_comm);
 }
 
+template<int dim, typename Number>
+void
+ErrorCalculator<dim, Number>::set_norm_evaluator(NormEvaluator const & norm_evaluator_in)
+{
+  norm_evaluator = norm_evaluator_in;
+}
+
 template<int dim, typename Number>
 void
 ErrorCalculator<dim, Number>::evaluate(VectorType const & solution,
@@ -179,14 +183,8 @@ ErrorCalculator<dim, Number>::do_evaluate(VectorType const & solution_vector, do
 {
   bool relative = error_data.calculate_relative_errors;
 
-  double const error = calculate_error<dim>(mpi_comm,
-                                            relative,
-                                            *dof_handler,
-                                            *mapping,
-                                            solution_vector,
-                                            error_data.analytical_solution,
-                                            time,
-                                            dealii::VectorTools::L2_norm);
+  double const error =
+    calculate_error_norm(solution_vector, time, dealii::VectorTools::L2_norm);
 
   dealii::ConditionalOStream pcout(std::cout,
                                    dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
@@ -223,14 +221,8 @@ ErrorCalculator<dim, Number>::do_evaluate(VectorType const & solution_vector, do
   // H1-seminorm
   if(error_data.calculate_H1_seminorm_error)
   {
-    double const error = calculate_error<dim>(mpi_comm,
-                                              relative,
-                                              *dof_handler,
-                                              *mapping,
-                                              solution_vector,
-                                              error_data.analytical_solution,
-                                              time,
-                                              dealii::VectorTools::H1_seminorm);
+    double const error =
+      calculate_error_norm(solution_vector, time, dealii::VectorTools::H1_seminorm);
 
     dealii::ConditionalOStream pcout(std::cout,
                                      dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
@@ -267,6 +259,46 @@ ErrorCalculator<dim, Number>::do_evaluate(VectorType const & solution_vector, do
   }
 }
 
+template<int dim, typename Number>
+double
+ErrorCalculator<dim, Number>::calculate_error_norm(
+  VectorType const &                    solution_vector,
+  double const                          time,
+  dealii::VectorTools::NormType const & norm_type) const
+{
+  bool const relative = error_data.calculate_relative_errors;
+
+  if(norm_evaluator)
+  {
+    double error_norm = 0.0, solution_norm = 0.0;
+    norm_evaluator(error_norm, solution_norm, norm_type);
+
+    if(relative == true)
+    {
+      AssertThrow(solution_norm > 1.e-15,
+                  dealii::ExcMessage(
+                    "Cannot compute relative error since norm of solution tends to zero."));
+
+      return error_norm / solution_norm;
+    }
+    else // absolute error
+    {
+      return error_norm;
+    }
+  }
+  else
+  {
+    return calculate_error<dim>(mpi_comm,
+                                relative,
+                                *dof_handler,
+                                *mapping,
+                                solution_vector,
+                                error_data.analytical_solution,
+                                time,
+                                norm_type);
+  }
+}
+
 template class ErrorCalculator<2, float>;
 template class ErrorCalculator<2, double>;
 
@@ -27,6 +27,7 @@
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
 #include <exadg/utilities/print_functions.h>
@@ -103,6 +104,14 @@ class ErrorCalculator
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
+  /*
+   * Computes the norm of the error and the norm of the analytical solution for a given norm type.
+   */
+  typedef std::function<void(double &                              error_norm,
+                             double &                              solution_norm,
+                             dealii::VectorTools::NormType const & norm_type)>
+    NormEvaluator;
+
   ErrorCalculator(MPI_Comm const & comm);
 
   void
@@ -110,6 +119,14 @@ public:
         dealii::Mapping<dim> const &      mapping,
         ErrorCalculationData<dim> const & error_data);
 
+  /*
+   * By default, errors are computed via dealii::VectorTools::integrate_difference(). This function
+   * allows to provide the norms from outside instead, e.g., from a matrix-free loop that evaluates
+   * several integral quantities at once.
+   */
+  void
+  set_norm_evaluator(NormEvaluator const & norm_evaluator);
+
   void
   evaluate(VectorType const & solution, double const & time, int const & time_step_number);
 
@@ -117,6 +134,11 @@ private:
   void
   do_evaluate(VectorType const & solution_vector, double const time);
 
+  double
+  calculate_error_norm(VectorType const &                    solution_vector,
+                       double const                          time,
+                       dealii::VectorTools::NormType const & norm_type) const;
+
   MPI_Comm const mpi_comm;
 
   unsigned int error_counter;
@@ -128,6 +150,8 @@ private:
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
   ErrorCalculationData<dim> error_data;
+
+  NormEvaluator norm_evaluator;
 };
 
 } // namespace ExaDG
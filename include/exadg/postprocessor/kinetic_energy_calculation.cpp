@@ -52,6 +52,14 @@ KineticEnergyCalculator<dim, Number>::setup(dealii::MatrixFree<dim, Number> cons
     create_directories(data.directory, mpi_comm);
 }
 
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::set_integral_evaluator(
+  IntegralEvaluator const & integral_evaluator_in)
+{
+  integral_evaluator = integral_evaluator_in;
+}
+
 template<int dim, typename Number>
 void
 KineticEnergyCalculator<dim, Number>::evaluate(VectorType const & velocity,
@@ -131,22 +139,30 @@ KineticEnergyCalculator<dim, Number>::integrate(dealii::MatrixFree<dim, Number>
                                                 Number &                                dissipation,
                                                 Number & max_vorticity)
 {
-  std::vector<Number> dst(5, 0.0);
-  matrix_free.cell_loop(&KineticEnergyCalculator<dim, Number>::cell_loop, this, dst, velocity);
-
-  // sum over all MPI processes
   Number volume = 1.0;
-  volume        = dealii::Utilities::MPI::sum(dst.at(0), mpi_comm);
-  energy        = dealii::Utilities::MPI::sum(dst.at(1), mpi_comm);
-  enstrophy     = dealii::Utilities::MPI::sum(dst.at(2), mpi_comm);
-  dissipation   = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
+
+  if(integral_evaluator)
+  {
+    integral_evaluator(volume, energy, enstrophy, dissipation, max_vorticity);
+  }
+  else
+  {
+    std::vector<Number> dst(5, 0.0);
+    matrix_free.cell_loop(&KineticEnergyCalculator<dim, Number>::cell_loop, this, dst, velocity);
+
+    // sum over all MPI processes
+    volume      = dealii::Utilities::MPI::sum(dst.at(0), mpi_comm);
+    energy      = dealii::Utilities::MPI::sum(dst.at(1), mpi_comm);
+    enstrophy   = dealii::Utilities::MPI::sum(dst.at(2), mpi_comm);
+    dissipation = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
+
+    max_vorticity = dealii::Utilities::MPI::max(dst.at(4), mpi_comm);
+  }
 
   energy /= volume;
   enstrophy /= volume;
   dissipation /= volume;
 
-  max_vorticity = dealii::Utilities::MPI::max(dst.at(4), mpi_comm);
-
   return volume;
 }
 
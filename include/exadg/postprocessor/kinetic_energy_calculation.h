@@ -92,6 +92,17 @@ public:
   typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
 
+  /*
+   * Computes the (non-normalized) integrals of volume, kinetic energy, enstrophy, and dissipation
+   * as well as the maximum vorticity.
+   */
+  typedef std::function<void(Number & volume,
+                             Number & energy,
+                             Number & enstrophy,
+                             Number & dissipation,
+                             Number & max_vorticity)>
+    IntegralEvaluator;
+
   KineticEnergyCalculator(MPI_Comm const & comm);
 
   void
@@ -100,6 +111,13 @@ public:
         unsigned int const                      quad_index_in,
         KineticEnergyData const &               kinetic_energy_data_in);
 
+  /*
+   * Replaces the cell loop of this class by an external evaluation routine, e.g., a matrix-free
+   * loop that evaluates several integral quantities at once.
+   */
+  void
+  set_integral_evaluator(IntegralEvaluator const & integral_evaluator_in);
+
   void
   evaluate(VectorType const & velocity, double const & time, int const & time_step_number);
 
@@ -145,6 +163,8 @@ protected:
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   KineticEnergyData                       data;
+
+  IntegralEvaluator integral_evaluator;
 };
 
 } // namespace ExaDG
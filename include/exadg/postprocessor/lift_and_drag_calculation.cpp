@@ -136,6 +136,13 @@ LiftAndDragCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_ha
     create_directories(data.directory, mpi_comm);
 }
 
+template<int dim, typename Number>
+void
+LiftAndDragCalculator<dim, Number>::set_force_evaluator(ForceEvaluator const & force_evaluator_in)
+{
+  force_evaluator = force_evaluator_in;
+}
+
 template<int dim, typename Number>
 void
 LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
@@ -146,16 +153,23 @@ LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
   {
     dealii::Tensor<1, dim, Number> Force;
 
-    calculate_lift_and_drag_force<dim, Number>(Force,
-                                               *matrix_free,
-                                               dof_index_velocity,
-                                               quad_index,
-                                               dof_index_pressure,
-                                               data.boundary_IDs,
-                                               velocity,
-                                               pressure,
-                                               data.viscosity,
-                                               mpi_comm);
+    if(force_evaluator)
+    {
+      force_evaluator(Force);
+    }
+    else
+    {
+      calculate_lift_and_drag_force<dim, Number>(Force,
+                                                 *matrix_free,
+                                                 dof_index_velocity,
+                                                 quad_index,
+                                                 dof_index_pressure,
+                                                 data.boundary_IDs,
+                                                 velocity,
+                                                 pressure,
+                                                 data.viscosity,
+                                                 mpi_comm);
+    }
 
     // compute lift and drag coefficients (c = (F/rho)/(1/2 U² A)
     double const reference_value = data.reference_value;
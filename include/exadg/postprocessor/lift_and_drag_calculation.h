@@ -74,6 +74,11 @@ class LiftAndDragCalculator
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
+  /*
+   * Computes the force acting on the surface specified by LiftAndDragData::boundary_IDs.
+   */
+  typedef std::function<void(dealii::Tensor<1, dim, Number> & force)> ForceEvaluator;
+
   LiftAndDragCalculator(MPI_Comm const & comm);
 
   void
@@ -84,6 +89,13 @@ public:
         unsigned int const                      quad_index_in,
         LiftAndDragData const &                 lift_and_drag_data_in);
 
+  /*
+   * Replaces the boundary face loop of this class by an external evaluation routine, e.g., a
+   * matrix-free loop that evaluates several integral quantities at once.
+   */
+  void
+  set_force_evaluator(ForceEvaluator const & force_evaluator_in);
+
   void
   evaluate(VectorType const & velocity, VectorType const & pressure, Number const & time) const;
 
@@ -99,6 +111,8 @@ private:
   mutable double c_L_min, c_L_max, c_D_min, c_D_max;
 
   LiftAndDragData data;
+
+  ForceEvaluator force_evaluator;
 };
 
 } // namespace ExaDG
@@ -28,6 +28,9 @@
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/vector_tools/probe_set.h>
+
 namespace ExaDG
 {
 template<int dim>
@@ -67,7 +70,8 @@ public:
   void
   setup(dealii::DoFHandler<dim> const &     dof_handler_pressure_in,
         dealii::Mapping<dim> const &        mapping_in,
-        PressureDifferenceData<dim> const & pressure_difference_data_in);
+        PressureDifferenceData<dim> const & pressure_difference_data_in,
+        bool const                          moving_mesh = false);
 
   void
   evaluate(VectorType const & pressure, double const & time) const;
@@ -81,6 +85,9 @@ private:
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
   PressureDifferenceData<dim> data;
+
+  // evaluates the pressure in point_1 and point_2
+  mutable ProbeSet<dim, 1, Number> probe_set;
 };
 
 } // namespace ExaDG
@@ -23,11 +23,16 @@
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_MGCOARSEGRIDSOLVERS_H_
 
 // deal.II
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_solver.h>
 #include <deal.II/lac/solver_cg.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_direct.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
 #include <deal.II/multigrid/mg_base.h>
 
 // ExaDG
@@ -446,6 +451,114 @@ private:
   std::shared_ptr<PreconditionerBase<NumberAMG>> amg_preconditioner;
 };
 
+/*
+ * Direct solver for small coarse-grid problems that does not require external linear algebra
+ * packages like Trilinos or PETSc. The sparse matrix of the coarse-grid operator is replicated on
+ * all MPI processes and factorized by UMFPACK (or by a dense inversion if deal.II has been
+ * compiled without UMFPACK). The sparsity pattern is computed once in the constructor, while
+ * update() only recomputes the matrix entries and the factorization.
+ */
+template<typename Operator>
+class MGCoarseDirect : public dealii::MGCoarseGridBase<
+                         dealii::LinearAlgebra::distributed::Vector<typename Operator::value_type>>
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<typename Operator::value_type>
+    VectorTypeMultigrid;
+
+public:
+  MGCoarseDirect(Operator const & op, bool const operator_is_singular, MPI_Comm const & comm)
+    : pde_operator(op), operator_is_singular(operator_is_singular), mpi_comm(comm)
+  {
+    pde_operator.init_system_matrix(sparsity_pattern, system_matrix, mpi_comm);
+
+    update();
+  }
+
+  void
+  update()
+  {
+    system_matrix = 0.0;
+    pde_operator.calculate_system_matrix(system_matrix, mpi_comm);
+
+    // for singular operators, the first unknown is fixed to remove the constant null space
+    if(operator_is_singular && system_matrix.m() > 0)
+    {
+      for(auto entry = system_matrix.begin(0); entry != system_matrix.end(0); ++entry)
+        entry->value() = (entry->column() == 0) ? 1.0 : 0.0;
+    }
+
+#ifdef DEAL_II_WITH_UMFPACK
+    solver.initialize(system_matrix);
+#else
+    AssertThrow(system_matrix.m() <= max_size_dense_inverse,
+                dealii::ExcMessage("The coarse-grid problem is too large for the dense inverse "
+                                   "used by MGCoarseDirect without UMFPACK (" +
+                                   std::to_string(system_matrix.m()) + " > " +
+                                   std::to_string(max_size_dense_inverse) +
+                                   " unknowns). Configure deal.II with UMFPACK or choose another "
+                                   "coarse-grid solver."));
+
+    inverse_matrix.copy_from(system_matrix);
+    inverse_matrix.gauss_jordan();
+#endif
+  }
+
+  void
+  operator()(unsigned int const /*level*/,
+             VectorTypeMultigrid &       dst,
+             VectorTypeMultigrid const & src) const
+  {
+    VectorTypeMultigrid r(src);
+    if(operator_is_singular)
+      set_zero_mean_value(r);
+
+    // gather the right-hand side on all processes
+    dealii::Vector<double> rhs(system_matrix.m());
+    for(unsigned int i = 0; i < r.get_partitioner()->locally_owned_size(); ++i)
+      rhs(r.get_partitioner()->local_to_global(i)) = r.local_element(i);
+    dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(rhs.begin(), rhs.size()),
+                                mpi_comm,
+                                dealii::ArrayView<double>(rhs.begin(), rhs.size()));
+
+    if(operator_is_singular && rhs.size() > 0)
+      rhs(0) = 0.0;
+
+#ifdef DEAL_II_WITH_UMFPACK
+    solver.solve(rhs);
+    dealii::Vector<double> const & solution = rhs;
+#else
+    dealii::Vector<double> solution(rhs.size());
+    inverse_matrix.vmult(solution, rhs);
+#endif
+
+    for(unsigned int i = 0; i < dst.get_partitioner()->locally_owned_size(); ++i)
+      dst.local_element(i) = solution(dst.get_partitioner()->local_to_global(i));
+
+    if(operator_is_singular)
+      set_zero_mean_value(dst);
+  }
+
+private:
+  Operator const & pde_operator;
+
+  bool const operator_is_singular;
+
+  MPI_Comm const mpi_comm;
+
+  dealii::SparsityPattern      sparsity_pattern;
+  dealii::SparseMatrix<double> system_matrix;
+
+#ifdef DEAL_II_WITH_UMFPACK
+  mutable dealii::SparseDirectUMFPACK solver;
+#else
+  // the dense inverse requires O(n^2) memory and O(n^3) operations on every process
+  static unsigned int constexpr max_size_dense_inverse = 2000;
+
+  dealii::FullMatrix<double> inverse_matrix;
+#endif
+};
+
 } // namespace ExaDG
 
 #endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_MGCOARSEGRIDSOLVERS_H_ */
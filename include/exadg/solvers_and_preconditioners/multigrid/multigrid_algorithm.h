@@ -33,10 +33,12 @@
 
 // ExaDG
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
+#include <exadg/utilities/kernel_profiler.h>
 #include <exadg/utilities/timer_tree.h>
 
 /*
- * Activate timings if desired.
+ * Activate timings if desired. Independently of this flag, timings are recorded at run time if the
+ * kernel profiler is enabled (e.g., to report the wall time per level in solver benchmarks).
  */
 #define ENABLE_TIMING false
 
@@ -59,7 +61,8 @@ public:
                      MGTransfer<VectorType> const &                               transfer,
                      dealii::MGLevelObject<std::shared_ptr<SmootherType>> const & smoother,
                      MPI_Comm const &                                             comm,
-                     unsigned int const                                           n_cycles = 1)
+                     unsigned int const                                           n_cycles = 1,
+                     bool const                                                   skip_idle = false)
     : minlevel(matrix.min_level()),
       maxlevel(matrix.max_level()),
       defect(minlevel, maxlevel),
@@ -70,7 +73,8 @@ public:
       transfer(transfer),
       smoother(&smoother, typeid(*this).name()),
       mpi_comm(comm),
-      n_cycles(n_cycles)
+      n_cycles(n_cycles),
+      skip_idle_levels(skip_idle)
   {
     AssertThrow(n_cycles == 1, dealii::ExcNotImplemented());
 
@@ -88,9 +92,8 @@ public:
   void
   vmult(OtherVectorType & dst, OtherVectorType const & src) const
   {
-#if ENABLE_TIMING
-    dealii::Timer timer;
-#endif
+    bool const do_timing = timings_are_enabled();
+    auto const start     = std::chrono::steady_clock::now();
 
     for(unsigned int i = minlevel; i < maxlevel; i++)
     {
@@ -102,9 +105,8 @@ public:
 
     dst.copy_locally_owned_data_from(solution[maxlevel]);
 
-#if ENABLE_TIMING
-    timer_tree->insert({"Multigrid"}, timer.wall_time());
-#endif
+    if(do_timing)
+      timer_tree->insert({"Multigrid"}, get_wall_time(start));
   }
 
   template<class OtherVectorType>
@@ -172,28 +174,33 @@ private:
   void
   v_cycle(unsigned int const level, bool const multigrid_is_a_solver) const
   {
-#if ENABLE_TIMING
-    dealii::Timer timer;
-#endif
+    bool const                            do_timing = timings_are_enabled();
+    std::chrono::steady_clock::time_point start;
 
     // call coarse grid solver
     if(level == minlevel)
     {
-#if ENABLE_TIMING
-      timer.restart();
-#endif
+      start = std::chrono::steady_clock::now();
 
       (*coarse)(level, solution[level], defect[level]);
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      if(do_timing)
+        timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, get_wall_time(start));
+    }
+    else if(level_is_idle(level))
+    {
+      // This process does not own any degrees of freedom on this level after the coarse levels
+      // have been repartitioned onto fewer processes. It only takes part in the (collective) grid
+      // transfer and the coarse grid correction.
+      transfer.restrict_and_add(level, defect[level - 1], t[level]);
+
+      v_cycle(level - 1, false);
+
+      transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
     }
     else
     {
-#if ENABLE_TIMING
-      timer.restart();
-#endif
+      start = std::chrono::steady_clock::now();
 
       // pre-smoothing
       if(multigrid_is_a_solver)
@@ -216,16 +223,13 @@ private:
       t[level].sadd(-1.0, 1.0, defect[level]);
       transfer.restrict_and_add(level, defect[level - 1], t[level]);
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      if(do_timing)
+        timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, get_wall_time(start));
 
       // coarse grid correction
       v_cycle(level - 1, false);
 
-#if ENABLE_TIMING
-      timer.restart();
-#endif
+      start = std::chrono::steady_clock::now();
 
       // prolongation
       transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
@@ -233,12 +237,39 @@ private:
       // post-smoothing
       (*smoother)[level]->step(solution[level], defect[level]);
 
-#if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
-#endif
+      if(do_timing)
+        timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, get_wall_time(start));
     }
   }
 
+  /**
+   * Returns true if the timings of the V-cycle are recorded in the timer tree.
+   */
+  static bool
+  timings_are_enabled()
+  {
+    return ENABLE_TIMING or KernelProfiler::is_enabled();
+  }
+
+  /**
+   * Returns the wall time in seconds elapsed since start.
+   */
+  static double
+  get_wall_time(std::chrono::steady_clock::time_point const & start)
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  /**
+   * Returns true if idle levels are skipped and the current process does not own any degrees of
+   * freedom on the given level.
+   */
+  bool
+  level_is_idle(unsigned int const level) const
+  {
+    return skip_idle_levels && solution[level].get_partitioner()->locally_owned_size() == 0;
+  }
+
   /**
    * Coarsest level.
    */
@@ -289,6 +320,12 @@ private:
 
   unsigned int const n_cycles;
 
+  /**
+   * Skip smoothing on levels where the current process does not own any degrees of freedom. This
+   * is only valid if the smoothers do not involve global communication.
+   */
+  bool const skip_idle_levels;
+
   std::shared_ptr<TimerTree> timer_tree;
 };
 
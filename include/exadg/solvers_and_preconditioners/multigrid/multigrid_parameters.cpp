@@ -181,6 +181,9 @@ enum_to_string(MultigridCoarseGridSolver const enum_type)
     case MultigridCoarseGridSolver::AMG:
       string_type = "AMG";
       break;
+    case MultigridCoarseGridSolver::Direct:
+      string_type = "Direct";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
@@ -95,7 +95,8 @@ enum class MultigridCoarseGridSolver
   Chebyshev,
   CG,
   GMRES,
-  AMG
+  AMG,
+  Direct // sparse direct solver (UMFPACK), dense inverse for small problems without UMFPACK
 };
 
 std::string
@@ -283,6 +284,7 @@ struct MultigridData
     : type(MultigridType::hMG),
       p_sequence(PSequenceType::Bisect),
       use_global_coarsening(false),
+      min_cells_per_process(0),
       smoother_data(SmootherData()),
       coarse_problem(CoarseGridData())
   {
@@ -300,6 +302,14 @@ struct MultigridData
 
     print_parameter(pcout, "Global coarsening", use_global_coarsening);
 
+    if(use_global_coarsening && involves_h_transfer())
+    {
+      if(min_cells_per_process > 0)
+        print_parameter(pcout, "Min. cells per process", min_cells_per_process);
+      else
+        print_parameter(pcout, "Min. cells per process", std::string("default"));
+    }
+
     smoother_data.print(pcout);
 
     coarse_problem.print(pcout);
@@ -324,6 +334,13 @@ struct MultigridData
   // hanging nodes
   bool use_global_coarsening;
 
+  // Global coarsening with h-transfer: coarser h-levels are repartitioned onto fewer MPI processes
+  // such that each active process owns at least this number of cells. Processes without cells on a
+  // level skip the smoother on that level. A value of 1 keeps all processes on all levels. The
+  // default value of 0 selects the tuned grain size of the coarsening algorithm, i.e., 200 cells
+  // per process for deal.II >= 9.4 and 400 cells per process for older deal.II versions.
+  unsigned int min_cells_per_process;
+
   // Smoother data
   SmootherData smoother_data;
 
@@ -326,8 +326,10 @@ class BalancedGranularityPartitionPolicy
   : public dealii::RepartitioningPolicyTools::Base<dim, spacedim>
 {
 public:
-  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes)
-    : n_mpi_processes_per_level{n_mpi_processes}
+  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes,
+                                     unsigned int const min_cells_per_process)
+    : n_mpi_processes_per_level{n_mpi_processes},
+      min_cells_per_process(min_cells_per_process > 0 ? min_cells_per_process : 200)
   {
   }
 
@@ -336,14 +338,15 @@ public:
   {
     dealii::types::global_cell_index const n_cells = tria_coarse_in.n_global_active_cells();
 
-    // TODO: We hard-code a grain-size limit of 200 cells per processor
-    // (assuming linear finite elements and typical behavior of
-    // supercomputers). In case we have fewer cells on the fine level, we do
-    // not immediately go to 200 cells per rank, but limit the growth by a
-    // factor of 8, which limits makes sure that we do not create too many
-    // messages for individual MPI processes.
+    // We use a grain-size limit of min_cells_per_process cells per processor
+    // (200 by default, assuming linear finite elements and typical behavior
+    // of supercomputers). In case we have fewer cells on the fine level, we do
+    // not immediately go to min_cells_per_process cells per rank, but limit
+    // the growth by a factor of 8, which makes sure that we do not create too
+    // many messages for individual MPI processes.
     unsigned int const grain_size_limit =
-      std::min<unsigned int>(200, 8 * n_cells / n_mpi_processes_per_level.back() + 1);
+      std::min<unsigned int>(min_cells_per_process,
+                             8 * n_cells / n_mpi_processes_per_level.back() + 1);
 
     dealii::RepartitioningPolicyTools::MinimalGranularityPolicy<dim, spacedim> partitioning_policy(
       grain_size_limit);
@@ -358,6 +361,8 @@ public:
 
 private:
   mutable std::vector<unsigned int> n_mpi_processes_per_level;
+
+  unsigned int const min_cells_per_process;
 };
 
 #else
@@ -467,14 +472,16 @@ gather_distributed_triangulation_by_node(
 template<int dim, int spacedim>
 std::vector<std::shared_ptr<dealii::Triangulation<dim, spacedim> const>>
 create_geometric_coarsening_sequence(
-  dealii::Triangulation<dim, spacedim> const & fine_triangulation_in)
+  dealii::Triangulation<dim, spacedim> const & fine_triangulation_in,
+  unsigned int const                           min_cells_per_process)
 {
 #if DEAL_II_VERSION_GTE(9, 4, 0)
 
   return dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
     fine_triangulation_in,
     BalancedGranularityPartitionPolicy<dim>(
-      dealii::Utilities::MPI::n_mpi_processes(fine_triangulation_in.get_communicator())));
+      dealii::Utilities::MPI::n_mpi_processes(fine_triangulation_in.get_communicator()),
+      min_cells_per_process));
 
 #else
 
@@ -505,12 +512,12 @@ create_geometric_coarsening_sequence(
     MPI_Comm mpi_comm = fine_triangulation->get_communicator();
 
     // as long as we have enough cells per process, we can perform regular
-    // coarsening with all MPI processes TODO: The number of 400 cells per MPI
+    // coarsening with all MPI processes. The default of 400 cells per MPI
     // process (or 50 if the next refinement were done in 3D) was found to be a
     // good tradeoff between communication cost and workload size of linear
-    // polynomials, resulting in small run times in preliminary studies. This
-    // could be generalized by a parameter to set in the application files.
-    unsigned int n_cells_per_process = 400;
+    // polynomials, resulting in small run times in preliminary studies.
+    unsigned int const n_cells_per_process =
+      min_cells_per_process > 0 ? min_cells_per_process : 400;
     for(int level = fine_triangulation->n_global_levels() - 2;
         level >= 0 &&
         tria_copy.n_global_active_cells() / dealii::Utilities::MPI::n_mpi_processes(mpi_comm) >
@@ -632,7 +639,8 @@ MultigridPreconditionerBase<dim, Number>::initialize_coarse_grid_triangulations(
           "without refinements, a dealii::parallel::distributed::Triangulation, or a "
           "MultigridType without h-transfer."));
 
-      coarse_grid_triangulations = create_geometric_coarsening_sequence(*tria);
+      coarse_grid_triangulations =
+        create_geometric_coarsening_sequence(*tria, data.min_cells_per_process);
     }
   }
 }
@@ -1150,6 +1158,14 @@ MultigridPreconditionerBase<dim, Number>::update_coarse_solver(bool const operat
 
       break;
     }
+    case MultigridCoarseGridSolver::Direct:
+    {
+      std::shared_ptr<MGCoarseDirect<Operator>> coarse_solver =
+        std::dynamic_pointer_cast<MGCoarseDirect<Operator>>(coarse_grid_solver);
+      coarse_solver->update();
+
+      break;
+    }
     default:
     {
       AssertThrow(false, dealii::ExcMessage("Unknown coarse-grid solver given"));
@@ -1221,6 +1237,12 @@ MultigridPreconditionerBase<dim, Number>::initialize_coarse_solver(bool const op
 
       break;
     }
+    case MultigridCoarseGridSolver::Direct:
+    {
+      coarse_grid_solver =
+        std::make_shared<MGCoarseDirect<Operator>>(coarse_operator, operator_is_singular, mpi_comm);
+      break;
+    }
     default:
     {
       AssertThrow(false, dealii::ExcMessage("Unknown coarse-grid solver specified."));
@@ -1267,9 +1289,20 @@ template<int dim, typename Number>
 void
 MultigridPreconditionerBase<dim, Number>::initialize_multigrid_algorithm()
 {
-  this
-    ->multigrid_algorithm = std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(
-    this->operators, *this->coarse_grid_solver, *this->transfers, this->smoothers, this->mpi_comm);
+  // Processes that do not own any cells on a repartitioned coarse level skip the smoother on that
+  // level. This requires smoothers without global communication in vmult()/step().
+  bool const skip_idle_levels = data.smoother_data.smoother == MultigridSmoother::Chebyshev or
+                                data.smoother_data.smoother == MultigridSmoother::Jacobi;
+
+  typedef MultigridAlgorithm<VectorTypeMG, Operator, Smoother> MultigridAlgorithmType;
+
+  this->multigrid_algorithm = std::make_shared<MultigridAlgorithmType>(this->operators,
+                                                                       *this->coarse_grid_solver,
+                                                                       *this->transfers,
+                                                                       this->smoothers,
+                                                                       this->mpi_comm,
+                                                                       1 /* n_cycles */,
+                                                                       skip_idle_levels);
 }
 
 template<int dim, typename Number>
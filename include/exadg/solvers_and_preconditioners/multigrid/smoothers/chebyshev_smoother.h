@@ -57,6 +57,13 @@ public:
   initialize(Operator const & matrix, AdditionalData const & additional_data)
   {
     smoother_object.initialize(matrix, additional_data);
+
+    // Estimate the eigenvalues here rather than lazily in the first call to vmult()/step(). The
+    // estimation involves global reductions, and processes without degrees of freedom on a
+    // multigrid level skip the smoother in the V-cycle.
+    VectorType vector;
+    matrix.initialize_dof_vector(vector);
+    smoother_object.estimate_eigenvalues(vector);
   }
 
 private:
@@ -46,6 +46,29 @@ public:
     inverse_mass_operator.apply(dst, src);
   }
 
+  /*
+   * dst = factor * M^{-1} src, see InverseMassOperator::apply_scale().
+   */
+  void
+  vmult_scale(VectorType & dst, Number const factor, VectorType const & src) const
+  {
+    inverse_mass_operator.apply_scale(dst, factor, src);
+  }
+
+  /*
+   * dst = factor * M^{-1} src + factor_add * vector_add, see
+   * InverseMassOperator::apply_scale_add().
+   */
+  void
+  vmult_scale_add(VectorType &       dst,
+                  Number const       factor,
+                  VectorType const & src,
+                  Number const       factor_add,
+                  VectorType const & vector_add) const
+  {
+    inverse_mass_operator.apply_scale_add(dst, factor, src, factor_add, vector_add);
+  }
+
   void
   update()
   {
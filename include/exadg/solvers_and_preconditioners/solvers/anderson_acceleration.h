@@ -0,0 +1,165 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_ANDERSON_ACCELERATION_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_ANDERSON_ACCELERATION_H_
+
+// C/C++
+#include <algorithm>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+namespace ExaDG
+{
+/*
+ * Anderson acceleration of a fixed-point iteration x_{k+1} = G(x_k) (Walker & Ni, 2011).
+ *
+ * With the residuals f_k = G(x_k) - x_k and the differences of the last m iterates
+ *
+ *   dF = [f_{k-m+1} - f_{k-m}, ..., f_k - f_{k-1}] ,  dG = [G(x_{k-m+1}) - G(x_{k-m}), ...] ,
+ *
+ * the next iterate is
+ *
+ *   x_{k+1} = G(x_k) - dG * gamma  with  gamma = argmin || f_k - dF * gamma || .
+ *
+ * The differences are stored in ring buffers, and the Gram matrix dF^T * dF is updated with one
+ * new row per iteration, so that each iteration requires m + 1 inner products in addition to the
+ * vector updates. The least-squares problem is solved via the (slightly regularized) normal
+ * equations, which is sufficient for the small depths m used in practice.
+ */
+template<typename VectorType>
+class AndersonAcceleration
+{
+public:
+  AndersonAcceleration(unsigned int const depth_in)
+    : depth(depth_in), n_iterations(0), gram(depth_in, depth_in)
+  {
+    AssertThrow(depth > 0, dealii::ExcMessage("Depth of Anderson acceleration has to be > 0."));
+  }
+
+  /*
+   * Takes the last iterate x and the result g = G(x) of the fixed-point map and overwrites g by
+   * the accelerated iterate.
+   */
+  void
+  update(VectorType & g, VectorType const & x)
+  {
+    if(n_iterations == 0)
+    {
+      residual.reinit(g, true);
+      residual_last.reinit(g, true);
+      g_last.reinit(g, true);
+
+      delta_f.resize(depth);
+      delta_g.resize(depth);
+      for(unsigned int i = 0; i < depth; ++i)
+      {
+        delta_f[i].reinit(g, true);
+        delta_g[i].reinit(g, true);
+      }
+    }
+
+    residual = g;
+    residual.add(-1.0, x);
+
+    if(n_iterations > 0)
+    {
+      unsigned int const slot = (n_iterations - 1) % depth;
+
+      delta_f[slot] = residual;
+      delta_f[slot].add(-1.0, residual_last);
+      delta_g[slot] = g;
+      delta_g[slot].add(-1.0, g_last);
+
+      unsigned int const n_active = std::min(n_iterations, depth);
+      for(unsigned int j = 0; j < n_active; ++j)
+      {
+        gram(slot, j) = delta_f[slot] * delta_f[j];
+        gram(j, slot) = gram(slot, j);
+      }
+    }
+
+    residual_last = residual;
+    g_last        = g;
+
+    if(n_iterations > 0)
+    {
+      unsigned int const n_active = std::min(n_iterations, depth);
+
+      dealii::FullMatrix<double> matrix(n_active, n_active);
+      dealii::Vector<double>     rhs(n_active), gamma(n_active);
+
+      double trace = 0.0;
+      for(unsigned int i = 0; i < n_active; ++i)
+      {
+        for(unsigned int j = 0; j < n_active; ++j)
+          matrix(i, j) = gram(i, j);
+        rhs(i) = delta_f[i] * residual;
+        trace += gram(i, i);
+      }
+
+      if(trace > 0.0)
+      {
+        for(unsigned int i = 0; i < n_active; ++i)
+          matrix(i, i) += regularization * trace / n_active;
+
+        matrix.gauss_jordan();
+        matrix.vmult(gamma, rhs);
+
+        for(unsigned int i = 0; i < n_active; ++i)
+          g.add(-gamma(i), delta_g[i]);
+      }
+    }
+
+    ++n_iterations;
+  }
+
+  /*
+   * Discards the history, e.g., if the fixed-point map changes.
+   */
+  void
+  reset()
+  {
+    n_iterations = 0;
+  }
+
+private:
+  static constexpr double regularization = 1.e-10;
+
+  unsigned int const depth;
+
+  unsigned int n_iterations;
+
+  VectorType residual, residual_last, g_last;
+
+  // ring buffers of differences of residuals and of fixed-point map evaluations
+  std::vector<VectorType> delta_f, delta_g;
+
+  dealii::FullMatrix<double> gram;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_ANDERSON_ACCELERATION_H_ */
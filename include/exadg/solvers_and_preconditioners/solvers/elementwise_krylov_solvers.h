@@ -113,6 +113,28 @@ converged(dealii::VectorizedArray<Number> & is_converged,
   return all_true(is_converged);
 }
 
+/*
+ * Masked update: set x to zero for all (vectorization) lanes that have already converged, so that
+ * converged lanes are not modified by subsequent iterations.
+ */
+template<typename Number>
+void
+set_zero_where_converged(Number & x, Number const is_converged)
+{
+  if(is_converged > 0.0)
+    x = 0.0;
+}
+
+template<typename Number>
+void
+set_zero_where_converged(dealii::VectorizedArray<Number> &     x,
+                         dealii::VectorizedArray<Number> const is_converged)
+{
+  for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    if(is_converged[v] > 0.0)
+      x[v] = 0.0;
+}
+
 template<typename Number>
 void
 adjust_division_by_zero(Number &)
@@ -296,6 +318,11 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
 
   unsigned int n_iter = 0;
 
+  // convergence status of each lane of the cell batch (negative values = not converged)
+  value_type is_converged = -one;
+  if(converged(is_converged, norm_r_abs, ABS_TOL, norm_r_rel, REL_TOL, n_iter, MAX_ITER))
+    return;
+
   while(true)
   {
     // v = A*p
@@ -308,6 +335,9 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     // alpha = (r^T*y) / (p^T*v)
     value_type alpha = (r_times_y) / (p_times_v);
 
+    // lanes that have already converged are not updated anymore
+    set_zero_where_converged(alpha, is_converged);
+
     // solution <- solution + alpha*p
     add(solution, alpha, p, M);
 
@@ -321,8 +351,8 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     // increment iteration counter
     ++n_iter;
 
-    // check convergence
-    if(all_smaller(norm_r_abs, ABS_TOL) || all_smaller(norm_r_rel, REL_TOL) || (n_iter > MAX_ITER))
+    // check convergence separately for each lane and stop once all lanes have converged
+    if(converged(is_converged, norm_r_abs, ABS_TOL, norm_r_rel, REL_TOL, n_iter, MAX_ITER))
     {
       break;
     }
@@ -337,6 +367,7 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
 
     // beta = (r^T*y)_new / (r^T*y)
     value_type beta = r_times_y_new / r_times_y;
+    set_zero_where_converged(beta, is_converged);
 
     // p <- y + beta*p
     equ(p, one, v, beta, p, M);
@@ -29,6 +29,7 @@
 #include <deal.II/lac/solver_gmres.h>
 
 // ExaDG
+#include <exadg/utilities/kernel_profiler.h>
 #include <exadg/utilities/timer_tree.h>
 
 namespace ExaDG
@@ -103,6 +104,67 @@ struct SolverDataCG
   bool         compute_performance_metrics;
 };
 
+/*
+ * Wrapper measuring vmult() of the wrapped preconditioner by ScopedOperatorTiming, analogous to the
+ * operators which are measured in OperatorBase::vmult().
+ */
+template<typename Preconditioner>
+class TimedPreconditioner
+{
+public:
+  TimedPreconditioner(Preconditioner const & preconditioner) : preconditioner(preconditioner)
+  {
+  }
+
+  template<typename VectorType>
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    ScopedOperatorTiming operator_timing;
+
+    preconditioner.vmult(dst, src);
+  }
+
+private:
+  Preconditioner const & preconditioner;
+};
+
+/*
+ * Kernel profiling of Krylov solvers: the vector updates and inner products are performed inside
+ * deal.II, so that their wall time is obtained as the time of the solve minus the time spent in
+ * the operator and the preconditioner, see KernelProfiler::get_operator_time(). The operator is
+ * passed to deal.II unchanged. Returns the wall time of the vector updates.
+ */
+template<typename Solver, typename Operator, typename Preconditioner, typename VectorType>
+double
+solve_and_measure_vector_updates(Solver &               solver,
+                                 Operator const &       underlying_operator,
+                                 Preconditioner const & preconditioner,
+                                 bool const             use_preconditioner,
+                                 VectorType &           dst,
+                                 VectorType const &     rhs)
+{
+  auto const   start               = std::chrono::steady_clock::now();
+  double const start_operator_time = KernelProfiler::get_operator_time();
+
+  if(use_preconditioner == false)
+  {
+    solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
+  }
+  else
+  {
+    solver.solve(underlying_operator,
+                 dst,
+                 rhs,
+                 TimedPreconditioner<Preconditioner>(preconditioner));
+  }
+
+  double const wall_time =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  return std::max(wall_time - (KernelProfiler::get_operator_time() - start_operator_time), 0.0);
+}
+
 template<typename Operator, typename Preconditioner, typename VectorType>
 class SolverCG : public SolverBase<VectorType>
 {
@@ -127,17 +189,21 @@ public:
 
     dealii::SolverCG<VectorType> solver(solver_control);
 
-    if(solver_data.use_preconditioner == false)
+    if(solver_data.use_preconditioner == true and update_preconditioner == true)
+    {
+      preconditioner.update();
+    }
+
+    if(KernelProfiler::is_enabled())
+    {
+      solve_profiled(solver, solver_control, dst, rhs);
+    }
+    else if(solver_data.use_preconditioner == false)
     {
       solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
     }
     else
     {
-      if(update_preconditioner == true)
-      {
-        preconditioner.update();
-      }
-
       solver.solve(underlying_operator, dst, rhs, preconditioner);
     }
 
@@ -161,6 +227,31 @@ public:
   }
 
 private:
+  /*
+   * The analytic cost of the vector updates assumes 10 vector reads/writes and 12 floating point
+   * operations per entry and iteration.
+   */
+  void
+  solve_profiled(dealii::SolverCG<VectorType> & solver,
+                 dealii::SolverControl const &  solver_control,
+                 VectorType &                   dst,
+                 VectorType const &             rhs) const
+  {
+    double const wall_time = solve_and_measure_vector_updates(
+      solver, underlying_operator, preconditioner, solver_data.use_preconditioner, dst, rhs);
+
+    double const n_entries    = rhs.locally_owned_elements().n_elements();
+    double const n_iterations = solver_control.last_step();
+    double const entry_size   = sizeof(typename VectorType::value_type);
+
+    KernelProfiler::add("SolverCG::vector_updates",
+                        wall_time,
+                        KernelCost(10.0 * n_iterations * n_entries * entry_size,
+                                   12.0 * n_iterations * n_entries),
+                        0,
+                        0);
+  }
+
   Operator const &   underlying_operator;
   Preconditioner &   preconditioner;
   SolverDataCG const solver_data;
@@ -247,17 +338,21 @@ public:
                                       true);
     }
 
-    if(solver_data.use_preconditioner == false)
+    if(solver_data.use_preconditioner == true and update_preconditioner == true)
+    {
+      preconditioner.update();
+    }
+
+    if(KernelProfiler::is_enabled())
+    {
+      solve_profiled(solver, solver_control, dst, rhs);
+    }
+    else if(solver_data.use_preconditioner == false)
     {
       solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
     }
     else
     {
-      if(update_preconditioner == true)
-      {
-        preconditioner.update();
-      }
-
       solver.solve(this->underlying_operator, dst, rhs, this->preconditioner);
     }
 
@@ -281,6 +376,35 @@ public:
   }
 
 private:
+  /*
+   * The analytic cost of the vector updates assumes classical Gram-Schmidt orthogonalization
+   * against the Krylov basis, i.e., 2 j + 6 vector reads/writes and 4 j + 6 floating point
+   * operations per entry in an iteration with j basis vectors, where j is on average half the
+   * basis size (max_n_tmp_vectors - 2) for long solves.
+   */
+  void
+  solve_profiled(dealii::SolverGMRES<VectorType> & solver,
+                 dealii::SolverControl const &     solver_control,
+                 VectorType &                      dst,
+                 VectorType const &                rhs) const
+  {
+    double const wall_time = solve_and_measure_vector_updates(
+      solver, underlying_operator, preconditioner, solver_data.use_preconditioner, dst, rhs);
+
+    double const n_entries    = rhs.locally_owned_elements().n_elements();
+    double const n_iterations = solver_control.last_step();
+    double const entry_size   = sizeof(typename VectorType::value_type);
+    double const basis_size   = std::max(solver_data.max_n_tmp_vectors, 3u) - 2.0;
+    double const n_basis      = 0.5 * std::min(n_iterations, basis_size);
+
+    KernelProfiler::add("SolverGMRES::vector_updates",
+                        wall_time,
+                        KernelCost((2.0 * n_basis + 6.0) * n_iterations * n_entries * entry_size,
+                                   (4.0 * n_basis + 6.0) * n_iterations * n_entries),
+                        0,
+                        0);
+  }
+
   Operator const &      underlying_operator;
   Preconditioner &      preconditioner;
   SolverDataGMRES const solver_data;
@@ -340,17 +464,21 @@ public:
 
     dealii::SolverFGMRES<VectorType> solver(solver_control, additional_data);
 
-    if(solver_data.use_preconditioner == false)
+    if(solver_data.use_preconditioner == true and update_preconditioner == true)
+    {
+      preconditioner.update();
+    }
+
+    if(KernelProfiler::is_enabled())
+    {
+      solve_profiled(solver, solver_control, dst, rhs);
+    }
+    else if(solver_data.use_preconditioner == false)
     {
       solver.solve(underlying_operator, dst, rhs, dealii::PreconditionIdentity());
     }
     else
     {
-      if(update_preconditioner == true)
-      {
-        preconditioner.update();
-      }
-
       solver.solve(underlying_operator, dst, rhs, preconditioner);
     }
 
@@ -374,6 +502,34 @@ public:
   }
 
 private:
+  /*
+   * The analytic cost of the vector updates is estimated as for SolverGMRES, with one additional
+   * vector read per entry and iteration for the preconditioned vectors stored by FGMRES and the
+   * basis size given by max_n_tmp_vectors.
+   */
+  void
+  solve_profiled(dealii::SolverFGMRES<VectorType> & solver,
+                 dealii::SolverControl const &      solver_control,
+                 VectorType &                       dst,
+                 VectorType const &                 rhs) const
+  {
+    double const wall_time = solve_and_measure_vector_updates(
+      solver, underlying_operator, preconditioner, solver_data.use_preconditioner, dst, rhs);
+
+    double const n_entries    = rhs.locally_owned_elements().n_elements();
+    double const n_iterations = solver_control.last_step();
+    double const entry_size   = sizeof(typename VectorType::value_type);
+    double const basis_size   = solver_data.max_n_tmp_vectors;
+    double const n_basis      = 0.5 * std::min(n_iterations, basis_size);
+
+    KernelProfiler::add("SolverFGMRES::vector_updates",
+                        wall_time,
+                        KernelCost((2.0 * n_basis + 7.0) * n_iterations * n_entries * entry_size,
+                                   (4.0 * n_basis + 6.0) * n_iterations * n_entries),
+                        0,
+                        0);
+  }
+
   Operator const &       underlying_operator;
   Preconditioner &       preconditioner;
   SolverDataFGMRES const solver_data;
@@ -28,6 +28,7 @@
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 #include <exadg/structure/driver.h>
 #include <exadg/utilities/print_solver_results.h>
+#include <exadg/utilities/solver_benchmark.h>
 #include <exadg/utilities/throughput_parameters.h>
 
 namespace ExaDG
@@ -79,6 +80,9 @@ Driver<dim, Number>::setup()
                       matrix_free_data->get_quadrature_vector(),
                       matrix_free_data->data);
 
+  if(not(is_test))
+    print_batch_fill_ratio(pcout, *matrix_free, mpi_comm);
+
   pde_operator->setup(matrix_free, matrix_free_data);
 
   if(!is_throughput_study)
@@ -287,6 +291,62 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
     application->get_parameters().degree, dofs, throughput);
 }
 
+template<int dim, typename Number>
+std::tuple<double, dealii::types::global_dof_index, double, std::vector<double>>
+Driver<dim, Number>::apply_solver(std::string const & solver_type_string,
+                                  unsigned int const  n_repetitions) const
+{
+  AssertThrow(not(is_throughput_study),
+              dealii::ExcMessage("The solver benchmark requires the setup of the solver."));
+
+  AssertThrow(solver_type_string == "Elasticity",
+              dealii::ExcMessage("Unknown solver type " + solver_type_string + "."));
+
+  Parameters const & parameters = application->get_parameters();
+
+  AssertThrow(not(parameters.large_deformation) or parameters.problem_type == ProblemType::Steady,
+              dealii::ExcMessage("The solver benchmark for the nonlinear elasticity problem is "
+                                 "only implemented for steady problems."));
+
+  pcout << std::endl << "Solving (non-)linear system of equations ..." << std::endl;
+
+  dealii::LinearAlgebra::distributed::Vector<Number> rhs, sol;
+  pde_operator->initialize_dof_vector(rhs);
+  pde_operator->initialize_dof_vector(sol);
+
+  std::function<unsigned int(void)> solve;
+
+  if(parameters.large_deformation)
+  {
+    // Newton solver, the number of iterations is the accumulated number of linear iterations
+    solve = [&](void) {
+      pde_operator->prescribe_initial_displacement(sol, 0.0 /* time */);
+      auto const iter = pde_operator->solve_nonlinear(
+        sol, rhs, 0.0 /* no mass term */, 0.0 /* time */, parameters.update_preconditioner);
+      return std::get<1>(iter);
+    };
+  }
+  else
+  {
+    pde_operator->compute_rhs_linear(rhs, 0.0 /* time */);
+
+    solve = [&](void) {
+      sol = 0.0;
+      return pde_operator->solve_linear(sol, rhs, 0.0 /* no mass term */, 0.0 /* time */);
+    };
+  }
+
+  std::tuple<double, double, std::vector<double>> const iterations_and_time =
+    measure_solver_time(solve, n_repetitions, mpi_comm, pde_operator->get_timings_preconditioner());
+
+  pcout << std::endl << " ... done." << std::endl << std::endl;
+
+  return std::make_tuple(std::get<0>(iterations_and_time),
+                         pde_operator->get_number_of_dofs(),
+                         std::get<1>(iterations_and_time),
+                         std::get<2>(iterations_and_time));
+}
+
 template class Driver<2, float>;
 template class Driver<3, float>;
 
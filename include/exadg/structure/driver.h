@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/grid/mapping_dof_vector.h>
+#include <exadg/matrix_free/batch_fill_ratio.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/structure/spatial_discretization/operator.h>
 #include <exadg/structure/time_integration/driver_quasi_static_problems.h>
@@ -112,6 +113,13 @@ public:
                  unsigned int const  n_repetitions_inner,
                  unsigned int const  n_repetitions_outer) const;
 
+  /*
+   * Solver benchmark: returns the average number of iterations, the number of degrees of freedom,
+   * the wall time of one solve, and the wall time per solve spent on each multigrid level.
+   */
+  std::tuple<double, dealii::types::global_dof_index, double, std::vector<double>>
+  apply_solver(std::string const & solver_type_string, unsigned int const n_repetitions) const;
+
 private:
   // MPI communicator
   MPI_Comm mpi_comm;
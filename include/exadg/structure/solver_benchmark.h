@@ -0,0 +1,205 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_STRUCTURE_SOLVER_BENCHMARK_H_
+#define INCLUDE_EXADG_STRUCTURE_SOLVER_BENCHMARK_H_
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/parameter_handler.h>
+
+// ExaDG
+
+// driver
+#include <exadg/structure/driver.h>
+
+// utilities
+#include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/hypercube_resolution_parameters.h>
+#include <exadg/utilities/kernel_profiler.h>
+#include <exadg/utilities/solver_benchmark.h>
+
+// application
+#include <exadg/structure/user_interface/declare_get_application.h>
+
+namespace ExaDG
+{
+void
+create_input_file(std::string const & input_file)
+{
+  dealii::ParameterHandler prm;
+
+  GeneralParameters general;
+  general.add_parameters(prm);
+
+  HypercubeResolutionParameters resolution;
+  resolution.add_parameters(prm);
+
+  SolverBenchmarkParameters benchmark;
+  benchmark.add_parameters(prm);
+
+  try
+  {
+    // we have to assume a default dimension and default Number type
+    // for the automatic generation of a default input file
+    unsigned int const Dim = 2;
+    typedef double     Number;
+    Structure::get_application<Dim, Number>(input_file, MPI_COMM_WORLD)->add_parameters(prm);
+  }
+  catch(...)
+  {
+  }
+
+  prm.print_parameters(input_file,
+                       dealii::ParameterHandler::Short |
+                         dealii::ParameterHandler::KeepDeclarationOrder);
+}
+
+template<int dim, typename Number>
+void
+run(SolverBenchmarkParameters const & benchmark,
+    std::string const &               input_file,
+    unsigned int const                degree,
+    unsigned int const                refine_space,
+    unsigned int const                n_cells_1d,
+    MPI_Comm const &                  mpi_comm,
+    bool const                        is_test)
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  std::shared_ptr<Structure::ApplicationBase<dim, Number>> application =
+    Structure::get_application<dim, Number>(input_file, mpi_comm);
+
+  application->set_parameters_throughput_study(degree, refine_space, n_cells_1d);
+
+  std::shared_ptr<Structure::Driver<dim, Number>> driver =
+    std::make_shared<Structure::Driver<dim, Number>>(mpi_comm, application, is_test, false);
+
+  driver->setup();
+
+  SolverBenchmarkResult result;
+  result.setup_time = dealii::Utilities::MPI::max(timer.wall_time(), mpi_comm);
+
+  std::tuple<double, dealii::types::global_dof_index, double, std::vector<double>> const
+    iterations_dofs_time = driver->apply_solver(benchmark.solver_type, benchmark.n_repetitions);
+
+  result.solver_type     = benchmark.solver_type;
+  result.dim             = dim;
+  result.degree          = degree;
+  result.refine_space    = refine_space;
+  result.n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  result.iterations      = std::get<0>(iterations_dofs_time);
+  result.n_dofs          = std::get<1>(iterations_dofs_time);
+  result.solve_time      = std::get<2>(iterations_dofs_time);
+
+  result.multigrid_level_times = std::get<3>(iterations_dofs_time);
+
+  benchmark.results.push_back(result);
+}
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  MPI_Comm mpi_comm(MPI_COMM_WORLD);
+
+  std::string input_file;
+
+  if(argc == 1)
+  {
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      std::cout << "To run the program, use:      ./solver_benchmark input_file" << std::endl
+                << "To setup the input file, use: ./solver_benchmark input_file --help"
+                << std::endl;
+    }
+
+    return 0;
+  }
+  else if(argc >= 2)
+  {
+    input_file = std::string(argv[1]);
+
+    if(argc == 3 && std::string(argv[2]) == "--help")
+    {
+      if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+        ExaDG::create_input_file(input_file);
+
+      return 0;
+    }
+  }
+
+  ExaDG::GeneralParameters             general(input_file);
+  ExaDG::HypercubeResolutionParameters resolution(input_file, general.dim);
+  ExaDG::SolverBenchmarkParameters     benchmark(input_file);
+
+  ExaDG::KernelProfiler::enable(general.kernel_profiling);
+
+  // fill resolution vector
+  resolution.fill_resolution_vector(&ExaDG::Structure::get_dofs_per_element, input_file);
+
+  // loop over numbers of MPI processes and resolutions and run simulations
+  for(unsigned int const n_ranks : benchmark.get_rank_counts(mpi_comm))
+  {
+    for(auto iter = resolution.resolutions.begin(); iter != resolution.resolutions.end(); ++iter)
+    {
+      unsigned int const degree       = std::get<0>(*iter);
+      unsigned int const refine_space = std::get<1>(*iter);
+      unsigned int const n_cells_1d   = std::get<2>(*iter);
+
+      auto const run = [&](MPI_Comm const & sub_comm) {
+        if(general.dim == 2 && general.precision == "float")
+          ExaDG::run<2, float>(
+            benchmark, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+        else if(general.dim == 2 && general.precision == "double")
+          ExaDG::run<2, double>(
+            benchmark, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+        else if(general.dim == 3 && general.precision == "float")
+          ExaDG::run<3, float>(
+            benchmark, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+        else if(general.dim == 3 && general.precision == "double")
+          ExaDG::run<3, double>(
+            benchmark, input_file, degree, refine_space, n_cells_1d, sub_comm, general.is_test);
+        else
+          AssertThrow(false,
+                      dealii::ExcMessage(
+                        "Only dim = 2|3 and precision = float|double implemented."));
+      };
+
+      benchmark.run_on_sub_communicator(run, n_ranks, mpi_comm);
+    }
+  }
+
+  if(not(general.is_test))
+    benchmark.print_results(mpi_comm);
+
+  benchmark.write_results(mpi_comm);
+
+  ExaDG::KernelProfiler::print_results(mpi_comm);
+
+  return 0;
+}
+
+
+#endif /* INCLUDE_EXADG_STRUCTURE_SOLVER_BENCHMARK_H_ */
@@ -834,6 +834,16 @@ Operator<dim, Number>::get_number_of_dofs() const
   return dof_handler.n_dofs();
 }
 
+template<int dim, typename Number>
+std::shared_ptr<TimerTree>
+Operator<dim, Number>::get_timings_preconditioner() const
+{
+  if(preconditioner.get() != nullptr)
+    return preconditioner->get_timings();
+
+  return nullptr;
+}
+
 template class Operator<2, float>;
 template class Operator<2, double>;
 
@@ -291,6 +291,13 @@ public:
   dealii::types::global_dof_index
   get_number_of_dofs() const;
 
+  /*
+   * Returns the timings of the preconditioner of the linear(ized) problem (used for solver
+   * benchmarks).
+   */
+  std::shared_ptr<TimerTree>
+  get_timings_preconditioner() const;
+
   // Multiphysics coupling via "Cached" boundary conditions
   std::shared_ptr<ContainerInterfaceData<dim, dim, Number>>
   get_container_interface_data_neumann();
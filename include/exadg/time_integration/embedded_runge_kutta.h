@@ -0,0 +1,372 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_EMBEDDED_RUNGE_KUTTA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_EMBEDDED_RUNGE_KUTTA_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+/*
+ *  Explicit Runge-Kutta methods with embedded error estimator. In addition to the solution of
+ *  order p, a solution of order q < p is computed from the same stages, and the difference of
+ *  both solutions serves as an estimate of the local truncation error of the lower-order method
+ *  (the higher-order solution is used to advance in time, local extrapolation).
+ *
+ *  Stage i reads U_i = u_n + dt * sum_{j<i} a(i,j) * k_j with k_i = f(U_i, t_n + c(i) * dt), and
+ *
+ *    u_{n+1} = u_n + dt * sum_i b(i)     * k_i,
+ *    error   =       dt * sum_i (b(i) - b_hat(i)) * k_i.
+ *
+ *  The schemes below have the first-same-as-last (FSAL) property. This property is not
+ *  exploited since the operator may change from one time step to the next (e.g. transported
+ *  velocity fields that are updated after each time step).
+ */
+template<typename Operator, typename VectorType>
+class EmbeddedRungeKuttaTimeIntegrator : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+public:
+  EmbeddedRungeKuttaTimeIntegrator(std::shared_ptr<Operator> const operator_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), order(0), order_embedded(0)
+  {
+  }
+
+  void
+  solve_timestep(VectorType & dst,
+                 VectorType & src,
+                 double const time,
+                 double const time_step) final
+  {
+    unsigned int const n_stages = c.size();
+
+    if(vec_stage.size() != src.size())
+    {
+      vec_k.resize(n_stages);
+      for(auto & k : vec_k)
+        k.reinit(src);
+      vec_stage.reinit(src);
+      vec_error.reinit(src);
+    }
+
+    for(unsigned int i = 0; i < n_stages; ++i)
+    {
+      vec_stage.equ(1.0, src);
+      for(unsigned int j = 0; j < i; ++j)
+      {
+        if(a[i][j] != 0.0)
+          vec_stage.add(time_step * a[i][j], vec_k[j]);
+      }
+
+      this->underlying_operator->evaluate(vec_k[i], vec_stage, time + c[i] * time_step);
+    }
+
+    dst.equ(1.0, src);
+    vec_error = 0.0;
+    for(unsigned int i = 0; i < n_stages; ++i)
+    {
+      if(b[i] != 0.0)
+        dst.add(time_step * b[i], vec_k[i]);
+      if(b[i] != b_hat[i])
+        vec_error.add(time_step * (b[i] - b_hat[i]), vec_k[i]);
+    }
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return order;
+  }
+
+  unsigned int
+  get_order_embedded() const
+  {
+    return order_embedded;
+  }
+
+  /*
+   * Returns the error estimate of the last time step in the root-mean-square norm weighted by
+   * abs_tol + rel_tol * max(|u_n|, |u_{n+1}|) for each degree of freedom. The time step is
+   * acceptable if the returned value is smaller than or equal to 1.
+   */
+  double
+  calculate_error_norm(VectorType const & solution_n,
+                       VectorType const & solution_np,
+                       double const       abs_tol,
+                       double const       rel_tol) const
+  {
+    double error_sum = 0.0;
+    for(unsigned int i = 0; i < vec_error.locally_owned_size(); ++i)
+    {
+      double const scale =
+        abs_tol + rel_tol * std::max(std::abs(static_cast<double>(solution_n.local_element(i))),
+                                     std::abs(static_cast<double>(solution_np.local_element(i))));
+      double const error = vec_error.local_element(i) / scale;
+      error_sum += error * error;
+    }
+
+    error_sum = dealii::Utilities::MPI::sum(error_sum, vec_error.get_mpi_communicator());
+
+    return std::sqrt(error_sum / static_cast<double>(vec_error.size()));
+  }
+
+protected:
+  void
+  resize(unsigned int const n_stages)
+  {
+    c.assign(n_stages, 0.0);
+    b.assign(n_stages, 0.0);
+    b_hat.assign(n_stages, 0.0);
+    a.assign(n_stages, std::vector<double>(n_stages, 0.0));
+  }
+
+  unsigned int order, order_embedded;
+
+  std::vector<std::vector<double>> a;
+  std::vector<double>              b, b_hat, c;
+
+private:
+  std::vector<VectorType> vec_k;
+  VectorType              vec_stage, vec_error;
+};
+
+/*
+ *  Runge-Kutta method of order 3 with embedded method of order 2 (4 stages) according to
+ *
+ *    Bogacki, Shampine, A 3(2) pair of Runge-Kutta formulas, Applied Mathematics Letters (1989)
+ *    2(4):321-325.
+ */
+template<typename Operator, typename VectorType>
+class EmbeddedRK3Stage4BS : public EmbeddedRungeKuttaTimeIntegrator<Operator, VectorType>
+{
+public:
+  EmbeddedRK3Stage4BS(std::shared_ptr<Operator> const operator_in)
+    : EmbeddedRungeKuttaTimeIntegrator<Operator, VectorType>(operator_in)
+  {
+    this->order          = 3;
+    this->order_embedded = 2;
+
+    this->resize(4);
+
+    this->c[1] = 1.0 / 2.0;
+    this->c[2] = 3.0 / 4.0;
+    this->c[3] = 1.0;
+
+    this->a[1][0] = 1.0 / 2.0;
+    this->a[2][1] = 3.0 / 4.0;
+    this->a[3][0] = 2.0 / 9.0;
+    this->a[3][1] = 1.0 / 3.0;
+    this->a[3][2] = 4.0 / 9.0;
+
+    this->b[0] = 2.0 / 9.0;
+    this->b[1] = 1.0 / 3.0;
+    this->b[2] = 4.0 / 9.0;
+
+    this->b_hat[0] = 7.0 / 24.0;
+    this->b_hat[1] = 1.0 / 4.0;
+    this->b_hat[2] = 1.0 / 3.0;
+    this->b_hat[3] = 1.0 / 8.0;
+  }
+};
+
+/*
+ *  Runge-Kutta method of order 5 with embedded method of order 4 (7 stages) according to
+ *
+ *    Dormand, Prince, A family of embedded Runge-Kutta formulae, Journal of Computational and
+ *    Applied Mathematics (1980) 6(1):19-26.
+ */
+template<typename Operator, typename VectorType>
+class EmbeddedRK5Stage7DP : public EmbeddedRungeKuttaTimeIntegrator<Operator, VectorType>
+{
+public:
+  EmbeddedRK5Stage7DP(std::shared_ptr<Operator> const operator_in)
+    : EmbeddedRungeKuttaTimeIntegrator<Operator, VectorType>(operator_in)
+  {
+    this->order          = 5;
+    this->order_embedded = 4;
+
+    this->resize(7);
+
+    this->c[1] = 1.0 / 5.0;
+    this->c[2] = 3.0 / 10.0;
+    this->c[3] = 4.0 / 5.0;
+    this->c[4] = 8.0 / 9.0;
+    this->c[5] = 1.0;
+    this->c[6] = 1.0;
+
+    this->a[1][0] = 1.0 / 5.0;
+    this->a[2][0] = 3.0 / 40.0;
+    this->a[2][1] = 9.0 / 40.0;
+    this->a[3][0] = 44.0 / 45.0;
+    this->a[3][1] = -56.0 / 15.0;
+    this->a[3][2] = 32.0 / 9.0;
+    this->a[4][0] = 19372.0 / 6561.0;
+    this->a[4][1] = -25360.0 / 2187.0;
+    this->a[4][2] = 64448.0 / 6561.0;
+    this->a[4][3] = -212.0 / 729.0;
+    this->a[5][0] = 9017.0 / 3168.0;
+    this->a[5][1] = -355.0 / 33.0;
+    this->a[5][2] = 46732.0 / 5247.0;
+    this->a[5][3] = 49.0 / 176.0;
+    this->a[5][4] = -5103.0 / 18656.0;
+    this->a[6][0] = 35.0 / 384.0;
+    this->a[6][2] = 500.0 / 1113.0;
+    this->a[6][3] = 125.0 / 192.0;
+    this->a[6][4] = -2187.0 / 6784.0;
+    this->a[6][5] = 11.0 / 84.0;
+
+    this->b[0] = 35.0 / 384.0;
+    this->b[2] = 500.0 / 1113.0;
+    this->b[3] = 125.0 / 192.0;
+    this->b[4] = -2187.0 / 6784.0;
+    this->b[5] = 11.0 / 84.0;
+
+    this->b_hat[0] = 5179.0 / 57600.0;
+    this->b_hat[2] = 7571.0 / 16695.0;
+    this->b_hat[3] = 393.0 / 640.0;
+    this->b_hat[4] = -92097.0 / 339200.0;
+    this->b_hat[5] = 187.0 / 2100.0;
+    this->b_hat[6] = 1.0 / 40.0;
+  }
+};
+
+/*
+ *  Proportional-integral (PI) step size controller according to
+ *
+ *    Hairer, Wanner, Solving Ordinary Differential Equations II, Section IV.2, Springer (1996),
+ *
+ *  i.e., dt_new = dt * safety * err_n^(-alpha) * err_{n-1}^(beta) with alpha = 0.7/k and
+ *  beta = 0.4/k, where k = q+1 for an embedded method of order q and err denotes the weighted
+ *  error norm (err <= 1 means that the tolerance is met). After a rejected step, the step size is
+ *  reduced according to the error of the rejected step and it is not allowed to increase in the
+ *  subsequent step.
+ */
+class PIStepSizeController
+{
+public:
+  PIStepSizeController(unsigned int const order_embedded,
+                       double const       safety_factor_in = 0.9,
+                       double const       min_factor_in    = 0.2,
+                       double const       max_factor_in    = 5.0)
+    : exponent(1.0 / (order_embedded + 1.0)),
+      alpha(0.7 * exponent),
+      beta(0.4 * exponent),
+      safety_factor(safety_factor_in),
+      min_factor(min_factor_in),
+      max_factor(max_factor_in),
+      error_last_accepted(1.0),
+      last_step_rejected(false)
+  {
+  }
+
+  /*
+   * Returns whether the time step with error norm error and step size time_step is accepted,
+   * and the step size to be used for the next step (or the repetition of a rejected step).
+   */
+  bool
+  evaluate(double const error, double const time_step, double & time_step_new)
+  {
+    // avoid division by zero for exact solutions
+    double const err = std::max(error, 1.e-10);
+
+    bool const accept = (err <= 1.0);
+
+    double factor = 1.0;
+    if(accept)
+    {
+      factor = safety_factor * std::pow(err, -alpha) * std::pow(error_last_accepted, beta);
+      factor = std::min(last_step_rejected ? 1.0 : max_factor, std::max(min_factor, factor));
+
+      error_last_accepted = err;
+    }
+    else
+    {
+      factor = safety_factor * std::pow(err, -exponent);
+      factor = std::min(1.0, std::max(min_factor, factor));
+    }
+
+    last_step_rejected = not accept;
+    time_step_new      = time_step * factor;
+
+    return accept;
+  }
+
+private:
+  double const exponent, alpha, beta;
+  double const safety_factor, min_factor, max_factor;
+
+  double error_last_accepted;
+  bool   last_step_rejected;
+};
+
+/*
+ *  Performs one time step with error control: The time step is repeated with reduced step size
+ *  until the error estimate meets the tolerance. On return, time_step contains the step size
+ *  actually used and time_step_next the step size proposed for the next time step. Returns the
+ *  number of rejected steps.
+ */
+template<typename Operator, typename VectorType>
+unsigned int
+solve_timestep_error_controlled(
+  EmbeddedRungeKuttaTimeIntegrator<Operator, VectorType> & integrator,
+  PIStepSizeController &                                   controller,
+  VectorType &                                             dst,
+  VectorType &                                             src,
+  double const                                             time,
+  double &                                                 time_step,
+  double &                                                 time_step_next,
+  double const                                             abs_tol,
+  double const                                             rel_tol,
+  unsigned int const                                       max_rejections = 50)
+{
+  unsigned int n_rejected = 0;
+
+  while(true)
+  {
+    integrator.solve_timestep(dst, src, time, time_step);
+
+    double const error = integrator.calculate_error_norm(src, dst, abs_tol, rel_tol);
+
+    if(controller.evaluate(error, time_step, time_step_next))
+      break;
+
+    ++n_rejected;
+    AssertThrow(n_rejected <= max_rejections,
+                dealii::ExcMessage("Error-controlled time stepping: too many rejected steps."));
+
+    time_step = time_step_next;
+  }
+
+  return n_rejected;
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_EMBEDDED_RUNGE_KUTTA_H_ */
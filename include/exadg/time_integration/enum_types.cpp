@@ -75,4 +75,28 @@ enum_to_string(GenAlphaType const enum_type)
   return string_type;
 }
 
+std::string
+enum_to_string(IMEXRKType const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case IMEXRKType::ARS111:
+      string_type = "ARS111";
+      break;
+    case IMEXRKType::ARS222:
+      string_type = "ARS222";
+      break;
+    case IMEXRKType::ARS443:
+      string_type = "ARS443";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+
 } // namespace ExaDG
@@ -47,6 +47,21 @@ enum class GenAlphaType
 std::string
 enum_to_string(GenAlphaType const enum_type);
 
+/*
+ * Additive implicit-explicit (IMEX) Runge-Kutta schemes according to Ascher, Ruuth, Spiteri
+ * (1997). ARS(s,sigma,p) denotes a scheme with s implicit stages, sigma explicit stages, and
+ * order p.
+ */
+enum class IMEXRKType
+{
+  ARS111,
+  ARS222,
+  ARS443
+};
+
+std::string
+enum_to_string(IMEXRKType const enum_type);
+
 } // namespace ExaDG
 
 #endif /* INCLUDE_EXADG_TIME_INTEGRATION_ENUM_TYPES_H_ */
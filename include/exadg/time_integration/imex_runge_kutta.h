@@ -0,0 +1,192 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_
+
+// C/C++
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/time_integration/enum_types.h>
+
+namespace ExaDG
+{
+/*
+ *  Butcher tableaus of additive implicit-explicit Runge-Kutta schemes according to
+ *
+ *    Ascher, Ruuth, Spiteri, Implicit-explicit Runge-Kutta methods for time-dependent partial
+ *    differential equations, Applied Numerical Mathematics (1997) 25:151-167.
+ *
+ *  The schemes have s+1 stages. The first stage is explicit, i.e., U_0 = u_n, and the first
+ *  column of the implicit tableau vanishes so that the implicit operator never has to be
+ *  evaluated at u_n. The implicit stages i = 1, ..., s share the same diagonal coefficient
+ *  gamma (singly diagonally implicit), so that all stages solve a linear system with the same
+ *  operator. All schemes are stiffly accurate, i.e., u_{n+1} = U_s.
+ *
+ *  Stage i of the time step t_n -> t_{n+1} = t_n + dt reads
+ *
+ *    U_i = u_n + dt * sum_{j<i}  a_expl(i,j) * f_expl(U_j)
+ *              + dt * sum_{j<=i} a_impl(i,j) * f_impl(U_j)
+ *
+ *  at time t_n + c(i) * dt.
+ */
+class IMEXRungeKuttaTableau
+{
+public:
+  IMEXRungeKuttaTableau(IMEXRKType const type)
+  {
+    if(type == IMEXRKType::ARS111)
+    {
+      // forward-backward Euler
+      order = 1;
+      resize(2);
+
+      c[1] = 1.0;
+
+      a_expl[1][0] = 1.0;
+
+      a_impl[1][1] = 1.0;
+    }
+    else if(type == IMEXRKType::ARS222)
+    {
+      order = 2;
+      resize(3);
+
+      double const gamma = 1.0 - 1.0 / std::sqrt(2.0);
+      double const delta = 1.0 - 1.0 / (2.0 * gamma);
+
+      c[1] = gamma;
+      c[2] = 1.0;
+
+      a_expl[1][0] = gamma;
+      a_expl[2][0] = delta;
+      a_expl[2][1] = 1.0 - delta;
+
+      a_impl[1][1] = gamma;
+      a_impl[2][1] = 1.0 - gamma;
+      a_impl[2][2] = gamma;
+    }
+    else if(type == IMEXRKType::ARS443)
+    {
+      order = 3;
+      resize(5);
+
+      c[1] = 1.0 / 2.0;
+      c[2] = 2.0 / 3.0;
+      c[3] = 1.0 / 2.0;
+      c[4] = 1.0;
+
+      a_expl[1][0] = 1.0 / 2.0;
+      a_expl[2][0] = 11.0 / 18.0;
+      a_expl[2][1] = 1.0 / 18.0;
+      a_expl[3][0] = 5.0 / 6.0;
+      a_expl[3][1] = -5.0 / 6.0;
+      a_expl[3][2] = 1.0 / 2.0;
+      a_expl[4][0] = 1.0 / 4.0;
+      a_expl[4][1] = 7.0 / 4.0;
+      a_expl[4][2] = 3.0 / 4.0;
+      a_expl[4][3] = -7.0 / 4.0;
+
+      a_impl[1][1] = 1.0 / 2.0;
+      a_impl[2][1] = 1.0 / 6.0;
+      a_impl[2][2] = 1.0 / 2.0;
+      a_impl[3][1] = -1.0 / 2.0;
+      a_impl[3][2] = 1.0 / 2.0;
+      a_impl[3][3] = 1.0 / 2.0;
+      a_impl[4][1] = 3.0 / 2.0;
+      a_impl[4][2] = -3.0 / 2.0;
+      a_impl[4][3] = 1.0 / 2.0;
+      a_impl[4][4] = 1.0 / 2.0;
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+    }
+
+    for(unsigned int i = 1; i < c.size(); ++i)
+    {
+      AssertThrow(std::abs(a_impl[i][i] - a_impl[1][1]) < 1.e-12,
+                  dealii::ExcMessage("Implicit stages must have the same diagonal coefficient."));
+    }
+  }
+
+  unsigned int
+  get_order() const
+  {
+    return order;
+  }
+
+  // total number of stages including the explicit first stage
+  unsigned int
+  get_n_stages() const
+  {
+    return c.size();
+  }
+
+  // diagonal coefficient of the implicit stages
+  double
+  get_gamma() const
+  {
+    return a_impl[1][1];
+  }
+
+  double
+  get_c(unsigned int const i) const
+  {
+    return c[i];
+  }
+
+  double
+  get_a_expl(unsigned int const i, unsigned int const j) const
+  {
+    return a_expl[i][j];
+  }
+
+  double
+  get_a_impl(unsigned int const i, unsigned int const j) const
+  {
+    return a_impl[i][j];
+  }
+
+private:
+  void
+  resize(unsigned int const n_stages)
+  {
+    c.resize(n_stages, 0.0);
+    a_expl.resize(n_stages, std::vector<double>(n_stages, 0.0));
+    a_impl.resize(n_stages, std::vector<double>(n_stages, 0.0));
+  }
+
+  unsigned int order;
+
+  std::vector<double>              c;
+  std::vector<std::vector<double>> a_expl;
+  std::vector<std::vector<double>> a_impl;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_ */
@@ -0,0 +1,259 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_
+
+// C/C++
+#include <functional>
+#include <memory>
+#include <vector>
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+/*
+ *  Local (multirate) time stepping for explicit Runge-Kutta methods.
+ *
+ *  The cells are grouped into time step levels l = 0, ..., L-1, where level l is advanced with
+ *  time step size dt / 2^l. One time step of level l consists of one Runge-Kutta step on level l
+ *  followed (recursively) by two time steps of level l+1. The underlying operator has to provide
+ *  an evaluation restricted to a time step level, i.e., cell integrals of the cells on the level
+ *  and face integrals of all faces whose finer adjacent cell is on the level (see
+ *  TimeStepLevels). The result has to be multiplied by the inverse mass matrix on the degrees of
+ *  freedom of the level only, while the contributions to the degrees of freedom of coarser cells
+ *  remain in weak form.
+ *
+ *  Interface treatment: The flux over a face between two levels is evaluated with the stage
+ *  states of the finer level, where the solution on the coarser side is obtained by linear
+ *  interpolation in time between the start value of the current coarse time step and the value
+ *  predicted by the Runge-Kutta step of the coarse level. The time integral of this flux is
+ *  accumulated for the coarser degrees of freedom and added (after multiplication with the
+ *  inverse mass matrix) once the coarse time step is complete. Hence, both sides of a face see
+ *  exactly the same flux and the scheme is conservative. Note that the temporal accuracy at level
+ *  interfaces is limited by the linear interpolation in time.
+ *
+ *  Operator needs to provide the functions
+ *
+ *    evaluate_time_step_level(dst, src, time, level),
+ *    apply_inverse_mass_operator_time_step_level(dst, level),
+ *    get_n_time_step_levels(),
+ *    get_time_step_level_dof_indices(level),
+ *    initialize_dof_vector(vector).
+ */
+template<typename Operator, typename VectorType>
+class LocalTimeSteppingIntegrator : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+private:
+  typedef typename VectorType::value_type Number;
+
+  typedef LocalTimeSteppingIntegrator<Operator, VectorType> This;
+
+public:
+  /*
+   * Operator seen by the Runge-Kutta method of a single time step level: only the degrees of
+   * freedom of the level are taken from the Runge-Kutta stage vector.
+   */
+  class LevelOperator
+  {
+  public:
+    LevelOperator(This const & integrator_in, unsigned int const level_in)
+      : integrator(integrator_in), level(level_in)
+    {
+      integrator.underlying_operator->initialize_dof_vector(stage_vector);
+    }
+
+    void
+    evaluate(VectorType & dst, VectorType const & src, double const time) const
+    {
+      integrator.fill_stage_vector(stage_vector, src, time, level);
+
+      integrator.underlying_operator->evaluate_time_step_level(dst, stage_vector, time, level);
+    }
+
+    void
+    initialize_dof_vector(VectorType & src) const
+    {
+      integrator.underlying_operator->initialize_dof_vector(src);
+    }
+
+  private:
+    This const & integrator;
+
+    unsigned int const level;
+
+    VectorType mutable stage_vector;
+  };
+
+  typedef std::function<std::shared_ptr<ExplicitTimeIntegrator<LevelOperator, VectorType>>(
+    std::shared_ptr<LevelOperator>)>
+    CreateIntegrator;
+
+  /*
+   * The function create_integrator creates the Runge-Kutta method used on each time step level.
+   */
+  LocalTimeSteppingIntegrator(std::shared_ptr<Operator> const operator_in,
+                              CreateIntegrator const &        create_integrator)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in),
+      n_levels(operator_in->get_n_time_step_levels())
+  {
+    for(unsigned int level = 0; level < n_levels; ++level)
+    {
+      level_integrators.push_back(
+        create_integrator(std::make_shared<LevelOperator>(*this, level)));
+    }
+
+    solution_start.resize(n_levels);
+    time_start.resize(n_levels, 0.0);
+    time_step_level.resize(n_levels, 0.0);
+
+    this->underlying_operator->initialize_dof_vector(solution);
+    this->underlying_operator->initialize_dof_vector(flux_accumulator);
+    this->underlying_operator->initialize_dof_vector(level_src);
+    this->underlying_operator->initialize_dof_vector(level_dst);
+  }
+
+  /*
+   * Performs one time step of the coarsest level 0 with time step size time_step.
+   */
+  void
+  solve_timestep(VectorType & dst,
+                 VectorType & src,
+                 double const time,
+                 double const time_step) final
+  {
+    solution.copy_locally_owned_data_from(src);
+    flux_accumulator = 0.0;
+
+    advance_level(0, time, time_step);
+
+    dst.copy_locally_owned_data_from(solution);
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return level_integrators[0]->get_order();
+  }
+
+private:
+  void
+  advance_level(unsigned int const level, double const time, double const time_step)
+  {
+    std::vector<unsigned int> const & indices =
+      this->underlying_operator->get_time_step_level_dof_indices(level);
+
+    // store start value for time interpolation on finer levels
+    solution_start[level].resize(indices.size());
+    for(unsigned int i = 0; i < indices.size(); ++i)
+      solution_start[level][i] = solution.local_element(indices[i]);
+    time_start[level]      = time;
+    time_step_level[level] = time_step;
+
+    // Runge-Kutta step on the current level (cells and faces of the current level)
+    level_src = 0.0;
+    for(unsigned int const index : indices)
+      level_src.local_element(index) = solution.local_element(index);
+
+    level_integrators[level]->solve_timestep(level_dst, level_src, time, time_step);
+
+    for(unsigned int const index : indices)
+      solution.local_element(index) = level_dst.local_element(index);
+
+    // For the degrees of freedom of coarser levels, level_dst contains the time integral (in weak
+    // form) of the fluxes over the faces between these levels and the current level.
+    for(unsigned int coarser = 0; coarser < level; ++coarser)
+    {
+      for(unsigned int const index :
+          this->underlying_operator->get_time_step_level_dof_indices(coarser))
+        flux_accumulator.local_element(index) += level_dst.local_element(index);
+    }
+
+    if(level + 1 < n_levels)
+    {
+      advance_level(level + 1, time, time_step / 2.0);
+      advance_level(level + 1, time + time_step / 2.0, time_step / 2.0);
+
+      // add fluxes over faces between the current level and finer levels
+      this->underlying_operator->apply_inverse_mass_operator_time_step_level(flux_accumulator,
+                                                                            level);
+      for(unsigned int const index : indices)
+      {
+        solution.local_element(index) += flux_accumulator.local_element(index);
+        flux_accumulator.local_element(index) = 0.0;
+      }
+    }
+  }
+
+  /*
+   * Stage vector of level: src on the current level, linear interpolation in time on coarser
+   * levels, and the current solution on finer levels (not accessed by the operator).
+   */
+  void
+  fill_stage_vector(VectorType &       stage_vector,
+                    VectorType const & src,
+                    double const       time,
+                    unsigned int const level) const
+  {
+    stage_vector.copy_locally_owned_data_from(solution);
+
+    for(unsigned int const index :
+        this->underlying_operator->get_time_step_level_dof_indices(level))
+      stage_vector.local_element(index) = src.local_element(index);
+
+    for(unsigned int coarser = 0; coarser < level; ++coarser)
+    {
+      std::vector<unsigned int> const & indices =
+        this->underlying_operator->get_time_step_level_dof_indices(coarser);
+
+      Number const factor = (time - time_start[coarser]) / time_step_level[coarser];
+      for(unsigned int i = 0; i < indices.size(); ++i)
+        stage_vector.local_element(indices[i]) =
+          solution_start[coarser][i] +
+          factor * (solution.local_element(indices[i]) - solution_start[coarser][i]);
+    }
+  }
+
+  unsigned int const n_levels;
+
+  std::vector<std::shared_ptr<ExplicitTimeIntegrator<LevelOperator, VectorType>>>
+    level_integrators;
+
+  // current solution: levels that have already completed the Runge-Kutta step of their current
+  // time step contain the predicted value at the end of that time step
+  VectorType solution;
+
+  // start values and times of the current time step of each level
+  std::vector<std::vector<Number>> solution_start;
+  std::vector<double>              time_start;
+  std::vector<double>              time_step_level;
+
+  // time integral of the fluxes over level interfaces for the coarser degrees of freedom
+  VectorType flux_accumulator;
+
+  VectorType level_src, level_dst;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_ */
@@ -0,0 +1,307 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_
+
+// C/C++
+#include <algorithm>
+#include <functional>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+struct PararealParameters
+{
+  PararealParameters()
+  {
+  }
+
+  PararealParameters(std::string const & input_file)
+  {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    // clang-format off
+    prm.enter_subsection("Parareal");
+      prm.add_parameter("TimeSlabs",
+                        n_time_slabs,
+                        "Number of time slabs solved in parallel (1 = sequential time stepping).",
+                        dealii::Patterns::Integer(1,100000),
+                        false);
+      prm.add_parameter("CoarseningFactor",
+                        coarsening_factor,
+                        "Ratio of the time step sizes of coarse and fine propagator.",
+                        dealii::Patterns::Integer(1,100000),
+                        false);
+      prm.add_parameter("MaxIterations",
+                        max_iterations,
+                        "Maximum number of Parareal iterations.",
+                        dealii::Patterns::Integer(1,100000),
+                        false);
+      prm.add_parameter("Tolerance",
+                        tolerance,
+                        "Relative tolerance of the change of the solution at the slab boundaries.",
+                        dealii::Patterns::Double(0.0,1.0),
+                        false);
+    prm.leave_subsection();
+    // clang-format on
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    pcout << std::endl << "Parareal:" << std::endl;
+
+    print_parameter(pcout, "Number of time slabs", n_time_slabs);
+    print_parameter(pcout, "Coarsening factor", coarsening_factor);
+    print_parameter(pcout, "Maximum number of iterations", max_iterations);
+    print_parameter(pcout, "Tolerance", tolerance);
+  }
+
+  unsigned int n_time_slabs = 1;
+
+  unsigned int coarsening_factor = 10;
+
+  unsigned int max_iterations = 10;
+
+  double tolerance = 1.e-8;
+};
+
+/*
+ * Splits mpi_comm into n_time_slabs groups of consecutive processes (slab_comm), each of which
+ * solves the problem in space on one time slab, and into communicators connecting the processes
+ * of equal rank within their group (time_comm), where the rank in time_comm is the index of the
+ * time slab. Since all groups use the same number of processes, the parallel layout of the DoF
+ * vectors is identical on all time slabs.
+ */
+inline void
+split_communicator_time_slabs(MPI_Comm const &   mpi_comm,
+                              unsigned int const n_time_slabs,
+                              MPI_Comm &         slab_comm,
+                              MPI_Comm &         time_comm)
+{
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  AssertThrow(n_time_slabs >= 1 and n_ranks % n_time_slabs == 0,
+              dealii::ExcMessage("The number of MPI processes has to be a multiple of the "
+                                 "number of time slabs."));
+
+  unsigned int const n_ranks_per_slab = n_ranks / n_time_slabs;
+
+  int ierr = MPI_Comm_split(mpi_comm, rank / n_ranks_per_slab, rank, &slab_comm);
+  AssertThrowMPI(ierr);
+
+  ierr = MPI_Comm_split(mpi_comm, rank % n_ranks_per_slab, rank, &time_comm);
+  AssertThrowMPI(ierr);
+}
+
+/*
+ * Parareal algorithm: the time interval [start_time, end_time] is decomposed into time slabs
+ * [T_n, T_n+1], n = 0, ..., N-1, one per rank of time_comm. Given a cheap coarse propagator G and
+ * an accurate fine propagator F, the values at the slab boundaries are iterated as
+ *
+ *   U_n+1^(k+1) = G(U_n^(k+1)) + F(U_n^k) - G(U_n^k),
+ *
+ * where the fine propagations of all slabs are independent and run in parallel, and only the
+ * coarse propagations form a sequential sweep over the slabs. After k iterations, the solution on
+ * the first k slabs equals the result of sequential fine time stepping. The iteration is stopped
+ * once the change of the values at the slab boundaries is below the relative tolerance.
+ *
+ * The propagators advance the given vector from the first to the second time argument.
+ */
+template<typename VectorType>
+class Parareal
+{
+private:
+  typedef typename VectorType::value_type Number;
+
+  typedef std::function<void(VectorType &, double const, double const)> Propagator;
+
+public:
+  Parareal(MPI_Comm const & time_comm, PararealParameters const & parameters)
+    : time_comm(time_comm),
+      parameters(parameters),
+      slab(dealii::Utilities::MPI::this_mpi_process(time_comm)),
+      n_slabs(dealii::Utilities::MPI::n_mpi_processes(time_comm)),
+      n_iterations(0),
+      converged(false)
+  {
+  }
+
+  /*
+   * On input, solution is the initial condition at start_time (only used on the first time
+   * slab). On output, solution is the solution at the end of the time slab of this process.
+   */
+  void
+  solve(VectorType &       solution,
+        double const       start_time,
+        double const       end_time,
+        Propagator const & fine,
+        Propagator const & coarse)
+  {
+    double const slab_start = get_slab_start_time(start_time, end_time, slab);
+    double const slab_end   = get_slab_start_time(start_time, end_time, slab + 1);
+
+    // start value of the time slab, coarse and fine solution at the end of the time slab
+    VectorType u_start(solution), g_end(solution), f_end(solution);
+
+    // initial coarse sweep
+    receive(u_start);
+    g_end = u_start;
+    coarse(g_end, slab_start, slab_end);
+    solution = g_end;
+    send(solution);
+
+    n_iterations = 0;
+    converged    = false;
+
+    while(not(converged) and n_iterations < parameters.max_iterations)
+    {
+      // fine propagation in parallel
+      f_end = u_start;
+      fine(f_end, slab_start, slab_end);
+
+      // correction sweep: U_n+1 = G(U_n) + F(U_n^old) - G(U_n^old)
+      f_end.add(-1.0, g_end);
+      receive(u_start);
+      g_end = u_start;
+      coarse(g_end, slab_start, slab_end);
+
+      VectorType & update = f_end;
+      update.add(1.0, g_end);
+      update.add(-1.0, solution);
+      solution.add(1.0, update);
+      send(solution);
+
+      ++n_iterations;
+
+      double const change = dealii::Utilities::MPI::max(update.l2_norm(), time_comm);
+      double const norm   = dealii::Utilities::MPI::max(solution.l2_norm(), time_comm);
+
+      // after n_slabs iterations, the solution equals the sequential fine solution
+      converged = (change <= parameters.tolerance * norm) or (n_iterations >= n_slabs);
+    }
+  }
+
+  unsigned int
+  get_number_of_iterations() const
+  {
+    return n_iterations;
+  }
+
+  /*
+   * Returns false if solve() stopped because the maximum number of iterations was reached before
+   * the tolerance was met (or before the solution was exact after n_slabs iterations).
+   */
+  bool
+  has_converged() const
+  {
+    return converged;
+  }
+
+  unsigned int
+  get_time_slab() const
+  {
+    return slab;
+  }
+
+  unsigned int
+  get_number_of_time_slabs() const
+  {
+    return n_slabs;
+  }
+
+  double
+  get_slab_start_time(double const start_time, double const end_time, unsigned int const n) const
+  {
+    return start_time + (end_time - start_time) * double(n) / double(n_slabs);
+  }
+
+private:
+  /*
+   * Receives the start value of this time slab from the previous time slab. On the first time
+   * slab, the start value (initial condition) remains unchanged.
+   */
+  void
+  receive(VectorType & vector) const
+  {
+    if(slab > 0)
+    {
+      int const ierr = MPI_Recv(vector.begin(),
+                                vector.locally_owned_size() * sizeof(Number),
+                                MPI_BYTE,
+                                slab - 1,
+                                mpi_tag,
+                                time_comm,
+                                MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+    }
+  }
+
+  /*
+   * Sends the solution at the end of this time slab to the next time slab.
+   */
+  void
+  send(VectorType const & vector) const
+  {
+    if(slab + 1 < n_slabs)
+    {
+      int const ierr = MPI_Send(vector.begin(),
+                                vector.locally_owned_size() * sizeof(Number),
+                                MPI_BYTE,
+                                slab + 1,
+                                mpi_tag,
+                                time_comm);
+      AssertThrowMPI(ierr);
+    }
+  }
+
+  static constexpr int mpi_tag = 4711;
+
+  MPI_Comm const time_comm;
+
+  PararealParameters const parameters;
+
+  unsigned int const slab;
+  unsigned int const n_slabs;
+
+  unsigned int n_iterations;
+  bool         converged;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_PARAREAL_H_ */
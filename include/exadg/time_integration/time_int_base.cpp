@@ -44,6 +44,12 @@ TimeIntBase::TimeIntBase(double const &      start_time_,
 {
 }
 
+void
+TimeIntBase::set_print_output(bool const print_output)
+{
+  pcout.set_condition(print_output and dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+}
+
 bool
 TimeIntBase::started() const
 {
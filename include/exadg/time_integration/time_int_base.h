@@ -55,6 +55,13 @@ public:
   {
   }
 
+  /*
+   * Output to pcout is written on the first process of the communicator if print_output is true
+   * (default), e.g., to print on one time slab only for parallel-in-time simulations.
+   */
+  void
+  set_print_output(bool const print_output);
+
   /*
    * Setup of time integration scheme.
    */
@@ -56,6 +56,32 @@ TimeIntExplRKBase<Number>::set_current_time_step_size(double const & time_step_s
   time_step = time_step_size;
 }
 
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::propagate(VectorType &       solution,
+                                     double const       start_time_in,
+                                     double const       end_time_in,
+                                     unsigned int const n_time_steps)
+{
+  AssertThrow(adaptive_time_stepping == false,
+              dealii::ExcMessage("Adaptive time stepping can not be used for propagation over a "
+                                 "prescribed number of time steps."));
+  AssertThrow(n_time_steps >= 1, dealii::ExcMessage("Invalid number of time steps."));
+
+  this->start_time       = start_time_in;
+  this->end_time         = end_time_in;
+  this->time             = start_time_in;
+  this->time_step_number = 1;
+  this->time_step        = (end_time_in - start_time_in) / double(n_time_steps);
+
+  solution_n = solution;
+
+  for(unsigned int i = 0; i < n_time_steps; ++i)
+    do_timestep();
+
+  solution = solution_n;
+}
+
 template<typename Number>
 void
 TimeIntExplRKBase<Number>::setup(bool const do_restart)
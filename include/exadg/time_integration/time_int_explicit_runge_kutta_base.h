@@ -53,6 +53,18 @@ public:
   void
   set_current_time_step_size(double const & time_step_size) final;
 
+  /*
+   * Propagator for parallel-in-time methods: advances solution from start_time_in to end_time_in
+   * with n_time_steps time steps of constant size. Postprocessing is not performed. Only
+   * one-step methods can be restarted from a given solution at arbitrary times, which is why this
+   * function is provided for Runge-Kutta methods only.
+   */
+  void
+  propagate(VectorType &       solution,
+            double const       start_time_in,
+            double const       end_time_in,
+            unsigned int const n_time_steps);
+
 protected:
   // solution vectors
   VectorType solution_n, solution_np;
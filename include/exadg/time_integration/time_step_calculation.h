@@ -164,6 +164,131 @@ calculate_const_time_step_diff(double const       diffusivity,
   return time_step;
 }
 
+/*
+ * Calculate time step size according to local CFL criterion in a single quadrature point, where
+ * u_x is the (relative) velocity and invJ the inverse Jacobian of the mapping in this point. The
+ * computed time step size corresponds to CFL = 1.0.
+ */
+template<int dim, typename value_type>
+inline dealii::VectorizedArray<value_type>
+calculate_time_step_cfl_local_point(
+  dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> const & u_x,
+  dealii::Tensor<2, dim, dealii::VectorizedArray<value_type>> const & invJ,
+  double const                                                        cfl_p,
+  CFLConditionType const                                              cfl_condition_type)
+{
+  dealii::VectorizedArray<value_type> delta_t =
+    dealii::make_vectorized_array<value_type>(std::numeric_limits<value_type>::max());
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> const ut_xi = transpose(invJ) * u_x;
+
+  if(cfl_condition_type == CFLConditionType::VelocityNorm)
+  {
+    delta_t = std::min(delta_t, cfl_p / ut_xi.norm());
+  }
+  else if(cfl_condition_type == CFLConditionType::VelocityComponents)
+  {
+    for(unsigned int d = 0; d < dim; ++d)
+      delta_t = std::min(delta_t, cfl_p / (std::abs(ut_xi[d])));
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+
+  return delta_t;
+}
+
+/*
+ * Finds the minimum of the local time step sizes over all processors and cuts the result after 4
+ * digits of accuracy.
+ */
+inline double
+reduce_time_step_cfl_local(double const local_time_step, MPI_Comm const & mpi_comm)
+{
+  // find minimum over all processors
+  double new_time_step = dealii::Utilities::MPI::min(local_time_step, mpi_comm);
+
+  // Cut time step size after, e.g., 4 digits of accuracy in order to make sure that there is no
+  // drift in the time step size depending on the number of processors when using adaptive time
+  // stepping. This effect can occur since the velocity field and the time step size are coupled
+  // (there is some form of feedback loop in case of adaptive time stepping, i.e., a minor change
+  // in the time step size due to round-off errors implies that the velocity field is evaluated
+  // at a slightly different time in the next time step and so on). This way, it can be ensured
+  // that the sequence of time step sizes is exactly reproducible with the results being
+  // independent of the number of processors, which is important for code verification in a
+  // parallel setting.
+  new_time_step = dealii::Utilities::truncate_to_n_digits(new_time_step, 4);
+
+  return new_time_step;
+}
+
+/*
+ * Accumulates the time step size according to the local CFL criterion (CFL = 1.0) over the
+ * quadrature points visited by a matrix-free cell loop. Operators that evaluate the velocity in
+ * the quadrature points anyway (e.g. convective operators) use this class to provide the time step
+ * size as a by-product of the operator evaluation, avoiding a separate loop over all cells.
+ */
+template<int dim, typename value_type>
+class TimeStepCalculatorCFL
+{
+public:
+  TimeStepCalculatorCFL()
+    : active(false), cfl_p(1.0), cfl_condition_type(CFLConditionType::VelocityNorm)
+  {
+  }
+
+  void
+  start(unsigned int const     degree,
+        double const           exponent_fe_degree,
+        CFLConditionType const cfl_condition_type_in)
+  {
+    active             = true;
+    cfl_p              = 1.0 / pow(degree, exponent_fe_degree);
+    cfl_condition_type = cfl_condition_type_in;
+    time_step = dealii::make_vectorized_array<value_type>(std::numeric_limits<value_type>::max());
+  }
+
+  bool
+  is_active() const
+  {
+    return active;
+  }
+
+  inline DEAL_II_ALWAYS_INLINE //
+    void
+    submit(dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> const & u_x,
+           dealii::Tensor<2, dim, dealii::VectorizedArray<value_type>> const & invJ)
+  {
+    time_step = std::min(time_step,
+                         calculate_time_step_cfl_local_point<dim, value_type>(u_x,
+                                                                              invJ,
+                                                                              cfl_p,
+                                                                              cfl_condition_type));
+  }
+
+  /*
+   * Returns the time step size (minimum over all processors) and deactivates the accumulation.
+   */
+  double
+  finish(MPI_Comm const & mpi_comm)
+  {
+    active = false;
+
+    double dt = std::numeric_limits<double>::max();
+    for(unsigned int v = 0; v < dealii::VectorizedArray<value_type>::size(); ++v)
+      dt = std::min(dt, (double)time_step[v]);
+
+    return reduce_time_step_cfl_local(dt, mpi_comm);
+  }
+
+private:
+  bool                                active;
+  double                              cfl_p;
+  CFLConditionType                    cfl_condition_type;
+  dealii::VectorizedArray<value_type> time_step;
+};
+
 /*
  * Calculate time step size according to local CFL criterion where the velocity field is a
  * prescribed analytical function. The computed time step size corresponds to CFL = 1.0.
@@ -201,24 +326,13 @@ calculate_time_step_cfl_local(dealii::MatrixFree<dim, value_type> const &  data,
 
       dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> u_x =
         FunctionEvaluator<1, dim, value_type>::value(velocity, q_point, time);
-      dealii::Tensor<2, dim, dealii::VectorizedArray<value_type>> invJ =
-        fe_eval.inverse_jacobian(q);
-      invJ                                                              = transpose(invJ);
-      dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> ut_xi = invJ * u_x;
-
-      if(cfl_condition_type == CFLConditionType::VelocityNorm)
-      {
-        delta_t_cell = std::min(delta_t_cell, cfl_p / ut_xi.norm());
-      }
-      else if(cfl_condition_type == CFLConditionType::VelocityComponents)
-      {
-        for(unsigned int d = 0; d < dim; ++d)
-          delta_t_cell = std::min(delta_t_cell, cfl_p / (std::abs(ut_xi[d])));
-      }
-      else
-      {
-        AssertThrow(false, dealii::ExcMessage("Not implemented."));
-      }
+
+      delta_t_cell =
+        std::min(delta_t_cell,
+                 calculate_time_step_cfl_local_point<dim, value_type>(u_x,
+                                                                      fe_eval.inverse_jacobian(q),
+                                                                      cfl_p,
+                                                                      cfl_condition_type));
     }
 
     // loop over vectorized array
@@ -239,7 +353,9 @@ calculate_time_step_cfl_local(dealii::MatrixFree<dim, value_type> const &  data,
 
 /*
  * Calculate time step size according to local CFL criterion where the velocity field is a numerical
- * solution field. The computed time step size corresponds to CFL = 1.0.
+ * solution field. The computed time step size corresponds to CFL = 1.0. If a grid velocity is
+ * given (ALE formulation), the CFL condition is evaluated for the relative velocity, which is
+ * computed in the quadrature points so that no temporary vector is needed.
  */
 template<int dim, typename value_type>
 inline double
@@ -251,9 +367,11 @@ calculate_time_step_cfl_local(
   unsigned int const                                             degree,
   double const                                                   exponent_fe_degree,
   CFLConditionType const                                         cfl_condition_type,
-  MPI_Comm const &                                               mpi_comm)
+  MPI_Comm const &                                               mpi_comm,
+  dealii::LinearAlgebra::distributed::Vector<value_type> const * grid_velocity = nullptr)
 {
   CellIntegrator<dim, dim, value_type> fe_eval(data, dof_index, quad_index);
+  CellIntegrator<dim, dim, value_type> fe_eval_grid(data, dof_index, quad_index);
 
   double new_time_step = std::numeric_limits<double>::max();
 
@@ -265,35 +383,32 @@ calculate_time_step_cfl_local(
     dealii::VectorizedArray<value_type> delta_t_cell =
       dealii::make_vectorized_array<value_type>(std::numeric_limits<value_type>::max());
 
-    dealii::Tensor<2, dim, dealii::VectorizedArray<value_type>> invJ;
     dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> u_x;
-    dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> ut_xi;
 
     fe_eval.reinit(cell);
     fe_eval.read_dof_values(velocity);
     fe_eval.evaluate(true, false);
 
+    if(grid_velocity != nullptr)
+    {
+      fe_eval_grid.reinit(cell);
+      fe_eval_grid.read_dof_values(*grid_velocity);
+      fe_eval_grid.evaluate(true, false);
+    }
+
     // loop over quadrature points
     for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
     {
-      u_x   = fe_eval.get_value(q);
-      invJ  = fe_eval.inverse_jacobian(q);
-      invJ  = transpose(invJ);
-      ut_xi = invJ * u_x;
-
-      if(cfl_condition_type == CFLConditionType::VelocityNorm)
-      {
-        delta_t_cell = std::min(delta_t_cell, cfl_p / ut_xi.norm());
-      }
-      else if(cfl_condition_type == CFLConditionType::VelocityComponents)
-      {
-        for(unsigned int d = 0; d < dim; ++d)
-          delta_t_cell = std::min(delta_t_cell, cfl_p / (std::abs(ut_xi[d])));
-      }
-      else
-      {
-        AssertThrow(false, dealii::ExcMessage("Not implemented."));
-      }
+      u_x = fe_eval.get_value(q);
+      if(grid_velocity != nullptr)
+        u_x -= fe_eval_grid.get_value(q);
+
+      delta_t_cell =
+        std::min(delta_t_cell,
+                 calculate_time_step_cfl_local_point<dim, value_type>(u_x,
+                                                                      fe_eval.inverse_jacobian(q),
+                                                                      cfl_p,
+                                                                      cfl_condition_type));
     }
 
     // loop over vectorized array
@@ -306,21 +421,7 @@ calculate_time_step_cfl_local(
     new_time_step = std::min(new_time_step, dt);
   }
 
-  // find minimum over all processors
-  new_time_step = dealii::Utilities::MPI::min(new_time_step, mpi_comm);
-
-  // Cut time step size after, e.g., 4 digits of accuracy in order to make sure that there is no
-  // drift in the time step size depending on the number of processors when using adaptive time
-  // stepping. This effect can occur since the velocity field and the time step size are coupled
-  // (there is some form of feedback loop in case of adaptive time stepping, i.e., a minor change
-  // in the time step size due to round-off errors implies that the velocity field is evaluated
-  // at a slightly different time in the next time step and so on). This way, it can be ensured
-  // that the sequence of time step sizes is exactly reproducible with the results being
-  // independent of the number of processors, which is important for code verification in a
-  // parallel setting.
-  new_time_step = dealii::Utilities::truncate_to_n_digits(new_time_step, 4);
-
-  return new_time_step;
+  return reduce_time_step_cfl_local(new_time_step, mpi_comm);
 }
 
 /*
@@ -60,6 +60,12 @@ struct GeneralParameters
                         "Set to true if the program is run as a test.",
                         dealii::Patterns::Bool(),
                         false);
+      prm.add_parameter("KernelProfiling",
+                        kernel_profiling,
+                        "Measure bandwidth and arithmetic throughput of matrix-free kernels and "
+                        "the wall time per level of the multigrid V-cycle.",
+                        dealii::Patterns::Bool(),
+                        false);
     prm.leave_subsection();
     // clang-format on
   }
@@ -69,6 +75,8 @@ struct GeneralParameters
   unsigned int dim = 2;
 
   bool is_test = false;
+
+  bool kernel_profiling = false;
 };
 
 } // namespace ExaDG
@@ -0,0 +1,296 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// likwid
+#ifdef EXADG_WITH_LIKWID
+#  include <likwid.h>
+#endif
+
+// perf_event (used if LIKWID is not available)
+#if defined(EXADG_WITH_PERF_EVENT) && !defined(EXADG_WITH_LIKWID)
+#  define EXADG_KERNEL_PROFILER_USE_PERF_EVENT
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <cstdint>
+#  include <cstring>
+#endif
+
+// C++
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/utilities.h>
+
+// ExaDG
+#include <exadg/utilities/kernel_profiler.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+namespace
+{
+struct KernelData
+{
+  KernelData() : calls(0), wall_time(0.0), cycles(0), instructions(0)
+  {
+  }
+
+  unsigned long long calls;
+  double             wall_time;
+  KernelCost         cost;
+  unsigned long long cycles;
+  unsigned long long instructions;
+};
+
+std::map<std::string, KernelData> kernel_data;
+
+// kernels might be measured by several threads of the same process
+std::mutex kernel_data_mutex;
+
+#ifdef EXADG_KERNEL_PROFILER_USE_PERF_EVENT
+// file descriptors of the group leader (CPU cycles) and the instruction counter
+int perf_fd_cycles       = -1;
+int perf_fd_instructions = -1;
+
+int
+open_perf_counter(std::uint64_t const config, int const group_fd)
+{
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.type           = PERF_TYPE_HARDWARE;
+  attr.size           = sizeof(attr);
+  attr.config         = config;
+  attr.disabled       = (group_fd == -1) ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  attr.read_format    = PERF_FORMAT_GROUP;
+
+  // measure the calling process on any CPU
+  return syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+void
+open_perf_counters()
+{
+  if(perf_fd_cycles != -1)
+    return;
+
+  perf_fd_cycles = open_perf_counter(PERF_COUNT_HW_CPU_CYCLES, -1);
+  if(perf_fd_cycles == -1)
+    return;
+
+  perf_fd_instructions = open_perf_counter(PERF_COUNT_HW_INSTRUCTIONS, perf_fd_cycles);
+  if(perf_fd_instructions == -1)
+  {
+    close(perf_fd_cycles);
+    perf_fd_cycles = -1;
+    return;
+  }
+
+  ioctl(perf_fd_cycles, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(perf_fd_cycles, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+#endif
+} // namespace
+
+bool KernelProfiler::enabled = false;
+
+double KernelProfiler::operator_time = 0.0;
+
+void
+KernelProfiler::enable(bool const do_enable)
+{
+  enabled = do_enable;
+
+#ifdef EXADG_KERNEL_PROFILER_USE_PERF_EVENT
+  if(enabled)
+    open_perf_counters();
+#endif
+}
+
+void
+KernelProfiler::add(std::string const &      name,
+                    double const             wall_time,
+                    KernelCost const &       cost,
+                    unsigned long long const cycles,
+                    unsigned long long const instructions)
+{
+  std::lock_guard<std::mutex> lock(kernel_data_mutex);
+
+  KernelData & data = kernel_data[name];
+
+  data.calls += 1;
+  data.wall_time += wall_time;
+  data.cost += cost;
+  data.cycles += cycles;
+  data.instructions += instructions;
+}
+
+void
+KernelProfiler::clear()
+{
+  std::lock_guard<std::mutex> lock(kernel_data_mutex);
+
+  kernel_data.clear();
+}
+
+bool
+KernelProfiler::read_counters(unsigned long long & cycles, unsigned long long & instructions)
+{
+#ifdef EXADG_KERNEL_PROFILER_USE_PERF_EVENT
+  if(perf_fd_cycles != -1)
+  {
+    struct
+    {
+      std::uint64_t n_counters;
+      std::uint64_t values[2];
+    } buffer;
+
+    if(read(perf_fd_cycles, &buffer, sizeof(buffer)) == sizeof(buffer))
+    {
+      cycles       = buffer.values[0];
+      instructions = buffer.values[1];
+      return true;
+    }
+  }
+#endif
+
+  cycles       = 0;
+  instructions = 0;
+  return false;
+}
+
+void
+KernelProfiler::print_results(MPI_Comm const & mpi_comm)
+{
+  if(not(enabled))
+    return;
+
+  // kernels might not be called on all processes
+  std::vector<std::string> local_names;
+  for(auto const & it : kernel_data)
+    local_names.push_back(it.first);
+
+  std::set<std::string> names;
+  for(auto const & names_of_process : dealii::Utilities::MPI::all_gather(mpi_comm, local_names))
+    names.insert(names_of_process.begin(), names_of_process.end());
+
+  std::vector<double> calls, wall_time, bytes, flops, cycles, instructions;
+  for(auto const & name : names)
+  {
+    KernelData const data = kernel_data.count(name) ? kernel_data.at(name) : KernelData();
+
+    calls.push_back((double)data.calls);
+    wall_time.push_back(data.wall_time);
+    bytes.push_back(data.cost.bytes);
+    flops.push_back(data.cost.flops);
+    cycles.push_back((double)data.cycles);
+    instructions.push_back((double)data.instructions);
+  }
+
+  calls        = dealii::Utilities::MPI::max(calls, mpi_comm);
+  wall_time    = dealii::Utilities::MPI::max(wall_time, mpi_comm);
+  bytes        = dealii::Utilities::MPI::sum(bytes, mpi_comm);
+  flops        = dealii::Utilities::MPI::sum(flops, mpi_comm);
+  cycles       = dealii::Utilities::MPI::sum(cycles, mpi_comm);
+  instructions = dealii::Utilities::MPI::sum(instructions, mpi_comm);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    // clang-format off
+    std::cout << std::endl
+              << print_horizontal_line() << std::endl << std::endl
+              << "Kernel performance (analytic memory transfer and arithmetic operations):"
+              << std::endl << std::endl
+              << std::setw(50) << std::left << "Kernel"
+              << std::setw(12) << std::left << "calls"
+              << std::setw(12) << std::left << "time [s]"
+              << std::setw(12) << std::left << "GB/s"
+              << std::setw(12) << std::left << "GFlop/s"
+              << std::setw(12) << std::left << "Flop/Byte"
+              << std::setw(12) << std::left << "IPC"
+              << std::endl;
+
+    unsigned int i = 0;
+    for(auto const & name : names)
+    {
+      std::cout << std::setw(50) << std::left << name
+                << std::setw(12) << std::left << (unsigned long long)calls[i]
+                << std::scientific << std::setprecision(3)
+                << std::setw(12) << std::left << wall_time[i]
+                << std::fixed << std::setprecision(2)
+                << std::setw(12) << std::left << (wall_time[i] > 0.0 ? 1e-9 * bytes[i] / wall_time[i] : 0.0)
+                << std::setw(12) << std::left << (wall_time[i] > 0.0 ? 1e-9 * flops[i] / wall_time[i] : 0.0)
+                << std::setw(12) << std::left << (bytes[i] > 0.0 ? flops[i] / bytes[i] : 0.0);
+      if(cycles[i] > 0.0)
+        std::cout << std::setw(12) << std::left << instructions[i] / cycles[i];
+      else
+        std::cout << std::setw(12) << std::left << "-";
+      std::cout << std::endl;
+
+      ++i;
+    }
+
+    std::cout << print_horizontal_line() << std::endl << std::endl << std::flush;
+    // clang-format on
+  }
+}
+
+void
+ScopedKernelProfiling::start()
+{
+  KernelProfiler::read_counters(start_cycles, start_instructions);
+
+#ifdef EXADG_WITH_LIKWID
+  LIKWID_MARKER_START(name.c_str());
+#endif
+
+  start_time = std::chrono::steady_clock::now();
+}
+
+void
+ScopedKernelProfiling::stop()
+{
+  double const wall_time =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+#ifdef EXADG_WITH_LIKWID
+  LIKWID_MARKER_STOP(name.c_str());
+#endif
+
+  unsigned long long cycles = 0, instructions = 0;
+  if(KernelProfiler::read_counters(cycles, instructions))
+  {
+    cycles -= start_cycles;
+    instructions -= start_instructions;
+  }
+
+  KernelProfiler::add(name, wall_time, cost, cycles, instructions);
+}
+
+} // namespace ExaDG
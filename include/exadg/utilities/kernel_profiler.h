@@ -0,0 +1,222 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_UTILITIES_KERNEL_PROFILER_H_
+#define INCLUDE_EXADG_UTILITIES_KERNEL_PROFILER_H_
+
+// C++
+#include <chrono>
+#include <string>
+#include <type_traits>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+/**
+ * Analytic cost of a kernel call, i.e., the number of bytes transferred from/to main memory and
+ * the number of floating point operations.
+ */
+struct KernelCost
+{
+  KernelCost() : bytes(0.0), flops(0.0)
+  {
+  }
+
+  KernelCost(double const bytes, double const flops) : bytes(bytes), flops(flops)
+  {
+  }
+
+  KernelCost &
+  operator+=(KernelCost const & other)
+  {
+    bytes += other.bytes;
+    flops += other.flops;
+    return *this;
+  }
+
+  double bytes;
+  double flops;
+};
+
+/**
+ * Process-wide registry of kernel measurements. For each kernel (identified by its name), the
+ * number of calls, the accumulated wall time, and the accumulated analytic cost are recorded,
+ * from which the achieved memory bandwidth and arithmetic throughput are derived. If ExaDG is
+ * compiled with LIKWID, each measurement is additionally enclosed by a LIKWID marker region of
+ * the same name (LIKWID_MARKER_INIT has to be called by the application). Otherwise, if ExaDG is
+ * compiled with perf_event support (Linux), CPU cycles and instructions are counted per kernel.
+ *
+ * The profiler is disabled by default so that the instrumented code paths only pay for the check
+ * of a boolean.
+ */
+class KernelProfiler
+{
+public:
+  /**
+   * Enables or disables the measurements.
+   */
+  static void
+  enable(bool const do_enable = true);
+
+  static bool
+  is_enabled()
+  {
+    return enabled;
+  }
+
+  /**
+   * Adds a measurement for the kernel with the given name.
+   */
+  static void
+  add(std::string const &      name,
+      double const             wall_time,
+      KernelCost const &       cost,
+      unsigned long long const cycles,
+      unsigned long long const instructions);
+
+  /**
+   * Removes all measurements.
+   */
+  static void
+  clear();
+
+  /**
+   * Prints calls, wall time (maximum over all processes), GB/s and GFlop/s (summed over all
+   * processes) and, if available, the number of instructions per cycle of all kernels. Has to be
+   * called by all processes of mpi_comm. Does nothing if the profiler is disabled.
+   */
+  static void
+  print_results(MPI_Comm const & mpi_comm);
+
+  /**
+   * Reads the hardware counters (CPU cycles, instructions) of the calling process. Returns false
+   * if no counters are available.
+   */
+  static bool
+  read_counters(unsigned long long & cycles, unsigned long long & instructions);
+
+  /**
+   * Returns the accumulated wall time of all regions measured by ScopedOperatorTiming, i.e., of
+   * the matrix-vector products of operators and preconditioners. Krylov solvers obtain the time of
+   * their vector updates by subtracting the increase of this time during a solve from the time of
+   * the solve.
+   */
+  static double
+  get_operator_time()
+  {
+    return operator_time;
+  }
+
+private:
+  friend class ScopedOperatorTiming;
+
+  static bool enabled;
+
+  static double operator_time;
+};
+
+/**
+ * Measures the kernel enclosed by the lifetime of this object. The name and the cost are only
+ * evaluated if the profiler is enabled, i.e., the name may be passed as a string or as a function
+ * object returning a string and the cost as a function object returning KernelCost. Since each
+ * measurement reads the hardware counters, this class is intended for operator-level calls (e.g.
+ * a matrix-vector product) rather than for individual cell or face ranges.
+ */
+class ScopedKernelProfiling
+{
+public:
+  template<typename Name, typename CostFunction>
+  ScopedKernelProfiling(Name const & name_in, CostFunction const & cost_function)
+    : active(KernelProfiler::is_enabled())
+  {
+    if(active)
+    {
+      if constexpr(std::is_invocable_v<Name const &>)
+        name = name_in();
+      else
+        name = name_in;
+      cost = cost_function();
+      start();
+    }
+  }
+
+  ~ScopedKernelProfiling()
+  {
+    if(active)
+      stop();
+  }
+
+private:
+  void
+  start();
+
+  void
+  stop();
+
+  bool const active;
+
+  std::string name;
+  KernelCost  cost;
+
+  std::chrono::steady_clock::time_point start_time;
+  unsigned long long                    start_cycles       = 0;
+  unsigned long long                    start_instructions = 0;
+};
+
+/**
+ * Measures the wall time of a matrix-vector product (e.g. OperatorBase::vmult()) and adds it to
+ * KernelProfiler::get_operator_time() if the profiler is enabled. Nested regions are counted only
+ * once, since a region sets the accumulated time to its value at the start of the region plus the
+ * duration of the region. This way, a preconditioner calling operators or inner Krylov solvers is
+ * not counted twice.
+ */
+class ScopedOperatorTiming
+{
+public:
+  ScopedOperatorTiming() : active(KernelProfiler::is_enabled())
+  {
+    if(active)
+    {
+      start_operator_time = KernelProfiler::operator_time;
+      start_time          = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~ScopedOperatorTiming()
+  {
+    if(active)
+      KernelProfiler::operator_time =
+        start_operator_time +
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  }
+
+private:
+  bool const active;
+
+  double                                start_operator_time = 0.0;
+  std::chrono::steady_clock::time_point start_time;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_KERNEL_PROFILER_H_ */
@@ -180,6 +180,23 @@ print_solver_info_linear(dealii::ConditionalOStream const & pcout,
   // clang-format on
 }
 
+/*
+ * Cost of a preconditioner (or of an inner solver) per iteration of the outer Krylov solver.
+ */
+inline void
+print_cost_per_iteration(dealii::ConditionalOStream const & pcout,
+                         double const                       cycles_per_iteration,
+                         double const                       wall_time_per_iteration)
+
+{
+  // clang-format off
+  pcout << std::endl
+        << "  Cycles:       " << std::setw(12) << std::fixed << std::setprecision(2) << std::right << cycles_per_iteration << std::endl
+        << "  Wall time [s]:" << std::setw(12) << std::scientific << std::setprecision(2) << std::right << wall_time_per_iteration << std::endl
+        << std::flush;
+  // clang-format on
+}
+
 inline void
 print_wall_time(dealii::ConditionalOStream const & pcout, double const wall_time)
 
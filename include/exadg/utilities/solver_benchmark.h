@@ -0,0 +1,380 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_UTILITIES_SOLVER_BENCHMARK_H_
+#define INCLUDE_EXADG_UTILITIES_SOLVER_BENCHMARK_H_
+
+// C/C++
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/base/utilities.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+#include <exadg/utilities/timer_tree.h>
+
+namespace ExaDG
+{
+/*
+ * Result of one solver benchmark run, i.e., one solver type for one combination of polynomial
+ * degree, refinement level, and number of MPI processes.
+ */
+struct SolverBenchmarkResult
+{
+  SolverBenchmarkResult()
+    : dim(0),
+      degree(0),
+      refine_space(0),
+      n_mpi_processes(0),
+      n_dofs(0),
+      setup_time(0.0),
+      iterations(0.0),
+      solve_time(0.0)
+  {
+  }
+
+  double
+  get_time_per_iteration() const
+  {
+    return iterations > 0.0 ? solve_time / iterations : solve_time;
+  }
+
+  // number of degrees of freedom processed per second in one iteration of the solver
+  double
+  get_throughput() const
+  {
+    return (double)n_dofs / get_time_per_iteration();
+  }
+
+  std::string                     solver_type;
+  unsigned int                    dim;
+  unsigned int                    degree;
+  unsigned int                    refine_space;
+  unsigned int                    n_mpi_processes;
+  dealii::types::global_dof_index n_dofs;
+
+  // wall time of driver setup (including multigrid setup), maximum over all processes
+  double setup_time;
+
+  // average number of iterations per solve
+  double iterations;
+
+  // wall time per solve (minimum over repetitions of the average over processes)
+  double solve_time;
+
+  // wall time per solve spent on each level of the multigrid V-cycle (index = level, average over
+  // repetitions and processes), empty if the preconditioner is not multigrid or if the timings of
+  // the V-cycle are not recorded (kernel profiling disabled)
+  std::vector<double> multigrid_level_times;
+};
+
+/*
+ * Returns the wall times of the calling process accumulated for the levels of the multigrid V-cycle
+ * (index = level) from the timer tree of a multigrid preconditioner, see MultigridAlgorithm. The
+ * vector is empty if the timer tree does not contain timings of the V-cycle.
+ */
+inline std::vector<double>
+get_multigrid_level_times(std::shared_ptr<TimerTree> const & preconditioner_timings)
+{
+  std::vector<double> level_times;
+
+  if(preconditioner_timings.get() == nullptr or preconditioner_timings->get_id() != "Multigrid")
+    return level_times;
+
+  std::string const prefix = "level ";
+  for(auto const & sub_tree : preconditioner_timings->get_sub_trees())
+  {
+    if(sub_tree->get_id().compare(0, prefix.size(), prefix) != 0)
+      continue;
+
+    unsigned int const level = std::stoi(sub_tree->get_id().substr(prefix.size()));
+    if(level >= level_times.size())
+      level_times.resize(level + 1, 0.0);
+
+    level_times[level] += sub_tree->get_wall_time();
+  }
+
+  return level_times;
+}
+
+/*
+ * Solves a linear system of equations several times and returns the average number of iterations,
+ * the minimum wall time of a single solve, and the wall time per solve spent on each level of the
+ * multigrid V-cycle (see SolverBenchmarkResult::multigrid_level_times). The function solve has to
+ * reset the initial guess and return the number of iterations. The per-level timings are taken
+ * from the timer tree of the preconditioner (optional).
+ */
+inline std::tuple<double, double, std::vector<double>>
+measure_solver_time(std::function<unsigned int(void)> const & solve,
+                    unsigned int const                        n_repetitions,
+                    MPI_Comm const &                          mpi_comm,
+                    std::shared_ptr<TimerTree> const &        preconditioner_timings = nullptr)
+{
+  double       wall_time        = std::numeric_limits<double>::max();
+  unsigned int total_iterations = 0;
+
+  // the timer tree of the preconditioner accumulates the timings of all solves
+  std::vector<double> level_times = get_multigrid_level_times(preconditioner_timings);
+
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+  {
+    MPI_Barrier(mpi_comm);
+
+    dealii::Timer timer;
+    timer.restart();
+
+    total_iterations += solve();
+
+    MPI_Barrier(mpi_comm);
+    dealii::Utilities::MPI::MinMaxAvg const time =
+      dealii::Utilities::MPI::min_max_avg(timer.wall_time(), mpi_comm);
+
+    wall_time = std::min(wall_time, time.avg);
+  }
+
+  std::vector<double> const level_times_end = get_multigrid_level_times(preconditioner_timings);
+
+  // processes may not have inserted timings for all levels (e.g. idle levels)
+  unsigned int const n_levels =
+    dealii::Utilities::MPI::max((unsigned int)level_times_end.size(), mpi_comm);
+  level_times.resize(n_levels, 0.0);
+  for(unsigned int level = 0; level < n_levels; ++level)
+  {
+    double const time_end = level < level_times_end.size() ? level_times_end[level] : 0.0;
+    level_times[level]    = (time_end - level_times[level]) / (double)n_repetitions;
+  }
+
+  if(n_levels > 0)
+  {
+    level_times = dealii::Utilities::MPI::sum(level_times, mpi_comm);
+    for(double & time : level_times)
+      time /= (double)dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  }
+
+  return std::make_tuple((double)total_iterations / (double)n_repetitions, wall_time, level_times);
+}
+
+struct SolverBenchmarkParameters
+{
+  SolverBenchmarkParameters()
+  {
+  }
+
+  SolverBenchmarkParameters(std::string const & input_file)
+  {
+    dealii::ParameterHandler prm;
+    add_parameters(prm);
+    prm.parse_input(input_file, "", true, true);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    // clang-format off
+    prm.enter_subsection("SolverBenchmark");
+      prm.add_parameter("SolverType",
+                        solver_type,
+                        "Type of solver.",
+                        dealii::Patterns::Anything(),
+                        true);
+      prm.add_parameter("Repetitions",
+                        n_repetitions,
+                        "Number of solves (taking minimum wall time).",
+                        dealii::Patterns::Integer(1),
+                        true);
+      prm.add_parameter("RankCounts",
+                        rank_counts,
+                        "Numbers of MPI processes to be used (empty: all processes).",
+                        dealii::Patterns::List(dealii::Patterns::Integer(1)),
+                        true);
+      prm.add_parameter("OutputFile",
+                        output_file,
+                        "Name of JSON file the results are written to (empty: no output).",
+                        dealii::Patterns::Anything(),
+                        true);
+    prm.leave_subsection();
+    // clang-format on
+  }
+
+  /*
+   * Returns the numbers of MPI processes of the strong-scaling sweep. Numbers exceeding the size
+   * of the communicator are skipped.
+   */
+  std::vector<unsigned int>
+  get_rank_counts(MPI_Comm const & mpi_comm) const
+  {
+    unsigned int const n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    std::vector<unsigned int> counts;
+    for(unsigned int const n : rank_counts)
+    {
+      if(n <= n_mpi_processes)
+        counts.push_back(n);
+    }
+
+    if(rank_counts.empty())
+      counts.push_back(n_mpi_processes);
+
+    return counts;
+  }
+
+  /*
+   * Calls run() with a sub-communicator containing the first n_ranks processes of mpi_comm. The
+   * remaining processes are idle. Results are collected on the first process of mpi_comm.
+   */
+  void
+  run_on_sub_communicator(std::function<void(MPI_Comm const &)> const & run,
+                          unsigned int const                            n_ranks,
+                          MPI_Comm const &                              mpi_comm) const
+  {
+    unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+    MPI_Comm sub_comm;
+    MPI_Comm_split(mpi_comm, rank < n_ranks ? 0 : MPI_UNDEFINED, rank, &sub_comm);
+
+    if(sub_comm != MPI_COMM_NULL)
+    {
+      run(sub_comm);
+      MPI_Comm_free(&sub_comm);
+    }
+
+    MPI_Barrier(mpi_comm);
+  }
+
+  void
+  print_results(MPI_Comm const & mpi_comm) const
+  {
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      // clang-format off
+      std::cout << std::endl
+                << print_horizontal_line()
+                << std::endl << std::endl
+                << "Solver type: " << solver_type
+                << std::endl << std::endl
+                << std::setw(5)  << std::left << "k"
+                << std::setw(5)  << std::left << "l"
+                << std::setw(8)  << std::left << "ranks"
+                << std::setw(15) << std::left << "DoFs"
+                << std::setw(15) << std::left << "t_setup"
+                << std::setw(10) << std::left << "n_iter"
+                << std::setw(15) << std::left << "t_solve"
+                << std::setw(15) << std::left << "t_iter"
+                << std::setw(15) << std::left << "DoFs/(sec*core)"
+                << std::endl << std::flush;
+
+      for(auto const & result : results)
+      {
+        std::cout << std::setw(5)  << std::left << result.degree
+                  << std::setw(5)  << std::left << result.refine_space
+                  << std::setw(8)  << std::left << result.n_mpi_processes
+                  << std::scientific << std::setprecision(4)
+                  << std::setw(15) << std::left << (double)result.n_dofs
+                  << std::setw(15) << std::left << result.setup_time
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(10) << std::left << result.iterations
+                  << std::scientific << std::setprecision(4)
+                  << std::setw(15) << std::left << result.solve_time
+                  << std::setw(15) << std::left << result.get_time_per_iteration()
+                  << std::setw(15) << std::left << result.get_throughput() / (double)result.n_mpi_processes
+                  << std::endl << std::flush;
+      }
+
+      std::cout << print_horizontal_line() << std::endl << std::endl << std::flush;
+      // clang-format on
+    }
+  }
+
+  /*
+   * Writes the results to output_file in JSON format (on the first process only).
+   */
+  void
+  write_results(MPI_Comm const & mpi_comm) const
+  {
+    if(output_file.empty() or dealii::Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+      return;
+
+    std::ofstream f(output_file);
+    AssertThrow(f.is_open(), dealii::ExcMessage("Could not open file " + output_file + "."));
+
+    f << std::scientific << std::setprecision(8);
+    f << "{" << std::endl << "  \"results\": [" << std::endl;
+
+    for(unsigned int i = 0; i < results.size(); ++i)
+    {
+      SolverBenchmarkResult const & result = results[i];
+
+      // clang-format off
+      f << "    {" << std::endl
+        << "      \"solver_type\": \"" << result.solver_type << "\"," << std::endl
+        << "      \"dim\": " << result.dim << "," << std::endl
+        << "      \"degree\": " << result.degree << "," << std::endl
+        << "      \"refine_space\": " << result.refine_space << "," << std::endl
+        << "      \"n_mpi_processes\": " << result.n_mpi_processes << "," << std::endl
+        << "      \"n_dofs\": " << result.n_dofs << "," << std::endl
+        << "      \"setup_time\": " << result.setup_time << "," << std::endl
+        << "      \"iterations\": " << result.iterations << "," << std::endl
+        << "      \"solve_time\": " << result.solve_time << "," << std::endl
+        << "      \"time_per_iteration\": " << result.get_time_per_iteration() << "," << std::endl
+        << "      \"throughput\": " << result.get_throughput() << "," << std::endl
+        << "      \"throughput_per_core\": " << result.get_throughput() / (double)result.n_mpi_processes << "," << std::endl
+        << "      \"multigrid_level_times\": [";
+      // clang-format on
+
+      for(unsigned int level = 0; level < result.multigrid_level_times.size(); ++level)
+        f << (level > 0 ? ", " : "") << result.multigrid_level_times[level];
+
+      f << "]" << std::endl << "    }" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+
+    f << "  ]" << std::endl << "}" << std::endl;
+  }
+
+  std::string solver_type = "Undefined";
+
+  // number of solves, the minimum wall time is taken
+  unsigned int n_repetitions = 3;
+
+  // numbers of MPI processes (strong scaling)
+  std::vector<unsigned int> rank_counts;
+
+  std::string output_file = "";
+
+  // global variable used to store the results of all runs
+  mutable std::vector<SolverBenchmarkResult> results;
+};
+} // namespace ExaDG
+
+
+#endif /* INCLUDE_EXADG_UTILITIES_SOLVER_BENCHMARK_H_ */
@@ -208,6 +208,24 @@ TimerTree::get_max_level() const
   return max_level;
 }
 
+std::string const &
+TimerTree::get_id() const
+{
+  return id;
+}
+
+double
+TimerTree::get_wall_time() const
+{
+  return data.get() != nullptr ? data->wall_time : 0.0;
+}
+
+std::vector<std::shared_ptr<TimerTree>> const &
+TimerTree::get_sub_trees() const
+{
+  return sub_trees;
+}
+
 void
 TimerTree::copy_from(std::shared_ptr<TimerTree> other)
 {
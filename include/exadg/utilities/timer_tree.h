@@ -94,6 +94,25 @@ public:
   unsigned int
   get_max_level() const;
 
+  /**
+   * Returns the ID of the root element of this tree.
+   */
+  std::string const &
+  get_id() const;
+
+  /**
+   * Returns the wall time of the calling process accumulated for the root element of this tree,
+   * or 0 if no wall time has been inserted for the root element.
+   */
+  double
+  get_wall_time() const;
+
+  /**
+   * Returns the direct sub-trees of the root element of this tree.
+   */
+  std::vector<std::shared_ptr<TimerTree>> const &
+  get_sub_trees() const;
+
 private:
   /**
    * This function "copies" a tree, meaning that only the ID is copied, while
@@ -0,0 +1,159 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_VECTOR_TOOLS_PROBE_SET_H_
+#define INCLUDE_EXADG_VECTOR_TOOLS_PROBE_SET_H_
+
+// deal.II
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+#include <deal.II/numerics/vector_tools.h>
+
+namespace ExaDG
+{
+/*
+ * This class evaluates a finite element solution in a fixed set of points (e.g. probes or points
+ * along lines), typically in every time step. In contrast to the functions in point_value.h, the
+ * points are located only once during setup (or after the grid has been moved) and all points are
+ * evaluated at once via dealii::Utilities::MPI::RemotePointEvaluation, i.e., with vectorized
+ * tensor-product evaluation on the owning processes and a single communication step.
+ *
+ * The points are only requested by the root process, so that the results returned by evaluate()
+ * are only available on rank 0. If a point lies on the boundary between several cells, the
+ * average of the values in these cells is returned.
+ */
+template<int dim, int n_components, typename Number>
+class ProbeSet
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef typename dealii::FEPointEvaluation<n_components, dim>::value_type value_type;
+
+  ProbeSet(MPI_Comm const & comm)
+    : mpi_comm(comm), dof_handler(nullptr), mapping(nullptr), moving_mesh(false)
+  {
+  }
+
+  /*
+   * Locates the points. If moving_mesh is true, the points are located again before every
+   * evaluation since the cells containing the points change when the grid is moved.
+   */
+  void
+  setup(std::vector<dealii::Point<dim>> const & points_in,
+        dealii::DoFHandler<dim> const &         dof_handler_in,
+        dealii::Mapping<dim> const &            mapping_in,
+        bool const                              moving_mesh_in,
+        double const                            tolerance = 1.e-10)
+  {
+    dof_handler = &dof_handler_in;
+    mapping     = &mapping_in;
+    moving_mesh = moving_mesh_in;
+
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+      points = points_in;
+    else
+      points.clear();
+
+    evaluator = std::make_shared<dealii::Utilities::MPI::RemotePointEvaluation<dim>>(tolerance);
+
+    locate_points();
+  }
+
+  /*
+   * Re-locates the points, e.g., after the grid has been moved.
+   */
+  void
+  locate_points()
+  {
+    AssertThrow(evaluator.get(), dealii::ExcMessage("ProbeSet has not been initialized."));
+
+    evaluator->reinit(points, dof_handler->get_triangulation(), *mapping);
+
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+    AssertThrow(dealii::Utilities::MPI::min(evaluator->all_points_found() ? 1 : 0, mpi_comm) == 1,
+                dealii::ExcMessage("Not all points of ProbeSet have been found."));
+#endif
+  }
+
+  /*
+   * Evaluates the dof_vector in all points. The returned vector is only filled on rank 0.
+   */
+  std::vector<value_type> const &
+  evaluate(VectorType const & dof_vector)
+  {
+    if(moving_mesh)
+      locate_points();
+
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+    bool const has_ghost_elements = dof_vector.has_ghost_elements();
+    if(not has_ghost_elements)
+      dof_vector.update_ghost_values();
+
+    auto const result = dealii::VectorTools::point_values<n_components>(
+      *evaluator, *dof_handler, dof_vector, dealii::VectorTools::EvaluationFlags::avg);
+
+    if(not has_ghost_elements)
+      dof_vector.zero_out_ghost_values();
+#else
+    dealii::LinearAlgebra::distributed::Vector<double> dof_vector_double;
+    dof_vector_double = dof_vector;
+    dof_vector_double.update_ghost_values();
+
+    auto const result = dealii::VectorTools::point_values<n_components>(
+      *evaluator, *dof_handler, dof_vector_double, dealii::VectorTools::EvaluationFlags::avg);
+#endif
+
+    values.resize(result.size());
+    for(unsigned int i = 0; i < result.size(); ++i)
+      values[i] = result[i];
+
+    return values;
+  }
+
+  unsigned int
+  n_points() const
+  {
+    return points.size();
+  }
+
+private:
+  MPI_Comm const mpi_comm;
+
+  dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler;
+  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  bool moving_mesh;
+
+  std::vector<dealii::Point<dim>> points;
+
+  std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>> evaluator;
+
+  std::vector<value_type> values;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_VECTOR_TOOLS_PROBE_SET_H_ */
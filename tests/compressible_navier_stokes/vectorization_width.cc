@@ -0,0 +1,224 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Checks that the body force, convective, viscous and combined operators of the compressible
+ * Navier-Stokes solver give the same result when evaluated with a single SIMD lane
+ * (Parameters::vectorization_width = 1) and with the default vectorization width of deal.II. The
+ * mesh has a number of cells that is not a multiple of the SIMD width, so that the default width
+ * also covers partially filled cell and face batches.
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/spatial_discretization/spatial_operators.h>
+
+namespace ExaDG
+{
+unsigned int const degree = 2;
+
+double const tol = 1.e-12;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+typedef CompNS::SpatialOperatorsBase<double> Operators;
+
+template<int dim>
+std::shared_ptr<CompNS::BoundaryDescriptor<dim> const>
+create_boundary_descriptor()
+{
+  std::shared_ptr<CompNS::BoundaryDescriptor<dim>> bc =
+    std::make_shared<CompNS::BoundaryDescriptor<dim>>();
+
+  // Dirichlet boundary conditions for all variables on boundary ID 0
+  bc->density.dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ConstantFunction<dim>>(1.0, 1)));
+  bc->velocity.dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ConstantFunction<dim>>(0.1, dim)));
+  bc->pressure.dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ConstantFunction<dim>>(0.4, 1)));
+  bc->energy.dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ConstantFunction<dim>>(1.0, 1)));
+  bc->energy.boundary_variable.insert(std::make_pair(0, CompNS::EnergyBoundaryVariable::Energy));
+
+  return bc;
+}
+
+template<int dim, typename VectorizedArrayType>
+std::shared_ptr<Operators>
+create_operators(dealii::Mapping<dim> const &                           mapping,
+                 dealii::DoFHandler<dim> const &                        dof_handler,
+                 dealii::AffineConstraints<double> const &              constraints,
+                 std::shared_ptr<CompNS::BoundaryDescriptor<dim> const> bc)
+{
+  typedef dealii::MatrixFree<dim, double, VectorizedArrayType> MatrixFree;
+
+  typename MatrixFree::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme = MatrixFree::AdditionalData::none;
+  additional_data.mapping_update_flags =
+    dealii::update_values | dealii::update_gradients | dealii::update_JxW_values |
+    dealii::update_quadrature_points | dealii::update_normal_vectors;
+  additional_data.mapping_update_flags_inner_faces    = additional_data.mapping_update_flags;
+  additional_data.mapping_update_flags_boundary_faces = additional_data.mapping_update_flags;
+
+  std::shared_ptr<MatrixFree> matrix_free = std::make_shared<MatrixFree>();
+  matrix_free->reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  CompNS::BodyForceOperatorData<dim> body_force_data;
+  body_force_data.rhs_rho = std::make_shared<dealii::Functions::ConstantFunction<dim>>(0.1, 1);
+  body_force_data.rhs_u   = std::make_shared<dealii::Functions::ConstantFunction<dim>>(0.2, dim);
+  body_force_data.rhs_E   = std::make_shared<dealii::Functions::ConstantFunction<dim>>(0.3, 1);
+
+  CompNS::ConvectiveOperatorData<dim> convective_data;
+  convective_data.bc = bc;
+
+  CompNS::ViscousOperatorData<dim> viscous_data;
+  viscous_data.bc = bc;
+
+  std::shared_ptr<CompNS::CombinedOperatorData<dim>> combined_data =
+    std::make_shared<CompNS::CombinedOperatorData<dim>>();
+  combined_data->bc = bc;
+
+  return std::make_shared<CompNS::SpatialOperators<dim, double, VectorizedArrayType>>(
+    matrix_free, body_force_data, convective_data, viscous_data, combined_data);
+}
+
+template<int dim>
+void
+run()
+{
+  // 3^dim cells, which is not a multiple of the SIMD width
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::subdivided_hyper_cube(triangulation, 3);
+
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(degree), dim + 2);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  std::shared_ptr<CompNS::BoundaryDescriptor<dim> const> bc = create_boundary_descriptor<dim>();
+
+  std::shared_ptr<Operators> operators_default =
+    create_operators<dim, dealii::VectorizedArray<double>>(mapping, dof_handler, constraints, bc);
+  std::shared_ptr<Operators> operators_scalar =
+    create_operators<dim, dealii::VectorizedArray<double, 1>>(mapping,
+                                                              dof_handler,
+                                                              constraints,
+                                                              bc);
+
+  // discontinuous conserved variables with positive density and energy
+  VectorType src(dof_handler.n_dofs());
+  for(unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = 1.0 + 0.2 * std::sin(0.1 * i);
+
+  double const time = 0.5;
+
+  auto check = [&](std::string const & name, auto const & evaluate) {
+    VectorType dst_default(dof_handler.n_dofs()), dst_scalar(dof_handler.n_dofs());
+
+    evaluate(*operators_default, dst_default);
+    evaluate(*operators_scalar, dst_scalar);
+
+    AssertThrow(dst_default.linfty_norm() > 0.0,
+                dealii::ExcMessage(name + " evaluates to zero, the check is void."));
+
+    dst_scalar.add(-1.0, dst_default);
+    AssertThrow(dst_scalar.linfty_norm() <= tol * dst_default.linfty_norm(),
+                dealii::ExcMessage(name + " differs between the vectorization widths."));
+
+    std::cout << name << " (dim = " << dim
+              << "): single SIMD lane agrees with default vectorization width." << std::endl;
+  };
+
+  check("Body force operator", [&](Operators const & op, VectorType & dst) {
+    op.evaluate_body_force_add(dst, src, time);
+  });
+  check("Convective operator", [&](Operators const & op, VectorType & dst) {
+    op.evaluate_convective(dst, src, time);
+  });
+  check("Viscous operator", [&](Operators const & op, VectorType & dst) {
+    op.evaluate_viscous(dst, src, time);
+  });
+  check("Combined operator", [&](Operators const & op, VectorType & dst) {
+    op.evaluate_combined(dst, src, time);
+  });
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::run<2>();
+    ExaDG::run<3>();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
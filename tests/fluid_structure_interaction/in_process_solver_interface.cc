@@ -0,0 +1,245 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Data exchange of InProcessSolverInterface between two participants ("Fluid" on the first half of
+ * the processes, "Solid" on the second half) over several time windows, each of which is computed
+ * in two time steps. Both participants write vector data on their write mesh and read the data of
+ * the other participant on their read mesh. The read values have to be the values of the nearest
+ * write vertex of the other participant, written in the same time window, and must not change
+ * before the end of a time window.
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/fluid_structure_interaction/precice/in_process_solver_interface.h>
+
+namespace ExaDG
+{
+unsigned int const dim = 2;
+
+double const time_window_size = 0.1;
+
+unsigned int const n_time_windows = 3;
+
+struct Participant
+{
+  std::string write_mesh_name;
+  std::string read_mesh_name;
+  std::string write_data_name;
+  std::string read_data_name;
+
+  // dim coordinates per vertex
+  std::vector<double> write_positions;
+  std::vector<double> read_positions;
+
+  // index of the nearest write vertex of the other participant for each read vertex
+  std::vector<unsigned int> nearest_write_vertex;
+};
+
+Participant const fluid = {"Fluid-Mesh-write",
+                           "Fluid-Mesh-read",
+                           "Stress",
+                           "Displacement",
+                           {0.0, 0.0, 1.0, 0.0, 2.0, 0.0},
+                           {0.1, 0.0, 1.9, 0.2},
+                           {0, 1}};
+
+Participant const solid = {"Solid-Mesh-write",
+                           "Solid-Mesh-read",
+                           "Displacement",
+                           "Stress",
+                           {0.0, 0.5, 2.0, 0.5},
+                           {0.9, 0.0, 1.6, 0.0, 2.5, 1.0},
+                           {1, 2, 2}};
+
+// value of component d written at vertex i in time window w, distinct for each participant
+double
+value(bool const is_fluid, unsigned int const w, unsigned int const i, unsigned int const d)
+{
+  return (is_fluid ? 1.0 : -1.0) * (100.0 * w + 10.0 * i + d + 1.0);
+}
+
+void
+write(preCICE::SolverInterface & interface,
+      int const                  data_id,
+      bool const                 is_fluid,
+      unsigned int const         time_window)
+{
+  Participant const & participant = is_fluid ? fluid : solid;
+
+  unsigned int const  n_vertices = participant.write_positions.size() / dim;
+  std::vector<int>    indices(n_vertices);
+  std::vector<double> values(dim * n_vertices);
+  for(unsigned int i = 0; i < n_vertices; ++i)
+  {
+    indices[i] = i;
+    for(unsigned int d = 0; d < dim; ++d)
+      values[dim * i + d] = value(is_fluid, time_window, i, d);
+  }
+
+  interface.writeBlockVectorData(data_id, n_vertices, indices.data(), values.data());
+}
+
+void
+check_read_data(preCICE::SolverInterface const & interface,
+                int const                        data_id,
+                bool const                       is_fluid,
+                unsigned int const               time_window)
+{
+  Participant const & participant = is_fluid ? fluid : solid;
+
+  unsigned int const  n_vertices = participant.read_positions.size() / dim;
+  std::vector<int>    indices(n_vertices);
+  std::vector<double> values(dim * n_vertices);
+  for(unsigned int i = 0; i < n_vertices; ++i)
+    indices[i] = i;
+
+  interface.readBlockVectorData(data_id, n_vertices, indices.data(), values.data());
+
+  // the read data is written by the other participant
+  for(unsigned int i = 0; i < n_vertices; ++i)
+    for(unsigned int d = 0; d < dim; ++d)
+      AssertThrow(values[dim * i + d] ==
+                    value(not(is_fluid), time_window, participant.nearest_write_vertex[i], d),
+                  dealii::ExcMessage("Read data does not match the nearest write vertex."));
+}
+
+void
+test(MPI_Comm const & mpi_comm)
+{
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  AssertThrow(n_processes >= 2, dealii::ExcMessage("This test requires two MPI processes."));
+
+  bool const          is_fluid    = (rank < n_processes / 2);
+  Participant const & participant = is_fluid ? fluid : solid;
+
+  preCICE::InProcessSolverInterface<dim> interface(mpi_comm,
+                                                   time_window_size,
+                                                   n_time_windows * time_window_size);
+
+  AssertThrow(interface.getDimensions() == (int)dim, dealii::ExcMessage("Wrong dimension."));
+
+  // setup of the coupling meshes and data (the vertices are added on all processes)
+  int const write_mesh_id = interface.getMeshID(participant.write_mesh_name);
+  int const read_mesh_id  = interface.getMeshID(participant.read_mesh_name);
+
+  std::vector<int> write_ids(participant.write_positions.size() / dim);
+  interface.setMeshVertices(write_mesh_id,
+                            write_ids.size(),
+                            participant.write_positions.data(),
+                            write_ids.data());
+  std::vector<int> read_ids(participant.read_positions.size() / dim);
+  interface.setMeshVertices(read_mesh_id,
+                            read_ids.size(),
+                            participant.read_positions.data(),
+                            read_ids.data());
+
+  AssertThrow(interface.getMeshVertexSize(read_mesh_id) == (int)read_ids.size(),
+              dealii::ExcMessage("Wrong number of mesh vertices."));
+
+  int const write_data_id = interface.getDataID(participant.write_data_name, write_mesh_id);
+  int const read_data_id  = interface.getDataID(participant.read_data_name, read_mesh_id);
+
+  double time_step_size = interface.initialize();
+  AssertThrow(std::abs(time_step_size - time_window_size) < 1.e-12,
+              dealii::ExcMessage("Wrong time step size after initialize()."));
+
+  write(interface, write_data_id, is_fluid, 0);
+  interface.initializeData();
+  check_read_data(interface, read_data_id, is_fluid, 0);
+
+  unsigned int time_window = 0;
+  while(interface.isCouplingOngoing())
+  {
+    // first time step: no data exchange within the time window
+    write(interface, write_data_id, is_fluid, time_window + 1);
+    time_step_size = interface.advance(0.5 * time_window_size);
+
+    AssertThrow(not(interface.isTimeWindowComplete()),
+                dealii::ExcMessage("The time window must not be complete after the first step."));
+    AssertThrow(std::abs(time_step_size - 0.5 * time_window_size) < 1.e-12,
+                dealii::ExcMessage("Wrong remaining time of the time window."));
+    check_read_data(interface, read_data_id, is_fluid, time_window);
+
+    // second time step: completes the time window and exchanges the data
+    time_step_size = interface.advance(time_step_size);
+
+    AssertThrow(interface.isTimeWindowComplete(),
+                dealii::ExcMessage("The time window has to be complete after the second step."));
+    ++time_window;
+    check_read_data(interface, read_data_id, is_fluid, time_window);
+  }
+
+  AssertThrow(time_window == n_time_windows,
+              dealii::ExcMessage("Wrong number of time windows."));
+
+  dealii::ConditionalOStream pcout(std::cout, rank == 0);
+  pcout << "Coupling completed after " << time_window << " time windows" << std::endl
+        << "Fluid and solid read the nearest write values in all time windows" << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test(MPI_COMM_WORLD);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,358 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Partitioned solution of a linear model interface problem with the acceleration methods of
+ * PartitionedSolver. The structure maps the interface stress s onto the interface displacement,
+ * d = K^{-1} (s + f), and the fluid maps the interface displacement onto the interface stress,
+ * s = - M d + g^n, where the added-mass operator M is strong enough for the plain fixed-point
+ * iteration to diverge. The Dirichlet-Neumann scheme iterates on d only, the parallel Jacobi scheme
+ * iterates on the stacked vector (d, s), with the displacement block owned by the first half of the
+ * processes ("structure processes") and the stress block owned by the second half ("fluid
+ * processes"). For the InterfaceRows variant of the Dirichlet-Neumann scheme, the vector x = (d, e)
+ * additionally contains a block e of "interior" displacements that G does not depend on, and the
+ * columns of the quasi-Newton methods are restricted to the interface displacement d. All schemes
+ * have to converge to the monolithic solution (K + M) d = g^n + f in every time step.
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+// ExaDG
+#include <exadg/fluid_structure_interaction/acceleration_schemes/partitioned_solver.h>
+
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const n = 8;
+
+unsigned int const n_time_steps = 4;
+
+double const added_mass = 0.5;
+
+double const tolerance = 1.e-8;
+
+// interior displacement e = interior_factor * d
+double const interior_factor = 0.5;
+
+double
+stiffness(unsigned int const i)
+{
+  return 1.0 + 0.25 * i;
+}
+
+double
+force(unsigned int const i)
+{
+  return 0.1 * (i + 1);
+}
+
+double
+fluid_load(unsigned int const i, unsigned int const time_step)
+{
+  return std::sin(0.5 * i + time_step);
+}
+
+/*
+ * dst = M src with the tridiagonal matrix M = added_mass * tridiag(-1, 2, -1)
+ */
+std::vector<double>
+apply_added_mass(std::vector<double> const & src)
+{
+  std::vector<double> dst(n, 0.0);
+  for(unsigned int i = 0; i < n; ++i)
+  {
+    dst[i] = 2.0 * added_mass * src[i];
+    if(i > 0)
+      dst[i] -= added_mass * src[i - 1];
+    if(i < n - 1)
+      dst[i] -= added_mass * src[i + 1];
+  }
+
+  return dst;
+}
+
+/*
+ * Returns the solution of the monolithic problem (K + M) d = g^n + f.
+ */
+std::vector<double>
+solve_monolithic(unsigned int const time_step)
+{
+  dealii::LAPACKFullMatrix<double> matrix(n, n);
+  dealii::Vector<double>           rhs(n);
+  for(unsigned int i = 0; i < n; ++i)
+  {
+    matrix(i, i) = stiffness(i) + 2.0 * added_mass;
+    if(i > 0)
+      matrix(i, i - 1) = -added_mass;
+    if(i < n - 1)
+      matrix(i, i + 1) = -added_mass;
+
+    rhs[i] = fluid_load(i, time_step) + force(i);
+  }
+
+  matrix.compute_lu_factorization();
+  matrix.solve(rhs);
+
+  return std::vector<double>(rhs.begin(), rhs.end());
+}
+
+/*
+ * Returns the global entries [offset, offset + n) of the distributed vector src on all processes.
+ */
+std::vector<double>
+gather(VectorType const & src, unsigned int const offset)
+{
+  std::vector<double> values(n, 0.0);
+  for(auto const i : src.locally_owned_elements())
+    if(i >= offset and i < offset + n)
+      values[i - offset] = src(i);
+
+  return dealii::Utilities::MPI::sum(values, src.get_mpi_communicator());
+}
+
+/*
+ * Writes the locally owned entries of values to the global entries [offset, offset + n) of dst.
+ */
+void
+scatter(VectorType & dst, std::vector<double> const & values, unsigned int const offset)
+{
+  for(auto const i : dst.locally_owned_elements())
+    if(i >= offset and i < offset + n)
+      dst(i) = values[i - offset];
+}
+
+double
+block_norm(VectorType const & src, unsigned int const offset)
+{
+  double norm_sqr = 0.0;
+  for(auto const i : src.locally_owned_elements())
+    if(i >= offset and i < offset + n)
+      norm_sqr += src(i) * src(i);
+
+  return std::sqrt(dealii::Utilities::MPI::sum(norm_sqr, src.get_mpi_communicator()));
+}
+
+/*
+ * Vector of n_blocks blocks of size n. The processes are split into n_blocks groups of consecutive
+ * ranks, and the i-th block is distributed among the processes of the i-th group.
+ */
+void
+initialize_vector(VectorType & vector, unsigned int const n_blocks, MPI_Comm const & mpi_comm)
+{
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  unsigned int const n_groups = std::min(n_blocks, n_processes);
+  unsigned int const group    = rank * n_groups / n_processes;
+
+  // processes [first, last) of the group of this process
+  unsigned int const first = (group * n_processes + n_groups - 1) / n_groups;
+  unsigned int const last  = ((group + 1) * n_processes + n_groups - 1) / n_groups;
+
+  // blocks [block_begin, block_end) of the group of this process
+  unsigned int const block_begin = group * n_blocks / n_groups;
+  unsigned int const block_end   = (group + 1) * n_blocks / n_groups;
+
+  unsigned int const size  = (block_end - block_begin) * n;
+  unsigned int const begin = block_begin * n + (rank - first) * size / (last - first);
+  unsigned int const end   = block_begin * n + (rank - first + 1) * size / (last - first);
+
+  dealii::IndexSet locally_owned(n_blocks * n);
+  locally_owned.add_range(begin, end);
+
+  vector.reinit(locally_owned, mpi_comm);
+}
+
+void
+test(std::string const & method, MPI_Comm const & mpi_comm)
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  FSI::Parameters parameters;
+  parameters.method               = method;
+  parameters.omega_init           = 0.3;
+  parameters.reused_time_steps    = 2;
+  parameters.partitioned_iter_max = 200;
+
+  pcout << std::endl << "Method " << method << ":" << std::endl;
+
+  for(std::string const scheme : {"DirichletNeumann", "ParallelJacobi", "InterfaceRows"})
+  {
+    bool const jacobi     = (scheme == "ParallelJacobi");
+    bool const restricted = (scheme == "InterfaceRows");
+
+    // local indices of the interface displacement d, i.e., of the first block
+    std::shared_ptr<std::vector<unsigned int> const> interface_rows;
+    if(restricted)
+    {
+      VectorType x;
+      initialize_vector(x, 2, mpi_comm);
+
+      auto rows = std::make_shared<std::vector<unsigned int>>();
+      for(auto const i : x.locally_owned_elements())
+        if(i < n)
+          rows->push_back(x.get_partitioner()->global_to_local(i));
+      interface_rows = rows;
+    }
+
+    FSI::PartitionedSolver<double> solver(parameters, mpi_comm);
+
+    // converged interface data of the previous time step
+    std::vector<double> displacement(n, 0.0), stress(n, 0.0);
+
+    double max_error = 0.0;
+    for(unsigned int time_step = 0; time_step < n_time_steps; ++time_step)
+    {
+      unsigned int n_iterations = 0;
+
+      FSI::FixedPointProblem<VectorType> problem;
+
+      problem.initialize_vector = [&](VectorType & x) {
+        initialize_vector(x, (jacobi or restricted) ? 2 : 1, mpi_comm);
+      };
+
+      problem.predict = [&](VectorType & x) {
+        scatter(x, displacement, 0);
+        if(jacobi)
+          scatter(x, stress, n);
+      };
+
+      problem.apply = [&](VectorType & x_tilde, VectorType const & x, unsigned int const) {
+        std::vector<double> const d = gather(x, 0);
+
+        // fluid
+        std::vector<double> s = apply_added_mass(d);
+        for(unsigned int i = 0; i < n; ++i)
+          s[i] = fluid_load(i, time_step) - s[i];
+
+        // structure, solved with the stress of the current iterate for the Jacobi scheme
+        std::vector<double> const & s_structure = jacobi ? gather(x, n) : s;
+        std::vector<double>         d_tilde(n);
+        for(unsigned int i = 0; i < n; ++i)
+          d_tilde[i] = (s_structure[i] + force(i)) / stiffness(i);
+
+        scatter(x_tilde, d_tilde, 0);
+        if(jacobi)
+          scatter(x_tilde, s, n);
+
+        if(restricted)
+        {
+          std::vector<double> e_tilde(n);
+          for(unsigned int i = 0; i < n; ++i)
+            e_tilde[i] = interior_factor * d_tilde[i];
+          scatter(x_tilde, e_tilde, n);
+        }
+
+        // the last iterate is the solution once converged
+        displacement = d;
+        if(jacobi)
+          stress = gather(x, n);
+
+        ++n_iterations;
+      };
+
+      problem.update = [&](VectorType const &) {};
+
+      problem.check_convergence = [&](VectorType const & r, VectorType const & x_tilde) {
+        bool converged = block_norm(r, 0) <= tolerance * block_norm(x_tilde, 0);
+        if(jacobi or restricted)
+          converged = converged and block_norm(r, n) <= tolerance * block_norm(x_tilde, n);
+        return converged;
+      };
+
+      problem.interface_rows = interface_rows;
+
+      solver.solve(problem);
+
+      AssertThrow(n_iterations < parameters.partitioned_iter_max,
+                  dealii::ExcMessage("Partitioned iteration did not converge."));
+
+      std::vector<double> const reference = solve_monolithic(time_step);
+
+      double error = 0.0, norm = 0.0;
+      for(unsigned int i = 0; i < n; ++i)
+      {
+        error += std::pow(displacement[i] - reference[i], 2);
+        norm += std::pow(reference[i], 2);
+      }
+      max_error = std::max(max_error, std::sqrt(error / norm));
+    }
+
+    AssertThrow(max_error < 1.e-6,
+                dealii::ExcMessage("Partitioned solution differs from monolithic solution."));
+
+    pcout << "  " << std::left << std::setw(18) << scheme
+          << ": converged to the monolithic solution in all time steps" << std::endl;
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    for(std::string const method : {"Aitken", "IQN-ILS", "IQN-IMVLS"})
+      ExaDG::test(method, MPI_COMM_WORLD);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
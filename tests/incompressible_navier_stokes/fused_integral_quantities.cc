@@ -0,0 +1,406 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Checks that the integral quantities evaluated in a single matrix-free loop by
+ * IntegralQuantitiesCalculator (PostProcessorData::fused_integral_quantities) agree with the
+ * separate loops of the individual postprocessing tools: errors with respect to an analytical
+ * solution (L2-norm and H1-seminorm), kinetic energy, enstrophy, dissipation and maximum vorticity,
+ * divergence and mass error, as well as lift and drag. Each tool is run once with its own loop and
+ * once with the fused evaluator, and the files written by the tools are compared.
+ *
+ * The velocity and pressure are arbitrary discontinuous polynomials on a Cartesian mesh and the
+ * analytical solution is linear, so that the errors are integrated exactly by both the quadrature
+ * of dealii::VectorTools::integrate_difference() and the over-integration quadrature used by the
+ * fused loop.
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/divergence_and_mass_error.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/integral_quantities_calculator.h>
+#include <exadg/postprocessor/error_calculation.h>
+#include <exadg/postprocessor/kinetic_energy_calculation.h>
+#include <exadg/postprocessor/lift_and_drag_calculation.h>
+
+namespace ExaDG
+{
+unsigned int const degree = 3;
+
+// the tools write their results with at least six significant digits
+double const tol = 1.e-5;
+
+double const evaluation_time = 0.5;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Linear function with n_components components.
+ */
+template<int dim>
+class LinearFunction : public dealii::Function<dim>
+{
+public:
+  LinearFunction(unsigned int const n_components) : dealii::Function<dim>(n_components)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    double value = 1.0 + component;
+    for(unsigned int d = 0; d < dim; ++d)
+      value += coefficient(d, component) * p[d];
+    return value;
+  }
+
+  dealii::Tensor<1, dim>
+  gradient(dealii::Point<dim> const &, unsigned int const component) const final
+  {
+    dealii::Tensor<1, dim> gradient;
+    for(unsigned int d = 0; d < dim; ++d)
+      gradient[d] = coefficient(d, component);
+    return gradient;
+  }
+
+private:
+  static double
+  coefficient(unsigned int const d, unsigned int const component)
+  {
+    return 0.5 + d - 0.3 * component;
+  }
+};
+
+template<int dim>
+class Setup
+{
+public:
+  Setup()
+    : mapping(degree),
+      fe_velocity(dealii::FE_DGQ<dim>(degree), dim),
+      fe_pressure(degree - 1),
+      dof_handler_velocity(triangulation),
+      dof_handler_pressure(triangulation)
+  {
+    // Cartesian mesh (affine mapping), boundary ID 0 at x = 0 for lift and drag
+    dealii::GridGenerator::hyper_cube(triangulation, 0., 1., true);
+    triangulation.refine_global(dim == 2 ? 2 : 1);
+
+    dof_handler_velocity.distribute_dofs(fe_velocity);
+    dof_handler_pressure.distribute_dofs(fe_pressure);
+
+    constraints.close();
+
+    typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+    additional_data.tasks_parallel_scheme = dealii::MatrixFree<dim, double>::AdditionalData::none;
+    additional_data.mapping_update_flags  = dealii::update_values | dealii::update_gradients |
+                                           dealii::update_JxW_values |
+                                           dealii::update_quadrature_points;
+    additional_data.mapping_update_flags_inner_faces =
+      additional_data.mapping_update_flags | dealii::update_normal_vectors;
+    additional_data.mapping_update_flags_boundary_faces =
+      additional_data.mapping_update_flags | dealii::update_normal_vectors;
+
+    // dof index 0: velocity, dof index 1: pressure
+    // quadrature 0: standard quadrature, quadrature 1: over-integration
+    std::vector<dealii::DoFHandler<dim> const *> dof_handlers = {&dof_handler_velocity,
+                                                                 &dof_handler_pressure};
+    std::vector<dealii::AffineConstraints<double> const *> constraint_matrices = {&constraints,
+                                                                                  &constraints};
+    std::vector<dealii::Quadrature<1>>                     quadratures = {
+      dealii::QGauss<1>(degree + 1), dealii::QGauss<1>(3 * degree / 2 + 1)};
+
+    matrix_free.reinit(mapping, dof_handlers, constraint_matrices, quadratures, additional_data);
+
+    matrix_free.initialize_dof_vector(velocity, 0);
+    matrix_free.initialize_dof_vector(pressure, 1);
+
+    // discontinuous fields with jumps between cells
+    for(unsigned int i = 0; i < velocity.locally_owned_size(); ++i)
+      velocity.local_element(i) = std::sin(0.1 * i) + 0.5;
+    for(unsigned int i = 0; i < pressure.locally_owned_size(); ++i)
+      pressure.local_element(i) = std::cos(0.2 * i);
+  }
+
+  dealii::Triangulation<dim>        triangulation;
+  dealii::MappingQ<dim>             mapping;
+  dealii::FESystem<dim>             fe_velocity;
+  dealii::FE_DGQ<dim>               fe_pressure;
+  dealii::DoFHandler<dim>           dof_handler_velocity;
+  dealii::DoFHandler<dim>           dof_handler_pressure;
+  dealii::AffineConstraints<double> constraints;
+  dealii::MatrixFree<dim, double>   matrix_free;
+
+  VectorType velocity, pressure;
+};
+
+/*
+ * The postprocessing tools, writing their results into the given directory.
+ */
+template<int dim>
+class Tools
+{
+public:
+  Tools(Setup<dim> const & setup, std::string const & directory)
+    : error_calculator_u(MPI_COMM_WORLD),
+      error_calculator_p(MPI_COMM_WORLD),
+      kinetic_energy_calculator(MPI_COMM_WORLD),
+      div_and_mass_error_calculator(MPI_COMM_WORLD),
+      lift_and_drag_calculator(MPI_COMM_WORLD)
+  {
+    error_data_u.analytical_solution_available = true;
+    error_data_u.analytical_solution           = std::make_shared<LinearFunction<dim>>(dim);
+    error_data_u.calculate_relative_errors     = true;
+    error_data_u.calculate_H1_seminorm_error   = true;
+    error_data_u.write_errors_to_file          = true;
+    error_data_u.directory                     = directory;
+    error_data_u.name                          = "velocity";
+
+    error_data_p.analytical_solution_available = true;
+    error_data_p.analytical_solution           = std::make_shared<LinearFunction<dim>>(1);
+    error_data_p.calculate_relative_errors     = false;
+    error_data_p.calculate_H1_seminorm_error   = true;
+    error_data_p.write_errors_to_file          = true;
+    error_data_p.directory                     = directory;
+    error_data_p.name                          = "pressure";
+
+    kinetic_energy_data.calculate                  = true;
+    kinetic_energy_data.calculate_every_time_steps = 1;
+    kinetic_energy_data.viscosity                  = 1.e-2;
+    kinetic_energy_data.directory                  = directory;
+
+    mass_data.calculate = true;
+    mass_data.directory = directory;
+
+    lift_and_drag_data.calculate       = true;
+    lift_and_drag_data.viscosity       = 1.e-2;
+    lift_and_drag_data.reference_value = 2.0;
+    lift_and_drag_data.boundary_IDs    = {0};
+    lift_and_drag_data.directory       = directory;
+
+    error_calculator_u.setup(setup.dof_handler_velocity, setup.mapping, error_data_u);
+    error_calculator_p.setup(setup.dof_handler_pressure, setup.mapping, error_data_p);
+    kinetic_energy_calculator.setup(setup.matrix_free, 0, 0, kinetic_energy_data);
+    div_and_mass_error_calculator.setup(setup.matrix_free, 0, 0, mass_data);
+    lift_and_drag_calculator.setup(
+      setup.dof_handler_velocity, setup.matrix_free, 0, 1, 0, lift_and_drag_data);
+  }
+
+  void
+  evaluate(Setup<dim> const & setup)
+  {
+    // the error calculators print the errors to the screen
+    std::ostringstream     screen_output;
+    std::streambuf * const buffer = std::cout.rdbuf(screen_output.rdbuf());
+
+    error_calculator_u.evaluate(setup.velocity, evaluation_time, -1 /* steady */);
+    error_calculator_p.evaluate(setup.pressure, evaluation_time, -1 /* steady */);
+
+    std::cout.rdbuf(buffer);
+
+    kinetic_energy_calculator.evaluate(setup.velocity, evaluation_time, 1 /* time step number */);
+    div_and_mass_error_calculator.evaluate(setup.velocity, evaluation_time, -1 /* steady */);
+    lift_and_drag_calculator.evaluate(setup.velocity, setup.pressure, evaluation_time);
+  }
+
+  ErrorCalculationData<dim>   error_data_u, error_data_p;
+  KineticEnergyData           kinetic_energy_data;
+  IncNS::MassConservationData mass_data;
+  LiftAndDragData             lift_and_drag_data;
+
+  ErrorCalculator<dim, double>                         error_calculator_u, error_calculator_p;
+  KineticEnergyCalculator<dim, double>                 kinetic_energy_calculator;
+  IncNS::DivergenceAndMassErrorCalculator<dim, double> div_and_mass_error_calculator;
+  LiftAndDragCalculator<dim, double>                   lift_and_drag_calculator;
+};
+
+/*
+ * Compares two files written by a postprocessing tool: words have to be equal and numbers have to
+ * agree up to the given relative tolerance.
+ */
+void
+compare_files(std::string const & filename_1, std::string const & filename_2)
+{
+  std::ifstream file_1(filename_1), file_2(filename_2);
+  AssertThrow(file_1.good() and file_2.good(), dealii::ExcMessage("Could not open " + filename_1));
+
+  std::string word_1, word_2;
+  while(file_1 >> word_1)
+  {
+    AssertThrow(file_2 >> word_2, dealii::ExcMessage(filename_2 + " is shorter."));
+
+    std::istringstream stream_1(word_1), stream_2(word_2);
+    double             number_1, number_2;
+    if((stream_1 >> number_1) and stream_1.eof() and (stream_2 >> number_2) and stream_2.eof())
+    {
+      AssertThrow(std::abs(number_1 - number_2) <=
+                    tol * std::max(std::abs(number_1), std::abs(number_2)) + 1.e-12,
+                  dealii::ExcMessage("Results in " + filename_1 + " differ: " + word_1 + " vs. " +
+                                     word_2));
+    }
+    else
+    {
+      AssertThrow(word_1 == word_2, dealii::ExcMessage("Files " + filename_1 + " differ."));
+    }
+  }
+
+  AssertThrow(not(file_2 >> word_2), dealii::ExcMessage(filename_1 + " is shorter."));
+}
+
+template<int dim>
+void
+run()
+{
+  Setup<dim> setup;
+
+  std::string const directory_separate = "output_" + std::to_string(dim) + "d_separate/";
+  std::string const directory_fused    = "output_" + std::to_string(dim) + "d_fused/";
+
+  // individual tools with separate loops
+  Tools<dim> separate(setup, directory_separate);
+  separate.evaluate(setup);
+
+  // individual tools with results of the fused loop (as done by IncNS::PostProcessor)
+  Tools<dim> fused(setup, directory_fused);
+
+  IncNS::IntegralQuantitiesCalculator<dim, double> calculator(MPI_COMM_WORLD);
+  calculator.setup(setup.matrix_free,
+                   0 /* dof index velocity */,
+                   1 /* dof index pressure */,
+                   0 /* quad index */,
+                   1 /* quad index error */,
+                   fused.error_data_u,
+                   fused.error_data_p,
+                   fused.kinetic_energy_data,
+                   fused.mass_data,
+                   fused.lift_and_drag_data);
+
+  fused.error_calculator_u.set_norm_evaluator(
+    [&calculator](double &                              error,
+                  double &                              solution,
+                  dealii::VectorTools::NormType const & norm_type) {
+      calculator.get_error_velocity(error, solution, norm_type);
+    });
+  fused.error_calculator_p.set_norm_evaluator(
+    [&calculator](double &                              error,
+                  double &                              solution,
+                  dealii::VectorTools::NormType const & norm_type) {
+      calculator.get_error_pressure(error, solution, norm_type);
+    });
+  fused.kinetic_energy_calculator.set_integral_evaluator(
+    [&calculator](double & volume,
+                  double & energy,
+                  double & enstrophy,
+                  double & dissipation,
+                  double & max_vorticity) {
+      calculator.get_kinetic_energy(volume, energy, enstrophy, dissipation, max_vorticity);
+    });
+  fused.div_and_mass_error_calculator.set_error_evaluator(
+    [&calculator](double & div_error,
+                  double & div_error_reference,
+                  double & mass_error,
+                  double & mass_error_reference) {
+      calculator.get_divergence_and_mass_error(div_error,
+                                               div_error_reference,
+                                               mass_error,
+                                               mass_error_reference);
+    });
+  fused.lift_and_drag_calculator.set_force_evaluator(
+    [&calculator](dealii::Tensor<1, dim, double> & force) { calculator.get_force(force); });
+
+  calculator.reinit(setup.velocity, setup.pressure, evaluation_time);
+  fused.evaluate(setup);
+
+  for(std::string const filename : {"velocity_L2",
+                                    "velocity_H1_seminorm",
+                                    "pressure_L2",
+                                    "pressure_H1_seminorm",
+                                    "kinetic_energy",
+                                    "mass.div_mass_error",
+                                    "lift",
+                                    "drag"})
+  {
+    compare_files(directory_separate + filename, directory_fused + filename);
+
+    std::cout << filename << " (dim = " << dim << "): fused loop agrees with separate loop."
+              << std::endl;
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::run<2>();
+    ExaDG::run<3>();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
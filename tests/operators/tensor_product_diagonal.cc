@@ -0,0 +1,310 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Checks that the diagonal and the block-diagonal computed by sum factorization (see
+ * TensorProductDiagonal) agree with the unit-vector loop over the cell operator, which is used if
+ * OperatorBaseData::use_tensor_product_diagonal is set to false.
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operators/convective_operator.h>
+#include <exadg/operators/tensor_product_diagonal.h>
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+
+namespace ExaDG
+{
+unsigned int const degree = 3;
+
+double const tol = 1.e-12;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+typedef std::vector<dealii::LAPACKFullMatrix<double>>     BlockMatrix;
+
+template<int dim>
+class Setup
+{
+public:
+  Setup()
+    : mapping(degree), fe_scalar(degree), fe_vector(dealii::FE_DGQ<dim>(degree), dim)
+  {
+    dealii::GridGenerator::hyper_cube(triangulation, -1., 1.);
+    triangulation.refine_global(dim == 2 ? 2 : 1);
+
+    // deform the mesh so that the geometry terms vary within the cells
+    dealii::GridTools::transform(
+      [](dealii::Point<dim> const & p) {
+        dealii::Point<dim> q = p;
+        for(unsigned int d = 0; d < dim; ++d)
+          q[d] += 0.1 * std::sin(dealii::numbers::PI * p[(d + 1) % dim]) * (1. - p[d] * p[d]);
+        return q;
+      },
+      triangulation);
+
+    dof_handler_scalar.reinit(triangulation);
+    dof_handler_scalar.distribute_dofs(fe_scalar);
+    dof_handler_vector.reinit(triangulation);
+    dof_handler_vector.distribute_dofs(fe_vector);
+
+    constraints.close();
+
+    typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+    additional_data.tasks_parallel_scheme = dealii::MatrixFree<dim, double>::AdditionalData::none;
+    additional_data.mapping_update_flags =
+      dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+    additional_data.mapping_update_flags_inner_faces =
+      additional_data.mapping_update_flags | dealii::update_normal_vectors;
+    additional_data.mapping_update_flags_boundary_faces =
+      additional_data.mapping_update_flags | dealii::update_normal_vectors;
+
+    // quadrature 0: standard quadrature, quadrature 1: over-integration
+    std::vector<dealii::DoFHandler<dim> const *> dof_handlers = {&dof_handler_scalar,
+                                                                 &dof_handler_vector};
+    std::vector<dealii::AffineConstraints<double> const *> constraint_matrices = {&constraints,
+                                                                                  &constraints};
+    std::vector<dealii::Quadrature<1>>                     quadratures = {
+      dealii::QGauss<1>(degree + 1), dealii::QGauss<1>(3 * degree / 2 + 1)};
+
+    matrix_free.reinit(mapping, dof_handlers, constraint_matrices, quadratures, additional_data);
+  }
+
+  dealii::Triangulation<dim>        triangulation;
+  dealii::MappingQ<dim>             mapping;
+  dealii::FE_DGQ<dim>               fe_scalar;
+  dealii::FESystem<dim>             fe_vector;
+  dealii::DoFHandler<dim>           dof_handler_scalar;
+  dealii::DoFHandler<dim>           dof_handler_vector;
+  dealii::AffineConstraints<double> constraints;
+  dealii::MatrixFree<dim, double>   matrix_free;
+};
+
+/*
+ * Makes sure that the fast computation is actually used for the given element.
+ */
+template<int dim, int n_components>
+void
+check_tensor_product_element(dealii::MatrixFree<dim, double> const & matrix_free,
+                             unsigned int const                      dof_index,
+                             unsigned int const                      quad_index)
+{
+  TensorProductDiagonal<dim, n_components, double> tensor_product_diagonal;
+
+  AssertThrow(tensor_product_diagonal.reinit(
+                matrix_free.get_shape_info(dof_index, quad_index), true, true, false, true, true),
+              dealii::ExcMessage("Element is not supported by TensorProductDiagonal."));
+}
+
+template<int dim, typename Operator>
+void
+compare_diagonals(dealii::MatrixFree<dim, double> const & matrix_free,
+                  Operator const &                        operator_fast,
+                  Operator const &                        operator_reference)
+{
+  VectorType diagonal_fast, diagonal_reference;
+  operator_fast.calculate_diagonal(diagonal_fast);
+  operator_reference.calculate_diagonal(diagonal_reference);
+
+  double const scaling = diagonal_reference.linfty_norm();
+  diagonal_fast -= diagonal_reference;
+  AssertThrow(diagonal_fast.linfty_norm() < tol * scaling,
+              dealii::ExcMessage("Diagonals do not agree."));
+
+  unsigned int const n_cells =
+    matrix_free.n_cell_batches() * dealii::VectorizedArray<double>::size();
+  unsigned int const dofs_per_cell =
+    matrix_free.get_dof_handler(operator_fast.get_dof_index()).get_fe().n_dofs_per_cell();
+
+  BlockMatrix matrices_fast(n_cells,
+                            dealii::LAPACKFullMatrix<double>(dofs_per_cell, dofs_per_cell));
+  BlockMatrix matrices_reference(matrices_fast);
+  for(unsigned int c = 0; c < n_cells; ++c)
+  {
+    matrices_fast[c]      = 0.;
+    matrices_reference[c] = 0.;
+  }
+  operator_fast.add_block_diagonal_matrices(matrices_fast);
+  operator_reference.add_block_diagonal_matrices(matrices_reference);
+
+  double max_entry = 0., max_difference = 0.;
+  for(unsigned int c = 0; c < n_cells; ++c)
+    for(unsigned int i = 0; i < dofs_per_cell; ++i)
+      for(unsigned int j = 0; j < dofs_per_cell; ++j)
+      {
+        max_entry = std::max(max_entry, std::abs(matrices_reference[c](i, j)));
+        max_difference =
+          std::max(max_difference, std::abs(matrices_fast[c](i, j) - matrices_reference[c](i, j)));
+      }
+
+  AssertThrow(max_difference < tol * max_entry,
+              dealii::ExcMessage("Block-diagonals do not agree."));
+}
+
+template<int dim>
+void
+test_laplace_operator(Setup<dim> const & setup)
+{
+  check_tensor_product_element<dim, 1>(setup.matrix_free, 0, 0);
+
+  auto boundary_descriptor = std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  boundary_descriptor->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  Poisson::LaplaceOperatorData<0, dim> data;
+  data.dof_index             = 0;
+  data.quad_index            = 0;
+  data.bc                    = boundary_descriptor;
+  data.kernel_data.IP_factor = 1.0;
+
+  Poisson::LaplaceOperator<dim, double, 1> operator_fast, operator_reference;
+  operator_fast.initialize(setup.matrix_free, setup.constraints, data);
+
+  data.use_tensor_product_diagonal = false;
+  operator_reference.initialize(setup.matrix_free, setup.constraints, data);
+
+  compare_diagonals(setup.matrix_free, operator_fast, operator_reference);
+
+  std::cout << "Laplace operator (dim = " << dim << "): diagonal and block-diagonal agree."
+            << std::endl;
+}
+
+template<int dim>
+void
+test_linearized_convective_operator(Setup<dim> const &              setup,
+                                    IncNS::FormulationConvectiveTerm formulation)
+{
+  check_tensor_product_element<dim, dim>(setup.matrix_free, 1, 1);
+
+  auto boundary_descriptor = std::make_shared<IncNS::BoundaryDescriptorU<dim>>();
+  boundary_descriptor->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+
+  IncNS::Operators::ConvectiveKernelData kernel_data;
+  kernel_data.formulation = formulation;
+
+  IncNS::ConvectiveOperatorData<dim> data;
+  data.kernel_data          = kernel_data;
+  data.dof_index            = 1;
+  data.quad_index           = 1;
+  data.quad_index_nonlinear = 1;
+  data.bc                   = boundary_descriptor;
+
+  // linearization point
+  VectorType velocity;
+  setup.matrix_free.initialize_dof_vector(velocity, 1);
+  for(unsigned int i = 0; i < velocity.locally_owned_size(); ++i)
+    velocity.local_element(i) = std::sin(0.1 * i);
+
+  auto kernel_fast = std::make_shared<IncNS::Operators::ConvectiveKernel<dim, double>>();
+  kernel_fast->reinit(setup.matrix_free, kernel_data, 1, 1, true);
+  kernel_fast->set_velocity_copy(velocity);
+
+  auto kernel_reference = std::make_shared<IncNS::Operators::ConvectiveKernel<dim, double>>();
+  kernel_reference->reinit(setup.matrix_free, kernel_data, 1, 1, true);
+  kernel_reference->set_velocity_copy(velocity);
+
+  IncNS::ConvectiveOperator<dim, double> operator_fast, operator_reference;
+  operator_fast.initialize(setup.matrix_free, setup.constraints, data, kernel_fast);
+
+  data.use_tensor_product_diagonal = false;
+  operator_reference.initialize(setup.matrix_free, setup.constraints, data, kernel_reference);
+
+  compare_diagonals(setup.matrix_free, operator_fast, operator_reference);
+
+  std::cout << "Linearized convective operator ("
+            << (formulation == IncNS::FormulationConvectiveTerm::DivergenceFormulation ?
+                  "divergence" :
+                  "convective")
+            << " formulation, dim = " << dim << "): diagonal and block-diagonal agree."
+            << std::endl;
+}
+
+template<int dim>
+void
+run()
+{
+  Setup<dim> setup;
+
+  test_laplace_operator(setup);
+  test_linearized_convective_operator(setup,
+                                      IncNS::FormulationConvectiveTerm::DivergenceFormulation);
+  test_linearized_convective_operator(setup,
+                                      IncNS::FormulationConvectiveTerm::ConvectiveFormulation);
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::run<2>();
+    ExaDG::run<3>();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
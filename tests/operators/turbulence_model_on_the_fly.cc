@@ -0,0 +1,337 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Checks that the eddy viscosity evaluated on the fly within the viscous kernel (with and without
+ * cache) agrees with the tables of variable coefficients filled by a separate loop of
+ * TurbulenceModel, both for the viscosity at the quadrature points of cells, interior faces and
+ * boundary faces and for the application of the viscous operator. The operator is applied twice
+ * per velocity field, the second time using the cached viscosity if the cache is enabled, and the
+ * velocity field is changed once to check that the cache is invalidated.
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operators/viscous_operator.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/turbulence_model.h>
+
+namespace ExaDG
+{
+unsigned int const degree = 3;
+
+double const tol = 1.e-12;
+
+double const viscosity = 1.e-3;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+typedef dealii::VectorizedArray<double>                    scalar;
+
+template<int dim>
+class Setup
+{
+public:
+  Setup() : mapping(degree), fe(dealii::FE_DGQ<dim>(degree), dim)
+  {
+    dealii::GridGenerator::hyper_cube(triangulation, -1., 1.);
+    triangulation.refine_global(dim == 2 ? 2 : 1);
+
+    // deform the mesh so that the filter width varies between the cells
+    dealii::GridTools::transform(
+      [](dealii::Point<dim> const & p) {
+        dealii::Point<dim> q = p;
+        for(unsigned int d = 0; d < dim; ++d)
+          q[d] += 0.1 * std::sin(dealii::numbers::PI * p[(d + 1) % dim]) * (1. - p[d] * p[d]);
+        return q;
+      },
+      triangulation);
+
+    dof_handler.reinit(triangulation);
+    dof_handler.distribute_dofs(fe);
+
+    constraints.close();
+
+    typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+    additional_data.tasks_parallel_scheme = dealii::MatrixFree<dim, double>::AdditionalData::none;
+    additional_data.mapping_update_flags =
+      dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+    additional_data.mapping_update_flags_inner_faces =
+      additional_data.mapping_update_flags | dealii::update_normal_vectors;
+    additional_data.mapping_update_flags_boundary_faces =
+      additional_data.mapping_update_flags | dealii::update_normal_vectors;
+
+    matrix_free.reinit(
+      mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+  }
+
+  dealii::Triangulation<dim>        triangulation;
+  dealii::MappingQ<dim>             mapping;
+  dealii::FESystem<dim>             fe;
+  dealii::DoFHandler<dim>           dof_handler;
+  dealii::AffineConstraints<double> constraints;
+  dealii::MatrixFree<dim, double>   matrix_free;
+};
+
+/*
+ * Compares the viscosity of both kernels at all quadrature points and returns the maximum eddy
+ * viscosity.
+ */
+template<int dim>
+double
+compare_viscosity(dealii::MatrixFree<dim, double> const &              matrix_free,
+                  IncNS::Operators::ViscousKernel<dim, double> const & kernel_table,
+                  IncNS::Operators::ViscousKernel<dim, double> const & kernel_on_the_fly)
+{
+  double max_eddy_viscosity = 0.0, max_difference = 0.0;
+
+  auto const compare = [&](scalar const & value_table,
+                           scalar const & value_on_the_fly,
+                           unsigned int const n_lanes) {
+    for(unsigned int v = 0; v < n_lanes; ++v)
+    {
+      max_eddy_viscosity = std::max(max_eddy_viscosity, value_table[v] - viscosity);
+      max_difference     = std::max(max_difference, std::abs(value_on_the_fly[v] - value_table[v]));
+    }
+  };
+
+  CellIntegrator<dim, dim, double> integrator(matrix_free, 0, 0);
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    kernel_on_the_fly.reinit_cell(integrator);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      compare(kernel_table.get_viscosity_cell(cell, q),
+              kernel_on_the_fly.get_viscosity_cell(cell, q),
+              matrix_free.n_active_entries_per_cell_batch(cell));
+  }
+
+  FaceIntegrator<dim, dim, double> integrator_m(matrix_free, true, 0, 0);
+  FaceIntegrator<dim, dim, double> integrator_p(matrix_free, false, 0, 0);
+  for(unsigned int face = 0; face < matrix_free.n_inner_face_batches(); ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_p.reinit(face);
+    kernel_on_the_fly.reinit_face(integrator_m, integrator_p);
+
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+      compare(kernel_table.get_viscosity_interior_face(face, q),
+              kernel_on_the_fly.get_viscosity_interior_face(face, q),
+              matrix_free.n_active_entries_per_face_batch(face));
+  }
+
+  for(unsigned int face = matrix_free.n_inner_face_batches();
+      face < matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+      ++face)
+  {
+    integrator_m.reinit(face);
+    kernel_on_the_fly.reinit_boundary_face(integrator_m);
+
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+      compare(kernel_table.get_viscosity_boundary_face(face, q),
+              kernel_on_the_fly.get_viscosity_boundary_face(face, q),
+              matrix_free.n_active_entries_per_face_batch(face));
+  }
+
+  AssertThrow(max_difference < tol * (viscosity + max_eddy_viscosity),
+              dealii::ExcMessage("Viscosity evaluated on the fly differs from table."));
+
+  return max_eddy_viscosity;
+}
+
+template<int dim>
+void
+test(Setup<dim> const &                        setup,
+     IncNS::TurbulenceEddyViscosityModel const model,
+     std::string const &                       model_name,
+     bool const                                cache)
+{
+  auto boundary_descriptor = std::make_shared<IncNS::BoundaryDescriptorU<dim>>();
+  boundary_descriptor->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+
+  IncNS::Operators::ViscousKernelData kernel_data;
+  kernel_data.IP_factor = 1.0;
+  kernel_data.viscosity = viscosity;
+
+  IncNS::TurbulenceModelData model_data;
+  model_data.turbulence_model        = model;
+  model_data.constant                = 0.5;
+  model_data.kinematic_viscosity     = viscosity;
+  model_data.dof_index               = 0;
+  model_data.quad_index              = 0;
+  model_data.degree                  = degree;
+  model_data.quad_indices_on_the_fly = {0};
+
+  IncNS::ViscousOperatorData<dim> operator_data;
+  operator_data.bc         = boundary_descriptor;
+  operator_data.dof_index  = 0;
+  operator_data.quad_index = 0;
+
+  // tables of variable coefficients
+  kernel_data.viscosity_is_variable = true;
+  auto kernel_table = std::make_shared<IncNS::Operators::ViscousKernel<dim, double>>();
+  kernel_table->reinit(setup.matrix_free, kernel_data, 0);
+
+  model_data.on_the_fly = false;
+  IncNS::TurbulenceModel<dim, double> model_table;
+  model_table.initialize(setup.matrix_free, setup.mapping, kernel_table, model_data);
+
+  operator_data.kernel_data = kernel_data;
+  IncNS::ViscousOperator<dim, double> operator_table;
+  operator_table.initialize(setup.matrix_free, setup.constraints, operator_data, kernel_table);
+
+  // on-the-fly evaluation
+  kernel_data.viscosity_is_variable = false;
+  auto kernel_on_the_fly = std::make_shared<IncNS::Operators::ViscousKernel<dim, double>>();
+  kernel_on_the_fly->reinit(setup.matrix_free, kernel_data, 0);
+
+  model_data.on_the_fly       = true;
+  model_data.cache_on_the_fly = cache;
+  IncNS::TurbulenceModel<dim, double> model_on_the_fly;
+  model_on_the_fly.initialize(setup.matrix_free, setup.mapping, kernel_on_the_fly, model_data);
+
+  operator_data.kernel_data = kernel_data;
+  IncNS::ViscousOperator<dim, double> operator_on_the_fly;
+  operator_on_the_fly.initialize(setup.matrix_free,
+                                 setup.constraints,
+                                 operator_data,
+                                 kernel_on_the_fly);
+
+  VectorType velocity, src, dst_table, dst_on_the_fly;
+  setup.matrix_free.initialize_dof_vector(velocity);
+  setup.matrix_free.initialize_dof_vector(src);
+  setup.matrix_free.initialize_dof_vector(dst_table);
+  setup.matrix_free.initialize_dof_vector(dst_on_the_fly);
+
+  for(unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = std::cos(0.3 * i);
+
+  double max_eddy_viscosity = 0.0;
+  for(unsigned int velocity_field = 0; velocity_field < 2; ++velocity_field)
+  {
+    for(unsigned int i = 0; i < velocity.locally_owned_size(); ++i)
+      velocity.local_element(i) = std::sin((0.1 + 0.2 * velocity_field) * i);
+
+    model_table.calculate_turbulent_viscosity(velocity);
+    model_on_the_fly.calculate_turbulent_viscosity(velocity);
+
+    operator_table.apply(dst_table, src);
+
+    // with cache, the first application computes the viscosity and the second one reads it
+    for(unsigned int n = 0; n < 2; ++n)
+    {
+      operator_on_the_fly.apply(dst_on_the_fly, src);
+
+      dst_on_the_fly -= dst_table;
+      AssertThrow(dst_on_the_fly.linfty_norm() < tol * dst_table.linfty_norm(),
+                  dealii::ExcMessage("Viscous operators do not agree."));
+    }
+
+    max_eddy_viscosity =
+      std::max(max_eddy_viscosity,
+               compare_viscosity(setup.matrix_free, *kernel_table, *kernel_on_the_fly));
+  }
+
+  AssertThrow(max_eddy_viscosity > 0.0, dealii::ExcMessage("Eddy viscosity is zero."));
+
+  std::cout << model_name << " model (dim = " << dim << ", cache = " << std::boolalpha << cache
+            << "): viscosity and viscous operator agree with tables of variable coefficients."
+            << std::endl;
+}
+
+template<int dim>
+void
+run()
+{
+  Setup<dim> setup;
+
+  for(bool const cache : {false, true})
+  {
+    test(setup, IncNS::TurbulenceEddyViscosityModel::Smagorinsky, "Smagorinsky", cache);
+    test(setup, IncNS::TurbulenceEddyViscosityModel::WALE, "WALE", cache);
+
+    // only implemented for dim = 3
+    if(dim == 3)
+    {
+      test(setup, IncNS::TurbulenceEddyViscosityModel::Vreman, "Vreman", cache);
+      test(setup, IncNS::TurbulenceEddyViscosityModel::Sigma, "Sigma", cache);
+    }
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::run<2>();
+    ExaDG::run<3>();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,201 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Anderson acceleration of the linear fixed-point map G(x) = A x + b, where A is a non-symmetric
+ * contraction of dimension n. For a depth of (at least) n, Anderson acceleration is equivalent to
+ * GMRES applied to (I - A) x = b and converges in n + 1 iterations in exact arithmetic, whereas the
+ * plain fixed-point iteration converges linearly with the spectral radius of A.
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/anderson_acceleration.h>
+
+namespace ExaDG
+{
+typedef dealii::Vector<double> VectorType;
+
+unsigned int const n = 6;
+
+double const tol = 1.e-10;
+
+unsigned int const max_iterations = 100;
+
+/*
+ * Upper bidiagonal matrix with diagonal entries 0.9, 0.8, ..., 0.4 and off-diagonal entries 0.3.
+ */
+dealii::FullMatrix<double>
+create_matrix()
+{
+  dealii::FullMatrix<double> A(n, n);
+  for(unsigned int i = 0; i < n; ++i)
+  {
+    A(i, i) = 0.9 - 0.1 * i;
+    if(i + 1 < n)
+      A(i, i + 1) = 0.3;
+  }
+
+  return A;
+}
+
+VectorType
+create_rhs(double const scaling)
+{
+  VectorType b(n);
+  for(unsigned int i = 0; i < n; ++i)
+    b(i) = scaling / (i + 1);
+
+  return b;
+}
+
+/*
+ * Solution of (I - A) x = b.
+ */
+VectorType
+solve_fixed_point_problem(dealii::FullMatrix<double> const & A, VectorType const & b)
+{
+  dealii::FullMatrix<double> matrix(n, n);
+  for(unsigned int i = 0; i < n; ++i)
+  {
+    for(unsigned int j = 0; j < n; ++j)
+      matrix(i, j) = -A(i, j);
+    matrix(i, i) += 1.0;
+  }
+  matrix.gauss_jordan();
+
+  VectorType x(n);
+  matrix.vmult(x, b);
+
+  return x;
+}
+
+/*
+ * Iterates x_{k+1} = G(x_k), accelerated by anderson if given, starting from x = 0 for at most
+ * n_iterations_max iterations, and returns the number of iterations until the error is below the
+ * tolerance.
+ */
+unsigned int
+iterate(AndersonAcceleration<VectorType> * anderson,
+        dealii::FullMatrix<double> const & A,
+        VectorType const &                 b,
+        unsigned int const                 n_iterations_max)
+{
+  VectorType const x_exact = solve_fixed_point_problem(A, b);
+
+  VectorType   x(n), g(n), error(n);
+  unsigned int k = 0;
+  for(; k < n_iterations_max; ++k)
+  {
+    error = x;
+    error.add(-1.0, x_exact);
+    if(error.l2_norm() < tol * x_exact.l2_norm())
+      break;
+
+    A.vmult(g, x);
+    g.add(1.0, b);
+
+    if(anderson)
+      anderson->update(g, x);
+
+    x = g;
+  }
+
+  return k;
+}
+
+void
+test()
+{
+  dealii::FullMatrix<double> const A = create_matrix();
+  VectorType const                 b = create_rhs(1.0);
+
+  unsigned int const n_iterations_plain = iterate(nullptr, A, b, max_iterations);
+
+  AssertThrow(n_iterations_plain == max_iterations,
+              dealii::ExcMessage("Plain fixed-point iteration converges too fast for this test."));
+
+  AndersonAcceleration<VectorType> anderson(n);
+  unsigned int const               n_iterations = iterate(&anderson, A, b, max_iterations);
+
+  AssertThrow(n_iterations <= n + 2,
+              dealii::ExcMessage("Anderson acceleration did not converge in n + 2 iterations."));
+
+  std::cout << std::endl
+            << "Linear fixed-point map of dimension n = " << n << ":" << std::endl
+            << "  Anderson acceleration (depth n) converges in at most n + 2 iterations."
+            << std::endl;
+
+  // A history collected for a different fixed-point map is discarded by reset(), so that the
+  // iteration behaves as for a new object.
+  AndersonAcceleration<VectorType> anderson_reset(n);
+  iterate(&anderson_reset, A, create_rhs(-2.0), 3);
+  anderson_reset.reset();
+
+  AssertThrow(iterate(&anderson_reset, A, b, max_iterations) == n_iterations,
+              dealii::ExcMessage("History has not been discarded by reset()."));
+
+  std::cout << "  reset() discards the history of a different fixed-point map." << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,251 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                        HEADER                                      */
+/*                                                                                    */
+/**************************************************************************************/
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/vectorization.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/preconditioners/elementwise_preconditioners.h>
+#include <exadg/solvers_and_preconditioners/solvers/elementwise_krylov_solvers.h>
+
+namespace ExaDG
+{
+/**************************************************************************************/
+/*                                                                                    */
+/*                                   PARAMETERS                                       */
+/*                                                                                    */
+/**************************************************************************************/
+unsigned int const M = 4;
+
+double const tol = 1.e-12;
+
+/*
+ * Diagonal matrix counting the number of matrix-vector products. Since the CG solver performs one
+ * matrix-vector product for the initial residual and one per iteration, the number of iterations
+ * is given by the number of matrix-vector products minus one.
+ */
+template<typename value_type>
+class DiagonalMatrix
+{
+public:
+  DiagonalMatrix(unsigned int const size) : M(size), n_vmult(0)
+  {
+    diagonal.resize(M);
+  }
+
+  void
+  vmult(value_type * dst, value_type const * src) const
+  {
+    ++n_vmult;
+
+    for(unsigned int i = 0; i < M; ++i)
+      dst[i] = diagonal[i] * src[i];
+  }
+
+  void
+  set_value(value_type const value, unsigned int const i)
+  {
+    AssertThrow(i < M, dealii::ExcMessage("Index exceeds matrix dimensions."));
+
+    diagonal[i] = value;
+  }
+
+  unsigned int
+  n_iterations() const
+  {
+    return n_vmult - 1;
+  }
+
+private:
+  // number of rows and columns of matrix
+  unsigned int const                M;
+  dealii::AlignedVector<value_type> diagonal;
+
+  mutable unsigned int n_vmult;
+};
+
+/*
+ * System of equations of vectorization lane v: In exact arithmetic, CG converges in as many
+ * iterations as the matrix has distinct eigenvalues. Lane v uses v % (M + 1) distinct eigenvalues,
+ * where zero distinct eigenvalues denotes a homogeneous right-hand side, i.e., a lane that is
+ * converged from the start.
+ */
+unsigned int
+n_distinct_eigenvalues(unsigned int const v)
+{
+  return v % (M + 1);
+}
+
+double
+matrix_entry(unsigned int const v, unsigned int const i)
+{
+  unsigned int const n_distinct = std::max(n_distinct_eigenvalues(v), 1u);
+
+  return 1.0 + (i % n_distinct);
+}
+
+double
+rhs_entry(unsigned int const v)
+{
+  return n_distinct_eigenvalues(v) > 0 ? 1.0 : 0.0;
+}
+
+/**************************************************************************************/
+/*                                                                                    */
+/*                                         MAIN                                       */
+/*                                                                                    */
+/**************************************************************************************/
+
+// dealii::VectorizedArray: lanes converge after different numbers of iterations
+void
+cg_test_lanes_converging_at_different_iterations()
+{
+  std::cout << std::endl
+            << "CG solver (VectorizedArray<double>), size M=4, lanes converging at different "
+               "iterations:"
+            << std::endl
+            << std::endl;
+
+  SolverData solver_data(100, tol, tol);
+
+  unsigned int const n_lanes = dealii::VectorizedArray<double>::size();
+
+  // reference: solve the system of each lane separately
+  std::vector<std::vector<double>> x_ref(n_lanes, std::vector<double>(M));
+  std::vector<unsigned int>        n_iter_ref(n_lanes);
+  for(unsigned int v = 0; v < n_lanes; ++v)
+  {
+    typedef Elementwise::PreconditionerIdentity<double>   Preconditioner;
+    typedef DiagonalMatrix<double>                        Matrix;
+    Preconditioner                                        preconditioner(M);
+    Elementwise::SolverCG<double, Matrix, Preconditioner> cg_solver(M, solver_data);
+
+    Matrix              A(M);
+    std::vector<double> b(M);
+    for(unsigned int i = 0; i < M; ++i)
+    {
+      A.set_value(matrix_entry(v, i), i);
+      b[i] = rhs_entry(v);
+    }
+
+    cg_solver.solve(&A, x_ref[v].data(), b.data(), &preconditioner);
+    n_iter_ref[v] = A.n_iterations();
+  }
+
+  if(n_lanes > 1)
+    AssertThrow(*std::min_element(n_iter_ref.begin(), n_iter_ref.end()) <
+                  *std::max_element(n_iter_ref.begin(), n_iter_ref.end()),
+                dealii::ExcMessage("All lanes converge after the same number of iterations."));
+
+  // solve the systems of all lanes at once
+  typedef Elementwise::PreconditionerIdentity<dealii::VectorizedArray<double>> Preconditioner;
+  typedef DiagonalMatrix<dealii::VectorizedArray<double>>                      Matrix;
+  Preconditioner                                                               preconditioner(M);
+  Elementwise::SolverCG<dealii::VectorizedArray<double>, Matrix, Preconditioner> cg_solver(
+    M, solver_data);
+
+  Matrix                                                 A(M);
+  dealii::AlignedVector<dealii::VectorizedArray<double>> b(M), x(M);
+  for(unsigned int i = 0; i < M; ++i)
+  {
+    dealii::VectorizedArray<double> diagonal, rhs;
+    for(unsigned int v = 0; v < n_lanes; ++v)
+    {
+      diagonal[v] = matrix_entry(v, i);
+      rhs[v]      = rhs_entry(v);
+    }
+    A.set_value(diagonal, i);
+    b[i] = rhs;
+  }
+
+  cg_solver.solve(&A, x.data(), b.data(), &preconditioner);
+
+  // the vectorized solver iterates until the slowest lane has converged
+  AssertThrow(A.n_iterations() == *std::max_element(n_iter_ref.begin(), n_iter_ref.end()),
+              dealii::ExcMessage("Number of iterations does not match the slowest lane."));
+
+  // lanes that have converged earlier must not be modified by the remaining iterations
+  for(unsigned int v = 0; v < n_lanes; ++v)
+  {
+    for(unsigned int i = 0; i < M; ++i)
+    {
+      AssertThrow(std::isfinite(x[i][v]), dealii::ExcMessage("Solution is not finite."));
+      AssertThrow(std::abs(x[i][v] - x_ref[v][i]) < 1.e-14,
+                  dealii::ExcMessage("Solution of lane differs from separate solution."));
+      AssertThrow(std::abs(matrix_entry(v, i) * x[i][v] - rhs_entry(v)) < 1.e-10,
+                  dealii::ExcMessage("Did not converge."));
+    }
+  }
+
+  std::cout << "converged." << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    // dealii::VectorizedArray<double>
+    ExaDG::cg_test_lanes_converging_at_different_iterations();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
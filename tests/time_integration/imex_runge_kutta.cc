@@ -0,0 +1,246 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Consistency and order conditions of the Butcher tableaus of the IMEX Runge-Kutta schemes. Since
+ * all schemes are stiffly accurate, the weights b of both tableaus are given by their last row.
+ * Up to order 3, the conditions of the additive scheme are the classical order conditions of both
+ * tableaus together with the coupling conditions sum_ij b_i a_ij c_j = 1/6 for all combinations
+ * of the explicit and implicit weights and coefficients. In addition, the convergence order is
+ * measured for the linear ODE du/dt = lambda_expl u + lambda_impl u.
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/time_integration/enum_types.h>
+#include <exadg/time_integration/imex_runge_kutta.h>
+
+namespace ExaDG
+{
+double const tol = 1.e-12;
+
+double const lambda_expl = -1.0;
+double const lambda_impl = -3.0;
+
+double const end_time = 1.0;
+
+typedef double (IMEXRungeKuttaTableau::*Coefficients)(unsigned int const, unsigned int const) const;
+
+void
+check_order_conditions(IMEXRungeKuttaTableau const & tableau)
+{
+  unsigned int const n_stages = tableau.get_n_stages();
+  unsigned int const last     = n_stages - 1;
+
+  std::vector<Coefficients> const tableaus = {&IMEXRungeKuttaTableau::get_a_expl,
+                                              &IMEXRungeKuttaTableau::get_a_impl};
+
+  for(auto const a : tableaus)
+  {
+    for(unsigned int i = 0; i < n_stages; ++i)
+    {
+      // c_i = sum_j a_ij
+      double row_sum = 0.0;
+      for(unsigned int j = 0; j < n_stages; ++j)
+        row_sum += (tableau.*a)(i, j);
+
+      AssertThrow(std::abs(row_sum - tableau.get_c(i)) < tol,
+                  dealii::ExcMessage("Row sum of tableau differs from c."));
+    }
+
+    // order 1: sum_i b_i = 1
+    double sum_b = 0.0;
+    for(unsigned int i = 0; i < n_stages; ++i)
+      sum_b += (tableau.*a)(last, i);
+
+    AssertThrow(std::abs(sum_b - 1.0) < tol, dealii::ExcMessage("Order condition 1 violated."));
+
+    // order 2: sum_i b_i c_i = 1/2
+    if(tableau.get_order() >= 2)
+    {
+      double sum_bc = 0.0;
+      for(unsigned int i = 0; i < n_stages; ++i)
+        sum_bc += (tableau.*a)(last, i) * tableau.get_c(i);
+
+      AssertThrow(std::abs(sum_bc - 1.0 / 2.0) < tol,
+                  dealii::ExcMessage("Order condition 2 violated."));
+    }
+
+    // order 3: sum_i b_i c_i^2 = 1/3 and sum_ij b_i a_ij c_j = 1/6 (including coupling conditions)
+    if(tableau.get_order() >= 3)
+    {
+      double sum_bcc = 0.0;
+      for(unsigned int i = 0; i < n_stages; ++i)
+        sum_bcc += (tableau.*a)(last, i) * std::pow(tableau.get_c(i), 2);
+
+      AssertThrow(std::abs(sum_bcc - 1.0 / 3.0) < tol,
+                  dealii::ExcMessage("Order condition 3 violated."));
+
+      for(auto const a_inner : tableaus)
+      {
+        double sum_bac = 0.0;
+        for(unsigned int i = 0; i < n_stages; ++i)
+          for(unsigned int j = 0; j < n_stages; ++j)
+            sum_bac += (tableau.*a)(last, i) * (tableau.*a_inner)(i, j) * tableau.get_c(j);
+
+        AssertThrow(std::abs(sum_bac - 1.0 / 6.0) < tol,
+                    dealii::ExcMessage("Coupling condition of order 3 violated."));
+      }
+    }
+  }
+}
+
+void
+check_structure(IMEXRungeKuttaTableau const & tableau)
+{
+  unsigned int const n_stages = tableau.get_n_stages();
+
+  for(unsigned int i = 0; i < n_stages; ++i)
+  {
+    // explicit tableau is strictly lower triangular, implicit tableau lower triangular
+    for(unsigned int j = i; j < n_stages; ++j)
+      AssertThrow(tableau.get_a_expl(i, j) == 0.0,
+                  dealii::ExcMessage("Explicit tableau is not strictly lower triangular."));
+    for(unsigned int j = i + 1; j < n_stages; ++j)
+      AssertThrow(tableau.get_a_impl(i, j) == 0.0,
+                  dealii::ExcMessage("Implicit tableau is not lower triangular."));
+
+    // the first column of the implicit tableau vanishes
+    AssertThrow(tableau.get_a_impl(i, 0) == 0.0,
+                dealii::ExcMessage("First column of implicit tableau does not vanish."));
+
+    // singly diagonally implicit
+    if(i > 0)
+      AssertThrow(std::abs(tableau.get_a_impl(i, i) - tableau.get_gamma()) < tol,
+                  dealii::ExcMessage("Implicit stages have different diagonal coefficients."));
+  }
+
+  // stiffly accurate
+  AssertThrow(std::abs(tableau.get_c(n_stages - 1) - 1.0) < tol,
+              dealii::ExcMessage("Last stage is not located at the end of the time step."));
+}
+
+/*
+ * Solution of du/dt = lambda_expl u + lambda_impl u, u(0) = 1, at the end time.
+ */
+double
+solve(IMEXRungeKuttaTableau const & tableau, unsigned int const n_time_steps)
+{
+  unsigned int const n_stages = tableau.get_n_stages();
+
+  double const dt = end_time / n_time_steps;
+
+  double              u = 1.0;
+  std::vector<double> stages(n_stages);
+  for(unsigned int n = 0; n < n_time_steps; ++n)
+  {
+    stages[0] = u;
+    for(unsigned int i = 1; i < n_stages; ++i)
+    {
+      double rhs = u;
+      for(unsigned int j = 0; j < i; ++j)
+        rhs += dt * (tableau.get_a_expl(i, j) * lambda_expl +
+                     tableau.get_a_impl(i, j) * lambda_impl) *
+               stages[j];
+
+      stages[i] = rhs / (1.0 - dt * tableau.get_a_impl(i, i) * lambda_impl);
+    }
+
+    u = stages[n_stages - 1];
+  }
+
+  return u;
+}
+
+void
+check_convergence_order(IMEXRungeKuttaTableau const & tableau)
+{
+  double const exact = std::exp((lambda_expl + lambda_impl) * end_time);
+
+  double const error_coarse = std::abs(solve(tableau, 80) - exact);
+  double const error_fine   = std::abs(solve(tableau, 160) - exact);
+
+  double const rate = std::log2(error_coarse / error_fine);
+
+  AssertThrow(rate > tableau.get_order() - 0.1,
+              dealii::ExcMessage("Measured convergence order is lower than the order of the "
+                                 "scheme."));
+}
+
+void
+test(IMEXRKType const type)
+{
+  IMEXRungeKuttaTableau const tableau(type);
+
+  check_structure(tableau);
+  check_order_conditions(tableau);
+  check_convergence_order(tableau);
+
+  std::cout << std::endl
+            << enum_to_string(type) << ": consistent tableaus of order " << tableau.get_order()
+            << ", measured convergence order confirmed." << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test(ExaDG::IMEXRKType::ARS111);
+    ExaDG::test(ExaDG::IMEXRKType::ARS222);
+    ExaDG::test(ExaDG::IMEXRKType::ARS443);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
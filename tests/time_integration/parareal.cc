@@ -0,0 +1,218 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Parareal applied to the linear ODE system du/dt = A u with one time slab per MPI process. The
+ * fine propagator is the classical Runge-Kutta method, the coarse propagator the explicit Euler
+ * method with a larger time step. After as many iterations as there are time slabs, the solution
+ * at the end of each time slab has to equal the result of sequential fine time stepping.
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/parareal.h>
+
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const start_time = 0.0;
+double const end_time   = 4.0;
+
+unsigned int const n_time_steps_fine   = 20;
+unsigned int const n_time_steps_coarse = 2;
+
+/*
+ * Damped oscillator: du_0/dt = u_1 - 0.1 u_0, du_1/dt = -u_0 - 0.1 u_1
+ */
+void
+apply_operator(VectorType & dst, VectorType const & src)
+{
+  dst(0) = src(1) - 0.1 * src(0);
+  dst(1) = -src(0) - 0.1 * src(1);
+}
+
+void
+propagate_runge_kutta(VectorType &       solution,
+                      double const       start,
+                      double const       end,
+                      unsigned int const n_time_steps)
+{
+  double const dt = (end - start) / n_time_steps;
+
+  VectorType k1(solution), k2(solution), k3(solution), k4(solution), tmp(solution);
+  for(unsigned int n = 0; n < n_time_steps; ++n)
+  {
+    apply_operator(k1, solution);
+    tmp = solution;
+    tmp.add(0.5 * dt, k1);
+    apply_operator(k2, tmp);
+    tmp = solution;
+    tmp.add(0.5 * dt, k2);
+    apply_operator(k3, tmp);
+    tmp = solution;
+    tmp.add(dt, k3);
+    apply_operator(k4, tmp);
+
+    solution.add(dt / 6.0, k1, dt / 3.0, k2);
+    solution.add(dt / 3.0, k3, dt / 6.0, k4);
+  }
+}
+
+void
+propagate_explicit_euler(VectorType &       solution,
+                         double const       start,
+                         double const       end,
+                         unsigned int const n_time_steps)
+{
+  double const dt = (end - start) / n_time_steps;
+
+  VectorType rhs(solution);
+  for(unsigned int n = 0; n < n_time_steps; ++n)
+  {
+    apply_operator(rhs, solution);
+    solution.add(dt, rhs);
+  }
+}
+
+void
+set_initial_condition(VectorType & solution)
+{
+  solution(0) = 1.0;
+  solution(1) = 0.0;
+}
+
+void
+test(MPI_Comm const & time_comm, unsigned int const max_iterations)
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(time_comm) == 0);
+
+  PararealParameters parameters;
+  parameters.n_time_slabs   = dealii::Utilities::MPI::n_mpi_processes(time_comm);
+  parameters.max_iterations = max_iterations;
+  parameters.tolerance      = 0.0;
+
+  Parareal<VectorType> parareal(time_comm, parameters);
+
+  auto const fine = [&](VectorType & solution, double const start, double const end) {
+    propagate_runge_kutta(solution, start, end, n_time_steps_fine);
+  };
+
+  auto const coarse = [&](VectorType & solution, double const start, double const end) {
+    propagate_explicit_euler(solution, start, end, n_time_steps_coarse);
+  };
+
+  VectorType solution(2);
+  set_initial_condition(solution);
+
+  parareal.solve(solution, start_time, end_time, fine, coarse);
+
+  // sequential fine time stepping up to the end of the time slab of this process
+  VectorType reference(2);
+  set_initial_condition(reference);
+  for(unsigned int n = 0; n <= parareal.get_time_slab(); ++n)
+    propagate_runge_kutta(reference,
+                          parareal.get_slab_start_time(start_time, end_time, n),
+                          parareal.get_slab_start_time(start_time, end_time, n + 1),
+                          n_time_steps_fine);
+
+  reference.add(-1.0, solution);
+  double const error = dealii::Utilities::MPI::max(reference.l2_norm(), time_comm);
+
+  // For a tolerance of zero, Parareal iterates until the solution is exact on all time slabs,
+  // which is the case after as many iterations as there are time slabs.
+  unsigned int const n_iterations_exact = std::min(max_iterations, parameters.n_time_slabs);
+
+  AssertThrow(parareal.get_number_of_iterations() == n_iterations_exact,
+              dealii::ExcMessage("Unexpected number of Parareal iterations."));
+
+  AssertThrow(parareal.has_converged() == (max_iterations >= parameters.n_time_slabs),
+              dealii::ExcMessage("Unexpected convergence status of Parareal."));
+
+  if(parareal.has_converged())
+  {
+    AssertThrow(error < 1.e-12,
+                dealii::ExcMessage("Parareal solution differs from sequential time stepping."));
+
+    pcout << std::endl
+          << "Parareal converged after as many iterations as there are time slabs." << std::endl
+          << "Solution equals sequential time stepping on all time slabs." << std::endl;
+  }
+  else
+  {
+    AssertThrow(error > 1.e-12,
+                dealii::ExcMessage("Parareal solution is exact before convergence."));
+
+    pcout << std::endl
+          << "Parareal stopped after the maximum number of iterations." << std::endl
+          << "Solution differs from sequential time stepping." << std::endl;
+  }
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    // one time slab per process
+    ExaDG::test(MPI_COMM_WORLD, 100);
+
+    // stop before the solution is exact on all time slabs (requires more than 2 time slabs)
+    ExaDG::test(MPI_COMM_WORLD, 2);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}